@@ -2,6 +2,8 @@
 #include "stm32f10x.h"
 #include "stm32f10x_gpio.h"
 #include "stm32f10x_adc.h"
+#include "stm32f10x_dma.h"
+#include "stm32f10x_rcc.h"
 #include "stdio.h"
 
 #include "pins.h"
@@ -14,6 +16,14 @@
 
  R31 = 200kohms; R29 = 10kohms. Vout = Vin * (R2 / (R2+R1)); Vout = Vin * 0,048.
  */
+
+// ADC1 converts the battery channel continuously and DMA1_Channel1 keeps the last ADC_SAMPLES in a circular buffer,
+// battery_voltage_10x_get() averages them. With ADCCLK at 10.7MHz and 239.5 + 12.5 cycles per conversion the buffer
+// covers the last 1.5ms, the average has 8x less random noise than a single conversion.
+#define ADC_SAMPLES 64
+
+static volatile uint16_t ui16_m_samples[ADC_SAMPLES];
+
 void adc_init() {
 	GPIO_InitTypeDef ginit;
 	ginit.GPIO_Pin = GPIO_Pin_4;
@@ -22,42 +32,62 @@ void adc_init() {
 
 	GPIO_Init(GPIOA, &ginit); // GPIO Initialization
 
+	// 10.7MHz from the 64MHz PCLK2, the ADC is specified up to 14MHz
+	RCC_ADCCLKConfig(RCC_PCLK2_Div6);
+	RCC_AHBPeriphClockCmd(RCC_AHBPeriph_DMA1, ENABLE);
+
+	DMA_DeInit(DMA1_Channel1);
+	DMA_InitTypeDef DMA_InitStructure;
+	DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) &(ADC1->DR);
+	DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t) ui16_m_samples;
+	DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+	DMA_InitStructure.DMA_BufferSize = ADC_SAMPLES;
+	DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+	DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+	DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_HalfWord;
+	DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_HalfWord;
+	DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+	DMA_InitStructure.DMA_Priority = DMA_Priority_Low;
+	DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+	DMA_Init(DMA1_Channel1, &DMA_InitStructure);
+	DMA_Cmd(DMA1_Channel1, ENABLE);
+
 	ADC_DeInit(ADC1); //Deinitialize the ADC to reconfigure it
 	ADC_InitTypeDef ADC_InitStruct;
 	ADC_StructInit(&ADC_InitStruct);
+	ADC_InitStruct.ADC_ContinuousConvMode = ENABLE;
 	ADC_InitStruct.ADC_ExternalTrigConv = ADC_ExternalTrigConv_None;
 	ADC_Init(ADC1, &ADC_InitStruct);
-	ADC_Cmd(ADC1, ENABLE);
 	ADC_RegularChannelConfig(ADC1, ADC_Channel_4, 1, ADC_SampleTime_239Cycles5);
+	ADC_DMACmd(ADC1, ENABLE);
+	ADC_Cmd(ADC1, ENABLE);
+
+	// calibrate once after power up, as the reference manual asks
+	ADC_ResetCalibration(ADC1);
+	while (ADC_GetResetCalibrationStatus(ADC1))
+		;
+	ADC_StartCalibration(ADC1);
+	while (ADC_GetCalibrationStatus(ADC1))
+		;
 
-	// Queue up a conversion
 	ADC_SoftwareStartConvCmd(ADC1, ENABLE);
+
+	// fill the buffer once, so nobody ever averages the zeros it starts with nor the first conversion, that used to
+	// be discarded as wrong
+	while (DMA_GetFlagStatus(DMA1_FLAG_TC1) == RESET)
+		;
 }
 
 #define NUM_STEPS 4096 // 12 bit
 
 uint16_t battery_voltage_10x_get() {
-  static uint8_t ui8_first_time = 1;
-  uint32_t rawVoltage;
-
-  // the very first measure need to be discarded as it seems to have a wrong value
-  if (ui8_first_time) {
-    ui8_first_time = 0;
-
-    while (ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC) == RESET)
-      ;
-
-    rawVoltage = (uint32_t) ADC_GetConversionValue(ADC1);
-    ADC_SoftwareStartConvCmd(ADC1, ENABLE); // start a conversion for next time.
-  }
-
-	while (ADC_GetFlagStatus(ADC1, ADC_FLAG_EOC) == RESET)
-		;
+	uint32_t ui32_sum = 0;
 
-	rawVoltage = (uint32_t) ADC_GetConversionValue(ADC1);
-	uint32_t v_1000x = (3300UL * rawVoltage) / NUM_STEPS; // voltage at input pin x1000
-	uint32_t busvolt_10x = (v_1000x * 2083) / 1000 / 10;
+	// the DMA keeps writing, each sample is a single halfword so this is always the last ADC_SAMPLES of them
+	for (int i = 0; i < ADC_SAMPLES; i++)
+		ui32_sum += ui16_m_samples[i];
 
-	ADC_SoftwareStartConvCmd(ADC1, ENABLE); // start a conversion for next time.
-	return busvolt_10x;
+	// voltage at the input pin is 3300mV * raw / NUM_STEPS, the divider is 2083 / 1000
+	return (uint16_t) ((3300ULL * 2083 * ui32_sum + NUM_STEPS * ADC_SAMPLES * 10000ULL / 2)
+			/ (NUM_STEPS * ADC_SAMPLES * 10000ULL));
 }
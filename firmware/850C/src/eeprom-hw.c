@@ -10,149 +10,195 @@
 #include <string.h>
 #include "stm32f10x_flash.h"
 #include "eeprom_hw.h"
+#include "flash_log.h"
+#include "ride_log.h"
+#include "last_gasp.h"
 
-#define EEPROM_START_ADDRESS            0x0807F000
-#define EEPROM_START_ADDRESS_PAGE_0     0x0807F000
-#define EEPROM_START_ADDRESS_PAGE_1     0x0807F800 // last page of 2kbytes of flash memory
+#define EEPROM_PAGE_SIZE                2048
+#define EEPROM_START_ADDRESS            (0x08080000 - (FLASH_LOG_PAGES * EEPROM_PAGE_SIZE)) // last pages of flash memory
+#define RIDE_LOG_START_ADDRESS          (EEPROM_START_ADDRESS - (RIDE_LOG_PAGES * EEPROM_PAGE_SIZE))
+#define LAST_GASP_START_ADDRESS         (RIDE_LOG_START_ADDRESS - EEPROM_PAGE_SIZE) // the linker script keeps the image below
 
-#define EEPROM_PAGE_KEY_ADDRESS         (1024 - 1)
-#define EEPROM_PAGE_WRITE_ID_ADDRESS    (EEPROM_PAGE_KEY_ADDRESS - 1)
+// FLASH_WaitForLastOperation() count the SPL gives a page erase
+#define FLASH_ERASE_TIMEOUT             0x000B0000
 
-#define EEPROM_MAGIC_KEY                ((uint8_t) 0x5a)
-
-static uint32_t ui32_m_eeprom_page = 0;
-
-static void eeprom_erase_page(uint32_t ui32_eeprom_page);
-static uint8_t eeprom_read(uint32_t ui32_address);
-static uint8_t eeprom_read_from_page(uint32_t ui32_address, uint32_t ui32_eeprom_page);
-// static uint32_t eeprom_write_to_page(uint32_t ui32_address, uint8_t ui8_data, uint32_t ui32_eeprom_page);
+// Older firmware kept one byte per half word in one of the last two pages, the last two of the log now. The log
+// reads it while it is empty and copies it, to keep the user settings after an update
+#define EEPROM_LEGACY_START_ADDRESS     0x0807F000
+#define EEPROM_LEGACY_PAGE_KEY_ADDRESS  (1024 - 1)
+#define EEPROM_LEGACY_PAGE_WRITE_ID_ADDRESS (EEPROM_LEGACY_PAGE_KEY_ADDRESS - 1)
+#define EEPROM_LEGACY_MAGIC_KEY         ((uint8_t) 0x5a)
 
 void eeprom_hw_init() {
-	// Nothing needed on 850C
+  flash_log_init();
 }
 
-// Set eeprom_page based on which page seems like it might be valid
-void find_valid_page()
+static uint8_t eeprom_legacy_read(uint32_t ui32_address, uint32_t ui32_eeprom_page)
 {
-  // check if both EEPROM pages have invalid values and if so, write default values on page 0
-  if((eeprom_read_from_page(EEPROM_PAGE_KEY_ADDRESS, 0) != EEPROM_MAGIC_KEY) &&
-	  (eeprom_read_from_page(EEPROM_PAGE_KEY_ADDRESS, 1) != EEPROM_MAGIC_KEY))
-  {
-    // setup page 0
-    ui32_m_eeprom_page = 0;
-    eeprom_erase_page(ui32_m_eeprom_page);
-    // write EEPROM_MAGIC_KEY and EEPROM_PAGE WRITE_ID
-    eeprom_write(EEPROM_PAGE_KEY_ADDRESS, EEPROM_MAGIC_KEY);
-    eeprom_write(EEPROM_PAGE_WRITE_ID_ADDRESS, 1); // start with value 1
-  }
-  // check if both EEPROM pages have valid values...
-  else if((eeprom_read_from_page(EEPROM_PAGE_KEY_ADDRESS, 0) == EEPROM_MAGIC_KEY) &&
-	  (eeprom_read_from_page(EEPROM_PAGE_KEY_ADDRESS, 1) == EEPROM_MAGIC_KEY))
-  {
-    // now find the page that has a higher write ID
-    if(eeprom_read_from_page(EEPROM_PAGE_WRITE_ID_ADDRESS, 1) > eeprom_read_from_page(EEPROM_PAGE_WRITE_ID_ADDRESS, 0))
-    {
-      ui32_m_eeprom_page = 1;
-    }
-    else
-    {
-      ui32_m_eeprom_page = 0;
-    }
-  }
-  else if(eeprom_read_from_page(EEPROM_PAGE_KEY_ADDRESS, 0) == EEPROM_MAGIC_KEY)
-  {
-      ui32_m_eeprom_page = 0;
-  }
+  uint16_t *ui16_p_address = (uint16_t *) (EEPROM_LEGACY_START_ADDRESS + (ui32_eeprom_page * EEPROM_PAGE_SIZE) + (ui32_address * 2));
+  return (uint8_t) (*ui16_p_address);
+}
+
+bool flash_log_hw_legacy_read(void *dest, uint16_t length_words)
+{
+  uint32_t ui32_page;
+
+  // the page with the valid magic key and the higher write ID
+  if (eeprom_legacy_read(EEPROM_LEGACY_PAGE_KEY_ADDRESS, 1) == EEPROM_LEGACY_MAGIC_KEY &&
+      (eeprom_legacy_read(EEPROM_LEGACY_PAGE_KEY_ADDRESS, 0) != EEPROM_LEGACY_MAGIC_KEY ||
+       eeprom_legacy_read(EEPROM_LEGACY_PAGE_WRITE_ID_ADDRESS, 1) > eeprom_legacy_read(EEPROM_LEGACY_PAGE_WRITE_ID_ADDRESS, 0)))
+    ui32_page = 1;
+  else if (eeprom_legacy_read(EEPROM_LEGACY_PAGE_KEY_ADDRESS, 0) == EEPROM_LEGACY_MAGIC_KEY)
+    ui32_page = 0;
   else
-  {
-      ui32_m_eeprom_page = 1;
-  }
+    return false;
+
+  if (eeprom_legacy_read(ADDRESS_KEY, ui32_page) != KEY)
+    return false;
+
+  for (int i = 0; i < sizeof(uint32_t) * length_words; i++)
+    ((uint8_t *) dest)[i] = eeprom_legacy_read(1 + i, ui32_page);
+
+  return true;
 }
 
 // Read raw EEPROM data, return false if it is blank or malformatted
 bool flash_read_words(void *dest, uint16_t length_words)
 {
-  uint8_t ui8_data;
+  return flash_log_read_words(dest, length_words);
+}
 
-  find_valid_page();
+bool flash_write_words(const void *value, uint16_t length_words)
+{
+  return flash_log_write_words(value, length_words);
+}
 
-  // start by reading address 0 and see if value is different from our key,
-  // if so mean that eeprom memory is clean (or data strucutre is invalid) and we need to populate
-  ui8_data = eeprom_read(ADDRESS_KEY);
-  if(ui8_data != KEY) // verify if our key exist
-	  return false;
+// Only the key can be written, anything but KEY makes the next flash_read_words() fail
+uint32_t eeprom_write(uint32_t ui32_address, uint8_t ui8_data)
+{
+  if (ui32_address != ADDRESS_KEY)
+    return 1;
 
-  // read the values from EEPROM to array
-  for(int i = 0; i < sizeof(uint32_t) * length_words; i++)
-  {
-     // we start at EEPROM address 1 as 0 is already in use by the KEY
-     ((uint8_t *) dest)[i] = eeprom_read(1 + i);
-  }
+  return flash_log_write_key(ui8_data) ? 0 : 1;
+}
 
-  return true;
+const uint32_t* flash_log_hw_page(uint8_t ui8_page)
+{
+  return (const uint32_t *) (EEPROM_START_ADDRESS + (ui8_page * EEPROM_PAGE_SIZE));
 }
 
-static void eeprom_write_array(const uint8_t *p_array, uint32_t ui32_len)
+bool flash_log_hw_program(uint8_t ui8_page, uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num)
 {
-  // write the full array
-  for(uint32_t ui32_i = 0; ui32_i < ui32_len; ui32_i++)
-  {
-    // start at 1 since 0 address is for KEY
-    eeprom_write(1 + ui32_i, *p_array++);
+  uint32_t ui32_address = EEPROM_START_ADDRESS + (ui8_page * EEPROM_PAGE_SIZE) + (ui16_offset * sizeof(uint32_t));
+  bool ok = true;
+
+  FLASH_Unlock();
+  while (ui16_num--) {
+    if (FLASH_ProgramWord(ui32_address, *p_words++) != FLASH_COMPLETE) {
+      ok = false;
+      break;
+    }
+    ui32_address += sizeof(uint32_t);
   }
+  FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+  FLASH_Lock();
+
+  return ok;
 }
 
-bool flash_write_words(const void *value, uint16_t length_words)
+bool flash_log_hw_erase(uint8_t ui8_page)
 {
-  // cycle/increment ui32_eeprom_page, to next page
-  ui32_m_eeprom_page = (ui32_m_eeprom_page + 1) % 2;
-
-  // erase the new page
-  eeprom_erase_page(ui32_m_eeprom_page);
-  // write on the new page
-  eeprom_write_array(value, sizeof(uint32_t) * length_words);
-  // write key
-  eeprom_write(ADDRESS_KEY, KEY);
-  // write EEPROM_MAGIC_KEY and EEPROM_PAGE WRITE_ID
-  eeprom_write(EEPROM_PAGE_KEY_ADDRESS, EEPROM_MAGIC_KEY);
-  uint8_t ui32_eeprom_write_id = eeprom_read_from_page(EEPROM_PAGE_WRITE_ID_ADDRESS, (ui32_m_eeprom_page == 0) ? 1 : 0) + 1;
-  eeprom_write(EEPROM_PAGE_WRITE_ID_ADDRESS, ui32_eeprom_write_id); // write new ID
+  FLASH_Status status;
 
-  return true;
+  FLASH_Unlock();
+  status = FLASH_ErasePage(EEPROM_START_ADDRESS + (ui8_page * EEPROM_PAGE_SIZE));
+  FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+  FLASH_Lock();
+
+  return status == FLASH_COMPLETE;
 }
 
-uint8_t eeprom_read(uint32_t ui32_address)
+const uint32_t* ride_log_hw_page(uint16_t ui16_page)
 {
-  uint16_t *ui16_p_address = (uint16_t *) (((uint32_t) EEPROM_START_ADDRESS) + (ui32_m_eeprom_page * 2048) + (ui32_address * 2));
-  return (uint8_t) (*ui16_p_address);
+  return (const uint32_t *) (RIDE_LOG_START_ADDRESS + (ui16_page * EEPROM_PAGE_SIZE));
 }
 
-uint8_t eeprom_read_from_page(uint32_t ui32_address, uint32_t ui32_eeprom_page)
+bool ride_log_hw_program(uint16_t ui16_page, uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num)
 {
-  uint16_t *ui16_p_address = (uint16_t *) (((uint32_t) EEPROM_START_ADDRESS) + (ui32_eeprom_page * 2048) + (ui32_address * 2));
-  return (uint8_t) (*ui16_p_address);
+  uint32_t ui32_address = RIDE_LOG_START_ADDRESS + (ui16_page * EEPROM_PAGE_SIZE) + (ui16_offset * sizeof(uint32_t));
+  bool ok = true;
+
+  FLASH_Unlock();
+  while (ui16_num--) {
+    if (FLASH_ProgramWord(ui32_address, *p_words++) != FLASH_COMPLETE) {
+      ok = false;
+      break;
+    }
+    ui32_address += sizeof(uint32_t);
+  }
+  FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
+  FLASH_Lock();
+
+  return ok;
 }
 
-uint32_t eeprom_write(uint32_t ui32_address, uint8_t ui8_data)
+bool ride_log_hw_erase(uint16_t ui16_page)
 {
-  ui32_address = ((uint32_t) EEPROM_START_ADDRESS) + (ui32_m_eeprom_page * 2048) + (ui32_address * 2);
+  FLASH_Status status;
 
   FLASH_Unlock();
-  if(FLASH_ProgramHalfWord(ui32_address, (uint16_t) ui8_data) != FLASH_COMPLETE)
-  {
-    FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
-    FLASH_Lock();
-    return 1;
-  }
+  status = FLASH_ErasePage(RIDE_LOG_START_ADDRESS + (ui16_page * EEPROM_PAGE_SIZE));
   FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
   FLASH_Lock();
 
-  return 0;
+  return status == FLASH_COMPLETE;
+}
+
+const uint32_t* last_gasp_hw_area(void)
+{
+  return (const uint32_t *) LAST_GASP_START_ADDRESS;
 }
 
-void eeprom_erase_page(uint32_t ui32_eeprom_page)
+bool last_gasp_hw_erase(void)
 {
+  FLASH_Status status;
+
   FLASH_Unlock();
-  FLASH_ErasePage(((uint32_t) EEPROM_START_ADDRESS) + (ui32_eeprom_page * 2048));
+  status = FLASH_ErasePage(LAST_GASP_START_ADDRESS);
+  FLASH_ClearFlag(FLASH_FLAG_EOP | FLASH_FLAG_PGERR | FLASH_FLAG_WRPRTERR);
   FLASH_Lock();
+
+  return status == FLASH_COMPLETE;
+}
+
+// Also called from the PVD interrupt, which can come in the middle of a flash_log or ride_log write or erase: this
+// waits for the operation the flash is busy with, programs with only PG set and leaves FLASH->CR as it found it
+bool last_gasp_hw_program(uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num)
+{
+  uint32_t ui32_address = LAST_GASP_START_ADDRESS + (ui16_offset * sizeof(uint32_t));
+  uint32_t ui32_cr;
+  bool ok = true;
+
+  if (FLASH_WaitForLastOperation(FLASH_ERASE_TIMEOUT) == FLASH_TIMEOUT)
+    return false;
+
+  ui32_cr = FLASH->CR;
+  FLASH->CR &= ~(FLASH_CR_PG | FLASH_CR_PER | FLASH_CR_MER);
+  if (ui32_cr & FLASH_CR_LOCK)
+    FLASH_Unlock();
+
+  while (ui16_num--) {
+    if (FLASH_ProgramWord(ui32_address, *p_words++) != FLASH_COMPLETE) {
+      ok = false;
+      break;
+    }
+    ui32_address += sizeof(uint32_t);
+  }
+
+  if (ui32_cr & FLASH_CR_LOCK)
+    FLASH_Lock();
+  else
+    FLASH->CR |= ui32_cr & (FLASH_CR_PG | FLASH_CR_PER | FLASH_CR_MER);
+
+  return ok;
 }
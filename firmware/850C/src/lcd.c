@@ -22,6 +22,8 @@
 #include "rtc.h"
 #include "fonts.h"
 #include "state.h"
+#include "ride_log.h"
+#include "last_gasp.h"
 
 // Battery SOC symbol:
 // 10 bars, each bar: with = 7, height = 24
@@ -58,7 +60,7 @@ void lcd_init(void)
 
 void power_off_management(void)
 {
-  if(buttons_get_onoff_long_click_event() &&
+  if((buttons_get_events() & ONOFF_LONG_CLICK) &&
     m_lcd_vars.lcd_screen_state == LCD_SCREEN_MAIN &&
     buttons_get_up_state() == 0 &&
     buttons_get_down_state() == 0)
@@ -89,6 +91,41 @@ void lcd_set_backlight_intensity(uint8_t ui8_intensity)
 
 
 
+// The PVD compares VDD to its highest level, 2.9V, and the MCU runs down to 2.0V
+void last_gasp_hw_enable(bool enable)
+{
+  EXTI_InitTypeDef EXTI_InitStructure;
+  NVIC_InitTypeDef NVIC_InitStructure;
+
+  RCC_APB1PeriphClockCmd(RCC_APB1Periph_PWR, ENABLE);
+  PWR_PVDLevelConfig(PWR_PVDLevel_2V9);
+  PWR_PVDCmd(enable ? ENABLE : DISABLE);
+
+  // EXTI line 16 is the PVD output, that rises when VDD falls below the level
+  EXTI_InitStructure.EXTI_Line = EXTI_Line16;
+  EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+  EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising;
+  EXTI_InitStructure.EXTI_LineCmd = enable ? ENABLE : DISABLE;
+  EXTI_Init(&EXTI_InitStructure);
+  EXTI_ClearITPendingBit(EXTI_Line16);
+
+  NVIC_InitStructure.NVIC_IRQChannel = PVD_IRQn;
+  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = PVD_INTERRUPT_PRIORITY;
+  NVIC_InitStructure.NVIC_IRQChannelSubPriority = 0;
+  NVIC_InitStructure.NVIC_IRQChannelCmd = enable ? ENABLE : DISABLE;
+  NVIC_Init(&NVIC_InitStructure);
+}
+
+// The battery was pulled: the backlight draws most of the current, turn it off so the capacitors hold VDD up
+// longer, then save the odometer and Wh. sim/bench/last_gasp_test.c checks this fits in the time that is left.
+void PVD_IRQHandler(void)
+{
+  EXTI_ClearITPendingBit(EXTI_Line16);
+
+  TIM_SetCompare2(TIM3, 0);
+  last_gasp_save(rt_vars.ui32_odometer_x10, rt_vars.ui32_wh_x10);
+}
+
 void lcd_power_off(uint8_t updateDistanceOdo)
 {
   // save current battery Wh
@@ -96,6 +133,8 @@ void lcd_power_off(uint8_t updateDistanceOdo)
 
   // save the variables on EEPROM
   eeprom_write_variables ();
+  ride_log_power_off();
+  last_gasp_hw_enable(false); // they are saved already
 
   // put screen all black and disable backlight
   UG_FillScreen(0);
@@ -29,15 +29,14 @@
 #include "stm32f10x_usart.h"
 #include "mainscreen.h"
 #include "configscreen.h"
+#include "events.h"
+#include "ride_log.h"
 
 void SetSysClockTo128Mhz(void);
 void adc_init();
 
 int main(void)
 {
-  volatile uint32_t ui32_timer_base_counter_1ms;
-  volatile uint32_t ui32_ms_loop_counter_1;
-
   SetSysClockTo128Mhz();
   RCC_APB1PeriphResetCmd(RCC_APB1Periph_WWDG, DISABLE);
 
@@ -50,8 +49,10 @@ int main(void)
   adc_init();
   system_power(1);
   systick_init();
+  buttons_init(); // after systick_init(), the edges are timestamped with it
   usart1_init();
   eeprom_init();
+  ride_log_init();
   rtc_init();
   timer3_init(); // drives LCD backlight
   lcd_init();
@@ -62,17 +63,14 @@ int main(void)
 
   while(1)
   {
-    // because of continue; at the end of each if code block that will stop the while (1) loop there,
-    // the first if block code will have the higher priority over any others
-    ui32_timer_base_counter_1ms = get_time_base_counter_1ms();
-    if((ui32_timer_base_counter_1ms - ui32_ms_loop_counter_1) > 20) // every 20ms
-    {
-      ui32_ms_loop_counter_1 = ui32_timer_base_counter_1ms;
-
-      // next 2 lines takes about 11ms to execute (main menu). Measured on 2019.03.04.
-      main_idle();
-      continue;
-    }
+    main_idle();
+
+    // sleep until the next interrupt if it posted nothing meanwhile: WFI also wakes up on an interrupt that is
+    // pending while they are disabled, which then runs as soon as they are enabled again
+    __disable_irq();
+    if (!events_pending())
+      __WFI();
+    __enable_irq();
   }
 }
 
@@ -101,8 +99,8 @@ void SetSysClockTo128Mhz(void)
     /* HCLK = SYSCLK */
     RCC_HCLKConfig(RCC_SYSCLK_Div1);
 
-    /* PCLK2 = HCLK */
-    RCC_PCLK2Config(RCC_HCLK_Div1);
+    /* PCLK2 = HCLK/2, the ADC clock is divided from it and can't get below 16MHz, over its 14MHz max, at 128MHz */
+    RCC_PCLK2Config(RCC_HCLK_Div2);
 
     /* PCLK1 = HCLK/2 */
     RCC_PCLK1Config(RCC_HCLK_Div2);
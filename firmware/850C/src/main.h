@@ -14,10 +14,12 @@
 // INTERRUPTS PRIORITIES
 // Define for the NVIC IRQChannel Preemption Priority
 // lower number has higher priority
+#define PVD_INTERRUPT_PRIORITY          0 // before anything else, the supply is going away
 #define USART1_INTERRUPT_PRIORITY       3
-#define USART1_DMA_INTERRUPT_PRIORITY   4
+#define USART1_DMA_INTERRUPT_PRIORITY   3 // must be the same as USART1, both update the RX DMA position
 #define TIM4_INTERRUPT_PRIORITY         5
 #define RTC_INTERRUT_PRIORITY           6
+#define BUTTONS_INTERRUPT_PRIORITY      7
 
 
 
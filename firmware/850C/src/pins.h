@@ -41,6 +41,17 @@
 #define BUTTON_DOWN__PORT                           GPIOA
 #define BUTTON_DOWN__PIN                            GPIO_Pin_15
 
+// the buttons edge interrupts, all three are on EXTI15_10_IRQn
+#define BUTTON_UP__PORT_SOURCE                      GPIO_PortSourceGPIOC
+#define BUTTON_UP__PIN_SOURCE                       GPIO_PinSource11
+#define BUTTON_UP__EXTI_LINE                        EXTI_Line11
+#define BUTTON_ONOFF__PORT_SOURCE                   GPIO_PortSourceGPIOC
+#define BUTTON_ONOFF__PIN_SOURCE                    GPIO_PinSource12
+#define BUTTON_ONOFF__EXTI_LINE                     EXTI_Line12
+#define BUTTON_DOWN__PORT_SOURCE                    GPIO_PortSourceGPIOA
+#define BUTTON_DOWN__PIN_SOURCE                     GPIO_PinSource15
+#define BUTTON_DOWN__EXTI_LINE                      EXTI_Line15
+
 #define USART1__PORT                                GPIOA
 #define USART1_TX__PIN                              GPIO_Pin_9
 #define USART1_RX__PIN                              GPIO_Pin_10
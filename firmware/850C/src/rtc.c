@@ -10,6 +10,7 @@
 #include "main.h"
 #include "stm32f10x_bkp.h"
 #include "rtc.h"
+#include "events.h"
 
 #define SECONDS_IN_DAY 86399
 #define CONFIGURATION_DONE 0xAAAA
@@ -31,6 +32,9 @@ void RTC_IRQHandler(void)
   }
 
   ui32_seconds_since_startup++;
+
+  if (RTC_GetCounter() % 60 == 0)
+    event_post(EVENT_RTC_MINUTE);
 }
 
 void rtc_init()
@@ -117,6 +121,8 @@ void rtc_init()
   }
 
   BKP_RTCOutputConfig(BKP_RTCOutputSource_None);
+
+  event_post(EVENT_RTC_MINUTE); // show the clock right away
 }
 
 void rtc_set_time(rtc_time_t *rtc_time)
@@ -124,6 +130,7 @@ void rtc_set_time(rtc_time_t *rtc_time)
   RTC_WaitForLastTask();
   RTC_SetCounter((((uint32_t) rtc_time->ui8_hours) * 3600) + (((uint32_t) rtc_time->ui8_minutes) * 60));
   RTC_WaitForLastTask();
+  event_post(EVENT_RTC_MINUTE);
 }
 
 rtc_time_t* rtc_get_time(void)
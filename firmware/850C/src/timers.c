@@ -12,6 +12,8 @@
 #include "main.h"
 #include "pins.h"
 #include "state.h"
+#include "buttons.h"
+#include "events.h"
 
 static volatile uint32_t _ms;
 volatile uint32_t time_base_counter_1ms = 0;
@@ -27,6 +29,10 @@ void SysTick_Handler(void) // runs every 1ms
   _ms++; // for delay_ms ()
 
   time_base_counter_1ms++;
+
+  // only wake up the main loop for the buttons while they are in use
+  if (time_base_counter_1ms % BUTTONS_CLOCK_MS == 0 && buttons_busy())
+    event_post(EVENT_BUTTONS);
 }
 
 void systick_init (void)
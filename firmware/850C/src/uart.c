@@ -1,6 +1,7 @@
 
 #include "uart.h"
 #include "usart1.h"
+#include "uart_rx_queue.h"
 
 uint8_t ui8_usart1_tx_buffer[UART_NUMBER_DATA_BYTES_TO_SEND];
 
@@ -13,17 +14,14 @@ void uart_init(void)
 }
 
 /**
- * @brief Returns pointer to RX buffer ready for parsing or NULL
+ * @brief Returns pointer to the next RX buffer ready for parsing or NULL, valid until the next call
  */
 const uint8_t* uart_get_rx_buffer_rdy(void)
 {
-	if(!usart1_received_package()) {
-		return NULL;
-	}
+	// parse here and not in the ISRs, so a busy link doesn't cost us interrupts
+	usart1_rx_dma_poll();
 
-	uint8_t *r = usart1_get_rx_buffer();
-	usart1_reset_received_package();
-	return r;
+	return uart_rx_queue_pop();
 }
 
 /**
@@ -31,6 +31,9 @@
 #include "../ugui_driver/ugui_bafang_850c.h"
 #include "../pins.h"
 #include "../timers.h"
+#include "screen.h"
+#include "glyph_cache.h"
+#include "profile.h"
 
 #define HDP (DISPLAY_WIDTH - 1)
 #define VDP (DISPLAY_HEIGHT - 1)
@@ -43,6 +46,7 @@ void lcd_set_xy(uint16_t ui16_x1, uint16_t ui16_y1, uint16_t ui16_x2,
                 uint16_t ui16_y2);
 
 void lcd_read_data_16bits(uint16_t command, uint16_t *out, int numtoread);
+void lcd_write_cycle();
 
 inline void Display_Reset() {
     
@@ -55,6 +59,7 @@ static void push_pixel_850(UG_COLOR c) {
         c = C_BLACK; // FIXME, not quite correct - we really should skip that pixel
     
     lcd_write_data_8bits(c);
+    ui32_g_lcd_pixels_written++;
 }
 
 /**
@@ -83,6 +88,31 @@ PushPixelFn HW_FillArea(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2) {
     return push_pixel_850;
 }
 
+/**
+ * A ugui acceleration function.  Continues the rectangle of HW_FillArea with len pixels of the same color, the bus
+ * is only set once so each pixel is just a write pulse.
+ */
+static void HW_FillRun(UG_COLOR c, UG_U16 len) {
+    if (c == C_TRANSPARENT)
+        c = C_BLACK; // same as push_pixel_850
+    
+    ui32_g_lcd_pixels_written += len;
+    
+    LCD_BUS__PORT->ODR = c;
+    
+    while (len--) {
+        lcd_write_cycle();
+    }
+}
+
+// The Cortex-M3 DWT cycle counter, our CMSIS version has no definitions for it
+#define DWT_CTRL   (*(volatile uint32_t *) 0xE0001000)
+#define DWT_CYCCNT (*(volatile uint32_t *) 0xE0001004)
+
+uint32_t profile_hw_ticks(void) {
+    return DWT_CYCCNT;
+}
+
 lcd_IC_t detect_lcd_type()
 {
     lcd_read_data_16bits(0xbf, lcd_devcode, 6); // ILI9481 doesn't support Read ID4 command (0xD3)
@@ -436,6 +466,11 @@ lcd_IC_t bafang_500C_lcd_init(void) {
     UG_DriverRegister(DRIVER_FILL_FRAME, (void*) HW_FillFrame);
     UG_DriverRegister(DRIVER_DRAW_LINE, (void*) HW_DrawLine);
     UG_DriverRegister(DRIVER_FILL_AREA, (void*) HW_FillArea);
+    UG_DriverRegister(DRIVER_FILL_RUN, (void*) HW_FillRun);
+    
+    // enable the cycle counter for the glyph cache statistics and the profile
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT_CTRL |= 1; // CYCCNTENA
 
     return type;
 }
@@ -494,6 +529,7 @@ void lcd_pixel_set(UG_S16 i16_x, UG_S16 i16_y, UG_COLOR ui32_color) {
     // Set data on bus
     //
     lcd_write_data_8bits(ui32_color);
+    ui32_g_lcd_pixels_written++;
     
 #if 0
     // I @geeksville don't think this is required and it cost cycles
@@ -558,6 +594,7 @@ UG_RESULT HW_FillFrame(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2,
     }
     
     ui32_pixels = i32_dx * i32_dy;
+    ui32_g_lcd_pixels_written += ui32_pixels;
     
     /**************************************************/
     // Set XY
@@ -17,9 +17,14 @@
 #include "usart1.h"
 #include "main.h"
 #include "uart.h"
+#include "uart_rx_queue.h"
 
-uint8_t ui8_rx_buffer[UART_NUMBER_DATA_BYTES_TO_RECEIVE];
-volatile uint8_t ui8_received_package_flag = 0;
+// Circular DMA buffer for RX, must be a power of 2 and hold more than the bytes received between two calls of
+// usart1_rx_dma_poll() (100ms, 96 bytes at 9600 bps would be the worst case but the motor sends ~30 bytes)
+#define USART1_RX_DMA_BUFFER_SIZE 256
+
+static uint8_t ui8_m_rx_dma_buffer[USART1_RX_DMA_BUFFER_SIZE];
+static uart_rx_dma_ring_t m_rx_dma_ring = { ui8_m_rx_dma_buffer, USART1_RX_DMA_BUFFER_SIZE };
 
 void usart1_init(void)
 {
@@ -46,6 +51,21 @@ void usart1_init(void)
   DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
   DMA_Init(DMA1_Channel4, &DMA_InitStructure);
 
+  // RX, the DMA writes to the buffer forever and we find the frames later
+  DMA_DeInit(DMA1_Channel5);
+  DMA_InitStructure.DMA_PeripheralBaseAddr = (uint32_t) &(USART1->DR);
+  DMA_InitStructure.DMA_MemoryBaseAddr = (uint32_t) ui8_m_rx_dma_buffer;
+  DMA_InitStructure.DMA_DIR = DMA_DIR_PeripheralSRC;
+  DMA_InitStructure.DMA_BufferSize = USART1_RX_DMA_BUFFER_SIZE;
+  DMA_InitStructure.DMA_PeripheralInc = DMA_PeripheralInc_Disable;
+  DMA_InitStructure.DMA_MemoryInc = DMA_MemoryInc_Enable;
+  DMA_InitStructure.DMA_PeripheralDataSize = DMA_PeripheralDataSize_Byte;
+  DMA_InitStructure.DMA_MemoryDataSize = DMA_MemoryDataSize_Byte;
+  DMA_InitStructure.DMA_Mode = DMA_Mode_Circular;
+  DMA_InitStructure.DMA_Priority = DMA_Priority_High;
+  DMA_InitStructure.DMA_M2M = DMA_M2M_Disable;
+  DMA_Init(DMA1_Channel5, &DMA_InitStructure);
+
   // USART pins
   GPIO_InitStructure.GPIO_Pin = USART1_RX__PIN;
   GPIO_InitStructure.GPIO_Speed = GPIO_Speed_50MHz;
@@ -73,6 +93,14 @@ void usart1_init(void)
   NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
   NVIC_Init(&NVIC_InitStructure);
 
+  // enable the RX DMA half and full transfer interrupts, so we keep track of the DMA position even without idle line
+  NVIC_InitStructure.NVIC_IRQChannel = DMA1_Channel5_IRQn;
+  NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = USART1_DMA_INTERRUPT_PRIORITY;
+  NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
+  NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+  NVIC_Init(&NVIC_InitStructure);
+  DMA_ITConfig(DMA1_Channel5, DMA_IT_HT | DMA_IT_TC, ENABLE);
+
   USART_ClearITPendingBit(USART1, USART_IT_RXNE);
   USART_ClearITPendingBit(USART1, USART_IT_TC);
 
@@ -80,24 +108,35 @@ void usart1_init(void)
   USART_Cmd(USART1, ENABLE);
 
   DMA_Cmd(DMA1_Channel4, ENABLE);
-  USART_DMACmd(USART1, USART_DMAReq_Tx, ENABLE);
+  DMA_Cmd(DMA1_Channel5, ENABLE);
+  USART_DMACmd(USART1, USART_DMAReq_Tx | USART_DMAReq_Rx, ENABLE);
   USART_Cmd(USART1, ENABLE);
 
-  // enable USART Receive and Transmit interrupts
-  USART_ITConfig(USART1, USART_IT_RXNE, ENABLE);
+  // the received bytes go to DMA, we only want to know when the line goes idle at the end of each package
+  USART_ITConfig(USART1, USART_IT_IDLE, ENABLE);
+}
+
+// Account the bytes the DMA wrote since the last call, from the USART1 and DMA1_Channel5 ISRs only
+static void usart1_rx_dma_update(void)
+{
+  uart_rx_dma_ring_update(&m_rx_dma_ring, USART1_RX_DMA_BUFFER_SIZE - DMA_GetCurrDataCounter(DMA1_Channel5));
+}
+
+void DMA1_Channel5_IRQHandler(void)
+{
+  if (DMA_GetITStatus(DMA1_IT_HT5) == SET)
+    DMA_ClearITPendingBit(DMA1_IT_HT5);
+
+  if (DMA_GetITStatus(DMA1_IT_TC5) == SET)
+    DMA_ClearITPendingBit(DMA1_IT_TC5);
+
+  usart1_rx_dma_update();
 }
 
 // USART1 Tx and Rx interrupt handler.
 void USART1_IRQHandler()
 {
-  uint8_t ui8_byte_received;
-  static uint8_t ui8_state_machine = 0;
-  static uint8_t ui8_rx[UART_NUMBER_DATA_BYTES_TO_RECEIVE];
-  static uint8_t ui8_rx_cnt = 0;
-  uint8_t ui8_i;
-  uint16_t ui16_crc_rx;
-
-  // The interrupt may be from Tx, Rx, or both.
+  // The interrupt may be from Tx, Rx idle line, or both.
   if(USART_GetITStatus(USART1, USART_IT_ORE) == SET)
   {
     USART_ReceiveData(USART1); // get ride of this interrupt flag
@@ -108,80 +147,24 @@ void USART1_IRQHandler()
     USART_ITConfig(USART1, USART_IT_TXE, DISABLE);
     return;
   }
-  else if(USART_GetITStatus(USART1, USART_IT_RXNE) == SET)
+  else if(USART_GetITStatus(USART1, USART_IT_IDLE) == SET)
   {
-    // receive byte
-    ui8_byte_received = (uint8_t) USART1->DR;
-
-    switch (ui8_state_machine)
-    {
-      case 0:
-      if (ui8_byte_received == 0x43) { // see if we get start package byte
-        ui8_rx[0] = ui8_byte_received;
-        ui8_state_machine = 1;
-      }
-      else
-        ui8_state_machine = 0;
-      break;
-
-      case 1:
-        ui8_rx[1] = ui8_byte_received;
-        ui8_state_machine = 2;
-      break;
-
-      case 2:
-      ui8_rx[ui8_rx_cnt + 2] = ui8_byte_received;
-      ++ui8_rx_cnt;
-
-      // reset if it is the last byte of the package and index is out of bounds
-      if (ui8_rx_cnt >= ui8_rx[1])
-      {
-        ui8_rx_cnt = 0;
-        ui8_state_machine = 0;
-
-        // just to make easy next calculations
-        ui16_crc_rx = 0xffff;
-        for (ui8_i = 0; ui8_i < ui8_rx[1]; ui8_i++)
-        {
-          crc16(ui8_rx[ui8_i], &ui16_crc_rx);
-        }
-
-        // if CRC is correct read the package
-        if (((((uint16_t) ui8_rx[ui8_rx[1] + 1]) << 8) +
-              ((uint16_t) ui8_rx[ui8_rx[1]])) == ui16_crc_rx)
-        {
-          // copy to the other buffer only if we processed already the last package
-          if(!ui8_received_package_flag)
-          {
-            ui8_received_package_flag = 1;
-
-            // store the received data to rx_buffer
-            memcpy(ui8_rx_buffer, ui8_rx, ui8_rx[1] + 2);
-          }
-        }
-      }
-    }
+    USART_ReceiveData(USART1); // reading SR and then DR clears the idle flag
+    usart1_rx_dma_update();
   }
 }
 
+/**
+ * @brief Parse the bytes the DMA received since the last call, the good frames go to the RX queue
+ */
+void usart1_rx_dma_poll(void)
+{
+  uart_rx_dma_ring_parse(&m_rx_dma_ring);
+}
+
 void usart1_start_dma_transfer(uint8_t ui8_len)
 {
   DMA_Cmd(DMA1_Channel4, DISABLE);
   DMA_SetCurrDataCounter(DMA1_Channel4, ui8_len);
   DMA_Cmd(DMA1_Channel4, ENABLE);
 }
-
-uint8_t* usart1_get_rx_buffer(void)
-{
-  return ui8_rx_buffer;
-}
-
-uint8_t usart1_received_package(void)
-{
-  return ui8_received_package_flag;
-}
-
-void usart1_reset_received_package(void)
-{
-  ui8_received_package_flag = 0;
-}
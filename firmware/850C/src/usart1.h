@@ -12,10 +12,8 @@
 #include "stdio.h"
 
 void usart1_init(void);
-uint8_t* usart1_get_rx_buffer(void);
-uint8_t usart1_received_package(void);
-void usart1_reset_received_package(void);
 void usart1_send_byte_and_block(uint8_t ui8_byte);
 void usart1_start_dma_transfer(uint8_t ui8_len);
+void usart1_rx_dma_poll(void);
 
 #endif
@@ -0,0 +1,177 @@
+/*
+ * Run length encoding of uGUI fonts, see FONT_TYPE_RLE in ugui.h.
+ *
+ * Glyphs are encoded over their own width only, so narrow glyphs of proportional fonts
+ * don't carry the padding up to char_width. Runs continue from the end of a row to the
+ * start of the next one, in the order the pixels are pushed to a FILL_AREA window.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "rle.h"
+
+static int glyphWidth(const UG_FONT* font, int ch)
+{
+  return font->widths ? font->widths[ch - font->start_char] : font->char_width;
+}
+
+/*
+ * Coverage of a pixel, 0..255. 1BPP fonts only give 0 or 256, which is encoded as
+ * fore color, because blending with 255 is not exactly the fore color.
+ */
+static int glyphAlpha(const UG_FONT* font, int ch, int x, int y)
+{
+  int bytesPerRow;
+
+  if (font->font_type == FONT_TYPE_1BPP) {
+
+    bytesPerRow = (font->char_width + 7) / 8;
+    if (font->p[(ch - font->start_char) * font->char_height * bytesPerRow + y * bytesPerRow + x / 8] & (1 << (x % 8)))
+      return 256;
+
+    return 0;
+  }
+
+  return font->p[(ch - font->start_char) * font->char_height * font->char_width + y * font->char_width + x];
+}
+
+/*
+ * Encode one glyph into out, return the number of bytes.
+ */
+static int encodeGlyph(const UG_FONT* font, int ch, unsigned char* out)
+{
+  int width = glyphWidth(font, ch);
+  int pixels = width * font->char_height;
+  int len = 0;
+  int literal = -1; // position of the open FONT_RLE_ALPHAS run byte, -1 if none
+  int i = 0;
+
+  while (i < pixels) {
+
+    int alpha = glyphAlpha(font, ch, i % width, i / width);
+    int n = 1;
+
+    while (i + n < pixels && n < FONT_RLE_MAX_LEN && glyphAlpha(font, ch, (i + n) % width, (i + n) / width) == alpha)
+      n++;
+
+    if (alpha == 0 || alpha == 256 || n > 1) {
+
+      literal = -1;
+      if (alpha == 0) {
+        out[len++] = FONT_RLE_BC | (n - 1);
+      }
+      else if (alpha == 256) {
+        out[len++] = FONT_RLE_FC | (n - 1);
+      }
+      else {
+        out[len++] = FONT_RLE_ALPHA | (n - 1);
+        out[len++] = alpha;
+      }
+    }
+    else {
+
+      // blended pixels that all differ, like the edges of anti aliased glyphs
+      if (literal < 0 || (out[literal] & ~FONT_RLE_TYPE_MASK) == FONT_RLE_MAX_LEN - 1) {
+
+        literal = len;
+        out[len++] = FONT_RLE_ALPHAS;
+      }
+      else {
+
+        out[literal]++;
+      }
+
+      out[len++] = alpha;
+    }
+
+    i += n;
+  }
+
+  return len;
+}
+
+int dumpRleFont(FILE* out, const UG_FONT* font, const char* fontName)
+{
+  int ch;
+  int b;
+  int len;
+  int total = 0;
+  int chars = font->end_char - font->start_char + 1;
+  int* offsets = malloc((chars + 1) * sizeof(int));
+  unsigned char* glyph = malloc(font->char_width * font->char_height * 2);
+
+/*
+ * First output run bytes, one line per character.
+ */
+  fprintf(out, "static __UG_FONT_DATA unsigned char fontBits_%s[] = {\n", fontName);
+
+  for (ch = font->start_char; ch <= font->end_char; ch++) {
+
+    offsets[ch - font->start_char] = total;
+    len = encodeGlyph(font, ch, glyph);
+
+    fprintf(out, "  ");
+    for (b = 0; b < len; b++)
+      fprintf(out, "0x%02X,", glyph[b]);
+
+    fprintf(out, " // 0x%X '%c'\n", ch, ch >= 32 && ch < 127 ? ch : ' ');
+    total += len;
+  }
+
+  offsets[chars] = total;
+  fprintf(out, "};\n");
+
+  if (total > 0xFFFF) {
+
+    fprintf(stderr, "RLE font is %d bytes, offsets only go up to 65535\n", total);
+    exit(1);
+  }
+
+/*
+ * Next output where each character starts.
+ */
+  fprintf(out, "static const UG_U16 fontOffsets_%s[] = {", fontName);
+
+  for (ch = 0; ch <= chars; ch++) {
+
+    if (ch)
+      fprintf(out, ",");
+
+    fprintf(out, "%s%d", ch % 16 ? "" : "\n  ", offsets[ch]);
+  }
+
+  fprintf(out, " };\n");
+
+/*
+ * Character widths, the RLE font always has them.
+ */
+  fprintf(out, "static const UG_U8 fontWidths_%s[] = {", fontName);
+
+  for (ch = font->start_char; ch <= font->end_char; ch++) {
+
+    if (ch != font->start_char)
+      fprintf(out, ",");
+
+    fprintf(out, "%s%d", (ch - font->start_char) % 16 ? "" : "\n  ", glyphWidth(font, ch));
+  }
+
+  fprintf(out, " };\n");
+
+/*
+ * Last, output UG_FONT structure.
+ */
+  fprintf(out, "const UG_FONT font_%s = { (unsigned char*)fontBits_%s, FONT_TYPE_RLE, %d, %d, %d, %d, (UG_U8*)fontWidths_%s, fontOffsets_%s };\n",
+          fontName,
+          fontName,
+          font->char_width,
+          font->char_height,
+          font->start_char,
+          font->end_char,
+          fontName,
+          fontName);
+
+  free(glyph);
+  free(offsets);
+
+  return total;
+}
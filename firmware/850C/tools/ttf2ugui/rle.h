@@ -0,0 +1,13 @@
+#ifndef RLE_H
+#define RLE_H
+
+#include <stdio.h>
+#include "ugui.h"
+
+/*
+ * Output a 1BPP or 8BPP font as a FONT_TYPE_RLE one: the bits, offsets and widths arrays
+ * and the UG_FONT structure named font_<fontName>. Returns the size of the bits array.
+ */
+int dumpRleFont(FILE* out, const UG_FONT* font, const char* fontName);
+
+#endif
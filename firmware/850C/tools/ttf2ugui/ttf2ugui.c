@@ -42,6 +42,7 @@
 #define SCREEN_WIDTH 132
 #define SCREEN_HEIGHT 40
 #include "ugui.h"
+#include "rle.h"
 
 static UG_GUI gui;
 static float fontSize = 0;
@@ -89,7 +90,7 @@ static int max(int a, int b)
  * Output C-language code that can be used to include
  * converted font into uGUI application.
  */
-static void dumpFont(const UG_FONT * font, const char* fontFile, float fontSize,int bitsPerPixel)
+static void dumpFont(const UG_FONT * font, const char* fontFile, float fontSize,int bitsPerPixel,int rle)
 {
   int bytesPerChar;
   int ch;
@@ -153,65 +154,77 @@ static void dumpFont(const UG_FONT * font, const char* fontFile, float fontSize,
   if (dpi > 0)
     fprintf(out, "//  --dpi %d\n", dpi);
   fprintf(out, "//  --bpp %d\n", (int)bitsPerPixel);
+  if (rle)
+    fprintf(out, "//  --rle\n");
 
 
   fprintf(out, "// For copyright, see original font file.\n");
   fprintf(out, "\n#include \"ugui.h\"\n\n");
 
-  fprintf(out, "static __UG_FONT_DATA unsigned char fontBits_%s[%d][%d] = {\n", fontName, font->end_char - font->start_char + 1, bytesPerChar);
+  if (rle) {
 
-  current = 0;
-  for (ch = font->start_char; ch <= font->end_char; ch++) {
+    int size = dumpRleFont(out, font, fontName);
 
-    fprintf(out, "  {");
-    for (b = 0; b < bytesPerChar; b++) {
+    fprintf(stderr, "%s: %d bytes of runs instead of %d bytes of bitmaps\n", fontName, size,
+            bytesPerChar * (font->end_char - font->start_char + 1));
+  }
+  else {
+
+    fprintf(out, "static __UG_FONT_DATA unsigned char fontBits_%s[%d][%d] = {\n", fontName, font->end_char - font->start_char + 1, bytesPerChar);
+
+    current = 0;
+    for (ch = font->start_char; ch <= font->end_char; ch++) {
+
+      fprintf(out, "  {");
+      for (b = 0; b < bytesPerChar; b++) {
+
+        if (b)
+          fprintf(out, ",");
 
-      if (b)
+        fprintf(out, "0x%02X", font->p[current]);
+        ++current;
+      }
+
+      fprintf(out, " }");
+      if (ch <= font->end_char - 1)
         fprintf(out, ",");
+      else
+        fprintf(out, " ");
 
-      fprintf(out, "0x%02X", font->p[current]);
-      ++current;
+      fprintf(out, " // 0x%X '%c'\n", ch, ch);
     }
 
-    fprintf(out, " }");
-    if (ch <= font->end_char - 1)
-      fprintf(out, ",");
-    else
-      fprintf(out, " ");
+    fprintf(out, "};\n");
 
-    fprintf(out, " // 0x%X '%c'\n", ch, ch);
-  }
+  /*
+   * Next output character widths.
+   */
+    fprintf(out, "static const UG_U8 fontWidths_%s[] = {\n", fontName);
 
-  fprintf(out, "};\n");
+    for (ch = font->start_char; ch <= font->end_char; ch++) {
 
-/*
- * Next output character widths.
- */
-  fprintf(out, "static const UG_U8 fontWidths_%s[] = {\n", fontName);
+      if (ch != font->start_char)
+        fprintf(out, ",");
 
-  for (ch = font->start_char; ch <= font->end_char; ch++) {
+      fprintf(out, "%d", font->widths[ch - font->start_char]);
+    }
 
-    if (ch != font->start_char)
-      fprintf(out, ",");
+    fprintf(out, "};\n");
 
-    fprintf(out, "%d", font->widths[ch - font->start_char]);
+  /*
+   * Last, output UG_FONT structure.
+   */
+    fprintf(out, "const UG_FONT font_%s = { (unsigned char*)fontBits_%s, FONT_TYPE_%dBPP, %d, %d, %d, %d, fontWidths_%s };\n",
+            fontName,
+            fontName,
+            bitsPerPixel,
+            font->char_width,
+            font->char_height,
+            font->start_char,
+            font->end_char,
+            fontName);
   }
 
-  fprintf(out, "};\n");
-
-/*
- * Last, output UG_FONT structure.
- */
-  fprintf(out, "const UG_FONT font_%s = { (unsigned char*)fontBits_%s, FONT_TYPE_%dBPP, %d, %d, %d, %d, fontWidths_%s };\n",
-          fontName,
-          fontName,
-          bitsPerPixel,
-          font->char_width,
-          font->char_height,
-          font->start_char,
-          font->end_char,
-          fontName);
-
   fclose(out);
 
   sprintf(outFileName, "%s_%dX%d.h", baseName, font->char_width, font->char_height);
@@ -460,6 +473,7 @@ static void showFont(const UG_FONT * font, char* text)
 }
 
 static int dump;
+static int rle;
 static char* fontFile = NULL;
 static char* showText = NULL;
 
@@ -467,6 +481,7 @@ static char* showText = NULL;
 static struct option longopts[] = {
   {"show", required_argument, NULL, 'a'},
   {"dump", no_argument, &dump, 1},
+  {"rle", no_argument, &rle, 1},
   {"dpi", required_argument, NULL, 'd'},
   {"minchar", required_argument, NULL, 'z'},
   {"maxchar", required_argument, NULL, 'e'},
@@ -478,9 +493,10 @@ static struct option longopts[] = {
 
 static void usage()
 {
-  fprintf(stderr, "ttf2ugui {--show text|--dump} --font=fontfile [--dpi=displaydpi] --size=fontsize [--bpp=bitsperpixel]\n");
+  fprintf(stderr, "ttf2ugui {--show text|--dump} --font=fontfile [--dpi=displaydpi] --size=fontsize [--bpp=bitsperpixel] [--rle]\n");
   fprintf(stderr, "If --dpi is not given, font size is assumed to be pixels.\n");
   fprintf(stderr, "Bits per pixel must be 1 or 8. Default is 1.\n");
+  fprintf(stderr, "--rle dumps the font as FONT_TYPE_RLE runs instead of bitmaps.\n");
 
 }
 
@@ -551,5 +567,5 @@ int main(int argc, char **argv)
     showFont(font, showText);
 
   if (dump)
-    dumpFont(font, fontFile, fontSize,bpp);
+    dumpFont(font, fontFile, fontSize,bpp,rle);
 }
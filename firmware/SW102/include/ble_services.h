@@ -2,6 +2,10 @@
 #ifndef INCLUDE_BLE_SERVICES_H_
 #define INCLUDE_BLE_SERVICES_H_
 
+#include <stdint.h>
+
 void ble_init(void);
+// Call from the main loop every 100ms, sends the speed, cadence and power notifications that changed
+void ble_update(uint16_t elapsed_ms);
 
 #endif /* INCLUDE_BLE_SERVICES_H_ */
@@ -5,6 +5,7 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include "nrf_gpio.h"
+#include "nrf_drv_gpiote.h"
 
 /* Default defines if ButtonClicked / LongClicked / DoubleClicked returns true once (1) or every time it is called (0) */
 #ifndef CLICKED_SIGNAL_ONCE
@@ -21,6 +22,7 @@ typedef struct
 {
   button_active_state ActiveState;
   uint32_t PinNumber;
+  nrf_gpio_pin_pull_t PullConfig;
 } Button;
 
 /* Button */
@@ -41,6 +43,9 @@ void InitButton(Button* button, uint32_t pin_number, nrf_gpio_pin_pull_t pull_co
 // Returns true if button is currently pressed
 bool PollButton(Button* button);
 
+// Call handler on each press and release, nrf_drv_gpiote_init() must have been called
+void ButtonSenseEdges(Button* button, nrf_drv_gpiote_evt_handler_t handler);
+
 bool ButtonClicked(Button* button);
 bool ButtonLongClicked(Button* button);
 bool ButtonDoubleClicked(Button* button);
@@ -34,4 +34,7 @@
 
 extern bool useSoftDevice;
 
+/* FDS garbage collection, see eeprom_hw.c */
+uint32_t eeprom_hw_gc(void);
+
 #endif /* INCLUDE_DEFINITIONS_H_ */
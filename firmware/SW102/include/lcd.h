@@ -11,7 +11,7 @@
 #include "stdint.h"
 
 void lcd_init(void);
-void lcd_refresh(void); // Call to flush framebuffer to SPI device
+void lcd_refresh(void); // Call to flush the changed parts of the framebuffer to SPI device
 void lcd_set_backlight_intensity(uint8_t level);
 
 
@@ -19,11 +19,17 @@
 #include "ble_dis.h"
 #include "fds.h"
 #include "state.h"
+#include "events.h"
+#include "data_export.h"
+#include "cycling_meas.h"
+#include "last_gasp.h"
 
-// define to enable the (not yet used) serial service
-// #define BLE_SERIAL
+// define to enable the serial service, used for the data export of data_export.h
+#define BLE_SERIAL
 // define to able reporting speed and cadence via bluetooth
 #define BLE_CSC
+// define to enable reporting pedal power (with speed and cadence) via bluetooth
+#define BLE_CPS
 // define to enable reporting battery SOC via bluetooth
 #define BLE_BAS
 
@@ -51,6 +57,14 @@
 #define FIRST_CONN_PARAMS_UPDATE_DELAY  APP_TIMER_TICKS(5000, APP_TIMER_PRESCALER)  /**< Time from initiating event (connect or start of notification) to first time sd_ble_gap_conn_param_update is called (5 seconds). */
 #define NEXT_CONN_PARAMS_UPDATE_DELAY   APP_TIMER_TICKS(30000, APP_TIMER_PRESCALER) /**< Time between each call to sd_ble_gap_conn_param_update after the first call (30 seconds). */
 #define MAX_CONN_PARAMS_UPDATE_COUNT    3                                           /**< Number of attempts before giving up the connection parameter negotiation. */
+#define EXPORT_MIN_CONN_INTERVAL        BLE_GAP_CP_MIN_CONN_INTVL_MIN               /**< Minimum connection interval while a data export is sent (7.5 ms, the shortest the SoftDevice allows). */
+#define EXPORT_MAX_CONN_INTERVAL        MSEC_TO_UNITS(15, UNIT_1_25_MS)             /**< Maximum connection interval while a data export is sent (15 ms). */
+
+#ifdef BLE_CPS
+#define BLE_UUID_CYCLING_POWER_SERVICE  0x1818                                      /**< Cycling Power service UUID, not in this SDK. */
+#define BLE_UUID_CP_MEASUREMENT_CHAR    0x2A63                                      /**< Cycling Power Measurement characteristic UUID. */
+#define BLE_UUID_CP_FEATURE_CHAR        0x2A65                                      /**< Cycling Power Feature characteristic UUID. */
+#endif
 
 #ifdef BLE_SERIAL
 #define NUS_SERVICE_UUID_TYPE           BLE_UUID_TYPE_VENDOR_BEGIN                  /**< UUID type for the Nordic UART Service (vendor specific). */
@@ -64,6 +78,9 @@ static ble_uuid_t                       m_adv_uuids[] = {
 #ifdef BLE_CSC
     {BLE_UUID_CYCLING_SPEED_AND_CADENCE, BLE_UUID_TYPE_BLE},
 #endif
+#ifdef BLE_CPS
+    {BLE_UUID_CYCLING_POWER_SERVICE, BLE_UUID_TYPE_BLE},
+#endif
 #ifdef BLE_BAS
     {BLE_UUID_BATTERY_SERVICE, BLE_UUID_TYPE_BLE},
 #endif
@@ -111,7 +128,54 @@ static void gap_params_init(void)
  */
 static void nus_data_handler(ble_nus_t * p_nus, uint8_t * p_data, uint16_t length)
 {
- // fixme
+  data_export_request(p_data, length);
+}
+
+static bool m_serial_retry; // the SoftDevice refused a packet for another reason than its TX buffers being full
+
+// Queue one data export packet, false when the SoftDevice has no TX buffer left: the next BLE_EVT_TX_COMPLETE
+// pumps the export again, so each connection event carries as many packets as it can
+static bool serial_send(const uint8_t *p_packet, uint16_t length)
+{
+  uint32_t err_code;
+
+  if (m_conn_handle == BLE_CONN_HANDLE_INVALID) {
+    data_export_abort(); // disconnected, nobody to send the rest to
+    return true;
+  }
+
+  err_code = ble_nus_string_send(&m_nus, (uint8_t *) p_packet, length);
+  if (err_code == NRF_SUCCESS)
+    return true;
+
+  if (err_code == NRF_ERROR_INVALID_STATE) {
+    data_export_abort(); // notifications not enabled
+    return true;
+  }
+
+  // anything else (NRF_ERROR_BUSY, NRF_ERROR_RESOURCES) passes, but there may be no packet in flight whose
+  // BLE_EVT_TX_COMPLETE would pump the export again, so ble_update() does
+  m_serial_retry = err_code != BLE_ERROR_NO_TX_PACKETS;
+  return false;
+}
+
+// Ask the central for the shortest connection interval while a data export is sent, and for the usual long one
+// once it is over to save power
+static void serial_active(bool active)
+{
+  ble_gap_conn_params_t conn_params;
+
+  if (m_conn_handle == BLE_CONN_HANDLE_INVALID)
+    return;
+
+  memset(&conn_params, 0, sizeof(conn_params));
+  conn_params.min_conn_interval = active ? EXPORT_MIN_CONN_INTERVAL : MIN_CONN_INTERVAL;
+  conn_params.max_conn_interval = active ? EXPORT_MAX_CONN_INTERVAL : MAX_CONN_INTERVAL;
+  conn_params.slave_latency     = SLAVE_LATENCY;
+  conn_params.conn_sup_timeout  = CONN_SUP_TIMEOUT;
+
+  // the central may refuse, the export then just goes slower
+  ble_conn_params_change_conn_params(&conn_params);
 }
 
 // Init the serial port service
@@ -123,15 +187,49 @@ static void serial_init()
   nus_init.data_handler = nus_data_handler;
 
   APP_ERROR_CHECK(ble_nus_init(&m_nus, &nus_init));
+
+  data_export_init(serial_send, serial_active, BLE_NUS_MAX_DATA_LEN);
 }
 #endif
 
-#ifdef BLE_CSC
+#if defined(BLE_CSC) || defined(BLE_CPS)
+
+static cycling_meas_t m_cycling_meas;                                               /**< Wheel and crank revolutions and power, for both services. */
+
+// Notify a cycling measurement if it changed since the last one sent
+static void cycling_meas_notify(cycling_notify_t * p_notify, uint16_t value_handle, uint8_t * p_data, uint8_t length,
+    uint16_t elapsed_ms)
+{
+    uint32_t               err_code;
+    uint16_t               hvx_len = length;
+    ble_gatts_hvx_params_t hvx_params;
 
-#define SPEED_AND_CADENCE_MEAS_INTERVAL APP_TIMER_TICKS(1000, APP_TIMER_PRESCALER)  /**< Speed and cadence measurement interval (milliseconds). */
+    if (m_conn_handle == BLE_CONN_HANDLE_INVALID || !cycling_notify_due(p_notify, p_data, length, elapsed_ms))
+        return;
 
+    memset(&hvx_params, 0, sizeof(hvx_params));
+    hvx_params.handle = value_handle;
+    hvx_params.type   = BLE_GATT_HVX_NOTIFICATION;
+    hvx_params.p_len  = &hvx_len;
+    hvx_params.p_data = p_data;
 
-APP_TIMER_DEF(m_csc_meas_timer_id);                                                 /**< CSC measurement timer. */
+    err_code = sd_ble_gatts_hvx(m_conn_handle, &hvx_params);
+    if (err_code == NRF_SUCCESS)
+    {
+        cycling_notify_sent(p_notify, p_data, length);
+    }
+    else if ((err_code != NRF_ERROR_INVALID_STATE) &&
+             (err_code != BLE_ERROR_NO_TX_PACKETS) &&
+             (err_code != BLE_ERROR_GATTS_SYS_ATTR_MISSING)
+            )
+    {
+        APP_ERROR_HANDLER(err_code);
+    }
+    // else notifications are off or the buffers full, try again on the next tick
+}
+#endif
+
+#ifdef BLE_CSC
 
 static ble_sensor_location_t supported_locations[] = {BLE_SENSOR_LOCATION_FRONT_WHEEL,
                                                       BLE_SENSOR_LOCATION_LEFT_CRANK,
@@ -146,85 +244,22 @@ static ble_sensor_location_t supported_locations[] = {BLE_SENSOR_LOCATION_FRONT_
 
 
 static ble_cscs_t m_cscs;                                                           /**< Structure used to identify the cycling speed and cadence service. */
+static cycling_notify_t m_csc_notify;                                               /**< The last speed and cadence measurement sent. */
 
-static uint32_t m_cumulative_wheel_revs;                                            /**< Cumulative wheel revolutions. */
 static bool     m_auto_calibration_in_progress;                                     /**< Set when an autocalibration is in progress. */
 
-
-#define KPH_TO_MM_PER_SEC               278                                         /**< Constant to convert kilometers per hour into millimeters per second. */
-
-#define DEGREES_PER_REVOLUTION          360                                         /**< Constant used in simulation for calculating crank speed. */
-#define RPM_TO_DEGREES_PER_SEC          6                                           /**< Constant to convert revolutions per minute into degrees per second. */
-
-static void csc_measurement(ble_cscs_meas_t * p_measurement)
-{
-    static uint16_t cumulative_crank_revs = 0;
-    static uint16_t event_time            = 0;
-    static uint16_t wheel_revolution_mm   = 0;
-    static uint16_t crank_rev_degrees     = 0;
-
-    uint16_t mm_per_sec;
-    uint16_t degrees_per_sec;
-    uint16_t event_time_inc;
-
-    // Per specification event time is in 1/1024th's of a second.
-    event_time_inc = (1024 * SPEED_AND_CADENCE_MEAS_INTERVAL) / 1000;
-
-    // Calculate simulated wheel revolution values.
-    p_measurement->is_wheel_rev_data_present = true;
-
-    mm_per_sec = KPH_TO_MM_PER_SEC * 20;
-
-    wheel_revolution_mm     += mm_per_sec * SPEED_AND_CADENCE_MEAS_INTERVAL / 1000;
-    m_cumulative_wheel_revs += wheel_revolution_mm / ui_vars.ui16_wheel_perimeter;
-    wheel_revolution_mm     %= ui_vars.ui16_wheel_perimeter;
-
-    p_measurement->cumulative_wheel_revs = m_cumulative_wheel_revs;
-    p_measurement->last_wheel_event_time =
-        event_time + (event_time_inc * (mm_per_sec - wheel_revolution_mm) / mm_per_sec);
-
-    // Calculate simulated cadence values.
-    p_measurement->is_crank_rev_data_present = true;
-
-    degrees_per_sec = RPM_TO_DEGREES_PER_SEC * 50;
-
-    crank_rev_degrees     += degrees_per_sec * SPEED_AND_CADENCE_MEAS_INTERVAL / 1000;
-    cumulative_crank_revs += crank_rev_degrees / DEGREES_PER_REVOLUTION;
-    crank_rev_degrees     %= DEGREES_PER_REVOLUTION;
-
-    p_measurement->cumulative_crank_revs = cumulative_crank_revs;
-    p_measurement->last_crank_event_time =
-        event_time + (event_time_inc * (degrees_per_sec - crank_rev_degrees) / degrees_per_sec);
-
-    event_time += event_time_inc;
-}
-
-/**@brief Function for handling the Cycling Speed and Cadence measurement timer timeouts.
- *
- * @details This function will be called each time the cycling speed and cadence
- *          measurement timer expires.
+/**@brief Function for sending the Cycling Speed and Cadence measurement when it changed.
  *
- * @param[in] p_context  Pointer used for passing some arbitrary information (context) from the
- *                       app_start_timer() call to the timeout handler.
+ * @param[in] elapsed_ms  Time since the last call.
  */
-static void csc_meas_timeout_handler(void * p_context)
+static void csc_update(uint16_t elapsed_ms)
 {
-    uint32_t        err_code;
-    ble_cscs_meas_t cscs_measurement;
-
-    UNUSED_PARAMETER(p_context);
+    uint32_t err_code;
+    uint8_t  encoded_csc_meas[CYCLING_MEAS_CSC_BYTES];
 
-    csc_measurement(&cscs_measurement);
+    cycling_meas_notify(&m_csc_notify, m_cscs.meas_handles.value_handle, encoded_csc_meas,
+        cycling_meas_csc_encode(&m_cycling_meas, encoded_csc_meas), elapsed_ms);
 
-    err_code = ble_cscs_measurement_send(&m_cscs, &cscs_measurement);
-    if ((err_code != NRF_SUCCESS) &&
-        (err_code != NRF_ERROR_INVALID_STATE) &&
-        (err_code != BLE_ERROR_NO_TX_PACKETS) &&
-        (err_code != BLE_ERROR_GATTS_SYS_ATTR_MISSING)
-       )
-    {
-        APP_ERROR_HANDLER(err_code);
-    }
     if (m_auto_calibration_in_progress)
     {
         err_code = ble_sc_ctrlpt_rsp_send(&(m_cscs.ctrl_pt), BLE_SCPT_SUCCESS);
@@ -254,7 +289,7 @@ ble_scpt_response_t sc_ctrlpt_event_handler(ble_sc_ctrlpt_t     * p_sc_ctrlpt,
     switch (p_evt->evt_type)
     {
         case BLE_SC_CTRLPT_EVT_SET_CUMUL_VALUE:
-            m_cumulative_wheel_revs = p_evt->params.cumulative_value;
+            cycling_meas_set_wheel_revs(&m_cycling_meas, p_evt->params.cumulative_value);
             break;
 
         case BLE_SC_CTRLPT_EVT_START_CALIBRATION:
@@ -298,12 +333,68 @@ static void csc_init() {
   BLE_GAP_CONN_SEC_MODE_SET_OPEN(&cscs_init.csc_sensor_loc_attr_md.read_perm); // for the sensor location characteristic, only the read permission can be set by the application, others are mendated by service specification
 
   APP_ERROR_CHECK(ble_cscs_init(&m_cscs, &cscs_init));
+}
 
-  APP_ERROR_CHECK(app_timer_create(&m_csc_meas_timer_id,
-                              APP_TIMER_MODE_REPEATED,
-                              csc_meas_timeout_handler));
+#endif
+
+#ifdef BLE_CPS
+
+static uint16_t                 m_cps_service_handle;                               /**< Handle of the cycling power service. */
+static ble_gatts_char_handles_t m_cp_meas_handles;                                  /**< Handles of the cycling power measurement characteristic. */
+static cycling_notify_t         m_cp_notify;                                        /**< The last power measurement sent. */
+
+/**@brief Function for sending the Cycling Power measurement when it changed.
+ *
+ * @param[in] elapsed_ms  Time since the last call.
+ */
+static void cp_update(uint16_t elapsed_ms)
+{
+    uint8_t encoded_cp_meas[CYCLING_MEAS_CP_BYTES];
+
+    cycling_meas_notify(&m_cp_notify, m_cp_meas_handles.value_handle, encoded_cp_meas,
+        cycling_meas_cp_encode(&m_cycling_meas, encoded_cp_meas), elapsed_ms);
+}
 
-  APP_ERROR_CHECK(app_timer_start(m_csc_meas_timer_id, SPEED_AND_CADENCE_MEAS_INTERVAL, NULL));
+// Init the cycling power service, the SDK has none: the measurement, its feature and the sensor location
+static void cps_init() {
+  ble_uuid_t               ble_uuid;
+  ble_add_char_params_t    add_char_params;
+  ble_gatts_char_handles_t char_handles;
+  uint8_t                  init_meas[CYCLING_MEAS_CP_BYTES];
+  uint8_t                  feature[4];
+  uint8_t                  sensor_location = BLE_SENSOR_LOCATION_OTHER; // the motor torque sensor, in the bottom bracket
+
+  BLE_UUID_BLE_ASSIGN(ble_uuid, BLE_UUID_CYCLING_POWER_SERVICE);
+  APP_ERROR_CHECK(sd_ble_gatts_service_add(BLE_GATTS_SRVC_TYPE_PRIMARY, &ble_uuid, &m_cps_service_handle));
+
+  memset(&add_char_params, 0, sizeof(add_char_params));
+  add_char_params.uuid              = BLE_UUID_CP_MEASUREMENT_CHAR;
+  add_char_params.max_len           = CYCLING_MEAS_CP_BYTES;
+  add_char_params.init_len          = cycling_meas_cp_encode(&m_cycling_meas, init_meas);
+  add_char_params.p_init_value      = init_meas;
+  add_char_params.is_var_len        = true;
+  add_char_params.char_props.notify = 1;
+  add_char_params.cccd_write_access = SEC_OPEN;
+  APP_ERROR_CHECK(characteristic_add(m_cps_service_handle, &add_char_params, &m_cp_meas_handles));
+
+  uint32_encode(CYCLING_MEAS_CP_FEATURES, feature);
+  memset(&add_char_params, 0, sizeof(add_char_params));
+  add_char_params.uuid            = BLE_UUID_CP_FEATURE_CHAR;
+  add_char_params.max_len         = sizeof(feature);
+  add_char_params.init_len        = sizeof(feature);
+  add_char_params.p_init_value    = feature;
+  add_char_params.char_props.read = 1;
+  add_char_params.read_access     = SEC_OPEN;
+  APP_ERROR_CHECK(characteristic_add(m_cps_service_handle, &add_char_params, &char_handles));
+
+  memset(&add_char_params, 0, sizeof(add_char_params));
+  add_char_params.uuid            = BLE_UUID_SENSOR_LOCATION_CHAR;
+  add_char_params.max_len         = sizeof(sensor_location);
+  add_char_params.init_len        = sizeof(sensor_location);
+  add_char_params.p_init_value    = &sensor_location;
+  add_char_params.char_props.read = 1;
+  add_char_params.read_access     = SEC_OPEN;
+  APP_ERROR_CHECK(characteristic_add(m_cps_service_handle, &add_char_params, &char_handles));
 }
 
 #endif
@@ -389,6 +480,10 @@ static void services_init(void)
     csc_init();
 #endif
 
+#ifdef BLE_CPS
+    cps_init();
+#endif
+
 #ifdef BLE_BAS
     bas_init();
 #endif
@@ -500,8 +595,19 @@ static void on_ble_evt(ble_evt_t * p_ble_evt)
 
         case BLE_GAP_EVT_DISCONNECTED:
             m_conn_handle = BLE_CONN_HANDLE_INVALID;
+#ifdef BLE_SERIAL
+            data_export_abort();
+#endif
             break; // BLE_GAP_EVT_DISCONNECTED
 
+#ifdef BLE_SERIAL
+        case BLE_EVT_TX_COMPLETE:
+            // TX buffers are free again, the main loop queues the next packets of the export
+            if (data_export_busy())
+              event_post(EVENT_EXPORT);
+            break; // BLE_EVT_TX_COMPLETE
+#endif
+
         case BLE_GAP_EVT_SEC_PARAMS_REQUEST:
             // Pairing not supported
             sd_ble_gap_sec_params_reply(m_conn_handle, BLE_GAP_SEC_STATUS_PAIRING_NOT_SUPP, NULL, NULL);
@@ -594,6 +700,10 @@ static void ble_evt_dispatch(ble_evt_t * p_ble_evt)
  */
 static void sys_evt_dispatch(uint32_t sys_evt)
 {
+    // The supply is going away, save the odometer and Wh before anything else
+    if (sys_evt == NRF_EVT_POWER_FAILURE_WARNING)
+        last_gasp_save(rt_vars.ui32_odometer_x10, rt_vars.ui32_wh_x10);
+
     // Dispatch the system event to the fstorage module, where it will be
     // dispatched to the Flash Data Storage (FDS) module.
     fs_sys_event_handler(sys_evt);
@@ -779,6 +889,30 @@ static void peer_init() {
   APP_ERROR_CHECK(err_code);
 }
 
+void ble_update(uint16_t elapsed_ms)
+{
+#ifdef BLE_SERIAL
+  if (m_serial_retry) {
+    m_serial_retry = false;
+    if (data_export_busy())
+      event_post(EVENT_EXPORT);
+  }
+#endif
+
+#if defined(BLE_CSC) || defined(BLE_CPS)
+  cycling_meas_update(&m_cycling_meas, elapsed_ms, ui_vars.ui16_wheel_speed_x10, ui_vars.ui16_wheel_perimeter,
+      ui_vars.ui8_pedal_cadence, ui_vars.ui16_pedal_power);
+#endif
+
+#ifdef BLE_CSC
+  csc_update(elapsed_ms);
+#endif
+
+#ifdef BLE_CPS
+  cp_update(elapsed_ms);
+#endif
+}
+
 void ble_init(void)
 {
   ble_stack_init();
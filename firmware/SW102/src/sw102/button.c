@@ -6,6 +6,7 @@
  * Released under the GPL License, Version 3
  */
 #include "button.h"
+#include "app_error.h"
 
 /**
  * @brief Init button struct. Call once.
@@ -17,6 +18,19 @@ void InitButton(Button* button, uint32_t pin_number, nrf_gpio_pin_pull_t pull_co
 
   button->ActiveState = active_state;
   button->PinNumber = pin_number;
+  button->PullConfig = pull_config;
+}
+
+/**
+ * @brief Sense both edges with a low power GPIOTE PORT event.
+ */
+void ButtonSenseEdges(Button* button, nrf_drv_gpiote_evt_handler_t handler)
+{
+  nrf_drv_gpiote_in_config_t config = GPIOTE_CONFIG_IN_SENSE_TOGGLE(false);
+
+  config.pull = button->PullConfig;
+  APP_ERROR_CHECK(nrf_drv_gpiote_in_init(button->PinNumber, &config, handler));
+  nrf_drv_gpiote_in_event_enable(button->PinNumber, true);
 }
 
 /**
@@ -11,15 +11,19 @@
 #include "eeprom_hw.h"
 #include "common.h"
 #include "fds.h"
+#include "last_gasp.h"
 #include "nrf_delay.h"
 #include "nrf_soc.h"
 #include "assert.h"
+#include "app_util.h"
+#include "app_util_platform.h"
 
 // volatile fs_ret_t last_fs_ret;
 
 /* Event handler */
 
-volatile static bool gc_done, init_done, write_done;
+volatile static bool gc_done, init_done, write_done, del_done;
+volatile static uint8_t ui8_m_gc_running; // started by eeprom_hw_gc() and not done yet
 
 /* Register fs_sys_event_handler with softdevice_sys_evt_handler_set in ble_stack_init or this doesn't fire! */
 static void fds_evt_handler(fds_evt_t const *const evt)
@@ -32,12 +36,15 @@ static void fds_evt_handler(fds_evt_t const *const evt)
     break;
   case FDS_EVT_GC:
     gc_done = true;
+    if (ui8_m_gc_running)
+      ui8_m_gc_running--;
     break;
   case FDS_EVT_UPDATE:
   case FDS_EVT_WRITE:
     write_done = true;
     break;
   case FDS_EVT_DEL_RECORD:
+    del_done = true;
     break;
 
   default:
@@ -47,6 +54,11 @@ static void fds_evt_handler(fds_evt_t const *const evt)
 
 #define FILE_ID     0x1001
 #define REC_KEY     0x2002
+#define LAST_GASP_REC_KEY 0x2004
+
+static const uint32_t *volatile p_m_last_gasp; // the data of the last gasp record, NULL while it can move
+static volatile bool m_last_gasp_moved; // by a garbage collection, find it again
+static fds_record_desc_t m_last_gasp_desc;
 
 // returns true if our preferences were found
 bool flash_read_words(void *dest, uint16_t length_words)
@@ -83,17 +95,40 @@ bool flash_read_words(void *dest, uint16_t length_words)
   return did_read;
 }
 
+// Every garbage collection goes through here, it moves the last gasp record: nothing is written to it until it
+// is found again
+uint32_t eeprom_hw_gc(void)
+{
+  uint32_t ret;
+
+  CRITICAL_REGION_ENTER();
+  p_m_last_gasp = NULL;
+  m_last_gasp_moved = true;
+  ui8_m_gc_running++;
+  CRITICAL_REGION_EXIT();
+
+  ret = fds_gc();
+  if (ret != FDS_SUCCESS) {
+    CRITICAL_REGION_ENTER();
+    ui8_m_gc_running--;
+    CRITICAL_REGION_EXIT();
+  }
+
+  return ret;
+}
+
 static bool wait_gc()
 {
   if(!useSoftDevice)
     return true; // assume success
 
   gc_done = false;
-  fds_gc();
+  eeprom_hw_gc();
   for (volatile int count = 0; count < 1000 && !gc_done; count++) {
     sd_app_evt_wait();
     nrf_delay_ms(1);
   }
+
   // Note: this can fail if the soft device is not enabled (normally performed in ble init)
   // assert(gc_done);
   return gc_done;
@@ -168,5 +203,168 @@ void eeprom_hw_init(void)
   // assert(init_done);
 
   wait_gc();
+
+  // the first boot with it
+  if (!last_gasp_hw_area())
+    last_gasp_hw_erase();
+}
+
+
+/*
+ * The last gasp records are the data of an FDS record of their own, which FDS writes erased. They are programmed
+ * with the SoftDevice flash calls directly: the POFWARN handler can't wait for the FDS queue. The SoftDevice does the
+ * operation between radio events and sends a system event that fstorage also takes for operations it did not start,
+ * we see it done in the flash itself. The garbage collection moves the record, nothing is written to it until it is
+ * found again. Erasing it writes a new erased record and deletes the old one, whose records last_gasp.c made not
+ * valid first.
+ */
+
+// A DFU update only keeps the DFU_APP_DATA_RESERVED bytes below the bootloader. The prebuilt one has the SDK
+// default, 3 pages of 1k, the FDS pages of the baseline firmware (see gcc_nrf51.ld).
+#define DFU_APP_DATA_RESERVED (3 * 1024)
+STATIC_ASSERT(FDS_VIRTUAL_PAGES * FDS_VIRTUAL_PAGE_SIZE * sizeof(uint32_t) <= DFU_APP_DATA_RESERVED);
+
+static void last_gasp_find(void)
+{
+  fds_flash_record_t flash_record;
+  fds_record_desc_t record_desc;
+  fds_find_token_t ftok;
+  const uint32_t *p_found = NULL;
+
+  memset(&ftok, 0x00, sizeof(ftok));
+  while (fds_record_find(FILE_ID, LAST_GASP_REC_KEY, &record_desc, &ftok) == FDS_SUCCESS) {
+    if (fds_record_open(&record_desc, &flash_record) != FDS_SUCCESS)
+      continue;
+
+    // the record stays where it is until the next garbage collection
+    fds_record_close(&record_desc);
+
+    // two if an erase was cut short, the records of the old one were made not valid first
+    if (!p_found && flash_record.p_header->tl.length_words == LAST_GASP_AREA_WORDS) {
+      m_last_gasp_desc = record_desc;
+      p_found = flash_record.p_data;
+    } else {
+      fds_record_delete(&record_desc);
+    }
+  }
+
+  // unless a garbage collection started meanwhile
+  CRITICAL_REGION_ENTER();
+  if (!ui8_m_gc_running) {
+    p_m_last_gasp = p_found;
+    m_last_gasp_moved = false;
+  }
+  CRITICAL_REGION_EXIT();
+}
+
+const uint32_t* last_gasp_hw_area(void)
+{
+  // found again from the main loop, once the garbage collections are done
+  if (m_last_gasp_moved && !ui8_m_gc_running && !(SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk))
+    last_gasp_find();
+
+  return p_m_last_gasp;
+}
+
+static bool flash_equals(const uint32_t *p_flash, const uint32_t *p_words, uint16_t ui16_num)
+{
+  while (ui16_num--) {
+    if (*p_flash++ != (p_words ? *p_words++ : 0xffffffff))
+      return false;
+  }
+
+  return true;
+}
+
+bool last_gasp_hw_erase(void)
+{
+  static uint32_t ui32_erased[LAST_GASP_AREA_WORDS];
+  fds_record_t record;
+  fds_record_desc_t record_desc, old_desc;
+  fds_record_chunk_t record_chunk;
+  bool has_old = last_gasp_hw_area() != NULL;
+
+  if (!useSoftDevice)
+    return false;
+
+  old_desc = m_last_gasp_desc;
+  memset(ui32_erased, 0xff, sizeof(ui32_erased));
+  record_chunk.p_data = ui32_erased;
+  record_chunk.length_words = LAST_GASP_AREA_WORDS;
+  record.file_id = FILE_ID;
+  record.key = LAST_GASP_REC_KEY;
+  record.data.p_chunks = &record_chunk;
+  record.data.num_chunks = 1;
+
+  p_m_last_gasp = NULL;
+
+  write_done = false;
+  if (fds_record_write(&record_desc, &record) != FDS_SUCCESS) {
+    // no space, the garbage collection makes some
+    wait_gc();
+    if (fds_record_write(&record_desc, &record) != FDS_SUCCESS) {
+      last_gasp_find();
+      return false;
+    }
+  }
+
+  for (volatile int count = 0; count < 1000 && !write_done; count++) {
+    sd_app_evt_wait();
+    nrf_delay_ms(1);
+  }
+
+  if (has_old) {
+    del_done = false;
+    if (fds_record_delete(&old_desc) == FDS_SUCCESS) {
+      for (volatile int count = 0; count < 1000 && !del_done; count++) {
+        sd_app_evt_wait();
+        nrf_delay_ms(1);
+      }
+    }
+  }
+
+  last_gasp_find();
+  return p_m_last_gasp && flash_equals(p_m_last_gasp, NULL, LAST_GASP_AREA_WORDS);
+}
+
+bool last_gasp_hw_program(uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num)
+{
+  uint32_t *p_flash = (uint32_t *) last_gasp_hw_area();
+  uint32_t ret;
+
+  if (!p_flash)
+    return false;
+
+  p_flash += ui16_offset;
+  ret = sd_flash_write(p_flash, (uint32_t *) p_words, ui16_num);
+
+  // the POFWARN handler can't wait, it just starts the write. The main loop waits until it is done, so that the
+  // record it marks merged is before FDS writes the settings again
+  if (SCB->ICSR & SCB_ICSR_VECTACTIVE_Msk)
+    return ret == NRF_SUCCESS;
+
+  for (volatile int count = 0; count < 1000; count++) {
+    if (ret == NRF_ERROR_BUSY)
+      ret = sd_flash_write(p_flash, (uint32_t *) p_words, ui16_num);
+
+    if (ret != NRF_SUCCESS && ret != NRF_ERROR_BUSY)
+      return false;
+    if (ret == NRF_SUCCESS && flash_equals(p_flash, p_words, ui16_num))
+      return true;
+
+    sd_app_evt_wait();
+    nrf_delay_ms(1);
+  }
+
+  return false;
 }
 
+// POFWARN when VDD falls below 2.7V, the highest threshold, the nRF51 runs down to 1.8V
+void last_gasp_hw_enable(bool enable)
+{
+  if (!useSoftDevice)
+    return;
+
+  APP_ERROR_CHECK(sd_power_pof_threshold_set(NRF_POWER_THRESHOLD_V27));
+  APP_ERROR_CHECK(sd_power_pof_enable(enable));
+}
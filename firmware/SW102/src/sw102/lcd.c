@@ -11,13 +11,21 @@
 /* Transferring the frame buffer by none-blocking SPI Transaction Manager showed that the CPU is blocked for the period of transaction
  * by ISR and library management because of very fast IRQ cadence.
  * Therefore we use standard blocking SPI transfer right away and save some complexity and flash space.
+ * (The nRF51 SPI master has no DMA, a byte at 4 MHz takes 2 us, about the time of its interrupt.)
+ *
+ * To keep the time the CPU is blocked short, the drawing functions remember the columns of each page that really
+ * changed and lcd_refresh() only sends those through the SH1107 page/column address commands.
+ * This replaces a list of the areas screenUpdate() drew: the fields are as wide as the screen, so no page ever had
+ * unchanged columns between two areas, and the list always sent at least the columns tracked here.
  */
 
+#include <string.h>
 #include "lcd.h"
 #include "common.h"
 #include "nrf_delay.h"
 #include "nrf_drv_spi.h"
 #include "ugui.h"
+#include "screen.h"
 
 
 /* Function prototype */
@@ -36,6 +44,10 @@ extern UG_GUI gui;
 /* Frame buffer in RAM with same structure as LCD memory --> 16 pages a 64 columns (1 kB) */
 uint8_t frameBuffer[16][64];
 
+/* Columns of each page changed since the last lcd_refresh(), none if dirtyX1 > dirtyX2 */
+static uint8_t dirtyX1[16];
+static uint8_t dirtyX2[16];
+
 /* Init sequence sampled by casainho from original SW102 display */
 static const uint8_t init_array[] = {
     0xAE, // 11. display on
@@ -80,30 +92,50 @@ static void send_cmd(const uint8_t *cmds, size_t numcmds)
   APP_ERROR_CHECK(nrf_drv_spi_transfer(&spi, cmds, numcmds, NULL, 0));
 }
 
+static void markDirty(uint8_t page, uint8_t x1, uint8_t x2)
+{
+  if(x1 < dirtyX1[page])
+    dirtyX1[page] = x1;
+  if(x2 > dirtyX2[page])
+    dirtyX2[page] = x2;
+}
+
+/// Set (or clear if color is black) the bits of mask in w bytes of a page, starting at column x
+static void drawPageSpan(int16_t x, uint8_t page, int16_t w, uint8_t mask, UG_COLOR color) {
+  if(x < 0) { // Clip left
+    w += x;
+    x  = 0;
+  }
+  if((x + w) > SCREEN_WIDTH) { // Clip right
+    w = (SCREEN_WIDTH - x);
+  }
+  if(w > 0) { // Proceed only if width is positive
+    uint8_t *pBuf = &frameBuffer[page][x];
+    int16_t first = -1, last = -1;
+
+    for(int16_t i = 0; i < w; i++) {
+      uint8_t b = color ? (pBuf[i] | mask) : (pBuf[i] & ~mask); // white : black
+
+      if(b != pBuf[i]) {
+        pBuf[i] = b;
+        if(first < 0)
+          first = i;
+        last = i;
+      }
+    }
+
+    if(first >= 0)
+      markDirty(page, x + first, x + last);
+  }
+}
+
 /// Heavily borrowed from https://github.com/adafruit/Adafruit_SSD1306/blob/master/Adafruit_SSD1306.cpp, because this display controller is basically the same
 /// and the frame buffer layout is identical (if you assume rotation 0 in the very old/heavily tested code)
 // Note: all drawing is from left to right, if you want from right to left, you'll need to pick a different start  x
 void drawFastHLineInternal(int16_t x, int16_t y, int16_t w, UG_COLOR color) {
 
   if((y >= 0) && (y < SCREEN_HEIGHT)) { // Y coord in bounds?
-    if(x < 0) { // Clip left
-      w += x;
-      x  = 0;
-    }
-    if((x + w) > SCREEN_WIDTH) { // Clip right
-      w = (SCREEN_WIDTH - x);
-    }
-    if(w > 0) { // Proceed only if width is positive
-      uint8_t *pBuf = &frameBuffer[(y / 8)][x],
-               mask = 1 << (y & 7);
-      if(color)
-        while(w--) { *pBuf++ |= mask; } // white
-      else { // black
-        mask = ~mask;
-        while(w--) { *pBuf++ &= mask; };
-      }
-      // case INVERSE:             while(w--) { *pBuf++ ^= mask; }; break;
-    }
+    drawPageSpan(x, y / 8, w, 1 << (y & 7), color);
   }
 }
 
@@ -127,9 +159,20 @@ static UG_RESULT accel_fill_frame(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG
   if(y2 < y1)
     ssd1306_swap(y1, y2); // Always draw top to bottom
 
+  if(y1 < 0)
+    y1 = 0;
+  if(y2 > SCREEN_HEIGHT - 1)
+    y2 = SCREEN_HEIGHT - 1;
+
+  // the rows of a page share their bytes, so do all of them at once
   while(y1 <= y2) {
-    drawFastHLineInternal(x1, y1, w, c);
-    y1++;
+    int16_t last = y1 | 7;
+
+    if(last > y2)
+      last = y2;
+
+    drawPageSpan(x1, y1 / 8, w, (0xff << (y1 & 7)) & (0xff >> (7 - (last & 7))), c);
+    y1 = last + 1;
   }
 
   return UG_RESULT_OK;
@@ -166,11 +209,15 @@ static void pset(UG_S16 x, UG_S16 y, UG_COLOR col)
 
   uint8_t page = y / 8;
   uint8_t pixel = y % 8;
+  uint8_t old = frameBuffer[page][x];
 
   if (col > 0)
     SET_BIT(frameBuffer[page][x], pixel);
   else
     CLR_BIT(frameBuffer[page][x], pixel);
+
+  if (frameBuffer[page][x] != old)
+    markDirty(page, x, x);
 }
 
 /**
@@ -192,7 +239,8 @@ void lcd_init(void)
   send_cmd(init_array, sizeof(init_array));
 
   // Clear internal RAM
-  lcd_refresh(); // Is already initialized to zero in bss segment.
+  memset(dirtyX2, 63, sizeof(dirtyX2)); // all of it, the frameBuffer is already initialized to zero in bss segment.
+  lcd_refresh();
 
   // Wait 100 ms
   nrf_delay_ms(100);  // Doesn't have to be exact this delay.
@@ -213,9 +261,26 @@ static int lcdBacklight = -1; // -1 means unset
 static int oldBacklight = -1;
 
 /**
- * @brief Start transfer of frameBuffer to LCD
+ * @brief Transfer the columns x1..x2 of a frameBuffer page to the LCD
  */
-void lcd_refresh(void)
+static void lcd_refresh_page(uint8_t page, uint8_t x1, uint8_t x2)
+{
+  static uint8_t pagecmd[] = { 0, 0x00, 0x10 };
+
+  // New page and column address
+  pagecmd[0] = 0xB0 | page;
+  pagecmd[1] = 0x00 | (x1 & 0x0f);
+  pagecmd[2] = 0x10 | (x1 >> 4);
+  send_cmd(pagecmd, sizeof(pagecmd));
+
+  // send page data
+  set_data();
+  APP_ERROR_CHECK(nrf_drv_spi_transfer(&spi, &frameBuffer[page][x1], x2 - x1 + 1, NULL, 0));
+
+  ui32_g_lcd_pixels_written += (x2 - x1 + 1) * 8; // each byte is a column of 8 pixels
+}
+
+static void lcd_refresh_backlight(void)
 {
   if(lcdBacklight != oldBacklight) {
     oldBacklight = lcdBacklight;
@@ -225,19 +290,22 @@ void lcd_refresh(void)
 
     send_cmd(cmd, sizeof(cmd));
   }
+}
 
-  uint8_t addr = 0xB0;
-  static uint8_t pagecmd[] = { 0, 0x00, 0x10 };
+/**
+ * @brief Start transfer of the changed parts of frameBuffer to LCD
+ */
+void lcd_refresh(void)
+{
+  lcd_refresh_backlight();
 
   for (uint8_t i = 0; i < 16; i++)
   {
-    // New page address
-    pagecmd[0] = addr++;
-    send_cmd(pagecmd, sizeof(pagecmd));
+    if (dirtyX1[i] <= dirtyX2[i])
+      lcd_refresh_page(i, dirtyX1[i], dirtyX2[i]);
 
-    // send page data
-    set_data();
-    APP_ERROR_CHECK(nrf_drv_spi_transfer(&spi, &frameBuffer[i][0], 64, NULL, 0));
+    dirtyX1[i] = SCREEN_WIDTH;
+    dirtyX2[i] = 0;
   }
 }
 
@@ -27,6 +27,10 @@
 #include "nrf_drv_wdt.h"
 #include "nrf_power.h"
 #include "timer.h"
+#include "profile.h"
+#include "events.h"
+#include "ride_log.h"
+#include "last_gasp.h"
 
 /* Variable definition */
 
@@ -73,6 +77,8 @@ void lcd_power_off(uint8_t updateDistanceOdo)
 
 // save the variables on EEPROM
   eeprom_write_variables();
+  ride_log_power_off();
+  last_gasp_hw_enable(false); // they are saved already
 
   // put screen all black and disable backlight
   UG_FillScreen(0);
@@ -182,6 +188,7 @@ int main(void)
 {
   init_softdevice();
   gpio_init();
+  buttons_init();
   system_power(true);
   lcd_init();
   uart_init();
@@ -194,6 +201,7 @@ int main(void)
 
   /* eeprom_init AFTER ble_init! */
   eeprom_init();
+  ride_log_init();
 
   screenShow(&bootScreen);
 
@@ -201,35 +209,26 @@ int main(void)
 
   // Enter main loop.
 
-  uint32_t lasttick = gui_ticks;
-  uint32_t tickshandled = 0; // we might miss ticks if running behind, so we use our own local count to figure out if we need to run our 100ms services
-  uint32_t ticksmissed = 0;
+  uint32_t lastcheck = gui_ticks;
   while (1)
   {
-    uint32_t tick = gui_ticks;
-    if (tick != lasttick)
-    {
-//      if(tick < 50 * 5) // uncomment to force a watchdog failure after 5 seconds
-//        watchdog_service(); // we only service the watchdog if we see our ticks are still increasing
-
-      if(tick != lasttick + 1) {
-        ticksmissed += (tick - lasttick - 1); // Error!  We fell behind and missed some ticks (probably due to screen draw taking more than 20 msec)
-
-        // if(is_sim_motor) app_error_fault_handler(FAULT_MISSEDTICK, 0, ticksmissed);
-      }
+    main_idle();
 
-      lasttick = tick;
+    if(gui_ticks - lastcheck >= 100 / MSEC_PER_TICK) { // every 100ms
+//      if(gui_ticks < 50 * 5) // uncomment to force a watchdog failure after 5 seconds
+//        watchdog_service(); // we only service the watchdog if we see our ticks are still increasing
 
-      if(tickshandled++ % (100 / MSEC_PER_TICK) == 0) { // every 100ms
+      if(useSoftDevice)
+        ble_update((gui_ticks - lastcheck) * MSEC_PER_TICK);
 
-        if(stack_overflow_debug() < 128) // we are close to running out of stack
-          APP_ERROR_HANDLER(FAULT_STACKOVERFLOW);
-      }
+      lastcheck = gui_ticks;
 
-      main_idle();
+      if(stack_overflow_debug() < 128) // we are close to running out of stack
+        APP_ERROR_HANDLER(FAULT_STACKOVERFLOW);
     }
 
-    if(useSoftDevice)
+    // sleep until the next interrupt, sd_app_evt_wait() returns right away if one ran since its last call
+    if(useSoftDevice && !events_pending())
       sd_app_evt_wait(); // let OS threads have time to run
   }
 
@@ -287,6 +286,10 @@ static void gui_timer_timeout(void *p_context)
 
   gui_ticks++;
 
+  // only wake up the main loop for the buttons while they are in use
+  if(buttons_busy())
+    event_post(EVENT_BUTTONS);
+
   if(gui_ticks % (1000 / MSEC_PER_TICK) == 0)
     ui32_seconds_since_startup++;
   
@@ -305,6 +308,11 @@ uint32_t get_seconds() {
   return ui32_seconds_since_startup;
 }
 
+/// The RTC1 counter app_timer runs at 32768Hz (APP_TIMER_PRESCALER 0), 24 bits
+uint32_t profile_hw_ticks(void) {
+  return NRF_RTC1->COUNTER;
+}
+
 static void init_app_timers(void)
 {
   // FIXME - not sure why I needed to do this manually: https://devzone.nordicsemi.com/f/nordic-q-a/31982/can-t-make-app_timer-work
@@ -0,0 +1,216 @@
+/*
+ * Bafang LCD SW102 Bluetooth firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * Ride log blocks as FDS records of their own file, next to the settings and last gasp records of eeprom_hw.c in
+ * the 3 FDS pages a DFU update keeps. A block is only written while a page still has room for the settings record
+ * after it, flash_write_words() can't make any at power off. Otherwise the block with the lowest sequence number is
+ * deleted and the space garbage collected, so the log keeps the latest 2 or 3 blocks. Every step is one FDS
+ * operation, their completion events post EVENT_RIDE_LOG.
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include "common.h"
+#include "app_util.h"
+#include "fds.h"
+#include "nrf_soc.h"
+#include "events.h"
+#include "eeprom.h"
+#include "ride_log.h"
+
+#define FILE_ID     0x1002
+#define REC_KEY     0x2003
+
+#define MAX_WAITS   1000 // for an FDS event, in wake ups of the main loop
+
+#define RECORD_WORDS(data_words) ((data_words) + sizeof(fds_header_t) / sizeof(uint32_t))
+#define SETTINGS_RECORD_WORDS    RECORD_WORDS(sizeof(eeprom_data_t) / sizeof(uint32_t))
+
+// ride_log_store_next() keeps the FDS find token in the iterator
+STATIC_ASSERT(sizeof(fds_find_token_t) <= sizeof(ride_log_iter_t));
+
+typedef enum {
+  STORE_IDLE,
+  STORE_WRITING,
+  STORE_WRITTEN,
+  STORE_FREEING, // deleting the oldest block then garbage collecting
+} store_state_t;
+
+static volatile store_state_t m_state;
+static uint16_t ui16_m_waits;
+
+static void fds_evt_handler(fds_evt_t const *const evt)
+{
+  switch (evt->id)
+  {
+  case FDS_EVT_WRITE:
+    if (evt->write.file_id != FILE_ID)
+      return;
+    m_state = STORE_WRITTEN;
+    break;
+  case FDS_EVT_DEL_RECORD:
+    if (evt->del.file_id != FILE_ID)
+      return;
+    if (eeprom_hw_gc() != FDS_SUCCESS)
+      m_state = STORE_IDLE;
+    break;
+  case FDS_EVT_GC:
+    if (m_state != STORE_FREEING)
+      return;
+    m_state = STORE_IDLE;
+    break;
+
+  default:
+    return;
+  }
+
+  event_post(EVENT_RIDE_LOG);
+}
+
+static const ride_log_header_t* record_header(fds_record_desc_t *p_desc)
+{
+  fds_flash_record_t flash_record;
+
+  if (fds_record_open(p_desc, &flash_record) != FDS_SUCCESS)
+    return NULL;
+
+  // the record stays where it is until the next garbage collection
+  fds_record_close(p_desc);
+  return flash_record.p_data;
+}
+
+static bool free_oldest(void)
+{
+  fds_record_desc_t record_desc, oldest_desc;
+  fds_find_token_t ftok;
+  const ride_log_header_t *p_header;
+  uint32_t ui32_oldest_seq = UINT32_MAX;
+
+  memset(&ftok, 0x00, sizeof(ftok));
+  while (fds_record_find(FILE_ID, REC_KEY, &record_desc, &ftok) == FDS_SUCCESS) {
+    p_header = record_header(&record_desc);
+    if (p_header && p_header->ui32_seq <= ui32_oldest_seq) {
+      ui32_oldest_seq = p_header->ui32_seq;
+      oldest_desc = record_desc;
+    }
+  }
+
+  return ui32_oldest_seq != UINT32_MAX && fds_record_delete(&oldest_desc) == FDS_SUCCESS;
+}
+
+uint32_t ride_log_store_init(void)
+{
+  fds_record_desc_t record_desc;
+  fds_find_token_t ftok;
+  const ride_log_header_t *p_header;
+  uint32_t ui32_seq = 0;
+
+  if (!useSoftDevice)
+    return 0;
+
+  // after eeprom_hw_init(), FDS is already initialized
+  APP_ERROR_CHECK(fds_register(fds_evt_handler));
+
+  memset(&ftok, 0x00, sizeof(ftok));
+  while (fds_record_find(FILE_ID, REC_KEY, &record_desc, &ftok) == FDS_SUCCESS) {
+    p_header = record_header(&record_desc);
+    if (p_header && p_header->ui32_seq >= ui32_seq)
+      ui32_seq = p_header->ui32_seq + 1;
+  }
+
+  return ui32_seq;
+}
+
+bool ride_log_store_write(const uint32_t *p_block)
+{
+  fds_record_t record;
+  fds_record_desc_t record_desc;
+  fds_record_chunk_t record_chunk;
+  fds_stat_t stat;
+  ret_code_t retcode;
+
+  if (!useSoftDevice)
+    return true; // like flash_write_words(), without the soft device the block is lost
+
+  switch (m_state) {
+  case STORE_IDLE:
+    if (fds_stat(&stat) != FDS_SUCCESS)
+      break;
+
+    // a page keeps room for the settings record after the block
+    if (stat.largest_contig < RECORD_WORDS(RIDE_LOG_BLOCK_WORDS) + SETTINGS_RECORD_WORDS) {
+      if (free_oldest())
+        m_state = STORE_FREEING;
+      else if (stat.dirty_records && eeprom_hw_gc() == FDS_SUCCESS)
+        m_state = STORE_FREEING;
+      else
+        return true; // no room for even one block, drop it
+      return false;
+    }
+
+    // FDS keeps a pointer to the block, which stays in RAM until we return true
+    record_chunk.p_data = p_block;
+    record_chunk.length_words = RIDE_LOG_BLOCK_WORDS;
+    record.file_id = FILE_ID;
+    record.key = REC_KEY;
+    record.data.p_chunks = &record_chunk;
+    record.data.num_chunks = 1;
+
+    retcode = fds_record_write(&record_desc, &record);
+    if (retcode == FDS_SUCCESS)
+      m_state = STORE_WRITING;
+    else if (retcode == FDS_ERR_NO_SPACE_IN_FLASH && free_oldest())
+      m_state = STORE_FREEING;
+    else
+      break; // the queues are full, try again
+    return false;
+
+  case STORE_WRITTEN:
+    m_state = STORE_IDLE;
+    ui16_m_waits = 0;
+    return true;
+
+  default:
+    break;
+  }
+
+  // sleep like the main loop would, until the FDS event or the next tick
+  if (++ui16_m_waits < MAX_WAITS) {
+    sd_app_evt_wait();
+    return false;
+  }
+
+  m_state = STORE_IDLE; // FDS never answered, drop the block
+  ui16_m_waits = 0;
+  return true;
+}
+
+void ride_log_store_prepare(void)
+{
+  // FDS finds the space itself, a garbage collection only runs when a block needs it
+}
+
+const uint32_t* ride_log_store_next(ride_log_iter_t *p_iter)
+{
+  fds_record_desc_t record_desc;
+  fds_find_token_t ftok;
+  const ride_log_header_t *p_header;
+
+  if (!useSoftDevice)
+    return NULL;
+
+  memcpy(&ftok, p_iter, sizeof(ftok));
+  while (fds_record_find(FILE_ID, REC_KEY, &record_desc, &ftok) == FDS_SUCCESS) {
+    p_header = record_header(&record_desc);
+    if (p_header && ride_log_block_valid((const uint32_t *) p_header)) {
+      memcpy(p_iter, &ftok, sizeof(ftok));
+      return (const uint32_t *) p_header;
+    }
+  }
+
+  return NULL;
+}
@@ -14,6 +14,7 @@
 #include "assert.h"
 #include "app_util_platform.h"
 #include "app_uart.h"
+#include "uart_rx_queue.h"
 
 extern uint32_t _app_uart_init(const app_uart_comm_params_t * p_comm_params,
     app_uart_buffers_t *     p_buffers,
@@ -38,30 +39,13 @@ static const app_uart_comm_params_t comm_params =
     .baud_rate    = UART_BAUDRATE_BAUDRATE_Baud9600
 };
 
-uint8_t ui8_rx_buffer[UART_NUMBER_DATA_BYTES_TO_RECEIVE];
 uint8_t ui8_tx_buffer[UART_NUMBER_DATA_BYTES_TO_SEND];
-volatile uint8_t ui8_received_package_flag = 0;
 
 uint8_t* uart_get_tx_buffer(void)
 {
   return ui8_tx_buffer;
 }
 
-uint8_t* usart1_get_rx_buffer(void)
-{
-  return ui8_rx_buffer;
-}
-
-uint8_t usart1_received_package(void)
-{
-  return ui8_received_package_flag;
-}
-
-void usart1_reset_received_package(void)
-{
-  ui8_received_package_flag = 0;
-}
-
 /**@brief   Function for handling UART interrupts.
  *
  * @details This function will receive a single character from the UART and append it to a string.
@@ -71,70 +55,13 @@ void usart1_reset_received_package(void)
 void uart_evt_callback(app_uart_evt_t * uart_evt)
 {
   uint8_t ui8_byte_received;
-  static uint8_t ui8_state_machine = 0;
-  static uint8_t ui8_rx[UART_NUMBER_DATA_BYTES_TO_RECEIVE];
-  static uint8_t ui8_rx_cnt = 0;
-  uint8_t ui8_i;
-  uint16_t ui16_crc_rx;
 
   switch (uart_evt->evt_type)
   {
     case APP_UART_DATA:
       //Data is ready on the UART
       ui8_byte_received = app_uart_get();
-      switch (ui8_state_machine)
-      {
-        case 0:
-        if (ui8_byte_received == 0x43) { // see if we get start package byte
-          ui8_rx[0] = ui8_byte_received;
-          ui8_state_machine = 1;
-        }
-        else
-          ui8_state_machine = 0;
-        break;
-
-        case 1:
-          ui8_rx[1] = ui8_byte_received;
-          ui8_state_machine = 2;
-        break;
-
-        case 2:
-        ui8_rx[ui8_rx_cnt + 2] = ui8_byte_received;
-        ++ui8_rx_cnt;
-
-        // reset if it is the last byte of the package and index is out of bounds
-        if (ui8_rx_cnt >= ui8_rx[1])
-        {
-          ui8_rx_cnt = 0;
-          ui8_state_machine = 0;
-
-          // just to make easy next calculations
-          ui16_crc_rx = 0xffff;
-          for (ui8_i = 0; ui8_i < ui8_rx[1]; ui8_i++)
-          {
-            crc16(ui8_rx[ui8_i], &ui16_crc_rx);
-          }
-
-          // if CRC is correct read the package
-          if (((((uint16_t) ui8_rx[ui8_rx[1] + 1]) << 8) +
-                ((uint16_t) ui8_rx[ui8_rx[1]])) == ui16_crc_rx)
-          {
-            // copy to the other buffer only if we processed already the last package
-            if(!ui8_received_package_flag)
-            {
-              ui8_received_package_flag = 1;
-
-              // store the received data to rx_buffer
-              memcpy(ui8_rx_buffer, ui8_rx, ui8_rx[1] + 2);
-            }
-          }
-        }
-        break;
-
-        default:
-          ui8_state_machine = 0;
-          break;
-      }
+      uart_rx_queue_parse(&ui8_byte_received, 1);
     break;
 
     case APP_UART_TX_EMPTY:
@@ -142,7 +69,7 @@ void uart_evt_callback(app_uart_evt_t * uart_evt)
       break;
 
     case APP_UART_COMMUNICATION_ERROR:
-        ui8_state_machine = 0;
+      uart_rx_queue_overrun();
       break;
 
     default:
@@ -167,17 +94,11 @@ void uart_init(void)
 }
 
 /**
- * @brief Returns pointer to RX buffer ready for parsing or NULL
+ * @brief Returns pointer to the next RX buffer ready for parsing or NULL, valid until the next call
  */
 const uint8_t* uart_get_rx_buffer_rdy(void)
 {
-  if(!usart1_received_package()) {
-    return NULL;
-  }
-
-  uint8_t *r = usart1_get_rx_buffer();
-  usart1_reset_received_package();
-  return r;
+  return uart_rx_queue_pop();
 }
 
 /**
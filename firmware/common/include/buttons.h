@@ -9,6 +9,12 @@
 #ifndef _BUTTON_H_
 #define _BUTTON_H_
 
+#include <stdint.h>
+#include <stdbool.h>
+
+// buttons_clock() must be called at least this often while buttons_busy(), and after each buttons_edge_irq()
+#define BUTTONS_CLOCK_MS 20
+
 typedef enum {
 	ONOFF_CLICK = 1,
 	ONOFF_CLICK_LONG_CLICK = 2,
@@ -25,35 +31,22 @@ typedef enum {
 	M_LONG_CLICK = 4096
 } buttons_events_t;
 
+// The level of each button, true while pressed
 uint32_t buttons_get_m_state(void);
 uint32_t buttons_get_up_state(void);
-uint32_t buttons_get_up_click_event(void);
-uint32_t buttons_get_up_click_long_click_event(void);
-uint32_t buttons_get_up_long_click_event(void);
-void buttons_clear_up_click_event(void);
-void buttons_clear_up_click_long_click_event(void);
-void buttons_clear_up_long_click_event(void);
 uint32_t buttons_get_down_state(void);
-uint32_t buttons_get_down_click_event(void);
-uint32_t buttons_get_down_click_long_click_event(void);
-uint32_t buttons_get_down_long_click_event(void);
-void buttons_clear_down_click_event(void);
-void buttons_clear_down_click_long_click_event(void);
-void buttons_clear_down_long_click_event(void);
 uint32_t buttons_get_onoff_state(void);
-uint32_t buttons_get_onoff_click_event(void);
-uint32_t buttons_get_onoff_click_long_click_event(void);
-uint32_t buttons_get_onoff_long_click_event(void);
-void buttons_clear_onoff_click_event(void);
-void buttons_clear_onoff_click_long_click_event(void);
-void buttons_clear_onoff_long_click_event(void);
-uint32_t buttons_get_up_down_click_event(void);
-void buttons_clear_up_down_click_event(void);
+
 void buttons_clock(void);
+bool buttons_busy(void);
 buttons_events_t buttons_get_events(void);
+void buttons_clear_events(buttons_events_t events);
 void buttons_clear_all_events(void);
 void buttons_set_events(buttons_events_t events);
+
+// Sets up the edge interrupts of the buttons, that call buttons_edge_irq()
 void buttons_init(void);
+void buttons_edge_irq(void);
 
 extern buttons_events_t buttons_events;
 
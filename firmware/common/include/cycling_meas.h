@@ -0,0 +1,68 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _CYCLING_MEAS_H_
+#define _CYCLING_MEAS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * The BLE Cycling Speed and Cadence and Cycling Power measurements, from the wheel speed, cadence and pedal power
+ * the UI gets every 100ms. The wheel and crank revolutions are counted by integrating the speed and cadence over
+ * each tick, and the time of the last revolution is interpolated inside the tick where it happened, as a sensor
+ * on the wheel or crank would have timed it.
+ */
+#define CYCLING_MEAS_CSC_BYTES      11 // flags, wheel revolutions and event time, crank revolutions and event time
+#define CYCLING_MEAS_CP_BYTES       14 // flags, power, wheel revolutions and event time, crank revolutions and event time
+#define CYCLING_MEAS_MAX_BYTES      CYCLING_MEAS_CP_BYTES
+
+#define CYCLING_MEAS_CP_FEATURES    0x0000000c // wheel and crank revolution data supported
+
+// Notify a changed measurement at most this often, the rate of the old fixed timer
+#define CYCLING_NOTIFY_MIN_MS       1000
+
+typedef struct {
+  uint32_t ui32_time; // now, in 1/2048 s
+  uint16_t ui16_time_frac; // and 1/1000 of those
+
+  uint32_t ui32_wheel_revs;
+  uint32_t ui32_wheel_event_time; // of the last wheel revolution, in 1/2048 s
+  uint32_t ui32_wheel_distance; // since that revolution, in 1/36 mm
+
+  uint16_t ui16_crank_revs;
+  uint32_t ui32_crank_event_time; // in 1/2048 s
+  uint32_t ui32_crank_angle; // since the last crank revolution, in rpm * ms, 60000 for one
+
+  int16_t i16_power;
+} cycling_meas_t;
+
+typedef struct {
+  uint8_t ui8_sent[CYCLING_MEAS_MAX_BYTES];
+  uint8_t ui8_sent_length;
+  uint16_t ui16_quiet_ms; // since the last notification
+} cycling_notify_t;
+
+void cycling_meas_init(cycling_meas_t *p_meas);
+// Advance by ui16_elapsed_ms at the speed, cadence and power the UI has now
+void cycling_meas_update(cycling_meas_t *p_meas, uint16_t ui16_elapsed_ms, uint16_t ui16_wheel_speed_x10,
+    uint16_t ui16_wheel_perimeter, uint8_t ui8_cadence, uint16_t ui16_power);
+// SC control point "set cumulative value"
+void cycling_meas_set_wheel_revs(cycling_meas_t *p_meas, uint32_t ui32_wheel_revs);
+
+// Encode the Cycling Speed and Cadence Measurement (0x2A5B) to p_dest, returns its length
+uint8_t cycling_meas_csc_encode(const cycling_meas_t *p_meas, uint8_t *p_dest);
+// Encode the Cycling Power Measurement (0x2A63) to p_dest, returns its length
+uint8_t cycling_meas_cp_encode(const cycling_meas_t *p_meas, uint8_t *p_dest);
+
+// True if the measurement differs from the last one sent and that was CYCLING_NOTIFY_MIN_MS ago, so nothing is
+// sent while the bike stands still. Call every tick with the time since the previous call.
+bool cycling_notify_due(cycling_notify_t *p_notify, const uint8_t *p_data, uint8_t ui8_length,
+    uint16_t ui16_elapsed_ms);
+// The notification went out
+void cycling_notify_sent(cycling_notify_t *p_notify, const uint8_t *p_data, uint8_t ui8_length);
+
+#endif /* _CYCLING_MEAS_H_ */
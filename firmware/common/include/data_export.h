@@ -0,0 +1,61 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _DATA_EXPORT_H_
+#define _DATA_EXPORT_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Bulk reads over a packet link (BLE NUS on the SW102). The central sends a request, one packet:
+ *
+ *   command, then its arguments
+ *
+ * and gets back a response split over as many packets as needed. Each packet starts with a byte holding a
+ * sequence number in bits 0-6, counting from 0 for each response, and DATA_EXPORT_LAST in the last packet. The
+ * rest of the packets, put together, is:
+ *
+ *   command, status, data, CRC16 (little endian) of the command, status and data
+ *
+ * A new request aborts the response in progress.
+ */
+#define DATA_EXPORT_VERSION     1
+#define DATA_EXPORT_LAST        0x80
+#define DATA_EXPORT_MAX_PACKET  20 // the NUS payload with the default MTU
+
+typedef enum {
+  DATA_EXPORT_CMD_INFO = 1, // data: version, settings size (16 bits), graph variables, graph points (16 bits, 0 if none),
+                            // ride log block size (16 bits), then the firmware version string
+  DATA_EXPORT_CMD_SETTINGS, // data: eeprom_data_t, as the firmware of the version in INFO has it
+  DATA_EXPORT_CMD_GRAPH, // arguments: graph variable, timescale. data: its points, oldest first, 32 bits each.
+                         // DATA_EXPORT_BAD_COMMAND on the SW102, which has no graphs
+  DATA_EXPORT_CMD_RIDE_LOG, // data: the stored ride log blocks, see ride_log.h
+} data_export_cmd_t;
+
+typedef enum {
+  DATA_EXPORT_OK = 0,
+  DATA_EXPORT_BAD_COMMAND,
+  DATA_EXPORT_BAD_ARGUMENT,
+} data_export_status_t;
+
+// Sends one packet, returns false if the link has no buffer for it now: the same packet is sent again on the next
+// data_export_pump()
+typedef bool (*data_export_send_t)(const uint8_t *p_packet, uint16_t ui16_length);
+// Called with true when a response starts and false when it is over, e.g. to ask for a faster link meanwhile
+typedef void (*data_export_active_t)(bool active);
+
+void data_export_init(data_export_send_t send, data_export_active_t active, uint16_t ui16_packet_size);
+// A request from the central, can be called from an interrupt, posts EVENT_EXPORT
+void data_export_request(const uint8_t *p_data, uint16_t ui16_length);
+// The EVENT_EXPORT handler, also call it when the link has room again (e.g. TX complete): sends packets until the
+// link is full or the response is over
+void data_export_pump(void);
+// Drop the response in progress, e.g. on disconnect
+void data_export_abort(void);
+bool data_export_busy(void);
+
+#endif /* _DATA_EXPORT_H_ */
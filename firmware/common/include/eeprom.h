@@ -141,6 +141,8 @@ void eeprom_init(void);
 void eeprom_init_variables(void);
 void eeprom_write_variables(void);
 void eeprom_init_defaults(void);
+// The settings as last read from or written to flash, for data_export.c
+const eeprom_data_t* eeprom_get_data(void);
 
 // *************************************************************************** //
 // EEPROM memory variables default values
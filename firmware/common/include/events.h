@@ -0,0 +1,34 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _EVENTS_H_
+#define _EVENTS_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// What the interrupts wake the main loop up for, the handlers run in this order
+typedef enum {
+  EVENT_BUTTONS = 0, // every BUTTONS_CLOCK_MS while buttons_busy()
+  EVENT_RT_TICK, // rt_processing() published new rt_vars, every 100ms
+  EVENT_RTC_MINUTE, // the wall clock minute changed or was set (850C)
+  EVENT_RIDE_LOG, // a ride log block is waiting to be stored, or storing it can go on
+  EVENT_EXPORT, // a data export request came in or the link can take more of the response (SW102)
+  EVENTS_NUM
+} event_t;
+
+typedef void (*event_handler_t)(void);
+
+// Can be called from any interrupt or the main loop, posts of the same event coalesce until it is dispatched
+void event_post(event_t event);
+
+bool events_pending(void);
+
+// Run the handlers of the events posted since the last call, each one to completion, return false if there were
+// none. Main loop only.
+bool events_dispatch(const event_handler_t handlers[EVENTS_NUM]);
+
+#endif /* _EVENTS_H_ */
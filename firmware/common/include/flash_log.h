@@ -0,0 +1,34 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _FLASH_LOG_H_
+#define _FLASH_LOG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#define FLASH_LOG_PAGES       4   // pages of flash used by the log, at least 2
+#define FLASH_LOG_PAGE_WORDS  512 // 2 kbytes pages
+
+// The settings are stored as chunks of this many words, a save only writes the chunks that changed
+#define FLASH_LOG_CHUNK_WORDS 8
+#define FLASH_LOG_MAX_KEYS    32 // key 0 is the commit record, so up to 31 chunks
+
+void flash_log_init(void);
+bool flash_log_is_empty(void);
+bool flash_log_read_words(void *p_dest, uint16_t ui16_length_words);
+bool flash_log_write_words(const void *p_value, uint16_t ui16_length_words);
+bool flash_log_write_key(uint8_t ui8_key);
+
+// Provided by the platform: the log pages are memory mapped, erased to 0xffffffff and programmed a word at a time
+const uint32_t* flash_log_hw_page(uint8_t ui8_page);
+bool flash_log_hw_erase(uint8_t ui8_page);
+bool flash_log_hw_program(uint8_t ui8_page, uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num);
+// Provided by the platform: the settings as an older firmware stored them, false if there are none. Read while the
+// log is empty, they may be in its pages
+bool flash_log_hw_legacy_read(void *p_dest, uint16_t ui16_length_words);
+
+#endif /* _FLASH_LOG_H_ */
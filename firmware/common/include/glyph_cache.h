@@ -0,0 +1,42 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _GLYPH_CACHE_H_
+#define _GLYPH_CACHE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ugui.h"
+
+// Glyphs drawn with a font, character and colors kept as runs of same color pixels, in the order they are pushed
+// to the FILL_AREA window, the least recently used ones are dropped when a new glyph doesn't fit. Only the
+// FONT_TYPE_1BPP and FONT_TYPE_8BPP fonts go through it, the FONT_TYPE_RLE ones already are runs in flash
+#define GLYPH_CACHE_ENTRIES 48
+#define GLYPH_CACHE_BYTES   1536 // a run of fc or bc is a byte, the labels and units glyphs are up to about 70 bytes
+
+// The hit rate and cycles per glyph, of the glyphs that go through the cache, are recomputed each time this many
+// glyphs were drawn
+#define GLYPH_CACHE_STATS_GLYPHS 64
+
+typedef struct {
+  uint32_t ui32_hits;
+  uint32_t ui32_misses;
+  uint32_t ui32_hit_cycles; // total cycles drawing glyphs from the cache
+  uint32_t ui32_miss_cycles; // total cycles decoding and caching glyphs
+  uint32_t ui32_cycles_per_glyph; // over the last GLYPH_CACHE_STATS_GLYPHS glyphs
+  uint8_t ui8_hit_percent; // same
+} glyph_cache_stats_t;
+
+extern glyph_cache_stats_t g_glyph_cache_stats;
+
+// Called by _UG_PutChar() after the FILL_AREA window is set: draws the glyph with p_fill_run and returns true if it
+// is cached, otherwise replaces *p_push_pixel with one that also records the glyph and glyph_cache_end() must be
+// called once all its pixels were pushed
+bool glyph_cache_begin(const UG_FONT *p_font, uint8_t ui8_char, UG_COLOR fc, UG_COLOR bc,
+    void (**p_push_pixel)(UG_COLOR), void (*p_fill_run)(UG_COLOR, UG_U16));
+void glyph_cache_end(void);
+
+#endif /* _GLYPH_CACHE_H_ */
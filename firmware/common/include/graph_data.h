@@ -0,0 +1,79 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _GRAPH_DATA_H_
+#define _GRAPH_DATA_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// the points of a graph, one per column
+#define GRAPH_MAX_POINTS	247
+
+// Each level is a timescale: level 0 gets a point every GRAPH_DATA_INTERVAL_MS, each point of level n is the mean
+// of GRAPH_LEVEL_FACTOR_n points of level n - 1, so 15 minutes, 1 hour and 4 hours. A factor can be any from 2 up.
+// There is no 8 hours scale, it would be another level (a factor of 2) with its points for every graph, nor a 30
+// seconds one, its points would come faster than the GRAPH_DATA_INTERVAL_MS level 0 is filtered over
+#define GRAPH_LEVELS          3
+#ifndef GRAPH_LEVEL_FACTOR_1
+#define GRAPH_LEVEL_FACTOR_1  4
+#endif
+#ifndef GRAPH_LEVEL_FACTOR_2
+#define GRAPH_LEVEL_FACTOR_2  4
+#endif
+// the levels above 0 only keep the points older than what the level below still has, the newest ones are made
+// from the level below when read
+#define GRAPH_LEVEL_POINTS(factor) (GRAPH_MAX_POINTS - GRAPH_MAX_POINTS / (factor))
+// level 0, point n is at n % GRAPH_MAX_POINTS, then each level above the same way
+#define GRAPH_STORED_POINTS (GRAPH_MAX_POINTS + GRAPH_LEVEL_POINTS(GRAPH_LEVEL_FACTOR_1) \
+    + GRAPH_LEVEL_POINTS(GRAPH_LEVEL_FACTOR_2))
+
+// GRAPH_LEVEL_FACTOR_n of each level, 1 for level 0
+extern const uint8_t ui8_g_graph_level_factor[GRAPH_LEVELS];
+
+// Where a graph keeps its points: each is stored as value - offset in an int8_t, int16_t or int32_t, the smallest
+// that holds the values of its variable. Values out of the range are saturated
+typedef struct {
+  void *points; // GRAPH_STORED_POINTS of them
+  uint8_t size; // of a point, in bytes
+  int32_t offset;
+} GraphStore;
+
+// For the graph fields, the points are a file scope compound literal like FieldRW. Building with
+// GRAPH_POINTS_INT32 stores all of them as int32_t, to compare with
+#ifdef GRAPH_POINTS_INT32
+#define GRAPH_STORE(type, offs) { .points = (int32_t [GRAPH_STORED_POINTS]){ 0 }, .size = sizeof(int32_t), .offset = 0 }
+#else
+#define GRAPH_STORE(type, offs) { .points = (type [GRAPH_STORED_POINTS]){ 0 }, .size = sizeof(type), .offset = (offs) }
+#endif
+
+// The points of each level are also counted in blocks that keep the max/min of their points, so the max/min of a
+// level are found from GRAPH_BLOCKS summaries and at most GRAPH_BLOCK_POINTS - 1 points, not all GRAPH_MAX_POINTS
+#define GRAPH_BLOCK_POINTS 32
+#define GRAPH_BLOCKS ((GRAPH_MAX_POINTS - 1) / GRAPH_BLOCK_POINTS + 2) // the most a level's points can span
+
+typedef struct {
+  GraphStore store;
+  int32_t discarded_sum[GRAPH_LEVELS - 1]; // of the points discarded by the level below for the next point
+  int32_t made_sum[GRAPH_LEVELS - 1]; // of the points made by the level below for the next point
+  uint32_t pushed; // points of level 0 so far
+  int32_t sum; // of the realtime samples for the next point
+  int32_t min_threshold; // points under it are ignored for the min
+  int32_t block_max[GRAPH_LEVELS][GRAPH_BLOCKS]; // of the points made in each block so far, the ring of blocks
+  int32_t block_min[GRAPH_LEVELS][GRAPH_BLOCKS]; // of a level goes round like its points
+} GraphData;
+
+// The points go to p_store, NULL for a graph without points yet
+void graph_data_init(GraphData *p_graph, const GraphStore *p_store, int32_t i32_min_threshold);
+void graph_data_push(GraphData *p_graph, int32_t i32_value);
+// The points of a level there are, up to GRAPH_MAX_POINTS
+uint16_t graph_data_points(const GraphData *p_graph, uint8_t ui8_level);
+// One of them, 0 is the oldest
+int32_t graph_data_point(const GraphData *p_graph, uint8_t ui8_level, uint16_t ui16_point);
+// Their max/min, INT32_MIN/INT32_MAX if none. Points under the min threshold are ignored for the min
+void graph_data_max_min(const GraphData *p_graph, uint8_t ui8_level, int32_t *p_max, int32_t *p_min);
+
+#endif /* _GRAPH_DATA_H_ */
@@ -0,0 +1,54 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _LAST_GASP_H_
+#define _LAST_GASP_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * The odometer and Wh are only saved with the other settings when the display is turned off, a battery pulled
+ * while riding would lose them. The supply supervisor (850C PVD, SW102 POFWARN) calls last_gasp_save() when the
+ * supply starts to fall, which programs them as a record of a few words to a flash area that is kept erased, so
+ * it fits in the time the supply capacitors hold the MCU up. At next boot the newest record is merged into the
+ * settings.
+ */
+#ifdef SW102
+#define LAST_GASP_AREA_WORDS  16 // the data of an FDS record, next to the settings in the 3 FDS pages
+#else
+#define LAST_GASP_AREA_WORDS  512 // a 2 kbytes page
+#endif
+
+// odometer, Wh, magic and CRC, merged. The last word is left erased and programmed to 0 once the record is merged
+#define LAST_GASP_RECORD_WORDS 4
+#define LAST_GASP_RECORDS     (LAST_GASP_AREA_WORDS / LAST_GASP_RECORD_WORDS)
+#define LAST_GASP_WRITE_WORDS 3 // programmed by last_gasp_save()
+
+typedef struct {
+  uint32_t ui32_odometer_x10;
+  uint32_t ui32_wh_x10;
+} last_gasp_record_t;
+
+// Find the newest record and the free space, erase the area if it is more than half used and has nothing to merge
+void last_gasp_init(void);
+// The newest record not merged yet, false if none
+bool last_gasp_read(last_gasp_record_t *p_record);
+// The settings with the counters of the newest record were saved, or newer ones: mark it merged
+void last_gasp_merged(void);
+// From the supply supervisor interrupt, the supply is going away
+void last_gasp_save(uint32_t ui32_odometer_x10, uint32_t ui32_wh_x10);
+
+// Provided by the platform: the area is memory mapped, erased to 0xffffffff and programmed a word at a time, it is
+// NULL if there is no flash for it. The program from last_gasp_save() interrupts the main loop, maybe in the
+// middle of another flash write or erase.
+const uint32_t* last_gasp_hw_area(void);
+bool last_gasp_hw_erase(void);
+bool last_gasp_hw_program(uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num);
+// Turn the supply supervisor interrupt on or off
+void last_gasp_hw_enable(bool enable);
+
+#endif /* _LAST_GASP_H_ */
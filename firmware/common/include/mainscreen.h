@@ -2,7 +2,7 @@
 
 #include "screen.h"
 
-void main_idle(); // call every 20ms
+bool main_idle(); // call each time the main thread wakes up, see events.h
 bool mainscreen_onpress(buttons_events_t events);
 void showNextScreen();
 
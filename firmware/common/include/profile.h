@@ -0,0 +1,65 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _PROFILE_H_
+#define _PROFILE_H_
+
+#include <stdint.h>
+#include "screen.h"
+
+// Time spent in the main loop, the screen rendering and the realtime layer, shown on diagnosticsScreen. On the 850C
+// this uses the DWT cycle counter, on the SW102 the RTC1 counter of the app_timer (30.5us resolution), on the sim
+// the host clock in ns.
+#if defined(SIM)
+#define PROFILE_TICKS_TO_US(t) ((t) / 1000)
+#define PROFILE_TICKS_MASK     0xffffffff
+#elif defined(SW102)
+#define PROFILE_TICKS_TO_US(t) ((uint64_t) (t) * 15625 / 512) // 1000000 / 32768
+#define PROFILE_TICKS_MASK     0x00ffffff // RTC1 is a 24 bits counter
+#else
+#define PROFILE_TICKS_TO_US(t) ((t) / 128) // 128MHz
+#define PROFILE_TICKS_MASK     0xffffffff
+#endif
+
+typedef enum {
+  PROFILE_MAIN_IDLE,
+  PROFILE_SCREEN_CLOCK,
+  PROFILE_SCREEN_UPDATE,
+  PROFILE_RENDER_LAYOUTS,
+  PROFILE_RENDER_FIELD, // one for each FieldVariant, up to FieldEnd
+  PROFILE_COMMUNICATIONS = PROFILE_RENDER_FIELD + FieldEnd + 1,
+  PROFILE_RT_PROCESSING,
+  PROFILE_POINTS
+} profile_point_t;
+
+// Bucket i counts the times under 64us << (3 * i): 64us, 512us, 4ms, 32ms and the last one all the longer ones
+#define PROFILE_BUCKETS 5
+
+typedef struct {
+  uint32_t ui32_count;
+  uint32_t ui32_min_us;
+  uint32_t ui32_max_us;
+  uint64_t ui64_total_us;
+  uint32_t ui32_buckets[PROFILE_BUCKETS];
+} profile_stats_t;
+
+extern profile_stats_t g_profile_stats[PROFILE_POINTS];
+extern const char *const g_profile_names[PROFILE_POINTS];
+
+// Provided by the platform: a free running counter, see PROFILE_TICKS_TO_US
+uint32_t profile_hw_ticks(void);
+
+static inline uint32_t profile_begin(void) {
+  return profile_hw_ticks();
+}
+
+/// Account the time since ui32_start, that profile_begin() returned, to point
+void profile_end(profile_point_t point, uint32_t ui32_start);
+void profile_reset(void);
+
+extern Screen diagnosticsScreen;
+
+#endif /* _PROFILE_H_ */
@@ -0,0 +1,118 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _RIDE_LOG_H_
+#define _RIDE_LOG_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "state.h"
+
+// How often a sample is taken, a multiple of the 100ms rt_processing() tick
+#ifndef RIDE_LOG_INTERVAL_MS
+#ifdef SW102
+#define RIDE_LOG_INTERVAL_MS 10000 // FDS only has room for a few blocks, see ride_log_fds.c
+#else
+#define RIDE_LOG_INTERVAL_MS 1000
+#endif
+#endif
+
+// Bit n logs channel n of RIDE_LOG_CHANNEL_LIST
+#ifndef RIDE_LOG_CHANNELS
+#define RIDE_LOG_CHANNELS 0xffff
+#endif
+
+// The samples are stored in blocks of this many words, each one is written to flash at once
+#define RIDE_LOG_BLOCK_WORDS 64
+
+// The 850C (and the sim) keep the blocks in a ring of flash pages, the SW102 in the few FDS records there is room for
+#define RIDE_LOG_PAGES       64  // 128 kbytes
+#define RIDE_LOG_PAGE_WORDS  512 // 2 kbytes pages
+
+// name, rt_vars_t field, divisor to get the unit
+#define RIDE_LOG_CHANNEL_LIST(X) \
+  X(speed_kmh, ui16_wheel_speed_x10, 10) \
+  X(battery_v, ui16_battery_voltage_filtered_x10, 10) \
+  X(battery_a, ui16_battery_current_filtered_x5, 5) \
+  X(battery_w, ui16_battery_power_filtered, 1) \
+  X(pedal_w, ui16_pedal_power_filtered, 1) \
+  X(cadence_rpm, ui8_pedal_cadence_filtered, 1) \
+  X(motor_temp_c, ui8_motor_temperature, 1) \
+  X(assist_level, ui8_assist_level, 1) \
+  X(energy_wh, ui32_wh_x10, 10) \
+  X(odometer_km, ui32_odometer_x10, 10)
+
+typedef enum {
+#define RIDE_LOG_CHANNEL_ENUM(name, field, divisor) RIDE_LOG_CHANNEL_##name,
+  RIDE_LOG_CHANNEL_LIST(RIDE_LOG_CHANNEL_ENUM)
+  RIDE_LOG_CHANNELS_NUM
+} ride_log_channel_t;
+
+#define RIDE_LOG_BLOCK_MAGIC 0x4c52 // "RL"
+#define RIDE_LOG_FLAG_BOOT   1      // the first block since the display was turned on, a new ride
+
+/*
+ * A block is this header and then the samples. Each sample is a varint with the bits of the channels that changed
+ * since the previous sample, then for each of them the zigzag varint of the difference. The first sample of a
+ * block is a difference from 0, so every block can be decoded alone.
+ */
+typedef struct {
+  uint16_t ui16_magic;
+  uint16_t ui16_crc; // CRC16 of the whole block, with this field 0
+  uint32_t ui32_seq; // counts the blocks since the log was first used
+  uint32_t ui32_time_s; // seconds since the display was turned on, of the first sample
+  uint16_t ui16_interval_ms;
+  uint16_t ui16_channels;
+  uint16_t ui16_samples;
+  uint16_t ui16_bytes; // of samples
+  uint8_t ui8_flags;
+  uint8_t ui8_reserved[3];
+} ride_log_header_t;
+
+#define RIDE_LOG_HEADER_WORDS (sizeof(ride_log_header_t) / sizeof(uint32_t))
+#define RIDE_LOG_BLOCK_BYTES  (RIDE_LOG_BLOCK_WORDS * sizeof(uint32_t))
+
+void ride_log_init(void);
+// From rt_processing(), every REALTIME_INTERVAL_MS
+void ride_log_sample(const rt_vars_t *p_rt_vars);
+// The EVENT_RIDE_LOG handler, stores the filled blocks a bit at a time
+void ride_log_flush(void);
+// Store what is logged so far before the power goes away, blocks until done
+void ride_log_power_off(void);
+// From the main loop when it has no events to handle, prepares the flash for the next block
+void ride_log_idle(void);
+
+extern uint32_t ui32_g_ride_log_samples_dropped; // because flash was still busy with the previous block
+
+// Magic, length and CRC are right
+bool ride_log_block_valid(const uint32_t *p_block);
+// Calls cb with the values of each sample of a block, false if the block is not valid
+typedef void (*ride_log_sample_cb_t)(void *p_context, const ride_log_header_t *p_header, uint16_t ui16_sample,
+    const uint32_t ui32_values[RIDE_LOG_CHANNELS_NUM]);
+bool ride_log_decode(const uint32_t *p_block, ride_log_sample_cb_t cb, void *p_context);
+
+// Where the blocks are stored, provided by ride_log_flash.c or the platform (SW102)
+typedef struct {
+  uint32_t ui32_a;
+  uint32_t ui32_b;
+} ride_log_iter_t;
+
+// Find the blocks already stored, return the sequence number for the next one
+uint32_t ride_log_store_init(void);
+// Call with the same block until it returns true, each call only blocks the main loop for a short time
+bool ride_log_store_write(const uint32_t *p_block);
+// The stored blocks, oldest first (SW102: in storage order). Zero the iterator to start, NULL at the end
+const uint32_t* ride_log_store_next(ride_log_iter_t *p_iter);
+// Erase ahead what the next block needs, so ride_log_store_write() doesn't have to. May block for a page erase
+void ride_log_store_prepare(void);
+
+// For ride_log_flash.c, provided by the platform: the pages are memory mapped, erased to 0xffffffff and programmed a
+// word at a time
+const uint32_t* ride_log_hw_page(uint16_t ui16_page);
+bool ride_log_hw_erase(uint16_t ui16_page);
+bool ride_log_hw_program(uint16_t ui16_page, uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num);
+
+#endif /* _RIDE_LOG_H_ */
@@ -6,6 +6,7 @@
 #include "ugui.h"
 #include "buttons.h"
 #include "main.h"
+#include "graph_data.h"
 
 /**
  * Main screen notes
@@ -143,11 +144,7 @@ typedef enum {
   ConvertFromImperial_mass,
 } ConvertUnitsType;
 
-// max points for hold up to 3 differents records of each variables, possible 15 minutes, 1 hour and 4 hours
-#define GRAPH_MAX_POINTS	247 // Note: we waste one record, to make our ring buffer code easier
-#define GRAPH_DATA_0_INTERVAL_MS 	3644 // graph updates are expensive - do rarely (247 * 3.644 seconds = 15 minutes)
-#define GRAPH_DATA_1_INTERVAL_MS  14575 // graph updates are expensive - do rarely (247 * 14.575 seconds = 1h minutes)
-#define GRAPH_DATA_2_INTERVAL_MS  58300 // graph updates are expensive - do rarely (247 * 58.300 seconds = 4h minutes)
+#define GRAPH_DATA_INTERVAL_MS 	3644 // graph updates are expensive - do rarely (247 * 3.644 seconds = 15 minutes, the other levels are 4 and 16 times that)
 #define GRAPH_COLOR_ACCENT  C_WHITE // Drawn as a top line on the graph
 #define GRAPH_COLOR_NORMAL  C_BLUE
 #define GRAPH_COLOR_WARN    C_YELLOW
@@ -159,9 +156,6 @@ typedef enum {
 #define GRAPH_XAXIS_FONT   SMALL_TEXT_FONT
 #define GRAPH_GRAPH_LABEL_OFFSET 12
 
-// Assumed period of screenUpdate invoke
-#define UPDATE_INTERVAL_MS 100
-
 // Real time period
 #define REALTIME_INTERVAL_MS 100
 
@@ -215,17 +209,6 @@ typedef struct {
   int32_t min;
 } GraphVars; // this should not be plural
 
-typedef struct {
-  int32_t points[GRAPH_MAX_POINTS];
-  int32_t max_val, min_val; // the max/min value we've seen (ever)
-  int32_t max_val_bck, min_val_bck;
-  int32_t start_valid; // the oldest point in our ring buffer
-  int32_t end_valid; // the newest point in our ring buffer
-  int32_t sum;
-  int32_t max;
-  int32_t min;
-} GraphData;
-
 typedef enum {
 	FilterDefault = 0,
 	FilterSquare
@@ -242,6 +225,7 @@ typedef struct {
   bool dirty :1; // true if this data has changed and needs to be rerendered
   bool blink :1; // if true, we should invoke the render function for this field every 500ms (or whatever the blink interval is) to possibly toggle animations on/off
   bool is_selected :1; // if true this field is currently selected by the user (either in a scrollable or actively editing it)
+  uint8_t watch :7; // editables: 0 until rendered, then 1 if the target is not written by copy_rt_to_ui_vars(), else 2 + its ui_vars_watch_index()
   // bool is_rendered : 1; // true if we're showing this field on the current screen (if false, some fieldPrintf work can be avoided
 
   union {
@@ -266,11 +250,10 @@ typedef struct {
     } editable;
 
     struct {
-      uint8_t x_axis_scale; // x axis scale
+      uint8_t x_axis_scale; // x axis scale, the level of data shown
       graph_x_axis_scale_config_t x_axis_scale_config : 4; // x axis scale configuration
 
-      // FIXME the following array should really be a single ptr to a set of cached data. To save ram because we create many of these FieldRW objects
-      GraphData *data[3]; // cached data for this graph - FIXME @casainho - it would be good to document this magic 3 constant and why it is there, even better to make into #def for NUM_TIMESCALES
+      GraphData *data; // cached data for this graph, all of the GRAPH_LEVELS timescales
     } graph;
   };
 } FieldRW;
@@ -298,6 +281,7 @@ typedef const struct Field {
 			FilterOp filter : 2; // allow 4 options for now
       graph_auto_max_min_t auto_max_min : 1;
 			int32_t min_threshold; // if value is less than this, it is ignored for purposes of calculating min/average - useful for ignoring speed/cadence when stopped
+			GraphStore store; // the points, GRAPH_STORE() with the smallest type for the values of source
 		} graph;
 
 		struct {
@@ -462,6 +446,7 @@ typedef struct FieldLayout {
 	const UG_FONT *font; // If this field requires a font, use this.  Or if NULL auto select the biggest font that can hold the string
 
 	uint32_t old_editable; // a cache value only used for editable fields, used to compare against previous values and redraw if needed.
+	uint8_t old_editable_len; // strlen of the old_editable string, if it changes the whole field is redrawn
 
 } FieldLayout;
 
@@ -517,11 +502,16 @@ extern bool screenConvertPounds;
 extern variables_t g_vars[VARS_SIZE];  // this is needed to be used on configurations otherwise I could not make code build
 #ifndef SW102
 extern GraphVars g_graphVars[VARS_SIZE]; // this is needed to be used on configurations otherwise I could not make code build
-extern GraphData g_graphData[VARS_SIZE][3];
+extern GraphData g_graphData[VARS_SIZE];
 #endif
 
 void fieldPrintf(Field *field, const char *fmt, ...);
 
+extern uint32_t ui32_g_lcd_pixels_written; // total pixels sent to the LCD since boot, counted by the LCD driver
+extern uint32_t ui32_g_screen_frame_pixels; // pixels sent to the LCD by the last screenUpdate()
+extern uint32_t ui32_g_editables_formatted; // editable values formatted to a string since boot
+extern uint32_t ui32_g_editables_skipped; // editable values not formatted nor drawn because they didn't change, since boot
+
 /// Update this readonly editable with a string value.  Important: the original field target must be pointing to a WRITABLE array, not a const string.
 void updateReadOnlyStr(Field *field, const char *str);
 
@@ -541,7 +531,7 @@ extern const UG_FONT *editable_units_font;
 
 extern uint8_t g_customizableFieldIndex;
 
-extern volatile bool g_graphs_ui_update[3];
+extern volatile bool g_graphs_ui_update[GRAPH_LEVELS];
 
 // The default is for editables to be two rows tall, with the data value on the second row
 // define this as 1 if you want them to be one row tall (because you have a wide enough screen)
@@ -570,6 +560,7 @@ extern volatile bool g_graphs_ui_update[3];
 #define SCREENCLICK_EXIT_SCROLLABLE ONOFF_CLICK
 #define SCREENCLICK_NEXT_SCREEN ONOFF_CLICK
 #define SCREENCLICK_ENTER_CONFIGURATIONS ONOFF_CLICK_LONG_CLICK
+#define SCREENCLICK_DIAGNOSTICS DOWN_CLICK_LONG_CLICK
 
 #define SCREENCLICK_START_CUSTOMIZING UPDOWN_CLICK
 #define SCREENCLICK_STOP_CUSTOMIZING ONOFF_LONG_CLICK
@@ -580,6 +571,7 @@ extern volatile bool g_graphs_ui_update[3];
 #define SCREENCLICK_STOP_EDIT ONOFF_CLICK
 #define SCREENCLICK_EXIT_SCROLLABLE ONOFF_LONG_CLICK
 #define SCREENCLICK_ENTER_CONFIGURATIONS ONOFF_CLICK_LONG_CLICK
+#define SCREENCLICK_DIAGNOSTICS DOWN_CLICK_LONG_CLICK
 
 #define SCREENCLICK_START_CUSTOMIZING UPDOWN_CLICK
 #define SCREENCLICK_STOP_CUSTOMIZING ONOFF_LONG_CLICK
@@ -0,0 +1,50 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _SEQLOCK_H_
+#define _SEQLOCK_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/*
+ * Sequence counter for data written by one side and read by the other, without either side ever waiting:
+ *
+ *   writer:  seqlock_write_begin(&seq); ...write the data...; seqlock_write_end(&seq);
+ *   reader:  do { s = seqlock_read_begin(&seq); ...copy the data...; } while (seqlock_read_retry(&seq, s));
+ *
+ * The counter is odd while the data is being written. A reader that was interrupted by the writer, or ran
+ * concurrently with it, sees the counter changed and copies again. There can only be one writer.
+ */
+typedef volatile uint32_t seqlock_t;
+
+static inline void seqlock_write_begin(seqlock_t *p_seq)
+{
+  (*p_seq)++;
+  __sync_synchronize();
+}
+
+static inline void seqlock_write_end(seqlock_t *p_seq)
+{
+  __sync_synchronize();
+  (*p_seq)++;
+}
+
+static inline uint32_t seqlock_read_begin(const seqlock_t *p_seq)
+{
+  uint32_t ui32_seq = *p_seq;
+
+  __sync_synchronize();
+  return ui32_seq;
+}
+
+static inline bool seqlock_read_retry(const seqlock_t *p_seq, uint32_t ui32_seq)
+{
+  __sync_synchronize();
+  return (ui32_seq & 1) || (*p_seq != ui32_seq);
+}
+
+#endif /* _SEQLOCK_H_ */
@@ -318,6 +318,12 @@ void rt_processing_start(void);
  */
 void copy_rt_to_ui_vars(void);
 
+/// A bit for each ui_vars member copy_rt_to_ui_vars() wrote with a new value, cleared by screenUpdate() once drawn
+extern uint64_t ui64_g_ui_vars_changed;
+
+/// The bit of a ui_vars member in ui64_g_ui_vars_changed, -1 if copy_rt_to_ui_vars() doesn't write it
+int8_t ui_vars_watch_index(const void *p_member);
+
 /// must be called from main() idle loop
 void automatic_power_off_management(void);
 
@@ -0,0 +1,50 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#ifndef _UART_RX_QUEUE_H_
+#define _UART_RX_QUEUE_H_
+
+#include <stdint.h>
+
+// Number of complete motor frames the UART ISR can queue while communications() is busy, must be a power of 2
+// and at least 2
+#define UART_RX_QUEUE_FRAMES 4
+
+// What to do with a new frame when the queue is full: 1 replaces the newest queued frame (the motor frames are
+// state snapshots, so the newest one has the most useful data), 0 drops the new frame and keeps the queued ones
+#define UART_RX_QUEUE_LATEST_WINS 1
+
+typedef struct {
+  uint32_t ui32_received; // frames that passed the CRC check
+  uint32_t ui32_lost; // frames dropped or overwritten because the queue was full
+  uint32_t ui32_crc_errors; // frames with a wrong CRC or length
+  uint32_t ui32_overruns; // times received bytes were lost before reaching the parser (UART/DMA overrun)
+  uint8_t ui8_max_queued; // high water mark of the queue
+} uart_rx_queue_stats_t;
+
+extern uart_rx_queue_stats_t g_uart_rx_queue_stats;
+
+void uart_rx_queue_push(const uint8_t *p_frame);
+const uint8_t* uart_rx_queue_pop(void);
+void uart_rx_queue_parse(const uint8_t *p_data, uint16_t ui16_len);
+void uart_rx_queue_overrun(void);
+
+// A circular buffer that a DMA channel receives into (850C), the ISRs only track its position and the bytes are
+// parsed later in thread context
+typedef struct {
+  uint8_t *p_buffer;
+  uint16_t ui16_size; // must be a power of 2
+  volatile uint32_t ui32_written; // free running count of bytes written by the DMA, updated by the ISRs
+  uint16_t ui16_last_pos; // only used by the ISRs
+  uint32_t ui32_read; // free running count of bytes parsed
+} uart_rx_dma_ring_t;
+
+// From the DMA half/full transfer and the USART idle line ISRs, with the buffer index the DMA writes next
+void uart_rx_dma_ring_update(uart_rx_dma_ring_t *p_ring, uint16_t ui16_pos);
+// Parse the bytes the DMA wrote since the last call, the producer of the queue
+void uart_rx_dma_ring_parse(uart_rx_dma_ring_t *p_ring);
+
+#endif /* _UART_RX_QUEUE_H_ */
@@ -26,9 +26,25 @@
 typedef enum
 {
 	FONT_TYPE_1BPP,
-	FONT_TYPE_8BPP
+	FONT_TYPE_8BPP,
+	FONT_TYPE_RLE
 } FONT_TYPE;
 
+/* FONT_TYPE_RLE: the pixels of each glyph, row after row over its width, as runs. A run byte holds the
+ * run length - 1 in the low 6 bits and the type in the top 2 bits: back color, fore color, one alpha byte
+ * follows for all pixels or one alpha byte follows for each pixel. offsets has the start of each glyph in p
+ * and, after the last one, the end of the data. */
+#define FONT_RLE_TYPE_MASK                            0xC0
+#define FONT_RLE_BC                                   0x00
+#define FONT_RLE_FC                                   0x40
+#define FONT_RLE_ALPHA                                0x80
+#define FONT_RLE_ALPHAS                               0xC0
+#define FONT_RLE_MAX_LEN                              64
+
+/* Anti-aliased glyphs: the alpha 0..255 of a pixel is rounded to a level of UG_BlendTable() */
+#define UG_BLEND_LEVELS                               32
+#define UG_BLEND_LEVEL(a)                             (((a) * UG_BLEND_LEVELS + 128) >> 8)
+
 typedef struct
 {
    unsigned char* p;
@@ -38,6 +54,7 @@ typedef struct
    UG_U16 start_char;
    UG_U16 end_char;
    UG_U8  *widths;
+   const UG_U16 *offsets; /* FONT_TYPE_RLE only */
 } UG_FONT;
 
 #ifdef USE_FONT_4X6
@@ -547,10 +564,11 @@ typedef struct
 #define DRIVER_ENABLED                                (1<<1)
 
 /* Supported drivers */
-#define NUMBER_OF_DRIVERS                             3
+#define NUMBER_OF_DRIVERS                             4
 #define DRIVER_DRAW_LINE                              0
 #define DRIVER_FILL_FRAME                             1
 #define DRIVER_FILL_AREA                              2
+#define DRIVER_FILL_RUN                               3 // void fill_run(UG_COLOR c, UG_U16 len): len pixels of c in the FILL_AREA window
 
 /* -------------------------------------------------------------------------------- */
 /* -- µGUI CORE STRUCTURE                                                        -- */
@@ -882,6 +900,7 @@ typedef struct
 UG_S16 UG_Init( UG_GUI* g, void (*p)(UG_S16,UG_S16,UG_COLOR), UG_S16 x, UG_S16 y );
 UG_S16 UG_SelectGUI( UG_GUI* g );
 void UG_FontSelect( const UG_FONT* font );
+const UG_COLOR* UG_BlendTable( UG_COLOR fc, UG_COLOR bc );
 void UG_FillScreen( UG_COLOR c );
 void UG_FillFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c );
 void UG_FillRoundFrame( UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_S16 r, UG_COLOR c );
@@ -88,6 +88,9 @@
 
 #define LABEL_COLOR MAIN_SCREEN_FIELD_LABELS_COLOR
 
+// Keep the glyphs drawn as runs of pixels, see glyph_cache.c, only used if the driver registers DRIVER_FILL_RUN
+#define USE_GLYPH_CACHE
+
 #endif
 
 // #define  USE_FONT_4X6
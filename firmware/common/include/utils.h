@@ -9,11 +9,19 @@
 #ifndef _UTILS_H
 #define _UTILS_H
 
+#include <stdint.h>
+
+// CRC16 implementation: 256 (fastest, 512 bytes of flash), 16 (32 bytes of flash) or 0 (bitwise, no table)
+#ifndef CRC16_TABLE_SIZE
+#define CRC16_TABLE_SIZE 256
+#endif
+
 int32_t map(int32_t x, int32_t in_min, int32_t in_max, int32_t out_min,
 		int32_t out_max);
 uint8_t ui8_max(uint8_t value_a, uint8_t value_b);
 uint8_t ui8_min(uint8_t value_a, uint8_t value_b);
 void crc16(uint8_t ui8_data, uint16_t *ui16_crc);
+uint16_t crc16_update(uint16_t ui16_crc, const uint8_t *p_data, uint16_t ui16_len);
 uint8_t* itoa(uint32_t ui32_i);
 //void ftoa(float n, char *res, int afterpoint);
 
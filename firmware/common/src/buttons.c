@@ -10,30 +10,126 @@
 
 #include "buttons.h"
 #include "state.h"
+#include "timer.h"
+#include "events.h"
+
+/*
+ * Every button runs the same state machine, m_transitions: each state is left either when the button was held in
+ * it for a timeout since its last level change, or on a level change, whichever came first. The edge interrupts
+ * (EXTI on the 850C, GPIOTE PORT on the SW102) wake up the main loop right away and timestamp the change, so
+ * the thresholds are measured from when the button moved and not from the next buttons_clock().
+ */
 
 #define TIME_1 1500 // changed to 1.5 sec because 2 secs seems too long to me and a user asked for it also
 #define TIME_2 200
 #define TIME_3 300
 #define TIME_4 1500
 
-#define BUTTONS_CLOCK_MS 20
-#define MS_TO_TICKS(a) ((a) / (BUTTONS_CLOCK_MS))
-
-static uint32_t ui32_onoff_button_state = 0;
-static uint32_t ui32_onoff_button_state_counter = 0;
-static uint32_t ui32_down_button_state = 0;
-static uint32_t ui32_down_button_state_counter = 0;
-static uint32_t ui32_up_button_state = 0;
-static uint32_t ui32_up_button_state_counter = 0;
-static uint32_t ui32_m_button_state = 0;
-static uint32_t ui32_m_button_state_counter = 0;
+// a level change is only taken this long after the previous one, the contacts bounce
+#define DEBOUNCE_MS BUTTONS_CLOCK_MS
+
+typedef enum {
+	STATE_IDLE = 0,
+	STATE_PRESSED, // for less than TIME_2, releasing now might start a click + long click
+	STATE_HELD, // for more than TIME_2
+	STATE_WAIT_RELEASE, // the event was sent, nothing else until the button is released
+	STATE_RELEASED, // after a short press, waiting TIME_3 for the second press of a click + long click
+	STATE_PRESSED_AGAIN, // the second press
+} button_state_t;
+
+// index in button_t.events
+typedef enum {
+	EV_NONE = 0,
+	EV_CLICK,
+	EV_CLICK_LONG_CLICK,
+	EV_LONG_CLICK,
+	EV_NUM
+} button_event_t;
+
+typedef struct {
+	bool pressed; // the level the button is at in this state, the other one is a level change
+	uint16_t ui16_timeout_ms; // 0 for none
+	uint8_t ui8_timeout_event;
+	uint8_t ui8_timeout_state; // the timeouts are from the last level change, they don't restart the time
+	uint8_t ui8_change_event;
+	uint8_t ui8_change_state;
+} button_transitions_t;
+
+static const button_transitions_t m_transitions[] = {
+	[STATE_IDLE] =          { false, 0,      EV_NONE,             0,                  EV_NONE,  STATE_PRESSED },
+	[STATE_PRESSED] =       { true,  TIME_2, EV_NONE,             STATE_HELD,         EV_NONE,  STATE_RELEASED },
+	[STATE_HELD] =          { true,  TIME_1, EV_LONG_CLICK,       STATE_WAIT_RELEASE, EV_CLICK, STATE_IDLE },
+	[STATE_WAIT_RELEASE] =  { true,  0,      EV_NONE,             0,                  EV_NONE,  STATE_IDLE },
+	[STATE_RELEASED] =      { false, TIME_3, EV_CLICK,            STATE_IDLE,         EV_NONE,  STATE_PRESSED_AGAIN },
+	[STATE_PRESSED_AGAIN] = { true,  TIME_4, EV_CLICK_LONG_CLICK, STATE_WAIT_RELEASE, EV_CLICK, STATE_IDLE },
+};
+
+typedef enum {
+	BUTTON_ONOFF = 0,
+	BUTTON_M,
+	BUTTON_UP,
+	BUTTON_DOWN,
+	BUTTONS_NUM
+} button_id_t;
+
+typedef struct {
+	uint32_t (*get_state)(void);
+	buttons_events_t events[EV_NUM];
+	int8_t i8_chord; // holding this one too turns the long click into UPDOWN_CLICK, -1 for none
+} button_t;
+
+static const button_t m_buttons[BUTTONS_NUM] = {
+	[BUTTON_ONOFF] = { buttons_get_onoff_state, { 0, ONOFF_CLICK, ONOFF_CLICK_LONG_CLICK, ONOFF_LONG_CLICK }, -1 },
+	[BUTTON_M] = { buttons_get_m_state, { 0, M_CLICK, M_CLICK_LONG_CLICK, M_LONG_CLICK }, -1 },
+	[BUTTON_UP] = { buttons_get_up_state, { 0, UP_CLICK, UP_CLICK_LONG_CLICK, UP_LONG_CLICK }, BUTTON_DOWN },
+	[BUTTON_DOWN] = { buttons_get_down_state, { 0, DOWN_CLICK, DOWN_CLICK_LONG_CLICK, DOWN_LONG_CLICK }, BUTTON_UP },
+};
+
+static uint8_t ui8_m_state[BUTTONS_NUM];
+static uint32_t ui32_m_changed_ms[BUTTONS_NUM]; // the last level change taken
 static uint32_t ui32_m_clear_event = 0;
+static volatile bool m_edge;
+static volatile uint32_t ui32_m_edge_ms; // the first edge interrupt since the last buttons_clock()
 buttons_events_t buttons_events = 0;
 
-#ifndef SW102
+#if defined(SIM)
+// the button states are provided by the host simulator, see sim/src/buttons_hw.c
+#elif !defined(SW102)
 #include "stm32f10x.h"
 #include "stm32f10x_gpio.h"
+#include "stm32f10x_exti.h"
 #include "pins.h"
+#include "main.h"
+
+#define BUTTONS_EXTI_LINES (BUTTON_UP__EXTI_LINE | BUTTON_ONOFF__EXTI_LINE | BUTTON_DOWN__EXTI_LINE)
+
+void EXTI15_10_IRQHandler(void) {
+	EXTI_ClearITPendingBit(BUTTONS_EXTI_LINES);
+	buttons_edge_irq();
+}
+
+void buttons_init(void) {
+	EXTI_InitTypeDef EXTI_InitStructure;
+	NVIC_InitTypeDef NVIC_InitStructure;
+
+	// pins_init() already enabled the AFIO clock
+	GPIO_EXTILineConfig(BUTTON_UP__PORT_SOURCE, BUTTON_UP__PIN_SOURCE);
+	GPIO_EXTILineConfig(BUTTON_ONOFF__PORT_SOURCE, BUTTON_ONOFF__PIN_SOURCE);
+	GPIO_EXTILineConfig(BUTTON_DOWN__PORT_SOURCE, BUTTON_DOWN__PIN_SOURCE);
+
+	EXTI_InitStructure.EXTI_Line = BUTTONS_EXTI_LINES;
+	EXTI_InitStructure.EXTI_Mode = EXTI_Mode_Interrupt;
+	EXTI_InitStructure.EXTI_Trigger = EXTI_Trigger_Rising_Falling;
+	EXTI_InitStructure.EXTI_LineCmd = ENABLE;
+	EXTI_Init(&EXTI_InitStructure);
+	EXTI_ClearITPendingBit(BUTTONS_EXTI_LINES);
+
+	NVIC_InitStructure.NVIC_IRQChannel = EXTI15_10_IRQn;
+	NVIC_InitStructure.NVIC_IRQChannelPreemptionPriority = BUTTONS_INTERRUPT_PRIORITY;
+	NVIC_InitStructure.NVIC_IRQChannelSubPriority = 1;
+	NVIC_InitStructure.NVIC_IRQChannelCmd = ENABLE;
+	NVIC_Init(&NVIC_InitStructure);
+}
 
 uint32_t buttons_get_up_state(void) {
 	if (ui_vars.ui8_buttons_up_down_invert) {
@@ -65,6 +161,25 @@ uint32_t buttons_get_m_state(void) {
 }
 #else
 #include "main.h"
+#include "app_error.h"
+#include "nrf_drv_gpiote.h"
+
+static void buttons_gpiote_handler(nrf_drv_gpiote_pin_t pin, nrf_gpiote_polarity_t action)
+{
+  buttons_edge_irq();
+}
+
+void buttons_init (void)
+{
+  if(!nrf_drv_gpiote_is_init())
+    APP_ERROR_CHECK(nrf_drv_gpiote_init());
+
+  // PORT events, they don't keep the HFCLK running like the IN channels would
+  ButtonSenseEdges(&buttonPWR, buttons_gpiote_handler);
+  ButtonSenseEdges(&buttonM, buttons_gpiote_handler);
+  ButtonSenseEdges(&buttonUP, buttons_gpiote_handler);
+  ButtonSenseEdges(&buttonDWN, buttons_gpiote_handler);
+}
 
 uint32_t buttons_get_up_state (void)
 {
@@ -101,128 +216,92 @@ uint32_t buttons_get_m_state (void)
 }
 #endif
 
-uint32_t buttons_get_m_click_event(void) {
-	return (buttons_events & M_CLICK) ? 1 : 0;
-}
-
-uint32_t buttons_get_m_long_click_event(void) {
-	return (buttons_events & M_LONG_CLICK) ? 1 : 0;
-}
-
-void buttons_clear_m_click_event(void) {
-	buttons_events &= ~M_CLICK;
-}
-
-uint32_t buttons_get_m_click_long_click_event(void) {
-	return (buttons_events & M_CLICK_LONG_CLICK) ? 1 : 0;
-}
-
-void buttons_clear_m_long_click_event(void) {
-	buttons_events &= ~M_LONG_CLICK;
-}
-
-void buttons_clear_m_click_long_click_event(void) {
-	buttons_events &= ~M_CLICK_LONG_CLICK;
-}
-
-uint32_t buttons_get_up_click_event(void) {
-	return (buttons_events & UP_CLICK) ? 1 : 0;
-}
-
-uint32_t buttons_get_up_long_click_event(void) {
-	return (buttons_events & UP_LONG_CLICK) ? 1 : 0;
-}
-
-void buttons_clear_up_click_event(void) {
-	buttons_events &= ~UP_CLICK;
-}
-
-uint32_t buttons_get_up_click_long_click_event(void) {
-	return (buttons_events & UP_CLICK_LONG_CLICK) ? 1 : 0;
-}
-
-void buttons_clear_up_long_click_event(void) {
-	buttons_events &= ~UP_LONG_CLICK;
+buttons_events_t buttons_get_events(void) {
+	return buttons_events;
 }
 
-void buttons_clear_up_click_long_click_event(void) {
-	buttons_events &= ~UP_CLICK_LONG_CLICK;
+void buttons_set_events(buttons_events_t events) {
+	buttons_events |= events;
 }
 
-uint32_t buttons_get_down_click_event(void) {
-	return (buttons_events & DOWN_CLICK) ? 1 : 0;
+void buttons_clear_events(buttons_events_t events) {
+	buttons_events &= ~events;
 }
 
-uint32_t buttons_get_down_long_click_event(void) {
-	return (buttons_events & DOWN_LONG_CLICK) ? 1 : 0;
-}
+void buttons_clear_all_events(void) {
+	ui32_m_clear_event = 1;
+	buttons_events = 0;
 
-void buttons_clear_down_click_event(void) {
-	buttons_events &= ~DOWN_CLICK;
+	for (int i = 0; i < BUTTONS_NUM; i++)
+		ui8_m_state[i] = STATE_IDLE;
 }
 
-void buttons_clear_down_click_long_click_event(void) {
-	buttons_events &= ~DOWN_CLICK_LONG_CLICK;
-}
+/// True while buttons_clock() has work to do: a button is pressed, a click is being timed or events wait to be handled
+bool buttons_busy(void) {
+	for (int i = 0; i < BUTTONS_NUM; i++)
+		if (ui8_m_state[i] != STATE_IDLE || m_buttons[i].get_state())
+			return true;
 
-uint32_t buttons_get_down_click_long_click_event(void) {
-	return (buttons_events & DOWN_CLICK_LONG_CLICK) ? 1 : 0;
+	return buttons_events || ui32_m_clear_event;
 }
 
-void buttons_clear_down_long_click_event(void) {
-	buttons_events &= ~DOWN_LONG_CLICK;
-}
+/// Called by the edge interrupt of any button
+void buttons_edge_irq(void) {
+	if (!m_edge) {
+		ui32_m_edge_ms = get_time_base_counter_1ms();
+		m_edge = true;
+	}
 
-uint32_t buttons_get_onoff_click_event(void) {
-	return (buttons_events & ONOFF_CLICK) ? 1 : 0;
+	event_post(EVENT_BUTTONS);
 }
 
-uint32_t buttons_get_onoff_long_click_event(void) {
-	return (buttons_events & ONOFF_LONG_CLICK) ? 1 : 0;
-}
+static void button_event(button_id_t button, button_event_t event) {
+	int8_t i8_chord = m_buttons[button].i8_chord;
 
-uint32_t buttons_get_onoff_click_long_click_event(void) {
-	return (buttons_events & ONOFF_CLICK_LONG_CLICK) ? 1 : 0;
-}
+	if (event == EV_NONE)
+		return;
 
-void buttons_clear_onoff_click_event(void) {
-	buttons_events &= ~ONOFF_CLICK;
+	// up and down button click
+	if (event == EV_LONG_CLICK && i8_chord >= 0
+			&& (ui8_m_state[i8_chord] == STATE_PRESSED || ui8_m_state[i8_chord] == STATE_HELD)) {
+		buttons_set_events(UPDOWN_CLICK);
+		ui8_m_state[i8_chord] = STATE_WAIT_RELEASE;
+	} else
+		buttons_set_events(m_buttons[button].events[event]);
 }
 
-void buttons_clear_onoff_click_long_click_event(void) {
-	buttons_events &= ~ONOFF_CLICK_LONG_CLICK;
-}
+static void button_clock(button_id_t button, uint32_t ui32_now, uint32_t ui32_edge_ms) {
+	bool pressed = m_buttons[button].get_state() != 0;
 
-void buttons_clear_onoff_long_click_event(void) {
-	buttons_events &= ~ONOFF_LONG_CLICK;
-}
+	while (true) {
+		const button_transitions_t *p_transitions = &m_transitions[ui8_m_state[button]];
+		bool changed = pressed != p_transitions->pressed;
+		uint32_t ui32_since = ui32_m_changed_ms[button];
 
-uint32_t buttons_get_up_down_click_event(void) {
-	return (buttons_events & UPDOWN_CLICK) ? 1 : 0;
-}
+		// the timeout wins if it expired before the level changed
+		if (p_transitions->ui16_timeout_ms && ui32_now - ui32_since > p_transitions->ui16_timeout_ms
+				&& (!changed || ui32_edge_ms - ui32_since > p_transitions->ui16_timeout_ms)) {
+			ui8_m_state[button] = p_transitions->ui8_timeout_state;
+			button_event(button, p_transitions->ui8_timeout_event);
+			continue; // the new state might take the level change
+		}
 
-void buttons_clear_up_down_click_event(void) {
-	buttons_events &= ~UPDOWN_CLICK;
-}
+		if (changed && ui32_now - ui32_since >= DEBOUNCE_MS) {
+			ui8_m_state[button] = p_transitions->ui8_change_state;
+			ui32_m_changed_ms[button] = ui32_edge_ms;
+			button_event(button, p_transitions->ui8_change_event);
+		}
 
-buttons_events_t buttons_get_events(void) {
-	return buttons_events;
+		return;
+	}
 }
 
-void buttons_set_events(buttons_events_t events) {
-	buttons_events |= events;
-}
+void buttons_clock(void) {
+	uint32_t ui32_now = get_time_base_counter_1ms();
+	uint32_t ui32_edge_ms = m_edge ? ui32_m_edge_ms : ui32_now;
 
-void buttons_clear_all_events(void) {
-	ui32_m_clear_event = 1;
-	buttons_events = 0;
-	ui32_onoff_button_state = 0;
-	ui32_up_button_state = 0;
-	ui32_down_button_state = 0;
-	ui32_m_button_state = 0;
-}
+	m_edge = false;
 
-void buttons_clock(void) {
 	// exit if any button is pressed after clear event
 	if ((ui32_m_clear_event)
 			&& (buttons_get_up_state() || buttons_get_down_state() || buttons_get_m_state()
@@ -232,357 +311,6 @@ void buttons_clock(void) {
 		ui32_m_clear_event = 0;
 	}
 
-	switch (ui32_onoff_button_state) {
-	case 0:
-		if (buttons_get_onoff_state()) {
-			ui32_onoff_button_state_counter = 0;
-			ui32_onoff_button_state = 1;
-		}
-		break;
-
-	case 1:
-		ui32_onoff_button_state_counter++;
-
-		// event long click
-		if (ui32_onoff_button_state_counter > MS_TO_TICKS(TIME_1)) {
-			buttons_set_events(ONOFF_LONG_CLICK);
-			ui32_onoff_button_state = 2;
-			break;
-		}
-
-		// if button release
-		if (!buttons_get_onoff_state()) {
-			// let's validade if will be a quick click + long click
-			if (ui32_onoff_button_state_counter <= MS_TO_TICKS(TIME_2)) {
-				ui32_onoff_button_state_counter = 0;
-				ui32_onoff_button_state = 3;
-				break;
-			}
-			// event click
-			else {
-				buttons_set_events(ONOFF_CLICK);
-				ui32_onoff_button_state = 0;
-				break;
-			}
-		}
-		break;
-
-	case 2:
-		// wait for button release
-		if (!buttons_get_onoff_state()) {
-			ui32_onoff_button_state = 0;
-			break;
-		}
-		break;
-
-	case 3:
-		ui32_onoff_button_state_counter++;
-
-		// on next step, start counting for long click
-		if (buttons_get_onoff_state()) {
-			ui32_onoff_button_state_counter = 0;
-			ui32_onoff_button_state = 4;
-			break;
-		}
-
-		// event click
-		if (ui32_onoff_button_state_counter > MS_TO_TICKS(TIME_3)) {
-			buttons_set_events(ONOFF_CLICK);
-			ui32_onoff_button_state = 0;
-			break;
-		}
-		break;
-
-	case 4:
-		ui32_onoff_button_state_counter++;
-
-		// event click, but this time it is: click + long click
-		if (ui32_onoff_button_state_counter > MS_TO_TICKS(TIME_4)) {
-			buttons_set_events(ONOFF_CLICK_LONG_CLICK);
-			ui32_onoff_button_state = 2;
-			break;
-		}
-
-		// button release
-		if (!buttons_get_onoff_state()) {
-			buttons_set_events(ONOFF_CLICK);
-			ui32_onoff_button_state = 0;
-			break;
-		}
-		break;
-
-	default:
-		ui32_onoff_button_state = 0;
-		break;
-	}
-
-	switch (ui32_m_button_state) {
-	case 0:
-		if (buttons_get_m_state()) {
-			ui32_m_button_state_counter = 0;
-			ui32_m_button_state = 1;
-		}
-		break;
-
-	case 1:
-		ui32_m_button_state_counter++;
-
-		// event long click
-		if (ui32_m_button_state_counter > MS_TO_TICKS(TIME_1)) {
-			buttons_set_events(M_LONG_CLICK);
-
-			ui32_m_button_state = 2;
-			ui32_m_button_state_counter = 0;
-			break;
-		}
-
-		// if button release
-		if (!buttons_get_m_state()) {
-			// let's validade if will be a quick click + long click
-			if (ui32_m_button_state_counter <= MS_TO_TICKS(TIME_2)) {
-				ui32_m_button_state_counter = 0;
-				ui32_m_button_state = 3;
-				break;
-			}
-			// event click
-			else {
-				buttons_set_events(M_CLICK);
-				ui32_m_button_state = 0;
-				break;
-			}
-		}
-		break;
-
-	case 2:
-		// wait for button release
-		if (!buttons_get_m_state()) {
-			ui32_m_button_state = 0;
-			break;
-		}
-		break;
-
-	case 3:
-		ui32_m_button_state_counter++;
-
-		// on next step, start counting for long click
-		if (buttons_get_m_state()) {
-			ui32_m_button_state_counter = 0;
-			ui32_m_button_state = 4;
-			break;
-		}
-
-		// event click
-		if (ui32_m_button_state_counter > MS_TO_TICKS(TIME_3)) {
-			buttons_set_events(M_CLICK);
-			ui32_m_button_state = 0;
-			break;
-		}
-		break;
-
-	case 4:
-		ui32_m_button_state_counter++;
-
-		// event click, but this time it is: click + long click
-		if (ui32_m_button_state_counter > MS_TO_TICKS(TIME_4)) {
-			buttons_set_events(M_CLICK_LONG_CLICK);
-			ui32_m_button_state = 2;
-			break;
-		}
-
-		// button release
-		if (!buttons_get_m_state()) {
-			buttons_set_events(M_CLICK);
-			ui32_m_button_state = 0;
-			break;
-		}
-		break;
-
-	default:
-		ui32_m_button_state = 0;
-		break;
-	}
-
-	switch (ui32_up_button_state) {
-	case 0:
-		if (buttons_get_up_state()) {
-			ui32_up_button_state_counter = 0;
-			ui32_up_button_state = 1;
-		}
-		break;
-
-	case 1:
-		ui32_up_button_state_counter++;
-
-		// event long click
-		if (ui32_up_button_state_counter > MS_TO_TICKS(TIME_1)) {
-			// up and down button click
-			if (ui32_down_button_state == 1) {
-				buttons_set_events(UPDOWN_CLICK);
-				ui32_down_button_state = 2;
-			} else {
-				buttons_set_events(UP_LONG_CLICK);
-			}
-
-			ui32_up_button_state = 2;
-			ui32_up_button_state_counter = 0;
-			break;
-		}
-
-		// if button release
-		if (!buttons_get_up_state()) {
-			// let's validade if will be a quick click + long click
-			if (ui32_up_button_state_counter <= MS_TO_TICKS(TIME_2)) {
-				ui32_up_button_state_counter = 0;
-				ui32_up_button_state = 3;
-				break;
-			}
-			// event click
-			else {
-				buttons_set_events(UP_CLICK);
-				ui32_up_button_state = 0;
-				break;
-			}
-		}
-		break;
-
-	case 2:
-		// wait for button release
-		if (!buttons_get_up_state()) {
-			ui32_up_button_state = 0;
-			break;
-		}
-		break;
-
-	case 3:
-		ui32_up_button_state_counter++;
-
-		// on next step, start counting for long click
-		if (buttons_get_up_state()) {
-			ui32_up_button_state_counter = 0;
-			ui32_up_button_state = 4;
-			break;
-		}
-
-		// event click
-		if (ui32_up_button_state_counter > MS_TO_TICKS(TIME_3)) {
-			buttons_set_events(UP_CLICK);
-			ui32_up_button_state = 0;
-			break;
-		}
-		break;
-
-	case 4:
-		ui32_up_button_state_counter++;
-
-		// event click, but this time it is: click + long click
-		if (ui32_up_button_state_counter > MS_TO_TICKS(TIME_4)) {
-			buttons_set_events(UP_CLICK_LONG_CLICK);
-			ui32_up_button_state = 2;
-			break;
-		}
-
-		// button release
-		if (!buttons_get_up_state()) {
-			buttons_set_events(UP_CLICK);
-			ui32_up_button_state = 0;
-			break;
-		}
-		break;
-
-	default:
-		ui32_up_button_state = 0;
-		break;
-	}
-
-	switch (ui32_down_button_state) {
-	case 0:
-		if (buttons_get_down_state()) {
-			ui32_down_button_state_counter = 0;
-			ui32_down_button_state = 1;
-		}
-		break;
-
-	case 1:
-		ui32_down_button_state_counter++;
-
-		// event long click
-		if (ui32_down_button_state_counter > MS_TO_TICKS(TIME_1)) {
-			// up and down button click
-			if (ui32_up_button_state == 1) {
-				buttons_set_events(UPDOWN_CLICK);
-				ui32_up_button_state = 2;
-			} else {
-				buttons_set_events(DOWN_LONG_CLICK);
-			}
-
-			ui32_down_button_state = 2;
-			ui32_down_button_state_counter = 0;
-			break;
-		}
-
-		// if button release
-		if (!buttons_get_down_state()) {
-			// let's validade if will be a quick click + long click
-			if (ui32_down_button_state_counter <= MS_TO_TICKS(TIME_2)) {
-				ui32_down_button_state_counter = 0;
-				ui32_down_button_state = 3;
-				break;
-			}
-			// event click
-			else {
-				buttons_set_events(DOWN_CLICK);
-				ui32_down_button_state = 0;
-				break;
-			}
-		}
-		break;
-
-	case 2:
-		// wait for button release
-		if (!buttons_get_down_state()) {
-			ui32_down_button_state = 0;
-			break;
-		}
-		break;
-
-	case 3:
-		ui32_down_button_state_counter++;
-
-		// on next step, start counting for long click
-		if (buttons_get_down_state()) {
-			ui32_down_button_state_counter = 0;
-			ui32_down_button_state = 4;
-			break;
-		}
-
-		// event click
-		if (ui32_down_button_state_counter > MS_TO_TICKS(TIME_3)) {
-			buttons_set_events(DOWN_CLICK);
-			ui32_down_button_state = 0;
-			break;
-		}
-		break;
-
-	case 4:
-		ui32_down_button_state_counter++;
-
-		// event click, but this time it is: click + long click
-		if (ui32_down_button_state_counter > MS_TO_TICKS(TIME_4)) {
-			buttons_set_events(DOWN_CLICK_LONG_CLICK);
-			ui32_down_button_state = 2;
-			break;
-		}
-
-		// button release
-		if (!buttons_get_down_state()) {
-			buttons_set_events(DOWN_CLICK);
-			ui32_down_button_state = 0;
-			break;
-		}
-		break;
-
-	default:
-		ui32_down_button_state = 0;
-		break;
-	}
+	for (int i = 0; i < BUTTONS_NUM; i++)
+		button_clock(i, ui32_now, ui32_edge_ms);
 }
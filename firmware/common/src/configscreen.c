@@ -2,6 +2,10 @@
 #include "mainscreen.h"
 #include "configscreen.h"
 #include "eeprom.h"
+#include "uart_rx_queue.h"
+#ifdef USE_GLYPH_CACHE
+#include "glyph_cache.h"
+#endif
 
 static Field wheelMenus[] =
 		{
@@ -312,6 +316,11 @@ static Field technicalMenus[] = {
   FIELD_READONLY_UINT(_S("Motor speed", "Mot speed"), &ui_vars.ui16_motor_speed_erps, ""),
   FIELD_READONLY_UINT("Motor FOC", &ui_vars.ui8_foc_angle, ""),
   FIELD_READONLY_UINT(_S("Hall sensors", "Hall sens"), &ui_vars.ui8_motor_hall_sensors, ""),
+  FIELD_READONLY_UINT(_S("Motor packages lost", "Pkgs lost"), &g_uart_rx_queue_stats.ui32_lost, ""),
+#ifdef USE_GLYPH_CACHE
+  FIELD_READONLY_UINT("Glyph cache hits", &g_glyph_cache_stats.ui8_hit_percent, "%"),
+  FIELD_READONLY_UINT("Glyph cycles", &g_glyph_cache_stats.ui32_cycles_per_glyph, ""),
+#endif
   FIELD_END };
 
 static Field topMenus[] = {
@@ -0,0 +1,147 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * The speed and cadence are taken as constant over each tick, so the revolutions inside it are at exact fractions
+ * of the tick: a revolution that ends after the wheel went x of the d it goes in the tick is timed at x/d of the
+ * tick. Time is kept in 1/2048 s, what the Cycling Power wheel event time uses, the Cycling Speed and Cadence
+ * ones and the crank ones are in 1/1024 s.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "cycling_meas.h"
+
+#define CSC_FLAG_WHEEL_REV_DATA     0x01
+#define CSC_FLAG_CRANK_REV_DATA     0x02
+#define CP_FLAG_WHEEL_REV_DATA      0x0010
+#define CP_FLAG_CRANK_REV_DATA      0x0020
+
+#define CRANK_REVOLUTION            60000 // rpm * ms
+
+// The time at ui32_done of the ui32_total the wheel or crank moves in a tick of ui16_elapsed_ms
+static uint32_t event_time(const cycling_meas_t *p_meas, uint32_t ui32_done, uint32_t ui32_total,
+    uint16_t ui16_elapsed_ms)
+{
+  // in 1/2048000 s, this is at most 2048 * ui16_elapsed_ms. Nothing moved when a shorter wheel perimeter was set
+  // standing still, then the revolution is at the start of the tick
+  uint32_t ui32_offset = ui32_total ?
+      (uint32_t) (((uint64_t) ui32_done * ui16_elapsed_ms * 2048) / ui32_total) : 0;
+
+  return p_meas->ui32_time + (p_meas->ui16_time_frac + ui32_offset) / 1000;
+}
+
+void cycling_meas_init(cycling_meas_t *p_meas)
+{
+  memset(p_meas, 0, sizeof(*p_meas));
+}
+
+void cycling_meas_update(cycling_meas_t *p_meas, uint16_t ui16_elapsed_ms, uint16_t ui16_wheel_speed_x10,
+    uint16_t ui16_wheel_perimeter, uint8_t ui8_cadence, uint16_t ui16_power)
+{
+  uint32_t ui32_total, ui32_done, ui32_left;
+
+  // 0.1 km/h for 1 ms is 1/36 mm
+  if (ui16_wheel_perimeter) {
+    uint32_t ui32_revolution = (uint32_t) ui16_wheel_perimeter * 36;
+
+    ui32_total = (uint32_t) ui16_wheel_speed_x10 * ui16_elapsed_ms;
+    ui32_done = 0;
+    for (;;) {
+      // the perimeter can be made shorter than the distance already gone
+      ui32_left = p_meas->ui32_wheel_distance < ui32_revolution ? ui32_revolution - p_meas->ui32_wheel_distance : 0;
+      if (ui32_total - ui32_done < ui32_left)
+        break;
+
+      ui32_done += ui32_left;
+      p_meas->ui32_wheel_distance = 0;
+      p_meas->ui32_wheel_revs++;
+      p_meas->ui32_wheel_event_time = event_time(p_meas, ui32_done, ui32_total, ui16_elapsed_ms);
+    }
+    p_meas->ui32_wheel_distance += ui32_total - ui32_done;
+  }
+
+  ui32_total = (uint32_t) ui8_cadence * ui16_elapsed_ms;
+  ui32_done = 0;
+  while (ui32_total - ui32_done >= CRANK_REVOLUTION - p_meas->ui32_crank_angle) {
+    ui32_done += CRANK_REVOLUTION - p_meas->ui32_crank_angle;
+    p_meas->ui32_crank_angle = 0;
+    p_meas->ui16_crank_revs++;
+    p_meas->ui32_crank_event_time = event_time(p_meas, ui32_done, ui32_total, ui16_elapsed_ms);
+  }
+  p_meas->ui32_crank_angle += ui32_total - ui32_done;
+
+  p_meas->i16_power = ui16_power > INT16_MAX ? INT16_MAX : (int16_t) ui16_power;
+
+  uint32_t ui32_frac = p_meas->ui16_time_frac + (uint32_t) ui16_elapsed_ms * 2048;
+  p_meas->ui32_time += ui32_frac / 1000;
+  p_meas->ui16_time_frac = ui32_frac % 1000;
+}
+
+void cycling_meas_set_wheel_revs(cycling_meas_t *p_meas, uint32_t ui32_wheel_revs)
+{
+  p_meas->ui32_wheel_revs = ui32_wheel_revs;
+}
+
+static uint8_t *put_u16(uint8_t *p_dest, uint16_t ui16_value)
+{
+  p_dest[0] = (uint8_t) ui16_value;
+  p_dest[1] = (uint8_t) (ui16_value >> 8);
+  return p_dest + 2;
+}
+
+static uint8_t *put_u32(uint8_t *p_dest, uint32_t ui32_value)
+{
+  p_dest = put_u16(p_dest, (uint16_t) ui32_value);
+  return put_u16(p_dest, (uint16_t) (ui32_value >> 16));
+}
+
+uint8_t cycling_meas_csc_encode(const cycling_meas_t *p_meas, uint8_t *p_dest)
+{
+  uint8_t *p = p_dest;
+
+  *p++ = CSC_FLAG_WHEEL_REV_DATA | CSC_FLAG_CRANK_REV_DATA;
+  p = put_u32(p, p_meas->ui32_wheel_revs);
+  p = put_u16(p, (uint16_t) (p_meas->ui32_wheel_event_time >> 1));
+  p = put_u16(p, p_meas->ui16_crank_revs);
+  p = put_u16(p, (uint16_t) (p_meas->ui32_crank_event_time >> 1));
+
+  return p - p_dest;
+}
+
+uint8_t cycling_meas_cp_encode(const cycling_meas_t *p_meas, uint8_t *p_dest)
+{
+  uint8_t *p = p_dest;
+
+  p = put_u16(p, CP_FLAG_WHEEL_REV_DATA | CP_FLAG_CRANK_REV_DATA);
+  p = put_u16(p, (uint16_t) p_meas->i16_power);
+  p = put_u32(p, p_meas->ui32_wheel_revs);
+  p = put_u16(p, (uint16_t) p_meas->ui32_wheel_event_time);
+  p = put_u16(p, p_meas->ui16_crank_revs);
+  p = put_u16(p, (uint16_t) (p_meas->ui32_crank_event_time >> 1));
+
+  return p - p_dest;
+}
+
+bool cycling_notify_due(cycling_notify_t *p_notify, const uint8_t *p_data, uint8_t ui8_length,
+    uint16_t ui16_elapsed_ms)
+{
+  if (p_notify->ui16_quiet_ms < CYCLING_NOTIFY_MIN_MS) {
+    p_notify->ui16_quiet_ms += ui16_elapsed_ms < CYCLING_NOTIFY_MIN_MS ? ui16_elapsed_ms : CYCLING_NOTIFY_MIN_MS;
+    if (p_notify->ui16_quiet_ms < CYCLING_NOTIFY_MIN_MS)
+      return false;
+  }
+
+  return ui8_length != p_notify->ui8_sent_length || memcmp(p_data, p_notify->ui8_sent, ui8_length);
+}
+
+void cycling_notify_sent(cycling_notify_t *p_notify, const uint8_t *p_data, uint8_t ui8_length)
+{
+  memcpy(p_notify->ui8_sent, p_data, ui8_length);
+  p_notify->ui8_sent_length = ui8_length;
+  p_notify->ui16_quiet_ms = 0;
+}
@@ -0,0 +1,292 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * The data export protocol of data_export.h, independent of the link: the platform gives a send function that
+ * refuses packets when its buffers are full and calls data_export_pump() again once they have room, so as many
+ * packets as the link takes go out at each connection event.
+ *
+ * The response is read from its source a packet at a time, nothing is copied. The graph points keep being pushed
+ * by the realtime ISR meanwhile, so a response can have a few points newer than when it was asked for. Ride log
+ * blocks each have their own CRC, a block moved by the storage while it was sent is dropped by the decoder.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "utils.h"
+#include "screen.h"
+#include "eeprom.h"
+#include "events.h"
+#include "ride_log.h"
+#include "data_export.h"
+
+#define DATA_EXPORT_MAX_REQUEST 4
+
+// Copies up to ui16_max bytes of the response data to p_dest, returns how many, 0 at the end
+typedef uint16_t (*source_read_t)(uint8_t *p_dest, uint16_t ui16_max);
+
+static data_export_send_t m_send;
+static data_export_active_t m_active;
+static uint16_t ui16_m_packet_size;
+
+static volatile uint8_t ui8_m_request[DATA_EXPORT_MAX_REQUEST];
+static volatile uint8_t ui8_m_request_length;
+static volatile bool m_request_pending;
+
+static bool m_busy;
+static source_read_t m_read;
+static uint8_t ui8_m_header[2]; // command, status
+static uint8_t ui8_m_header_sent;
+static uint16_t ui16_m_crc;
+static uint8_t ui8_m_crc_sent;
+static uint8_t ui8_m_seq;
+static uint8_t ui8_m_packet[DATA_EXPORT_MAX_PACKET];
+static uint16_t ui16_m_packet_length; // of the packet to send again, 0 if none
+
+// DATA_EXPORT_CMD_INFO and DATA_EXPORT_CMD_SETTINGS: bytes in memory
+static const uint8_t *p_m_bytes;
+static uint16_t ui16_m_bytes_left;
+static uint8_t ui8_m_info[8 + sizeof(VERSION_STRING)];
+
+#ifndef SW102
+// DATA_EXPORT_CMD_GRAPH, the SW102 has no graphs
+static GraphData *p_m_graph;
+static uint8_t ui8_m_graph_level;
+static uint16_t ui16_m_graph_point; // the next one, from the oldest
+static uint16_t ui16_m_graph_points;
+static uint8_t ui8_m_graph_byte; // of that point
+#endif
+
+// DATA_EXPORT_CMD_RIDE_LOG
+static ride_log_iter_t m_ride_log_iter;
+static const uint8_t *p_m_ride_log_block;
+static uint16_t ui16_m_ride_log_offset;
+
+static uint16_t bytes_read(uint8_t *p_dest, uint16_t ui16_max)
+{
+  if (ui16_max > ui16_m_bytes_left)
+    ui16_max = ui16_m_bytes_left;
+
+  memcpy(p_dest, p_m_bytes, ui16_max);
+  p_m_bytes += ui16_max;
+  ui16_m_bytes_left -= ui16_max;
+
+  return ui16_max;
+}
+
+#ifndef SW102
+static uint16_t graph_read(uint8_t *p_dest, uint16_t ui16_max)
+{
+  uint16_t ui16_length = 0;
+
+  while (ui16_length < ui16_max && ui16_m_graph_point < ui16_m_graph_points) {
+    int32_t i32_point = graph_data_point(p_m_graph, ui8_m_graph_level, ui16_m_graph_point);
+
+    p_dest[ui16_length++] = (uint8_t) ((uint32_t) i32_point >> (8 * ui8_m_graph_byte));
+    if (++ui8_m_graph_byte == sizeof(int32_t)) {
+      ui8_m_graph_byte = 0;
+      ui16_m_graph_point++;
+    }
+  }
+
+  return ui16_length;
+}
+#endif
+
+static uint16_t ride_log_read(uint8_t *p_dest, uint16_t ui16_max)
+{
+  if (!p_m_ride_log_block || ui16_m_ride_log_offset == RIDE_LOG_BLOCK_BYTES) {
+    p_m_ride_log_block = (const uint8_t *) ride_log_store_next(&m_ride_log_iter);
+    ui16_m_ride_log_offset = 0;
+
+    if (!p_m_ride_log_block)
+      return 0;
+  }
+
+  if (ui16_max > RIDE_LOG_BLOCK_BYTES - ui16_m_ride_log_offset)
+    ui16_max = RIDE_LOG_BLOCK_BYTES - ui16_m_ride_log_offset;
+
+  memcpy(p_dest, p_m_ride_log_block + ui16_m_ride_log_offset, ui16_max);
+  ui16_m_ride_log_offset += ui16_max;
+
+  return ui16_max;
+}
+
+static uint16_t empty_read(uint8_t *p_dest, uint16_t ui16_max)
+{
+  return 0;
+}
+
+static void put_u16(uint8_t *p_dest, uint16_t ui16_value)
+{
+  p_dest[0] = (uint8_t) ui16_value;
+  p_dest[1] = (uint8_t) (ui16_value >> 8);
+}
+
+static data_export_status_t start(const uint8_t *p_request, uint16_t ui16_length)
+{
+  m_read = empty_read;
+
+  switch (p_request[0]) {
+    case DATA_EXPORT_CMD_INFO:
+      ui8_m_info[0] = DATA_EXPORT_VERSION;
+      put_u16(&ui8_m_info[1], sizeof(eeprom_data_t));
+#ifndef SW102
+      ui8_m_info[3] = VARS_SIZE;
+      put_u16(&ui8_m_info[4], GRAPH_MAX_POINTS);
+#endif
+      put_u16(&ui8_m_info[6], RIDE_LOG_BLOCK_BYTES);
+      memcpy(&ui8_m_info[8], VERSION_STRING, sizeof(VERSION_STRING) - 1);
+
+      p_m_bytes = ui8_m_info;
+      ui16_m_bytes_left = sizeof(ui8_m_info) - 1;
+      m_read = bytes_read;
+      return DATA_EXPORT_OK;
+
+    case DATA_EXPORT_CMD_SETTINGS:
+      p_m_bytes = (const uint8_t *) eeprom_get_data();
+      ui16_m_bytes_left = sizeof(eeprom_data_t);
+      m_read = bytes_read;
+      return DATA_EXPORT_OK;
+
+#ifndef SW102
+    case DATA_EXPORT_CMD_GRAPH:
+      if (ui16_length < 3 || p_request[1] >= VARS_SIZE || p_request[2] >= GRAPH_LEVELS)
+        return DATA_EXPORT_BAD_ARGUMENT;
+
+      p_m_graph = &g_graphData[p_request[1]];
+      ui8_m_graph_level = p_request[2];
+      ui16_m_graph_points = graph_data_points(p_m_graph, ui8_m_graph_level);
+      ui16_m_graph_point = 0;
+      ui8_m_graph_byte = 0;
+      m_read = graph_read;
+      return DATA_EXPORT_OK;
+#endif
+
+    case DATA_EXPORT_CMD_RIDE_LOG:
+      memset(&m_ride_log_iter, 0, sizeof(m_ride_log_iter));
+      p_m_ride_log_block = NULL;
+      m_read = ride_log_read;
+      return DATA_EXPORT_OK;
+
+    default:
+      return DATA_EXPORT_BAD_COMMAND;
+  }
+}
+
+// The next packet of the response, the last one has DATA_EXPORT_LAST
+static uint16_t packet_build(void)
+{
+  uint16_t ui16_length = 1;
+  uint16_t ui16_room = ui16_m_packet_size;
+  uint16_t ui16_num;
+
+  while (ui8_m_header_sent < sizeof(ui8_m_header) && ui16_length < ui16_room)
+    ui8_m_packet[ui16_length++] = ui8_m_header[ui8_m_header_sent++];
+
+  // a source can give less than asked for, e.g. at the end of a ride log block
+  while (m_read != empty_read && ui16_length < ui16_room) {
+    ui16_num = m_read(&ui8_m_packet[ui16_length], ui16_room - ui16_length);
+    if (!ui16_num)
+      m_read = empty_read; // the data is over, the CRC follows
+
+    ui16_m_crc = crc16_update(ui16_m_crc, &ui8_m_packet[ui16_length], ui16_num);
+    ui16_length += ui16_num;
+  }
+
+  if (m_read == empty_read) {
+    while (ui8_m_crc_sent < sizeof(ui16_m_crc) && ui16_length < ui16_room)
+      ui8_m_packet[ui16_length++] = (uint8_t) (ui16_m_crc >> (8 * ui8_m_crc_sent++));
+  }
+
+  ui8_m_packet[0] = ui8_m_seq++ & ~DATA_EXPORT_LAST;
+  if (ui8_m_crc_sent == sizeof(ui16_m_crc))
+    ui8_m_packet[0] |= DATA_EXPORT_LAST;
+
+  return ui16_length;
+}
+
+static void stop(void)
+{
+  if (m_busy && m_active)
+    m_active(false);
+
+  m_busy = false;
+  ui16_m_packet_length = 0;
+}
+
+void data_export_init(data_export_send_t send, data_export_active_t active, uint16_t ui16_packet_size)
+{
+  m_send = send;
+  m_active = active;
+  ui16_m_packet_size = ui16_packet_size < DATA_EXPORT_MAX_PACKET ? ui16_packet_size : DATA_EXPORT_MAX_PACKET;
+}
+
+// Note: the request is copied here and started by the main loop, a second one that comes before that replaces it
+void data_export_request(const uint8_t *p_data, uint16_t ui16_length)
+{
+  if (!ui16_length)
+    return;
+
+  if (ui16_length > DATA_EXPORT_MAX_REQUEST)
+    ui16_length = DATA_EXPORT_MAX_REQUEST;
+
+  for (uint16_t i = 0; i < ui16_length; i++)
+    ui8_m_request[i] = p_data[i];
+  ui8_m_request_length = ui16_length;
+  m_request_pending = true;
+
+  event_post(EVENT_EXPORT);
+}
+
+void data_export_pump(void)
+{
+  if (m_request_pending) {
+    uint8_t ui8_request[DATA_EXPORT_MAX_REQUEST];
+    uint16_t ui16_length = ui8_m_request_length;
+
+    m_request_pending = false;
+    for (uint16_t i = 0; i < ui16_length; i++)
+      ui8_request[i] = ui8_m_request[i];
+
+    stop();
+    ui8_m_header[0] = ui8_request[0];
+    ui8_m_header[1] = start(ui8_request, ui16_length);
+    ui8_m_header_sent = 0;
+    ui16_m_crc = crc16_update(0xffff, ui8_m_header, sizeof(ui8_m_header));
+    ui8_m_crc_sent = 0;
+    ui8_m_seq = 0;
+
+    m_busy = true;
+    if (m_active)
+      m_active(true);
+  }
+
+  while (m_busy) {
+    if (!ui16_m_packet_length)
+      ui16_m_packet_length = packet_build();
+
+    if (!m_send(ui8_m_packet, ui16_m_packet_length))
+      return; // the link is full, we are called again when it has room
+
+    bool last = ui8_m_packet[0] & DATA_EXPORT_LAST;
+    ui16_m_packet_length = 0;
+    if (last)
+      stop();
+  }
+}
+
+void data_export_abort(void)
+{
+  m_request_pending = false;
+  stop();
+}
+
+bool data_export_busy(void)
+{
+  return m_busy || m_request_pending;
+}
@@ -10,6 +10,7 @@
 #include <string.h>
 #include "eeprom.h"
 #include "eeprom_hw.h"
+#include "last_gasp.h"
 #include "main.h"
 #include "mainscreen.h"
 //#include "lcd_configurations.h"
@@ -227,9 +228,25 @@ void eeprom_init() {
 		m_eeprom_data.eeprom_version = EEPROM_VERSION;
 	}
 
+	// the counters saved when the supply went away while riding are newer than the settings
+	last_gasp_record_t last_gasp;
+	bool last_gasp_found;
+
+	last_gasp_init();
+	last_gasp_found = last_gasp_read(&last_gasp);
+	if (last_gasp_found) {
+		m_eeprom_data.ui32_odometer_x10 = last_gasp.ui32_odometer_x10;
+		m_eeprom_data.ui32_wh_x10_offset = last_gasp.ui32_wh_x10;
+	}
+
 	eeprom_init_variables();
 
 	set_conversions();
+
+	if (last_gasp_found && flash_write_words(&m_eeprom_data, sizeof(m_eeprom_data) / sizeof(uint32_t)))
+		last_gasp_merged();
+
+	last_gasp_hw_enable(true);
 }
 
 void eeprom_init_variables(void) {
@@ -304,6 +321,7 @@ void eeprom_init_variables(void) {
 	ui_vars->ui8_offroad_power_limit_div25 =
 			m_eeprom_data.ui8_offroad_power_limit_div25;
 	rt_vars->ui32_odometer_x10 = m_eeprom_data.ui32_odometer_x10; // odometer value should reside on RT vars
+	rt_vars->ui32_wh_x10 = m_eeprom_data.ui32_wh_x10_offset; // rt_calc_wh() only sets it after 1s, a save before must not lose it
 	ui_vars->ui8_walk_assist_feature_enabled =
 			m_eeprom_data.ui8_walk_assist_feature_enabled;
 	COPY_ARRAY(ui_vars, &m_eeprom_data, ui8_walk_assist_level_factor);
@@ -601,7 +619,9 @@ void eeprom_write_variables(void) {
   m_eeprom_data.motorFOCField_x_axis_scale_config = motorFOCGraph.rw->graph.x_axis_scale_config;
 #endif
 
-	flash_write_words(&m_eeprom_data, sizeof(m_eeprom_data) / sizeof(uint32_t));
+	// a last gasp record written by a supply that came back is older than these settings
+	if (flash_write_words(&m_eeprom_data, sizeof(m_eeprom_data) / sizeof(uint32_t)))
+		last_gasp_merged();
 }
 
 void eeprom_init_defaults(void)
@@ -615,3 +635,8 @@ void eeprom_init_defaults(void)
   eeprom_init();
 #endif
 }
+
+const eeprom_data_t* eeprom_get_data(void)
+{
+  return &m_eeprom_data;
+}
@@ -0,0 +1,54 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * Events posted by the interrupts for the main loop, which sleeps while there are none.
+ *
+ * Each event is a flag: producers only ever set it and the main loop clears it right before running the handler,
+ * so no locking is needed. A post that lands between the clear and the end of the handler runs the handler once
+ * more, it is never lost.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "events.h"
+
+#define compiler_barrier() __asm volatile ("" ::: "memory")
+
+static volatile bool m_posted[EVENTS_NUM];
+
+void event_post(event_t event)
+{
+  m_posted[event] = true;
+}
+
+bool events_pending(void)
+{
+  for (int i = 0; i < EVENTS_NUM; i++)
+    if (m_posted[i])
+      return true;
+
+  return false;
+}
+
+bool events_dispatch(const event_handler_t handlers[EVENTS_NUM])
+{
+  bool dispatched = false;
+
+  for (int i = 0; i < EVENTS_NUM; i++) {
+    if (!m_posted[i])
+      continue;
+
+    m_posted[i] = false;
+    compiler_barrier();
+
+    if (handlers[i])
+      handlers[i]();
+    dispatched = true;
+  }
+
+  return dispatched;
+}
@@ -4,6 +4,9 @@
 #include "stdlib.h"
 #include "fault.h"
 #include "state.h"
+#ifdef SIM
+#include "sim.h"
+#endif
 
 #ifdef SW102
 #include "hardfault.h"
@@ -48,10 +51,14 @@ Screen faultScreen = { .fields = { { .height = -1, .color = ColorInvert,
 				&REGULAR_TEXT_FONT }, { .field = NULL } } };
 
 static inline void debugger_break(void) {
+#ifdef SIM
+	__builtin_trap();
+#else
 	__asm volatile(
 			"bkpt #0x01\n\t"
 			"mov pc, lr\n\t"
 	);
+#endif
 }
 
 /**@brief       Callback function for errors, asserts, and faults.
@@ -114,10 +121,14 @@ void app_error_fault_handler(uint32_t id, uint32_t pc, uint32_t info) {
 	if (g_is_sim_motor)
 		debugger_break(); // if debugging, try to drop into the debugger
 
+#ifdef SIM
+	sim_exit(1); // nobody will ever press the power button, leave with the fault screen as last frame
+#endif
+
 	// loop until the user presses the pwr button then reboot
 	buttons_clear_all_events(); // require a new press
 	while (1) {
-		if (buttons_get_onoff_click_event())
+		if (buttons_get_events() & ONOFF_CLICK)
 #ifdef SW102
         nrf_delay_ms(20);
       sd_nvic_SystemReset();
@@ -125,7 +136,7 @@ void app_error_fault_handler(uint32_t id, uint32_t pc, uint32_t info) {
 			; // FIXME
 #endif
 
-		buttons_clock(); // Note: this is done _after_ button events is checked to provide a 20ms debounce
+		buttons_clock();
 	}
 }
 
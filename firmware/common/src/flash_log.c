@@ -0,0 +1,409 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * Append only key/value log of the settings over FLASH_LOG_PAGES pages of flash.
+ *
+ * The settings struct is split in chunks of FLASH_LOG_CHUNK_WORDS words, chunk n is stored with key n + 1. A save
+ * appends a record only for the chunks that differ from what is in flash, then a commit record (key 0) that
+ * holds the KEY byte. Records are word aligned:
+ *
+ *   header (tag, key, data length in words), sequence number, data words, CRC16 and its complement
+ *
+ * Every record gets the next sequence number, a record whose sequence number is higher than the newest commit
+ * record belongs to a save that was cut short, so at boot it is made invalid by programming its CRC word to 0,
+ * which flash allows on a programmed word. A save is then either all in flash or not at all. Until its commit
+ * record is written the records of a save are only in the pending index, the committed one still has the
+ * records a cut would fall back to.
+ *
+ * Each page starts with a magic word and a generation number, the page with the highest generation is the one
+ * being appended to. When it is full the next free page is erased if needed and opened, and if that leaves no
+ * free page the oldest page is compacted: the records of it that are still the newest of their key, committed
+ * or pending, are copied with their sequence number to the new page and the oldest page is erased. A cut during
+ * compaction leaves two copies of the same record, the one in the newer page wins, and the compaction is finished
+ * at next boot.
+ *
+ * The index of the newest record of each key is built once by flash_log_init(), reads and saves never scan the
+ * flash.
+ *
+ * The settings of the older firmware (flash_log_hw_legacy_read()) may be in pages of the log, the first read
+ * copies them to the log before a save can erase them.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "utils.h"
+#include "eeprom_hw.h"
+#include "flash_log.h"
+
+#if FLASH_LOG_PAGES < 2
+#error "FLASH_LOG_PAGES must be at least 2"
+#endif
+
+#define FLASH_LOG_ERASED          0xffffffff
+#define FLASH_LOG_PAGE_MAGIC      0x31474f4c // "LOG1"
+#define FLASH_LOG_PAGE_HEADER     2 // magic, generation
+#define FLASH_LOG_RECORD_TAG      0x5aa5
+#define FLASH_LOG_RECORD_OVERHEAD 3 // header, sequence number, CRC
+#define FLASH_LOG_KEY_COMMIT      0
+#define FLASH_LOG_NO_RECORD       0xffff
+
+#define record_header(key, len)   (((uint32_t) FLASH_LOG_RECORD_TAG << 16) | ((uint32_t) (key) << 8) | (len))
+#define record_key(header)        (((header) >> 8) & 0xff)
+#define record_len(header)        ((header) & 0xff)
+#define record_seq(p_record)      ((p_record)[1])
+#define record_data(p_record)     (&(p_record)[2])
+
+static uint16_t ui16_m_index[FLASH_LOG_MAX_KEYS]; // page * FLASH_LOG_PAGE_WORDS + offset of the newest committed record of each key
+static uint16_t ui16_m_pending[FLASH_LOG_MAX_KEYS]; // the same for the save in progress, until its commit record
+static uint8_t ui8_m_page; // the page we append to
+static uint16_t ui16_m_offset; // first free word of that page, FLASH_LOG_PAGE_WORDS if no page is open
+static uint32_t ui32_m_generation; // of the newest page
+static uint32_t ui32_m_seq; // of the newest record
+static uint32_t ui32_m_commit_seq; // of the newest commit record
+
+static const uint32_t* record_at(uint16_t ui16_address)
+{
+  return flash_log_hw_page(ui16_address / FLASH_LOG_PAGE_WORDS) + ui16_address % FLASH_LOG_PAGE_WORDS;
+}
+
+static uint32_t record_crc(const uint32_t *p_record, uint8_t ui8_len)
+{
+  uint16_t ui16_crc = crc16_update(0xffff, (const uint8_t *) p_record, (ui8_len + 2) * sizeof(uint32_t));
+
+  return ((uint32_t) (uint16_t) ~ui16_crc << 16) | ui16_crc;
+}
+
+/// The header and CRC of an indexed record are still right, the flash may have been erased or damaged since
+static bool record_good(const uint32_t *p_record, uint8_t ui8_key)
+{
+  uint8_t ui8_len = record_len(p_record[0]);
+
+  return (p_record[0] >> 16) == FLASH_LOG_RECORD_TAG && record_key(p_record[0]) == ui8_key && ui8_len > 0 &&
+      ui8_len <= FLASH_LOG_CHUNK_WORDS && p_record[ui8_len + 2] == record_crc(p_record, ui8_len);
+}
+
+static bool page_in_use(uint8_t ui8_page)
+{
+  const uint32_t *p_page = flash_log_hw_page(ui8_page);
+
+  return p_page[0] == FLASH_LOG_PAGE_MAGIC && p_page[1] != FLASH_LOG_ERASED;
+}
+
+static bool words_blank(const uint32_t *p_words, uint16_t ui16_num)
+{
+  while (ui16_num--) {
+    if (*p_words++ != FLASH_LOG_ERASED)
+      return false;
+  }
+
+  return true;
+}
+
+/// Calls fn for every record of the page with a good CRC, returns the offset after the last record
+static uint16_t page_walk(uint8_t ui8_page, void (*fn)(uint16_t ui16_address, const uint32_t *p_record))
+{
+  const uint32_t *p_page = flash_log_hw_page(ui8_page);
+  uint16_t ui16_offset = FLASH_LOG_PAGE_HEADER;
+
+  while (ui16_offset < FLASH_LOG_PAGE_WORDS) {
+    uint32_t ui32_header = p_page[ui16_offset];
+    uint16_t ui16_words = record_len(ui32_header) + FLASH_LOG_RECORD_OVERHEAD;
+
+    if (ui32_header == FLASH_LOG_ERASED)
+      break;
+
+    // a header half written by a cut, nothing was written after it
+    if ((ui32_header >> 16) != FLASH_LOG_RECORD_TAG || record_key(ui32_header) >= FLASH_LOG_MAX_KEYS ||
+        record_len(ui32_header) == 0 || ui16_offset + ui16_words > FLASH_LOG_PAGE_WORDS) {
+      ui16_offset++;
+      continue;
+    }
+
+    if (p_page[ui16_offset + ui16_words - 1] == record_crc(&p_page[ui16_offset], record_len(ui32_header)))
+      fn(ui8_page * FLASH_LOG_PAGE_WORDS + ui16_offset, &p_page[ui16_offset]);
+
+    ui16_offset += ui16_words;
+  }
+
+  return ui16_offset;
+}
+
+/// Fills p_pages with the pages in use, oldest first, and returns how many there are
+static uint8_t pages_by_generation(uint8_t *p_pages)
+{
+  uint8_t ui8_num = 0;
+
+  for (uint8_t ui8_page = 0; ui8_page < FLASH_LOG_PAGES; ui8_page++) {
+    if (!page_in_use(ui8_page))
+      continue;
+
+    uint8_t i = ui8_num++;
+    for (; i > 0 && flash_log_hw_page(p_pages[i - 1])[1] > flash_log_hw_page(ui8_page)[1]; i--)
+      p_pages[i] = p_pages[i - 1];
+    p_pages[i] = ui8_page;
+  }
+
+  return ui8_num;
+}
+
+static void find_newest_seq(uint16_t ui16_address, const uint32_t *p_record)
+{
+  if (record_seq(p_record) > ui32_m_seq)
+    ui32_m_seq = record_seq(p_record);
+
+  if (record_key(p_record[0]) == FLASH_LOG_KEY_COMMIT && record_seq(p_record) > ui32_m_commit_seq)
+    ui32_m_commit_seq = record_seq(p_record);
+}
+
+static void index_record(uint16_t ui16_address, const uint32_t *p_record)
+{
+  uint8_t ui8_key = record_key(p_record[0]);
+  uint8_t ui8_len = record_len(p_record[0]);
+
+  if (record_seq(p_record) > ui32_m_commit_seq) {
+    uint32_t ui32_zero = 0;
+
+    flash_log_hw_program(ui16_address / FLASH_LOG_PAGE_WORDS,
+        ui16_address % FLASH_LOG_PAGE_WORDS + ui8_len + FLASH_LOG_RECORD_OVERHEAD - 1, &ui32_zero, 1);
+    return;
+  }
+
+  // pages are walked oldest first, so on equal sequence numbers the copy in the newer page wins
+  if (ui16_m_index[ui8_key] == FLASH_LOG_NO_RECORD ||
+      record_seq(p_record) >= record_seq(record_at(ui16_m_index[ui8_key])))
+    ui16_m_index[ui8_key] = ui16_address;
+}
+
+static bool open_page(void);
+
+/// Returns the address of the new record, FLASH_LOG_NO_RECORD if it could not be written
+static uint16_t append(uint8_t ui8_key, const void *p_data, uint8_t ui8_len, uint32_t ui32_seq)
+{
+  uint32_t ui32_record[FLASH_LOG_CHUNK_WORDS + FLASH_LOG_RECORD_OVERHEAD];
+  uint16_t ui16_words = ui8_len + FLASH_LOG_RECORD_OVERHEAD;
+  uint16_t ui16_address;
+
+  if (ui8_len == 0 || ui8_len > FLASH_LOG_CHUNK_WORDS)
+    return FLASH_LOG_NO_RECORD;
+
+  if (ui16_m_offset + ui16_words > FLASH_LOG_PAGE_WORDS ||
+      !words_blank(flash_log_hw_page(ui8_m_page) + ui16_m_offset, ui16_words)) {
+    if (!open_page())
+      return FLASH_LOG_NO_RECORD;
+  }
+
+  ui32_record[0] = record_header(ui8_key, ui8_len);
+  ui32_record[1] = ui32_seq;
+  memcpy(&ui32_record[2], p_data, ui8_len * sizeof(uint32_t));
+  ui32_record[ui16_words - 1] = record_crc(ui32_record, ui8_len);
+
+  // header first, a cut leaves either nothing or a record with a bad CRC
+  if (!flash_log_hw_program(ui8_m_page, ui16_m_offset, ui32_record, ui16_words)) {
+    ui16_m_offset = FLASH_LOG_PAGE_WORDS; // don't trust this page anymore
+    return FLASH_LOG_NO_RECORD;
+  }
+
+  ui16_address = ui8_m_page * FLASH_LOG_PAGE_WORDS + ui16_m_offset;
+  ui16_m_offset += ui16_words;
+
+  return ui16_address;
+}
+
+/// Copies the records of the page an index points to, to the open page
+static bool compact_index(uint8_t ui8_page, uint16_t *p_index)
+{
+  for (uint8_t ui8_key = 0; ui8_key < FLASH_LOG_MAX_KEYS; ui8_key++) {
+    uint16_t ui16_address = p_index[ui8_key];
+
+    if (ui16_address == FLASH_LOG_NO_RECORD || ui16_address / FLASH_LOG_PAGE_WORDS != ui8_page)
+      continue;
+
+    const uint32_t *p_record = record_at(ui16_address);
+    if (!record_good(p_record, ui8_key)) {
+      p_index[ui8_key] = FLASH_LOG_NO_RECORD; // nothing left to copy
+      continue;
+    }
+
+    ui16_address = append(ui8_key, record_data(p_record), record_len(p_record[0]), record_seq(p_record));
+    if (ui16_address == FLASH_LOG_NO_RECORD)
+      return false;
+    p_index[ui8_key] = ui16_address;
+  }
+
+  return true;
+}
+
+/// Copies the records of a page that are still the newest of their key to the open page, then erases it. The
+/// committed ones too if a save in progress has newer ones, a cut before its commit falls back to them.
+static bool compact(uint8_t ui8_page)
+{
+  return compact_index(ui8_page, ui16_m_index) && compact_index(ui8_page, ui16_m_pending) &&
+      flash_log_hw_erase(ui8_page);
+}
+
+static bool open_page(void)
+{
+  uint8_t ui8_pages[FLASH_LOG_PAGES];
+  uint8_t ui8_page;
+
+  for (ui8_page = 0; ui8_page < FLASH_LOG_PAGES && page_in_use(ui8_page); ui8_page++)
+    ;
+  if (ui8_page == FLASH_LOG_PAGES)
+    return false;
+
+  if (!words_blank(flash_log_hw_page(ui8_page), FLASH_LOG_PAGE_WORDS) && !flash_log_hw_erase(ui8_page))
+    return false;
+
+  uint32_t ui32_header[FLASH_LOG_PAGE_HEADER] = { FLASH_LOG_PAGE_MAGIC, ++ui32_m_generation };
+  if (!flash_log_hw_program(ui8_page, 0, ui32_header, FLASH_LOG_PAGE_HEADER))
+    return false;
+
+  ui8_m_page = ui8_page;
+  ui16_m_offset = FLASH_LOG_PAGE_HEADER;
+
+  // always keep a free page to open next
+  if (pages_by_generation(ui8_pages) == FLASH_LOG_PAGES)
+    return compact(ui8_pages[0]);
+
+  return true;
+}
+
+void flash_log_init(void)
+{
+  uint8_t ui8_pages[FLASH_LOG_PAGES];
+  uint8_t ui8_num = pages_by_generation(ui8_pages);
+
+  ui32_m_seq = 0;
+  ui32_m_commit_seq = 0;
+  ui32_m_generation = 0;
+  ui16_m_offset = FLASH_LOG_PAGE_WORDS; // the first append opens a page
+  memset(ui16_m_index, 0xff, sizeof(ui16_m_index));
+  memset(ui16_m_pending, 0xff, sizeof(ui16_m_pending));
+
+  for (uint8_t i = 0; i < ui8_num; i++)
+    page_walk(ui8_pages[i], find_newest_seq);
+
+  for (uint8_t i = 0; i < ui8_num; i++)
+    ui16_m_offset = page_walk(ui8_pages[i], index_record);
+
+  if (ui8_num) {
+    ui8_m_page = ui8_pages[ui8_num - 1];
+    ui32_m_generation = flash_log_hw_page(ui8_m_page)[1];
+  }
+
+  // a cut while compacting, finish it
+  if (ui8_num == FLASH_LOG_PAGES)
+    compact(ui8_pages[0]);
+}
+
+/// Returns true if nothing was ever saved
+bool flash_log_is_empty(void)
+{
+  return ui16_m_index[FLASH_LOG_KEY_COMMIT] == FLASH_LOG_NO_RECORD;
+}
+
+// Read the settings, return false if they are missing or were invalidated
+bool flash_log_read_words(void *p_dest, uint16_t ui16_length_words)
+{
+  uint16_t ui16_commit = ui16_m_index[FLASH_LOG_KEY_COMMIT];
+
+  if (flash_log_is_empty()) {
+    if (!flash_log_hw_legacy_read(p_dest, ui16_length_words))
+      return false;
+
+    // the pages in use only have records of cut copies, start over so the copy never opens the pages after the first
+    for (uint8_t ui8_page = 0; ui8_page < FLASH_LOG_PAGES; ui8_page++) {
+      if (page_in_use(ui8_page))
+        flash_log_hw_erase(ui8_page);
+    }
+    ui16_m_offset = FLASH_LOG_PAGE_WORDS;
+
+    // in the log before a save erases the page they are in. If this is cut they are read from there again
+    flash_log_write_words(p_dest, ui16_length_words);
+    return true;
+  }
+
+  if (record_data(record_at(ui16_commit))[0] != KEY)
+    return false;
+
+  for (uint16_t ui16_word = 0; ui16_word < ui16_length_words; ui16_word += FLASH_LOG_CHUNK_WORDS) {
+    uint8_t ui8_key = 1 + ui16_word / FLASH_LOG_CHUNK_WORDS;
+    uint16_t ui16_len = ui16_length_words - ui16_word;
+
+    if (ui8_key >= FLASH_LOG_MAX_KEYS || ui16_m_index[ui8_key] == FLASH_LOG_NO_RECORD)
+      return false;
+
+    const uint32_t *p_record = record_at(ui16_m_index[ui8_key]);
+    if (ui16_len > record_len(p_record[0]))
+      ui16_len = record_len(p_record[0]);
+
+    memcpy((uint32_t *) p_dest + ui16_word, record_data(p_record), ui16_len * sizeof(uint32_t));
+  }
+
+  return true;
+}
+
+/// Appends the chunks that changed and commits them
+bool flash_log_write_words(const void *p_value, uint16_t ui16_length_words)
+{
+  for (uint16_t ui16_word = 0; ui16_word < ui16_length_words; ui16_word += FLASH_LOG_CHUNK_WORDS) {
+    uint8_t ui8_key = 1 + ui16_word / FLASH_LOG_CHUNK_WORDS;
+    uint8_t ui8_len = FLASH_LOG_CHUNK_WORDS;
+    const uint32_t *p_chunk = (const uint32_t *) p_value + ui16_word;
+
+    if (ui8_key >= FLASH_LOG_MAX_KEYS)
+      return false;
+
+    if (ui16_length_words - ui16_word < FLASH_LOG_CHUNK_WORDS)
+      ui8_len = ui16_length_words - ui16_word;
+
+    // against the newest record in flash, the next commit also commits those of a save that failed
+    uint16_t ui16_address = ui16_m_pending[ui8_key] != FLASH_LOG_NO_RECORD ? ui16_m_pending[ui8_key] :
+        ui16_m_index[ui8_key];
+
+    if (ui16_address != FLASH_LOG_NO_RECORD) {
+      const uint32_t *p_record = record_at(ui16_address);
+
+      if (record_len(p_record[0]) == ui8_len && !memcmp(record_data(p_record), p_chunk, ui8_len * sizeof(uint32_t)))
+        continue;
+    }
+
+    ui16_address = append(ui8_key, p_chunk, ui8_len, ++ui32_m_seq);
+    if (ui16_address == FLASH_LOG_NO_RECORD)
+      return false;
+    ui16_m_pending[ui8_key] = ui16_address;
+  }
+
+  return flash_log_write_key(KEY);
+}
+
+/// Commits the chunks written so far with this key, anything but KEY makes flash_log_read_words() fail
+bool flash_log_write_key(uint8_t ui8_key)
+{
+  uint32_t ui32_key = ui8_key;
+  uint16_t ui16_commit = ui16_m_index[FLASH_LOG_KEY_COMMIT];
+
+  // nothing new to commit
+  if (ui16_commit != FLASH_LOG_NO_RECORD && record_seq(record_at(ui16_commit)) == ui32_m_seq &&
+      record_data(record_at(ui16_commit))[0] == ui32_key)
+    return true;
+
+  ui16_commit = append(FLASH_LOG_KEY_COMMIT, &ui32_key, 1, ++ui32_m_seq);
+  if (ui16_commit == FLASH_LOG_NO_RECORD)
+    return false;
+
+  for (uint8_t i = 0; i < FLASH_LOG_MAX_KEYS; i++) {
+    if (ui16_m_pending[i] != FLASH_LOG_NO_RECORD)
+      ui16_m_index[i] = ui16_m_pending[i];
+  }
+  memset(ui16_m_pending, 0xff, sizeof(ui16_m_pending));
+
+  ui16_m_index[FLASH_LOG_KEY_COMMIT] = ui16_commit;
+  ui32_m_commit_seq = ui32_m_seq;
+  return true;
+}
@@ -1,3559 +1,81 @@
 #include "fonts.h"
 
 #ifdef USE_FONT_61X99
-static __UG_FONT_DATA unsigned char BITS_FONT_61X99[95][792] =
-		{
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x20 ' '
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x21 '!'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0xFF,
-						0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00,
-						0xF0, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0xF0,
-						0xFF, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0xF0, 0xFF,
-						0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0xF0, 0xFF, 0x00,
-						0x00, 0x00, 0xF0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0xE0, 0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xE0,
-						0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x7F,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xE0, 0x7F,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0xE0, 0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xE0,
-						0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x7F,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00,
-						0xC0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0xC0,
-						0x3F, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0xC0, 0x3F,
-						0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0xC0, 0x3F, 0x00,
-						0x00, 0x00, 0xC0, 0x3F, 0x00, 0xC0, 0x3F, 0x00, 0x00,
-						0x00, 0xC0, 0x3F, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00,
-						0xC0, 0x3F, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x22 '"'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xC0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x01, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x01, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-						0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xF8,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xF8, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xF8, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x7F, 0x00, 0xF8, 0x03, 0x00, 0x00,
-						0x00, 0x80, 0x7F, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00,
-						0x80, 0x7F, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x80,
-						0x7F, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x80, 0x3F,
-						0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00,
-						0xFE, 0x01, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0xFE,
-						0x01, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0xFE, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0xFE, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x1F, 0x00, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x1F, 0x00, 0xFF, 0x00, 0x00, 0x00, 0xFE,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFE, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFE, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-						0xFF, 0xFF, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0x03, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
-						0x00, 0x00, 0xF8, 0x07, 0xC0, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x03, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x03, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03,
-						0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xE0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0xF0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0xF0, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xFF, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x7F,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-						0xF8, 0x03, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0xFC,
-						0x03, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0x1F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F,
-						0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00,
-						0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xFC,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFC, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFC, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0x1F, 0x00,
-						0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0xFF,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x0F, 0x80, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x0F, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x07, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x07, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07,
-						0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xC0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xC0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x03, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x01, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x01, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-						0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0xF0,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xF8, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0xF8, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x7F, 0x00, 0xF8, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x23 '#'
-				{ 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
-						0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFE,
-						0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-						0xFF, 0xFF, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x8F,
-						0xFF, 0x07, 0x00, 0x00, 0x80, 0xFF, 0xC7, 0x0F, 0xF8,
-						0x07, 0x00, 0x00, 0xC0, 0xFF, 0xC3, 0x0F, 0xC0, 0x07,
-						0x00, 0x00, 0xC0, 0xFF, 0xC1, 0x0F, 0x00, 0x07, 0x00,
-						0x00, 0xE0, 0xFF, 0xC0, 0x0F, 0x00, 0x04, 0x00, 0x00,
-						0xE0, 0x7F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x7F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
-						0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x3F, 0xC0, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x3F, 0xC0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x3F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x7F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x7F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
-						0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xC1,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xC1, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xC7, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0xCF, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0xDF, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xF7,
-						0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE7, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x87, 0xFF, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0xFF, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x07, 0xFF, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x07, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x07, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x07, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x07, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0xF8,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0xF8, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0xF8, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x07, 0xF8, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x07, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x07, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x07, 0xFC, 0x0F, 0x00, 0x00, 0x08, 0x00, 0xE0,
-						0x07, 0xFC, 0x0F, 0x00, 0x00, 0x38, 0x00, 0xE0, 0x07,
-						0xFE, 0x07, 0x00, 0x00, 0xF8, 0x00, 0xE0, 0x07, 0xFE,
-						0x07, 0x00, 0x00, 0xF8, 0x03, 0xE0, 0x07, 0xFF, 0x03,
-						0x00, 0x00, 0xF8, 0x1F, 0xE0, 0xC7, 0xFF, 0x03, 0x00,
-						0x00, 0xF8, 0xFF, 0xE0, 0xF7, 0xFF, 0x01, 0x00, 0x00,
-						0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8,
-						0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0xFF,
-						0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
-						0xFF, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x24 '$'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x0F, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0xF0,
-						0x0F, 0x00, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0x07,
-						0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF8, 0x03, 0xE0,
-						0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFC, 0x01, 0xF0, 0xFF,
-						0xFF, 0x01, 0x00, 0x00, 0xFE, 0x01, 0xF0, 0x0F, 0xFE,
-						0x03, 0x00, 0x00, 0xFE, 0x00, 0xF8, 0x07, 0xF8, 0x07,
-						0x00, 0x00, 0x7F, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0x00,
-						0x80, 0x7F, 0x00, 0xFC, 0x01, 0xE0, 0x0F, 0x00, 0xC0,
-						0x3F, 0x00, 0xFE, 0x01, 0xE0, 0x1F, 0x00, 0xC0, 0x1F,
-						0x00, 0xFE, 0x00, 0xC0, 0x1F, 0x00, 0xE0, 0x0F, 0x00,
-						0xFE, 0x00, 0xC0, 0x1F, 0x00, 0xF0, 0x0F, 0x00, 0x7F,
-						0x00, 0x80, 0x3F, 0x00, 0xF0, 0x07, 0x00, 0x7F, 0x00,
-						0x80, 0x3F, 0x00, 0xF8, 0x03, 0x00, 0x7F, 0x00, 0x80,
-						0x3F, 0x00, 0xFC, 0x03, 0x00, 0x7F, 0x00, 0x80, 0x3F,
-						0x00, 0xFC, 0x01, 0x00, 0x7F, 0x00, 0x80, 0x3F, 0x00,
-						0xFE, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x3F, 0x00, 0xFF,
-						0x00, 0x00, 0x7F, 0x00, 0x80, 0x3F, 0x80, 0x7F, 0x00,
-						0x00, 0x7F, 0x00, 0x80, 0x3F, 0x80, 0x3F, 0x00, 0x00,
-						0x7F, 0x00, 0x80, 0x3F, 0xC0, 0x1F, 0x00, 0x00, 0x7F,
-						0x00, 0x80, 0x3F, 0xE0, 0x1F, 0x00, 0x00, 0xFE, 0x00,
-						0xC0, 0x1F, 0xE0, 0x0F, 0x00, 0x00, 0xFE, 0x00, 0xC0,
-						0x1F, 0xF0, 0x07, 0x00, 0x00, 0xFE, 0x00, 0xE0, 0x1F,
-						0xF8, 0x07, 0x00, 0x00, 0xFC, 0x01, 0xE0, 0x0F, 0xFC,
-						0x03, 0x00, 0x00, 0xFC, 0x03, 0xF0, 0x0F, 0xFC, 0x01,
-						0x00, 0x00, 0xF8, 0x07, 0xF8, 0x07, 0xFE, 0x01, 0x00,
-						0x00, 0xF0, 0x0F, 0xFE, 0x03, 0xFF, 0x00, 0x00, 0x00,
-						0xF0, 0xFF, 0xFF, 0x03, 0x7F, 0x00, 0x00, 0x00, 0xE0,
-						0xFF, 0xFF, 0x81, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x7F, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F,
-						0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0xE0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x7F, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x80,
-						0x7F, 0xC0, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x80, 0x3F,
-						0xF0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0xF8,
-						0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0xF8, 0x07,
-						0xFF, 0x01, 0x00, 0x00, 0xF0, 0x0F, 0xFC, 0x03, 0xFC,
-						0x03, 0x00, 0x00, 0xF0, 0x07, 0xFE, 0x01, 0xF8, 0x07,
-						0x00, 0x00, 0xF8, 0x03, 0xFE, 0x00, 0xF0, 0x07, 0x00,
-						0x00, 0xFC, 0x03, 0xFF, 0x00, 0xF0, 0x0F, 0x00, 0x00,
-						0xFC, 0x01, 0x7F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0xFE,
-						0x00, 0x7F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0xFF, 0x80,
-						0x3F, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x7F, 0x80, 0x3F,
-						0x00, 0xC0, 0x1F, 0x00, 0x80, 0x3F, 0x80, 0x3F, 0x00,
-						0xC0, 0x1F, 0x00, 0xC0, 0x3F, 0x80, 0x3F, 0x00, 0xC0,
-						0x1F, 0x00, 0xE0, 0x1F, 0x80, 0x3F, 0x00, 0xC0, 0x1F,
-						0x00, 0xE0, 0x0F, 0x80, 0x3F, 0x00, 0xC0, 0x1F, 0x00,
-						0xF0, 0x07, 0x80, 0x3F, 0x00, 0xC0, 0x1F, 0x00, 0xF8,
-						0x07, 0x80, 0x3F, 0x00, 0xC0, 0x1F, 0x00, 0xF8, 0x03,
-						0x80, 0x3F, 0x00, 0xC0, 0x1F, 0x00, 0xFC, 0x01, 0x80,
-						0x3F, 0x00, 0xC0, 0x1F, 0x00, 0xFE, 0x01, 0x00, 0x7F,
-						0x00, 0xE0, 0x0F, 0x00, 0xFE, 0x00, 0x00, 0x7F, 0x00,
-						0xE0, 0x0F, 0x00, 0x7F, 0x00, 0x00, 0x7F, 0x00, 0xF0,
-						0x0F, 0x80, 0x7F, 0x00, 0x00, 0xFE, 0x00, 0xF0, 0x07,
-						0xC0, 0x3F, 0x00, 0x00, 0xFE, 0x01, 0xF8, 0x07, 0xC0,
-						0x1F, 0x00, 0x00, 0xFC, 0x03, 0xFC, 0x03, 0xE0, 0x0F,
-						0x00, 0x00, 0xF8, 0x07, 0xFF, 0x01, 0xF0, 0x0F, 0x00,
-						0x00, 0xF8, 0xFF, 0xFF, 0x01, 0xF0, 0x07, 0x00, 0x00,
-						0xF0, 0xFF, 0xFF, 0x00, 0xF8, 0x03, 0x00, 0x00, 0xC0,
-						0xFF, 0x3F, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x80, 0xFF,
-						0x1F, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0xFC, 0x03,
-						0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x25 '%'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x0F, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07,
-						0xF8, 0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0xF0,
-						0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0xF0, 0x7F,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0xF0,
-						0x3F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0xF0, 0x3F,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0xF0, 0x3F, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0x01, 0xF8, 0x1F, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x01, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x03, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x03, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x03, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xC7,
-						0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xF7, 0xFF,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0xFF, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0xFE, 0xFF, 0xFF, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0xFF, 0xDF, 0xFF, 0x01, 0x00, 0xF8,
-						0x1F, 0x80, 0xFF, 0xC7, 0xFF, 0x01, 0x00, 0xF8, 0x1F,
-						0xC0, 0xFF, 0x83, 0xFF, 0x03, 0x00, 0xF8, 0x1F, 0xE0,
-						0xFF, 0x80, 0xFF, 0x03, 0x00, 0xF8, 0x0F, 0xF0, 0x7F,
-						0x00, 0xFF, 0x07, 0x00, 0xF8, 0x0F, 0xF0, 0x3F, 0x00,
-						0xFF, 0x07, 0x00, 0xF8, 0x0F, 0xF8, 0x1F, 0x00, 0xFE,
-						0x0F, 0x00, 0xF8, 0x0F, 0xF8, 0x1F, 0x00, 0xFC, 0x1F,
-						0x00, 0xF8, 0x0F, 0xFC, 0x0F, 0x00, 0xFC, 0x1F, 0x00,
-						0xF8, 0x0F, 0xFC, 0x0F, 0x00, 0xF8, 0x3F, 0x00, 0xFC,
-						0x07, 0xFC, 0x07, 0x00, 0xF8, 0x7F, 0x00, 0xFC, 0x07,
-						0xFE, 0x07, 0x00, 0xF0, 0xFF, 0x00, 0xFC, 0x07, 0xFE,
-						0x07, 0x00, 0xE0, 0xFF, 0x00, 0xFC, 0x07, 0xFE, 0x07,
-						0x00, 0xE0, 0xFF, 0x01, 0xFC, 0x03, 0xFE, 0x07, 0x00,
-						0xC0, 0xFF, 0x03, 0xFE, 0x03, 0xFE, 0x07, 0x00, 0x80,
-						0xFF, 0x03, 0xFE, 0x03, 0xFE, 0x07, 0x00, 0x80, 0xFF,
-						0x07, 0xFE, 0x01, 0xFE, 0x07, 0x00, 0x00, 0xFF, 0x0F,
-						0xFF, 0x01, 0xFE, 0x07, 0x00, 0x00, 0xFE, 0x1F, 0xFF,
-						0x00, 0xFE, 0x0F, 0x00, 0x00, 0xFE, 0xBF, 0xFF, 0x00,
-						0xFE, 0x0F, 0x00, 0x00, 0xFC, 0xBF, 0x7F, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0xF8, 0xFF, 0x7F, 0x00, 0xFC, 0x1F,
-						0x00, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0xFC, 0x1F, 0x00,
-						0x00, 0xF0, 0xFF, 0x1F, 0x00, 0xFC, 0x3F, 0x00, 0x00,
-						0xE0, 0xFF, 0x1F, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xC0,
-						0xFF, 0x0F, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x80, 0xFF,
-						0x07, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x80, 0xFF, 0x0F,
-						0x00, 0xF0, 0xFF, 0x01, 0x00, 0xC0, 0xFF, 0x1F, 0x00,
-						0xE0, 0xFF, 0x03, 0x00, 0xF0, 0xFF, 0x3F, 0x00, 0xC0,
-						0xFF, 0x0F, 0x00, 0xFC, 0xFF, 0x7F, 0x00, 0x80, 0xFF,
-						0x7F, 0x80, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0xFF,
-						0xFF, 0xF7, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
-						0xE1, 0xFF, 0x07, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x80,
-						0xFF, 0x0F, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0xFF,
-						0x1F, 0x00, 0x00, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x26 '&'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x27 '''
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x28 '('
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0xFF, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x29 ')'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x10, 0x00, 0xF8, 0x07, 0x00, 0x02, 0x00,
-						0x00, 0x78, 0x00, 0xF8, 0x07, 0x80, 0x07, 0x00, 0x00,
-						0xF8, 0x01, 0xF0, 0x03, 0xE0, 0x07, 0x00, 0x00, 0xF8,
-						0x07, 0xF0, 0x03, 0xF8, 0x07, 0x00, 0x00, 0xFC, 0x1F,
-						0xF0, 0x03, 0xFE, 0x0F, 0x00, 0x00, 0xFC, 0x7F, 0xF0,
-						0x83, 0xFF, 0x0F, 0x00, 0x00, 0xFC, 0xFF, 0x03, 0xE0,
-						0xFF, 0x0F, 0x00, 0x00, 0xFE, 0xFF, 0x07, 0xF8, 0xFF,
-						0x1F, 0x00, 0x00, 0xFE, 0xFF, 0x03, 0xF0, 0xFF, 0x1F,
-						0x00, 0x00, 0xF8, 0xFF, 0x03, 0xF0, 0xFF, 0x07, 0x00,
-						0x00, 0x80, 0xFF, 0x01, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x01, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0x01, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x10,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x38, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x7E, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0x3F, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x1F, 0xFE, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x1F, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x0F, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x0F, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0xF0,
-						0x3F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0xF0, 0x7F,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0xE0, 0xFF, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x01, 0xE0, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x7C, 0x00, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x70, 0x00, 0x80, 0x03, 0x00, 0x00, 0x00, 0x00, 0x20,
-						0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2A '*'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00,
-						0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xE0,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xE0, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2B '+'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2C ','
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFC,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFC, 0xFF,
-						0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
-						0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-						0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2D '-'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2E '.'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2F '/'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-						0x07, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01,
-						0xF0, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0,
-						0xFF, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x80, 0xFF,
-						0x01, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFF, 0x03,
-						0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFE, 0x03, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
-						0xFC, 0x07, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xFE,
-						0x07, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xFE, 0x03,
-						0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFF, 0x03, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00,
-						0xF0, 0x1F, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xF0,
-						0x1F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x3F,
-						0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x3F, 0x00,
-						0x80, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0xC0,
-						0xFF, 0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0xC0, 0xFF,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0xFF, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0xFF, 0x00, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00,
-						0xE0, 0x7F, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xC0,
-						0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0x7F,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0xE0, 0x7F,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0xE0, 0x7F,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xC0, 0x7F,
-						0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-						0xC0, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0,
-						0xFF, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0xFF,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0xC0, 0xFF, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0xFF, 0x00, 0x00,
-						0x00, 0xE0, 0x3F, 0x00, 0x80, 0xFF, 0x00, 0x00, 0x00,
-						0xE0, 0x3F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xF0,
-						0x3F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x3F,
-						0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x1F, 0x00,
-						0x00, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
-						0xFF, 0x03, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE,
-						0x03, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFE, 0x03,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xFC, 0x07, 0x00,
-						0x00, 0xFC, 0x07, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0xFE, 0x07, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFE,
-						0x03, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFF, 0x03,
-						0x00, 0x00, 0xF0, 0x3F, 0x00, 0x80, 0xFF, 0x01, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00,
-						0xE0, 0xFF, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0x07, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-						0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x30 '0'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0xFF, 0xEF, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0xFF, 0xE1, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x3F, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x07, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFE,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFE, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFE, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFE, 0xFF, 0xFF, 0xFF,
-						0xFF, 0xFF, 0x07, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x07, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x31 '1'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
-						0xFC, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xFC,
-						0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xFC, 0x7F,
-						0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00,
-						0xFC, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0xF8,
-						0x7F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x00, 0xF0, 0xFF,
-						0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0xE0, 0xFF, 0x00,
-						0x00, 0x00, 0x04, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
-						0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-						0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
-						0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x32 '2'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00,
-						0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0xE0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0,
-						0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF,
-						0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00,
-						0xF8, 0xFF, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0xF0,
-						0xFF, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0xE0, 0xFF,
-						0x01, 0x00, 0x00, 0x20, 0x00, 0x00, 0xC0, 0xFF, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03,
-						0x00, 0x00, 0x10, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00,
-						0x00, 0xF0, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00,
-						0xF0, 0x07, 0x00, 0xFC, 0xFF, 0x00, 0x00, 0x00, 0xF0,
-						0x7F, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0xFF,
-						0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
-						0xFF, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
-						0x07, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x33 '3'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0xFB, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0xF9, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF9,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xF8, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0xF8, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0x7F, 0xF8, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x3F, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x1F, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x1F, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x0F, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0xF8,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0xF8, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x01, 0xF8, 0x1F, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-						0x80, 0x7F, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xC0,
-						0x7F, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0x3F,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0xF8,
-						0x1F, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0xF8, 0x1F,
-						0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0xF8, 0x1F, 0x00,
-						0x00, 0x00, 0xFC, 0x07, 0x00, 0xF8, 0x1F, 0x00, 0x00,
-						0x00, 0xFE, 0x03, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-						0xFE, 0x03, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0xFF,
-						0x01, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x80, 0xFF, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0x80, 0xFF, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0xF8,
-						0x1F, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xF8, 0x1F,
-						0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xF8, 0x1F, 0x00,
-						0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00,
-						0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xE0,
-						0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xE0, 0xFF,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0xFF,
-						0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
-						0xFF, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x34 '4'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01,
-						0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00,
-						0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-						0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xC0,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF,
-						0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
-						0xFF, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF,
-						0x01, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-						0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
-						0xFF, 0x03, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00,
-						0x00, 0x00, 0x20, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00,
-						0x00, 0xE0, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00,
-						0xE0, 0x07, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0xE0,
-						0x7F, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0xFF,
-						0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
-						0xFF, 0x07, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x35 '5'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x0F, 0x00,
-						0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
-						0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0xF0, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF8,
-						0xFF, 0x01, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0xFC, 0x3F,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0xFE, 0x1F, 0x00,
-						0x80, 0x0F, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00,
-						0x0E, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x08,
-						0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x80, 0xFF, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x03, 0xF8, 0xFF, 0x07, 0x00,
-						0x00, 0x00, 0xFE, 0x03, 0xFE, 0xFF, 0x1F, 0x00, 0x00,
-						0x00, 0xFF, 0x03, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00,
-						0xFF, 0xC3, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF,
-						0xE3, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xFF, 0xF3,
-						0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFF, 0xFB, 0x1F,
-						0xF0, 0xFF, 0x07, 0x00, 0x00, 0xFF, 0xFB, 0x03, 0xC0,
-						0xFF, 0x07, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0xFF,
-						0x0F, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0x00, 0xFE, 0x1F,
-						0x00, 0x00, 0xFF, 0x7F, 0x00, 0x00, 0xFC, 0x1F, 0x00,
-						0x00, 0xFF, 0x3F, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00,
-						0xFF, 0x1F, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xFF,
-						0x1F, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xFF, 0x0F,
-						0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xFF, 0x0F, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00,
-						0xE0, 0x7F, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0xE0,
-						0xFF, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0xE0, 0xFF,
-						0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0x00,
-						0x00, 0xFF, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00,
-						0xFE, 0x07, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xFE,
-						0x07, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xFE, 0x07,
-						0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xFE, 0x07, 0x00,
-						0x00, 0xC0, 0xFF, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
-						0xC0, 0xFF, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xC0,
-						0xFF, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xC0, 0xFF,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xC0, 0x7F, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0xF8, 0x0F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF8,
-						0x0F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF8, 0x1F,
-						0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0xF0, 0x1F, 0x00,
-						0x00, 0xF0, 0x3F, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00,
-						0xF0, 0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xF8,
-						0x1F, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xFC, 0x0F, 0x00,
-						0x00, 0xC0, 0xFF, 0x01, 0x00, 0xFF, 0x07, 0x00, 0x00,
-						0x80, 0xFF, 0x07, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00,
-						0xFF, 0x1F, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xFE,
-						0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFC, 0xFF,
-						0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x36 '6'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F,
-						0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00,
-						0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
-						0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFC,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFC, 0xFF,
-						0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFC, 0xFF, 0xFF,
-						0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x3F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x37 '7'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x80, 0xFF,
-						0x0F, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0x80, 0xFF, 0x03,
-						0xE0, 0xFF, 0x01, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0xC0,
-						0xFF, 0x03, 0x00, 0x00, 0xC0, 0xFF, 0x00, 0x80, 0xFF,
-						0x03, 0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xFF, 0x07,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0xFF, 0x07, 0x00,
-						0x00, 0xE0, 0x7F, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00,
-						0xF0, 0x3F, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xF0,
-						0x3F, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xF0, 0x3F,
-						0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xF0, 0x3F, 0x00,
-						0x00, 0xFE, 0x07, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00,
-						0xFE, 0x07, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFE,
-						0x07, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFE, 0x03,
-						0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0xFF, 0x03, 0x00,
-						0x00, 0xF0, 0x7F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00,
-						0xE0, 0xFF, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xE0,
-						0xFF, 0x01, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0xFF,
-						0x01, 0x80, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03,
-						0xC0, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x07, 0xE0,
-						0x7F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0xE0, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F, 0xF0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0xFF, 0xF8, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0xFF, 0xFD, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
-						0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0xE7, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0xC3, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x01, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xE0,
-						0xFF, 0x00, 0xFE, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x7F,
-						0x00, 0xF8, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x3F, 0x00,
-						0xF0, 0xFF, 0x07, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0xE0,
-						0xFF, 0x07, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x80, 0xFF,
-						0x0F, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x80, 0xFF, 0x0F,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xFF, 0x1F, 0x00,
-						0x00, 0xFE, 0x07, 0x00, 0x00, 0xFE, 0x1F, 0x00, 0x00,
-						0xFE, 0x07, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xFE,
-						0x07, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFF, 0x03,
-						0x00, 0x00, 0xF8, 0x3F, 0x00, 0x00, 0xFF, 0x03, 0x00,
-						0x00, 0xF8, 0x3F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00,
-						0xF0, 0x3F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xF0,
-						0x3F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x3F,
-						0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x3F, 0x00,
-						0x00, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00,
-						0xFF, 0x03, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFF,
-						0x07, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0xFF, 0x07,
-						0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x07, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0xFC,
-						0x0F, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xFE, 0x0F,
-						0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0xFF, 0x07, 0x00,
-						0x00, 0xF8, 0x7F, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00,
-						0xF0, 0xFF, 0x01, 0xC0, 0xFF, 0x03, 0x00, 0x00, 0xF0,
-						0xFF, 0x07, 0xF8, 0xFF, 0x01, 0x00, 0x00, 0xE0, 0xFF,
-						0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF,
-						0xFF, 0x7F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x38 '8'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xE0, 0xFF,
-						0x03, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00,
-						0xF0, 0xFF, 0x00, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0xC0,
-						0xFF, 0x01, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x80, 0xFF,
-						0x01, 0x00, 0x00, 0xF8, 0x1F, 0x00, 0x00, 0xFF, 0x03,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xFF, 0x03, 0x00,
-						0x00, 0xFE, 0x07, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00,
-						0xFE, 0x07, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0xFE,
-						0x03, 0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0xFF, 0x03,
-						0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFF, 0x03, 0x00,
-						0x00, 0xF8, 0x0F, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0xF8,
-						0x1F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x1F,
-						0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x1F, 0x00,
-						0x80, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x80,
-						0xFF, 0x01, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x80, 0xFF,
-						0x01, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x80, 0xFF, 0x01,
-						0x00, 0x00, 0xF0, 0x3F, 0x00, 0x80, 0xFF, 0x01, 0x00,
-						0x00, 0xF0, 0x3F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
-						0xF0, 0x3F, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00, 0xF0,
-						0x7F, 0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0xF0, 0x7F,
-						0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0x7F, 0x00,
-						0x00, 0xFF, 0x03, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00,
-						0xFF, 0x03, 0x00, 0x00, 0xF8, 0x7F, 0x00, 0x00, 0xFF,
-						0x07, 0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFF, 0x07,
-						0x00, 0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFE, 0x0F, 0x00,
-						0x00, 0xFC, 0x7F, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00,
-						0xFE, 0x7F, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0xFF,
-						0x7F, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x80, 0xFF, 0x7F,
-						0x00, 0x00, 0xF8, 0x7F, 0x00, 0xC0, 0xFF, 0x7F, 0x00,
-						0x00, 0xF0, 0xFF, 0x01, 0xE0, 0xEF, 0x7F, 0x00, 0x00,
-						0xF0, 0xFF, 0x07, 0xFC, 0xEF, 0x7F, 0x00, 0x00, 0xE0,
-						0xFF, 0xFF, 0xFF, 0xE7, 0x7F, 0x00, 0x00, 0xC0, 0xFF,
-						0xFF, 0xFF, 0xE3, 0x7F, 0x00, 0x00, 0x80, 0xFF, 0xFF,
-						0xFF, 0xE1, 0x7F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x7F,
-						0xE0, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x3F, 0xE0,
-						0x3F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0xE0, 0x3F,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x00, 0xF0, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-						0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0xE0, 0xFF, 0x00,
-						0x00, 0x00, 0x38, 0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00,
-						0x00, 0xF8, 0x00, 0x00, 0xFC, 0x3F, 0x00, 0x00, 0x00,
-						0xF8, 0x07, 0x00, 0xFE, 0x1F, 0x00, 0x00, 0x00, 0xF8,
-						0x3F, 0xC0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xF8, 0xFF,
-						0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
-						0xFF, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
-						0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } // 0x39 '9'
-		};
-static UG_U8 WITHS_FONT_61X99[] = { 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61,
-		61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61, 61 };
-const UG_FONT FONT_61X99 = { (unsigned char*) BITS_FONT_61X99, FONT_TYPE_1BPP,
-		61, 99, 32, 58, WITHS_FONT_61X99 };
+static __UG_FONT_DATA unsigned char BITS_FONT_61X99[] = {
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x16, // 0x20 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x07,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x33,0x48,0x33,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x14,0x4B,0x30,0x4B,0x30,0x4B,0x30,0x4B,0x30,0x4B,0x30,0x4B,0x30,0x4B,0x30,0x4B,0x30,0x4B,0x30,0x4B,0x30,0x4B,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1B, // 0x21 '!'
+  0x3F,0x08,0x4B,0x0B,0x4B,0x18,0x4B,0x0B,0x4B,0x18,0x4B,0x0B,0x4B,0x18,0x4B,0x0B,0x4B,0x18,0x4B,0x0B,0x4B,0x18,0x4B,0x0B,0x4B,0x18,0x4B,0x0B,0x4B,0x19,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1B,0x48,0x0E,0x48,0x1B,0x47,0x0F,0x47,0x1C,0x47,0x0F,0x47,0x1C,0x47,0x0F,0x47,0x1C,0x47,0x0F,0x47,0x1C,0x47,0x0F,0x47,0x1C,0x47,0x0F,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x39, // 0x22 '"'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x08,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x22,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x22,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x15,0x71,0x0A,0x71,0x0A,0x71,0x09,0x71,0x0A,0x71,0x0A,0x71,0x0A,0x71,0x15,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x22,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x22,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x15,0x71,0x0A,0x71,0x0A,0x71,0x0A,0x71,0x09,0x71,0x0A,0x71,0x0A,0x71,0x15,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x22,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x22,0x46,0x0B,0x46,0x21,0x47,0x0A,0x47,0x21,0x47,0x0A,0x47,0x21,0x46,0x0B,0x46,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1E, // 0x23 '#'
+  0x1D,0x45,0x36,0x45,0x36,0x45,0x36,0x45,0x36,0x45,0x36,0x45,0x33,0x4D,0x2A,0x56,0x23,0x5B,0x1F,0x5E,0x1B,0x60,0x1A,0x61,0x19,0x62,0x18,0x54,0x02,0x4B,0x18,0x4B,0x02,0x45,0x06,0x47,0x17,0x4B,0x03,0x45,0x09,0x44,0x17,0x4A,0x04,0x45,0x0B,0x42,0x16,0x4A,0x05,0x45,0x0D,0x40,0x16,0x49,0x06,0x45,0x24,0x4A,0x06,0x45,0x24,0x49,0x07,0x45,0x24,0x49,0x07,0x45,0x24,0x49,0x07,0x45,0x24,0x49,0x07,0x45,0x24,0x49,0x07,0x45,0x24,0x49,0x07,0x45,0x24,0x49,0x07,0x45,0x24,0x4A,0x06,0x45,0x25,0x49,0x06,0x45,0x25,0x4A,0x05,0x45,0x25,0x4B,0x04,0x45,0x26,0x4A,0x04,0x45,0x26,0x4C,0x02,0x45,0x27,0x4C,0x01,0x45,0x28,0x4C,0x00,0x45,0x28,0x53,0x29,0x52,0x2A,0x51,0x2B,0x50,0x2C,0x50,0x2D,0x50,0x2C,0x51,0x2C,0x50,0x2C,0x50,0x2D,0x50,0x2C,0x50,0x2B,0x51,0x2A,0x52,0x29,0x53,0x28,0x45,0x00,0x4D,0x27,0x45,0x01,0x4C,0x27,0x45,0x03,0x4B,0x26,0x45,0x04,0x4A,0x26,0x45,0x04,0x4B,0x25,0x45,0x05,0x4A,0x25,0x45,0x06,0x49,0x25,0x45,0x06,0x4A,0x24,0x45,0x07,0x49,0x24,0x45,0x07,0x49,0x24,0x45,0x07,0x49,0x24,0x45,0x07,0x49,0x24,0x45,0x07,0x49,0x24,0x45,0x07,0x49,0x24,0x45,0x07,0x49,0x24,0x45,0x07,0x48,0x25,0x45,0x06,0x49,0x13,0x40,0x10,0x45,0x06,0x49,0x13,0x42,0x0E,0x45,0x05,0x49,0x14,0x44,0x0C,0x45,0x05,0x49,0x14,0x46,0x0A,0x45,0x04,0x49,0x15,0x49,0x07,0x45,0x02,0x4B,0x15,0x4C,0x04,0x45,0x00,0x4C,0x16,0x64,0x17,0x63,0x18,0x62,0x1A,0x60,0x1E,0x5B,0x23,0x56,0x2A,0x4E,0x33,0x45,0x36,0x45,0x36,0x45,0x36,0x45,0x36,0x45,0x36,0x45,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x2F, // 0x24 '$'
+  0x3F,0x3F,0x3F,0x3F,0x28,0x47,0x34,0x46,0x0B,0x47,0x20,0x47,0x08,0x4D,0x1C,0x47,0x08,0x4F,0x1B,0x46,0x07,0x52,0x19,0x46,0x07,0x54,0x17,0x47,0x07,0x47,0x04,0x48,0x16,0x46,0x07,0x47,0x07,0x47,0x14,0x46,0x07,0x47,0x09,0x47,0x12,0x47,0x07,0x46,0x0B,0x46,0x11,0x47,0x07,0x47,0x0B,0x47,0x10,0x46,0x08,0x46,0x0D,0x46,0x0F,0x46,0x09,0x46,0x0D,0x46,0x0E,0x47,0x08,0x46,0x0F,0x46,0x0D,0x46,0x09,0x46,0x0F,0x46,0x0C,0x46,0x0A,0x46,0x0F,0x46,0x0B,0x47,0x0A,0x46,0x0F,0x46,0x0B,0x46,0x0B,0x46,0x0F,0x46,0x0A,0x46,0x0C,0x46,0x0F,0x46,0x09,0x47,0x0C,0x46,0x0F,0x46,0x08,0x47,0x0D,0x46,0x0F,0x46,0x08,0x46,0x0E,0x46,0x0F,0x46,0x07,0x46,0x0F,0x46,0x0F,0x46,0x06,0x47,0x10,0x46,0x0D,0x46,0x07,0x46,0x11,0x46,0x0D,0x46,0x06,0x46,0x12,0x46,0x0C,0x47,0x05,0x47,0x13,0x46,0x0B,0x46,0x05,0x47,0x14,0x47,0x09,0x47,0x05,0x46,0x16,0x47,0x07,0x47,0x05,0x47,0x17,0x47,0x04,0x48,0x05,0x47,0x18,0x55,0x05,0x46,0x1A,0x53,0x05,0x46,0x1D,0x4F,0x06,0x47,0x1E,0x4D,0x07,0x46,0x22,0x47,0x09,0x46,0x34,0x47,0x33,0x47,0x34,0x46,0x34,0x47,0x33,0x47,0x34,0x46,0x09,0x47,0x22,0x46,0x07,0x4D,0x1E,0x47,0x06,0x4F,0x1D,0x46,0x05,0x52,0x1B,0x46,0x05,0x54,0x19,0x47,0x05,0x47,0x04,0x48,0x17,0x47,0x05,0x47,0x07,0x47,0x16,0x46,0x05,0x47,0x09,0x47,0x14,0x46,0x06,0x46,0x0B,0x46,0x13,0x47,0x05,0x47,0x0B,0x47,0x12,0x46,0x06,0x46,0x0D,0x46,0x11,0x46,0x07,0x46,0x0D,0x46,0x10,0x47,0x06,0x46,0x0F,0x46,0x0F,0x46,0x07,0x46,0x0F,0x46,0x0E,0x46,0x08,0x46,0x0F,0x46,0x0D,0x47,0x08,0x46,0x0F,0x46,0x0C,0x47,0x09,0x46,0x0F,0x46,0x0C,0x46,0x0A,0x46,0x0F,0x46,0x0B,0x46,0x0B,0x46,0x0F,0x46,0x0A,0x47,0x0B,0x46,0x0F,0x46,0x0A,0x46,0x0C,0x46,0x0F,0x46,0x09,0x46,0x0D,0x46,0x0F,0x46,0x08,0x47,0x0E,0x46,0x0D,0x46,0x09,0x46,0x0F,0x46,0x0D,0x46,0x08,0x46,0x10,0x46,0x0C,0x47,0x07,0x47,0x11,0x46,0x0B,0x46,0x07,0x47,0x12,0x47,0x09,0x47,0x07,0x46,0x14,0x47,0x07,0x47,0x07,0x46,0x16,0x47,0x04,0x48,0x07,0x47,0x16,0x55,0x07,0x46,0x18,0x53,0x07,0x46,0x1B,0x4F,0x08,0x47,0x1C,0x4D,0x08,0x47,0x20,0x47,0x0B,0x46,0x34,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3E, // 0x25 '%'
+  0x3F,0x3F,0x3F,0x3F,0x0D,0x49,0x2F,0x4F,0x2A,0x52,0x28,0x55,0x25,0x57,0x23,0x59,0x21,0x5B,0x1F,0x4B,0x04,0x4B,0x1F,0x4A,0x07,0x4A,0x1D,0x4A,0x09,0x49,0x1D,0x49,0x0A,0x4A,0x1C,0x49,0x0B,0x49,0x1B,0x49,0x0C,0x49,0x1B,0x49,0x0C,0x49,0x1B,0x49,0x0C,0x49,0x1B,0x49,0x0C,0x49,0x1B,0x49,0x0C,0x49,0x1B,0x49,0x0C,0x49,0x1B,0x49,0x0B,0x49,0x1C,0x4A,0x0A,0x49,0x1C,0x4A,0x0A,0x49,0x1D,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x4A,0x07,0x49,0x20,0x49,0x06,0x49,0x21,0x49,0x05,0x49,0x22,0x4A,0x02,0x4A,0x24,0x49,0x00,0x4B,0x25,0x55,0x27,0x53,0x28,0x52,0x29,0x50,0x2B,0x4F,0x2A,0x4F,0x2A,0x4F,0x2A,0x52,0x28,0x53,0x13,0x49,0x08,0x56,0x12,0x49,0x07,0x4C,0x00,0x4A,0x11,0x49,0x06,0x4B,0x02,0x4A,0x11,0x49,0x05,0x4B,0x04,0x4A,0x10,0x49,0x04,0x4A,0x06,0x4A,0x10,0x48,0x04,0x4A,0x08,0x4A,0x0F,0x48,0x04,0x49,0x09,0x4A,0x0F,0x48,0x03,0x49,0x0B,0x4A,0x0E,0x48,0x03,0x49,0x0C,0x4A,0x0D,0x48,0x02,0x49,0x0D,0x4A,0x0D,0x48,0x02,0x49,0x0E,0x4A,0x0B,0x48,0x03,0x48,0x0F,0x4B,0x0A,0x48,0x02,0x49,0x10,0x4B,0x09,0x48,0x02,0x49,0x11,0x4A,0x09,0x48,0x02,0x49,0x11,0x4B,0x08,0x47,0x03,0x49,0x12,0x4B,0x06,0x48,0x03,0x49,0x13,0x4A,0x06,0x48,0x03,0x49,0x13,0x4B,0x05,0x47,0x04,0x49,0x14,0x4B,0x03,0x48,0x04,0x49,0x15,0x4B,0x02,0x47,0x05,0x4A,0x14,0x4C,0x00,0x48,0x05,0x4A,0x15,0x4B,0x00,0x47,0x07,0x49,0x16,0x53,0x07,0x4A,0x16,0x51,0x08,0x4A,0x16,0x50,0x09,0x4B,0x16,0x4F,0x0A,0x4A,0x17,0x4D,0x0B,0x4B,0x17,0x4B,0x0D,0x4B,0x16,0x4C,0x0C,0x4C,0x14,0x4E,0x0C,0x4C,0x11,0x51,0x0C,0x4D,0x0D,0x54,0x0C,0x4F,0x07,0x58,0x0C,0x70,0x0C,0x61,0x00,0x4D,0x0C,0x5E,0x03,0x4D,0x0D,0x5B,0x06,0x4C,0x0D,0x58,0x09,0x4C,0x0F,0x52,0x2C,0x4B,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x27, // 0x26 '&'
+  0x3F,0x13,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2E,0x4C,0x2F,0x4C,0x2F,0x4C,0x2F,0x4C,0x2F,0x4C,0x2F,0x4C,0x2F,0x4C,0x2F,0x4C,0x30,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x31,0x4A,0x32,0x48,0x33,0x48,0x33,0x48,0x33,0x48,0x33,0x48,0x33,0x48,0x33,0x48,0x33,0x48,0x34,0x46,0x35,0x46,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x0E, // 0x27 '''
+  0x3F,0x2E,0x43,0x34,0x47,0x31,0x4A,0x2F,0x4C,0x2D,0x4E,0x2C,0x4F,0x2A,0x4F,0x2B,0x4C,0x2D,0x4C,0x2E,0x4B,0x2F,0x4B,0x2F,0x4A,0x30,0x4A,0x30,0x4A,0x31,0x49,0x31,0x49,0x31,0x49,0x31,0x49,0x32,0x48,0x32,0x49,0x31,0x49,0x32,0x49,0x31,0x49,0x32,0x49,0x31,0x49,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x49,0x31,0x49,0x32,0x49,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x31,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x33,0x48,0x33,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x33,0x48,0x33,0x49,0x32,0x49,0x32,0x49,0x33,0x48,0x33,0x49,0x33,0x48,0x33,0x49,0x32,0x49,0x33,0x48,0x33,0x49,0x33,0x48,0x33,0x49,0x33,0x49,0x33,0x48,0x33,0x49,0x33,0x49,0x33,0x49,0x33,0x49,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x4B,0x31,0x4C,0x31,0x4C,0x30,0x4E,0x2E,0x50,0x2D,0x4E,0x2F,0x4C,0x31,0x4A,0x34,0x47,0x38,0x43,0x3F,0x3F,0x3F,0x3F,0x37, // 0x28 '('
+  0x3F,0x03,0x43,0x38,0x47,0x34,0x4A,0x31,0x4C,0x2F,0x4E,0x2D,0x4F,0x2E,0x4F,0x2F,0x4D,0x31,0x4C,0x31,0x4B,0x31,0x4B,0x32,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x49,0x33,0x49,0x33,0x49,0x33,0x49,0x33,0x48,0x33,0x49,0x33,0x49,0x32,0x49,0x33,0x49,0x32,0x49,0x33,0x49,0x32,0x49,0x33,0x48,0x33,0x49,0x32,0x49,0x33,0x48,0x33,0x49,0x32,0x49,0x33,0x48,0x33,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x33,0x48,0x33,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x49,0x31,0x49,0x32,0x49,0x31,0x49,0x32,0x49,0x31,0x49,0x32,0x48,0x32,0x49,0x31,0x49,0x31,0x49,0x31,0x49,0x31,0x4A,0x30,0x4A,0x30,0x4A,0x2F,0x4B,0x2F,0x4B,0x2E,0x4C,0x2D,0x4C,0x2C,0x4E,0x2A,0x50,0x2B,0x4E,0x2D,0x4C,0x2F,0x4A,0x31,0x47,0x34,0x43,0x3F,0x3F,0x3F,0x3F,0x3F,0x22, // 0x29 ')'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x07,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x33,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x34,0x47,0x25,0x40,0x0D,0x47,0x0D,0x40,0x15,0x43,0x0B,0x47,0x0B,0x43,0x14,0x45,0x0A,0x45,0x0A,0x45,0x14,0x47,0x08,0x45,0x08,0x47,0x13,0x4A,0x06,0x45,0x06,0x4A,0x12,0x4C,0x04,0x45,0x04,0x4C,0x12,0x4F,0x0A,0x4E,0x11,0x51,0x07,0x51,0x10,0x50,0x09,0x50,0x12,0x4E,0x09,0x4E,0x18,0x49,0x0B,0x49,0x20,0x45,0x0B,0x45,0x28,0x41,0x0B,0x41,0x3F,0x3F,0x28,0x40,0x09,0x40,0x2F,0x42,0x07,0x42,0x2D,0x45,0x03,0x45,0x2B,0x47,0x01,0x47,0x29,0x47,0x03,0x47,0x27,0x48,0x03,0x48,0x25,0x48,0x05,0x48,0x23,0x49,0x05,0x49,0x21,0x49,0x07,0x49,0x1F,0x49,0x09,0x49,0x1D,0x4A,0x09,0x4A,0x1B,0x4A,0x0B,0x4A,0x1C,0x48,0x0B,0x48,0x1F,0x46,0x0D,0x46,0x21,0x44,0x0F,0x44,0x24,0x42,0x0F,0x42,0x27,0x40,0x11,0x40,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3A, // 0x2A '*'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x06,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x1F,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x09,0x72,0x1F,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1E, // 0x2B '+'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x16,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x33,0x48,0x33,0x47,0x34,0x47,0x34,0x47,0x33,0x48,0x33,0x47,0x34,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x31,0x49,0x31,0x49,0x32,0x48,0x33,0x47,0x34,0x45,0x36,0x42,0x3F,0x3F,0x3F,0x3F,0x16, // 0x2C ','
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x02,0x67,0x14,0x67,0x14,0x67,0x14,0x67,0x14,0x67,0x14,0x67,0x14,0x67,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3D, // 0x2D '-'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x16,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x2D,0x4E,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1A, // 0x2E '.'
+  0x3F,0x2D,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x47,0x34,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x33,0x48,0x33,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x21, // 0x2F '/'
+  0x3F,0x3F,0x3F,0x3F,0x0D,0x48,0x2F,0x50,0x29,0x54,0x26,0x56,0x23,0x5A,0x20,0x5C,0x1E,0x5E,0x1C,0x4C,0x06,0x4C,0x1A,0x4B,0x0A,0x4B,0x19,0x49,0x0E,0x49,0x18,0x49,0x10,0x49,0x16,0x49,0x12,0x49,0x15,0x48,0x14,0x48,0x14,0x49,0x14,0x49,0x13,0x48,0x16,0x48,0x12,0x49,0x16,0x49,0x11,0x48,0x18,0x48,0x10,0x49,0x18,0x49,0x0F,0x48,0x1A,0x48,0x0F,0x48,0x1A,0x48,0x0E,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x48,0x1C,0x48,0x0C,0x49,0x1C,0x48,0x0C,0x49,0x1C,0x49,0x0B,0x49,0x1C,0x49,0x0B,0x49,0x1C,0x49,0x0B,0x49,0x1C,0x49,0x0B,0x48,0x1E,0x48,0x0A,0x49,0x1E,0x48,0x0A,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x09,0x49,0x1E,0x49,0x0A,0x48,0x1E,0x48,0x0B,0x48,0x1D,0x49,0x0B,0x49,0x1C,0x49,0x0B,0x49,0x1C,0x49,0x0B,0x49,0x1C,0x49,0x0B,0x49,0x1C,0x49,0x0C,0x48,0x1C,0x48,0x0D,0x48,0x1C,0x48,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0E,0x48,0x1A,0x48,0x0F,0x48,0x19,0x49,0x0F,0x49,0x18,0x49,0x10,0x48,0x18,0x48,0x11,0x48,0x17,0x49,0x12,0x48,0x16,0x48,0x13,0x49,0x14,0x49,0x14,0x48,0x14,0x48,0x15,0x49,0x12,0x49,0x16,0x49,0x10,0x49,0x18,0x49,0x0E,0x49,0x19,0x4A,0x0B,0x4B,0x1A,0x4C,0x06,0x4C,0x1C,0x5E,0x1E,0x5C,0x20,0x5A,0x22,0x57,0x26,0x54,0x29,0x50,0x2F,0x48,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x23, // 0x30 '0'
+  0x3F,0x3F,0x3F,0x3F,0x19,0x40,0x38,0x43,0x35,0x46,0x32,0x49,0x2F,0x4C,0x2C,0x4F,0x29,0x52,0x26,0x55,0x23,0x58,0x20,0x5B,0x1E,0x5D,0x1E,0x52,0x00,0x49,0x1E,0x4F,0x03,0x49,0x1E,0x4C,0x06,0x49,0x1E,0x49,0x09,0x49,0x1E,0x46,0x0C,0x49,0x1E,0x43,0x0F,0x49,0x1E,0x40,0x12,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x1E,0x71,0x0A,0x71,0x0A,0x71,0x0A,0x71,0x0A,0x71,0x0A,0x71,0x0A,0x71,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x05, // 0x31 '1'
+  0x3F,0x3F,0x3F,0x3F,0x09,0x4A,0x2C,0x53,0x25,0x58,0x20,0x5D,0x1D,0x60,0x1B,0x61,0x1A,0x62,0x19,0x4C,0x07,0x4E,0x18,0x48,0x0E,0x4C,0x17,0x46,0x11,0x4B,0x17,0x44,0x14,0x4B,0x16,0x42,0x17,0x4A,0x16,0x40,0x1A,0x4A,0x32,0x49,0x32,0x49,0x32,0x4A,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x31,0x49,0x32,0x49,0x32,0x49,0x31,0x4A,0x31,0x49,0x31,0x4A,0x31,0x49,0x31,0x4A,0x31,0x49,0x31,0x49,0x31,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x30,0x4A,0x31,0x49,0x31,0x49,0x31,0x49,0x31,0x49,0x31,0x49,0x31,0x49,0x32,0x49,0x31,0x49,0x31,0x49,0x32,0x49,0x31,0x49,0x31,0x4A,0x31,0x49,0x31,0x4A,0x30,0x4A,0x31,0x4A,0x30,0x4B,0x30,0x69,0x12,0x69,0x12,0x69,0x12,0x69,0x12,0x69,0x12,0x69,0x12,0x69,0x12,0x69,0x12,0x69,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x0E, // 0x32 '2'
+  0x3F,0x3F,0x3F,0x3F,0x0A,0x4B,0x2B,0x54,0x23,0x5A,0x20,0x5D,0x1E,0x5E,0x1D,0x60,0x1B,0x60,0x1B,0x4A,0x07,0x4E,0x1A,0x46,0x0E,0x4C,0x19,0x44,0x11,0x4B,0x19,0x42,0x14,0x4B,0x18,0x40,0x17,0x4A,0x32,0x49,0x32,0x4A,0x31,0x4A,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x48,0x32,0x49,0x30,0x4A,0x2F,0x4B,0x2C,0x4D,0x25,0x55,0x26,0x53,0x28,0x52,0x29,0x53,0x28,0x55,0x26,0x57,0x24,0x58,0x2D,0x50,0x2F,0x4D,0x30,0x4C,0x31,0x4A,0x32,0x4A,0x32,0x4A,0x32,0x49,0x32,0x4A,0x32,0x49,0x32,0x49,0x32,0x49,0x33,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x31,0x4A,0x31,0x49,0x32,0x49,0x31,0x4A,0x31,0x4A,0x30,0x4A,0x30,0x4B,0x16,0x40,0x17,0x4B,0x17,0x43,0x13,0x4C,0x17,0x46,0x0E,0x4D,0x18,0x4A,0x08,0x4E,0x19,0x61,0x1A,0x60,0x1B,0x5E,0x1D,0x5D,0x1E,0x5B,0x22,0x56,0x2B,0x4C,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x25, // 0x33 '3'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x10,0x49,0x31,0x4A,0x30,0x4B,0x30,0x4B,0x2F,0x4C,0x2E,0x4D,0x2E,0x4D,0x2D,0x4E,0x2C,0x4F,0x2C,0x4F,0x2B,0x50,0x2A,0x51,0x2A,0x51,0x29,0x52,0x28,0x48,0x00,0x49,0x28,0x47,0x01,0x49,0x27,0x48,0x01,0x49,0x26,0x48,0x02,0x49,0x26,0x47,0x03,0x49,0x25,0x48,0x03,0x49,0x24,0x48,0x04,0x49,0x24,0x47,0x05,0x49,0x23,0x48,0x05,0x49,0x22,0x48,0x06,0x49,0x22,0x47,0x07,0x49,0x21,0x48,0x07,0x49,0x20,0x48,0x08,0x49,0x20,0x47,0x09,0x49,0x1F,0x48,0x09,0x49,0x1E,0x48,0x0A,0x49,0x1E,0x47,0x0B,0x49,0x1D,0x48,0x0B,0x49,0x1C,0x48,0x0C,0x49,0x1C,0x47,0x0D,0x49,0x1B,0x48,0x0D,0x49,0x1A,0x48,0x0E,0x49,0x1A,0x48,0x0E,0x49,0x19,0x48,0x0F,0x49,0x18,0x48,0x10,0x49,0x18,0x48,0x10,0x49,0x17,0x48,0x11,0x49,0x16,0x48,0x12,0x49,0x16,0x48,0x12,0x49,0x15,0x48,0x13,0x49,0x14,0x48,0x14,0x49,0x14,0x48,0x14,0x49,0x14,0x71,0x0A,0x71,0x0A,0x71,0x0A,0x71,0x0A,0x71,0x0A,0x71,0x0A,0x71,0x28,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x13, // 0x34 '4'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3B,0x62,0x19,0x62,0x19,0x62,0x19,0x62,0x19,0x62,0x19,0x62,0x19,0x62,0x19,0x62,0x19,0x62,0x19,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x46,0x35,0x4D,0x2E,0x52,0x29,0x55,0x26,0x57,0x24,0x59,0x22,0x5B,0x20,0x5C,0x2A,0x52,0x2E,0x4E,0x30,0x4C,0x30,0x4C,0x31,0x4B,0x31,0x4A,0x32,0x4A,0x32,0x49,0x32,0x4A,0x32,0x49,0x32,0x49,0x32,0x49,0x33,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x31,0x4A,0x31,0x49,0x32,0x49,0x31,0x4A,0x31,0x4A,0x30,0x4A,0x31,0x4A,0x30,0x4A,0x19,0x40,0x15,0x4A,0x1A,0x42,0x12,0x4B,0x1A,0x45,0x0D,0x4C,0x1B,0x49,0x07,0x4D,0x1C,0x5E,0x1D,0x5D,0x1E,0x5C,0x1F,0x5A,0x21,0x58,0x25,0x54,0x2C,0x4B,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x26, // 0x35 '5'
+  0x3F,0x3F,0x3F,0x3F,0x13,0x49,0x2E,0x52,0x27,0x57,0x22,0x5B,0x1E,0x5D,0x1D,0x5E,0x1C,0x5F,0x1B,0x4D,0x07,0x4A,0x1A,0x4B,0x0E,0x46,0x19,0x4B,0x11,0x44,0x18,0x4A,0x15,0x42,0x17,0x4A,0x18,0x40,0x17,0x49,0x31,0x49,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x48,0x33,0x48,0x32,0x49,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x49,0x32,0x49,0x32,0x49,0x0B,0x48,0x1D,0x48,0x08,0x4F,0x1A,0x48,0x06,0x53,0x17,0x49,0x05,0x55,0x16,0x49,0x03,0x59,0x14,0x49,0x02,0x5B,0x13,0x49,0x01,0x5D,0x12,0x49,0x00,0x49,0x06,0x4E,0x11,0x49,0x00,0x46,0x0B,0x4C,0x11,0x50,0x0E,0x4B,0x10,0x4F,0x10,0x4B,0x0F,0x4E,0x12,0x4A,0x0F,0x4D,0x14,0x4A,0x0E,0x4C,0x15,0x4A,0x0E,0x4C,0x16,0x4A,0x0D,0x4B,0x17,0x4A,0x0D,0x4B,0x18,0x49,0x0D,0x4B,0x18,0x49,0x0D,0x4B,0x18,0x4A,0x0C,0x4A,0x19,0x4A,0x0C,0x4A,0x1A,0x49,0x0C,0x4A,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0E,0x48,0x1A,0x49,0x0E,0x49,0x19,0x48,0x0F,0x49,0x18,0x49,0x10,0x48,0x18,0x49,0x10,0x48,0x18,0x49,0x10,0x49,0x17,0x48,0x12,0x48,0x16,0x49,0x12,0x49,0x15,0x48,0x14,0x49,0x13,0x49,0x14,0x49,0x12,0x49,0x16,0x49,0x11,0x49,0x16,0x4A,0x0E,0x4A,0x18,0x4B,0x0B,0x4A,0x1A,0x4C,0x07,0x4C,0x1B,0x5F,0x1D,0x5D,0x1F,0x5A,0x22,0x58,0x25,0x54,0x29,0x50,0x2F,0x49,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x20, // 0x36 '6'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x37,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6B,0x10,0x6B,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x48,0x33,0x48,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x48,0x33,0x48,0x32,0x48,0x33,0x48,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x49,0x31,0x49,0x32,0x49,0x31,0x49,0x32,0x49,0x31,0x49,0x32,0x49,0x31,0x49,0x31,0x4A,0x31,0x49,0x31,0x4A,0x31,0x4A,0x30,0x4A,0x31,0x4A,0x30,0x4A,0x31,0x4A,0x30,0x4B,0x30,0x4A,0x30,0x4B,0x30,0x4A,0x30,0x4B,0x30,0x4B,0x30,0x4A,0x30,0x4B,0x30,0x4B,0x2F,0x4B,0x30,0x4B,0x30,0x4B,0x2F,0x4C,0x2F,0x4B,0x30,0x4B,0x30,0x4B,0x30,0x4B,0x2F,0x4C,0x2F,0x4B,0x30,0x4B,0x30,0x4B,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x26, // 0x37 '7'
+  0x3F,0x3F,0x3F,0x3F,0x0E,0x4A,0x2D,0x52,0x27,0x56,0x24,0x58,0x21,0x5C,0x1E,0x5D,0x1D,0x5F,0x1B,0x4C,0x06,0x4D,0x1A,0x4A,0x0A,0x4B,0x19,0x4A,0x0C,0x4B,0x18,0x49,0x0E,0x4A,0x17,0x49,0x10,0x4A,0x16,0x49,0x10,0x4A,0x16,0x49,0x10,0x4A,0x15,0x49,0x12,0x49,0x15,0x49,0x12,0x49,0x15,0x49,0x12,0x49,0x15,0x49,0x12,0x49,0x15,0x49,0x12,0x49,0x15,0x49,0x12,0x49,0x15,0x49,0x12,0x48,0x16,0x4A,0x10,0x49,0x16,0x4A,0x10,0x49,0x17,0x4A,0x0F,0x48,0x18,0x4B,0x0D,0x49,0x18,0x4B,0x0D,0x48,0x1A,0x4B,0x0B,0x49,0x1A,0x4C,0x09,0x49,0x1C,0x4D,0x07,0x48,0x1E,0x4D,0x05,0x48,0x20,0x4E,0x02,0x48,0x22,0x4E,0x00,0x48,0x24,0x56,0x26,0x54,0x28,0x51,0x2A,0x52,0x28,0x55,0x25,0x57,0x22,0x5A,0x20,0x4A,0x01,0x50,0x1D,0x4A,0x03,0x50,0x1B,0x4A,0x06,0x4F,0x19,0x4A,0x08,0x4F,0x17,0x4A,0x0B,0x4E,0x16,0x49,0x0D,0x4E,0x14,0x49,0x0F,0x4D,0x13,0x4A,0x11,0x4C,0x12,0x49,0x12,0x4C,0x12,0x49,0x13,0x4C,0x10,0x49,0x15,0x4B,0x10,0x49,0x16,0x4A,0x10,0x49,0x16,0x4B,0x0E,0x49,0x18,0x4A,0x0E,0x49,0x18,0x4A,0x0E,0x49,0x19,0x49,0x0E,0x49,0x19,0x49,0x0E,0x49,0x19,0x49,0x0E,0x49,0x19,0x49,0x0E,0x49,0x19,0x49,0x0E,0x49,0x19,0x49,0x0E,0x4A,0x18,0x49,0x0E,0x4A,0x17,0x49,0x10,0x49,0x17,0x49,0x10,0x4A,0x16,0x49,0x10,0x4A,0x15,0x49,0x12,0x4A,0x13,0x4A,0x12,0x4B,0x11,0x4A,0x14,0x4B,0x0F,0x4A,0x16,0x4C,0x0C,0x4B,0x16,0x4E,0x07,0x4D,0x18,0x62,0x1A,0x60,0x1C,0x5E,0x1F,0x5A,0x23,0x56,0x27,0x52,0x2D,0x4A,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x22, // 0x38 '8'
+  0x3F,0x3F,0x3F,0x3F,0x0C,0x49,0x2F,0x50,0x29,0x54,0x25,0x58,0x22,0x5A,0x1F,0x5D,0x1D,0x5F,0x1B,0x4C,0x06,0x4D,0x1A,0x4A,0x0B,0x4B,0x18,0x4A,0x0E,0x4A,0x16,0x49,0x11,0x49,0x16,0x49,0x12,0x49,0x14,0x49,0x13,0x49,0x13,0x49,0x15,0x49,0x12,0x49,0x16,0x48,0x12,0x48,0x17,0x49,0x10,0x49,0x18,0x48,0x10,0x49,0x18,0x48,0x10,0x49,0x18,0x49,0x0F,0x48,0x19,0x49,0x0E,0x49,0x1A,0x48,0x0E,0x49,0x1A,0x48,0x0E,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x49,0x0D,0x49,0x1A,0x4A,0x0C,0x4A,0x19,0x4A,0x0C,0x4A,0x18,0x4B,0x0D,0x49,0x18,0x4B,0x0D,0x49,0x18,0x4B,0x0D,0x4A,0x16,0x4C,0x0D,0x4A,0x16,0x4C,0x0E,0x4A,0x15,0x4C,0x0E,0x4A,0x14,0x4D,0x0F,0x4A,0x12,0x4E,0x0F,0x4B,0x10,0x4F,0x10,0x4B,0x0E,0x50,0x11,0x4C,0x0B,0x46,0x00,0x49,0x11,0x4E,0x06,0x49,0x00,0x49,0x12,0x5D,0x01,0x49,0x13,0x5B,0x02,0x49,0x14,0x59,0x03,0x49,0x16,0x55,0x05,0x49,0x17,0x53,0x06,0x48,0x1A,0x4F,0x08,0x48,0x1D,0x48,0x0B,0x49,0x32,0x49,0x32,0x49,0x32,0x48,0x33,0x48,0x32,0x49,0x32,0x49,0x32,0x48,0x33,0x48,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x49,0x32,0x48,0x32,0x49,0x31,0x49,0x17,0x40,0x18,0x4A,0x17,0x42,0x15,0x4A,0x18,0x44,0x11,0x4B,0x19,0x47,0x0D,0x4B,0x1A,0x4A,0x07,0x4D,0x1B,0x5F,0x1C,0x5E,0x1D,0x5D,0x1E,0x5B,0x22,0x58,0x26,0x52,0x2E,0x49,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x27, // 0x39 '9'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x16, // 0x3A ':'
+};
+static const UG_U16 OFFSETS_FONT_61X99[] = {
+  0,95,257,434,724,1018,1426,1762,1889,2081,2274,2483,2632,2760,2862,2973,
+  3166,3468,3656,3842,4036,4272,4453,4727,4898,5186,5460,5555 };
+static const UG_U8 WIDTHS_FONT_61X99[] = {
+  61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,61,
+  61,61,61,61,61,61,61,61,61,61,61 };
+const UG_FONT FONT_61X99 = { (unsigned char*)BITS_FONT_61X99, FONT_TYPE_RLE, 61, 99, 32, 58, (UG_U8*)WIDTHS_FONT_61X99, OFFSETS_FONT_61X99 };
 #endif
 
 #ifdef USE_FONT_45X72
-static __UG_FONT_DATA unsigned char BITS_FONT_45X72[95][432] =
-		{
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x20 ' '
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x21 '!'
-				{ 0x00, 0xFC, 0x03, 0xF8, 0x07, 0x00, 0x00, 0xFC, 0x03, 0xF8,
-						0x07, 0x00, 0x00, 0xFC, 0x03, 0xF8, 0x07, 0x00, 0x00,
-						0xFC, 0x03, 0xF8, 0x07, 0x00, 0x00, 0xFC, 0x03, 0xF8,
-						0x07, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0x00, 0x00,
-						0xF8, 0x01, 0xF0, 0x03, 0x00, 0x00, 0xF8, 0x01, 0xF0,
-						0x03, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0x00, 0x00,
-						0xF8, 0x01, 0xF0, 0x03, 0x00, 0x00, 0xF8, 0x01, 0xF0,
-						0x03, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0x00, 0x00,
-						0xF8, 0x01, 0xF0, 0x03, 0x00, 0x00, 0xF8, 0x01, 0xF0,
-						0x03, 0x00, 0x00, 0xF8, 0x01, 0xF0, 0x03, 0x00, 0x00,
-						0xF0, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0xE0,
-						0x01, 0x00, 0x00, 0xF0, 0x00, 0xE0, 0x01, 0x00, 0x00,
-						0xF0, 0x00, 0xE0, 0x01, 0x00, 0x00, 0xF0, 0x00, 0xE0,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x22 '"'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x7C, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x7E, 0x00, 0x00,
-						0x00, 0xF8, 0x01, 0x7E, 0x00, 0x00, 0x00, 0xF8, 0x00,
-						0x3E, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x3E, 0x00, 0x00,
-						0x00, 0xFC, 0x00, 0x3F, 0x00, 0x00, 0x00, 0xFC, 0x00,
-						0x3F, 0x00, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x00,
-						0x00, 0x7E, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x7E, 0x80,
-						0x1F, 0x00, 0x00, 0x00, 0x7E, 0x80, 0x1F, 0x00, 0x00,
-						0x00, 0x3E, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0xC0,
-						0x0F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0x00, 0x00,
-						0x00, 0x1F, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x1F, 0xC0,
-						0x07, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x80,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x80, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x07, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xC0,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xC0, 0x0F, 0xF0,
-						0x03, 0x00, 0x00, 0xC0, 0x07, 0xF0, 0x01, 0x00, 0x00,
-						0xE0, 0x07, 0xF8, 0x01, 0x00, 0x00, 0xE0, 0x07, 0xF8,
-						0x01, 0x00, 0x00, 0xE0, 0x07, 0xF8, 0x01, 0x00, 0x00,
-						0xE0, 0x03, 0xF8, 0x00, 0x00, 0x00, 0xF0, 0x03, 0xFC,
-						0x00, 0x00, 0x00, 0xF0, 0x03, 0xFC, 0x00, 0x00, 0x00,
-						0xF0, 0x03, 0x7C, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x7C,
-						0x00, 0x00, 0x00, 0xF8, 0x01, 0x7E, 0x00, 0x00, 0xF8,
-						0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF,
-						0x7F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xFC,
-						0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF,
-						0x3F, 0x00, 0x00, 0x7C, 0x00, 0x1F, 0x00, 0x00, 0x00,
-						0x7C, 0x00, 0x1F, 0x00, 0x00, 0x00, 0x7E, 0x80, 0x1F,
-						0x00, 0x00, 0x00, 0x7E, 0x80, 0x1F, 0x00, 0x00, 0x00,
-						0x3E, 0x80, 0x0F, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F,
-						0x00, 0x00, 0x00, 0x3F, 0xC0, 0x0F, 0x00, 0x00, 0x00,
-						0x3F, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x1F, 0xC0, 0x07,
-						0x00, 0x00, 0x80, 0x1F, 0xE0, 0x07, 0x00, 0x00, 0x80,
-						0x1F, 0xE0, 0x07, 0x00, 0x00, 0x80, 0x0F, 0xE0, 0x03,
-						0x00, 0x00, 0x80, 0x0F, 0xE0, 0x03, 0x00, 0x00, 0xC0,
-						0x0F, 0xF0, 0x03, 0x00, 0x00, 0xC0, 0x0F, 0xF0, 0x03,
-						0x00, 0x00, 0xC0, 0x07, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x23 '#'
-				{ 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x03, 0x00, 0x00,
-						0xC0, 0xFF, 0xFF, 0x0F, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
-						0x0F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
-						0xF8, 0xFF, 0xF1, 0x0F, 0x00, 0x00, 0xF8, 0xE7, 0x01,
-						0x0F, 0x00, 0x00, 0xFC, 0xE3, 0x01, 0x08, 0x00, 0x00,
-						0xFC, 0xE1, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xE1, 0x01,
-						0x00, 0x00, 0x00, 0xFE, 0xE0, 0x01, 0x00, 0x00, 0x00,
-						0xFE, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xE0, 0x01,
-						0x00, 0x00, 0x00, 0xFE, 0xE0, 0x01, 0x00, 0x00, 0x00,
-						0xFE, 0xE0, 0x01, 0x00, 0x00, 0x00, 0xFE, 0xE0, 0x01,
-						0x00, 0x00, 0x00, 0xFE, 0xE1, 0x01, 0x00, 0x00, 0x00,
-						0xFC, 0xE3, 0x01, 0x00, 0x00, 0x00, 0xFC, 0xE3, 0x01,
-						0x00, 0x00, 0x00, 0xF8, 0xE7, 0x01, 0x00, 0x00, 0x00,
-						0xF8, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xE0, 0xFF,
-						0x03, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x07, 0x00, 0x00,
-						0x00, 0xE0, 0xFD, 0x07, 0x00, 0x00, 0x00, 0xE0, 0xF9,
-						0x0F, 0x00, 0x00, 0x00, 0xE0, 0xF1, 0x0F, 0x00, 0x00,
-						0x00, 0xE0, 0xE1, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0xE1,
-						0x1F, 0x00, 0x00, 0x00, 0xE0, 0xC1, 0x1F, 0x00, 0x00,
-						0x00, 0xE0, 0xC1, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0xC1,
-						0x1F, 0x00, 0x00, 0x00, 0xE0, 0xC1, 0x1F, 0x00, 0x00,
-						0x00, 0xE0, 0xC1, 0x1F, 0x00, 0x00, 0x00, 0xE0, 0xC1,
-						0x1F, 0x00, 0x00, 0x00, 0xE0, 0xE1, 0x0F, 0x00, 0x00,
-						0x01, 0xE0, 0xE1, 0x0F, 0x00, 0x00, 0x07, 0xE0, 0xF1,
-						0x0F, 0x00, 0x00, 0x3F, 0xE0, 0xF1, 0x07, 0x00, 0x00,
-						0xFF, 0xE1, 0xFD, 0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-						0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-						0xFE, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x24 '$'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x3F, 0x00, 0x00,
-						0x80, 0x0F, 0xE0, 0xFF, 0x00, 0x00, 0xC0, 0x07, 0xF0,
-						0xFF, 0x03, 0x00, 0xE0, 0x07, 0xF8, 0xFF, 0x07, 0x00,
-						0xF0, 0x03, 0xFC, 0xE1, 0x0F, 0x00, 0xF0, 0x01, 0x7C,
-						0x80, 0x0F, 0x00, 0xF8, 0x01, 0x7E, 0x80, 0x1F, 0x00,
-						0xFC, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x7C, 0x00, 0x3F,
-						0x00, 0x1F, 0x00, 0x3E, 0x00, 0x1F, 0x00, 0x3E, 0x00,
-						0x3F, 0x00, 0x1F, 0x00, 0x3E, 0x80, 0x1F, 0x00, 0x1F,
-						0x00, 0x3E, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x3E, 0xC0,
-						0x07, 0x00, 0x1F, 0x00, 0x3E, 0xE0, 0x07, 0x00, 0x1F,
-						0x00, 0x3E, 0xF0, 0x03, 0x00, 0x1F, 0x00, 0x3E, 0xF0,
-						0x01, 0x00, 0x3F, 0x00, 0x3F, 0xF8, 0x01, 0x00, 0x3E,
-						0x00, 0x1F, 0xFC, 0x00, 0x00, 0x7E, 0x80, 0x1F, 0x7C,
-						0x00, 0x00, 0x7C, 0x80, 0x0F, 0x3E, 0x00, 0x00, 0xFC,
-						0xE1, 0x0F, 0x3F, 0x00, 0x00, 0xF8, 0xFF, 0x87, 0x1F,
-						0x00, 0x00, 0xF0, 0xFF, 0x83, 0x0F, 0x00, 0x00, 0xE0,
-						0xFF, 0xC1, 0x07, 0x00, 0x00, 0x80, 0x3F, 0xE0, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x80, 0x1F, 0x00, 0x00,
-						0x00, 0x7C, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x3E, 0xF8,
-						0xFF, 0x01, 0x00, 0x00, 0x3F, 0xFC, 0xFF, 0x03, 0x00,
-						0x80, 0x1F, 0xFE, 0xF0, 0x07, 0x00, 0x80, 0x0F, 0x3E,
-						0xC0, 0x07, 0x00, 0xC0, 0x07, 0x3F, 0xC0, 0x0F, 0x00,
-						0xE0, 0x07, 0x1F, 0x80, 0x0F, 0x00, 0xF0, 0x83, 0x1F,
-						0x80, 0x0F, 0x00, 0xF0, 0x81, 0x0F, 0x00, 0x1F, 0x00,
-						0xF8, 0x81, 0x0F, 0x00, 0x1F, 0x00, 0xFC, 0x80, 0x0F,
-						0x00, 0x1F, 0x00, 0x7C, 0x80, 0x0F, 0x00, 0x1F, 0x00,
-						0x3E, 0x80, 0x0F, 0x00, 0x1F, 0x00, 0x3F, 0x80, 0x0F,
-						0x00, 0x1F, 0x80, 0x1F, 0x80, 0x0F, 0x00, 0x1F, 0x80,
-						0x0F, 0x80, 0x1F, 0x80, 0x1F, 0xC0, 0x07, 0x00, 0x1F,
-						0x80, 0x0F, 0xE0, 0x07, 0x00, 0x3F, 0xC0, 0x0F, 0xF0,
-						0x03, 0x00, 0x3E, 0xC0, 0x07, 0xF0, 0x01, 0x00, 0xFE,
-						0xF0, 0x07, 0xF8, 0x01, 0x00, 0xFC, 0xFF, 0x03, 0xFC,
-						0x00, 0x00, 0xF8, 0xFF, 0x01, 0x7C, 0x00, 0x00, 0xF0,
-						0xFF, 0x00, 0x3E, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x25 '%'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x1F,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
-						0x00, 0x00, 0x00, 0xF0, 0x1F, 0xFE, 0x01, 0x00, 0x00,
-						0xF0, 0x0F, 0xFC, 0x01, 0x00, 0x00, 0xF0, 0x07, 0xFC,
-						0x03, 0x00, 0x00, 0xF8, 0x03, 0xF8, 0x03, 0x00, 0x00,
-						0xF8, 0x03, 0xF8, 0x03, 0x00, 0x00, 0xF8, 0x03, 0xF8,
-						0x03, 0x00, 0x00, 0xF8, 0x03, 0xF8, 0x03, 0x00, 0x00,
-						0xF8, 0x03, 0xF8, 0x03, 0x00, 0x00, 0xF8, 0x03, 0xF8,
-						0x03, 0x00, 0x00, 0xF8, 0x07, 0xFC, 0x01, 0x00, 0x00,
-						0xF8, 0x07, 0xFC, 0x01, 0x00, 0x00, 0xF0, 0x07, 0xFE,
-						0x00, 0x00, 0x00, 0xF0, 0x07, 0x7F, 0x00, 0x00, 0x00,
-						0xF0, 0x8F, 0x7F, 0x00, 0x00, 0x00, 0xE0, 0xEF, 0x3F,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00,
-						0xE0, 0xFF, 0x0F, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00, 0x00,
-						0xF8, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0xFF, 0x00, 0xC0, 0x1F, 0xC0,
-						0xFF, 0xFF, 0x00, 0xC0, 0x1F, 0xE0, 0x3F, 0xFE, 0x01,
-						0xC0, 0x1F, 0xF0, 0x0F, 0xFE, 0x01, 0xC0, 0x1F, 0xF0,
-						0x07, 0xFC, 0x03, 0xC0, 0x1F, 0xF8, 0x03, 0xFC, 0x07,
-						0xC0, 0x0F, 0xFC, 0x01, 0xF8, 0x07, 0xC0, 0x0F, 0xFC,
-						0x01, 0xF0, 0x0F, 0xC0, 0x0F, 0xFC, 0x00, 0xF0, 0x1F,
-						0xC0, 0x0F, 0xFE, 0x00, 0xE0, 0x1F, 0xE0, 0x07, 0xFE,
-						0x00, 0xC0, 0x3F, 0xE0, 0x07, 0xFE, 0x00, 0xC0, 0x7F,
-						0xE0, 0x07, 0xFE, 0x00, 0x80, 0xFF, 0xF0, 0x03, 0xFE,
-						0x00, 0x00, 0xFF, 0xF1, 0x03, 0xFE, 0x00, 0x00, 0xFF,
-						0xF9, 0x03, 0xFE, 0x01, 0x00, 0xFE, 0xFB, 0x01, 0xFE,
-						0x01, 0x00, 0xFC, 0xFF, 0x00, 0xFC, 0x01, 0x00, 0xF8,
-						0xFF, 0x00, 0xFC, 0x03, 0x00, 0xF8, 0x7F, 0x00, 0xFC,
-						0x07, 0x00, 0xF0, 0x3F, 0x00, 0xF8, 0x0F, 0x00, 0xE0,
-						0x3F, 0x00, 0xF8, 0x1F, 0x00, 0xF0, 0x7F, 0x00, 0xF0,
-						0x3F, 0x00, 0xFC, 0xFF, 0x00, 0xE0, 0xFF, 0x80, 0xFF,
-						0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x80,
-						0xFF, 0xFF, 0x7F, 0xFE, 0x07, 0x00, 0xFE, 0xFF, 0x3F,
-						0xFC, 0x0F, 0x00, 0xF8, 0xFF, 0x07, 0xF8, 0x1F, 0x00,
-						0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x26 '&'
-				{ 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x27 '''
-				{ 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x28 '('
-				{ 0xC0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x07, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x01, 0x00,
-						0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x29 ')'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x01, 0xF0, 0x01, 0x10, 0x00, 0x00, 0x0F, 0xF0, 0x01,
-						0x1E, 0x00, 0x80, 0x3F, 0xF0, 0x81, 0x3F, 0x00, 0x80,
-						0xFF, 0xF0, 0xE1, 0x3F, 0x00, 0x80, 0xFF, 0x03, 0xF8,
-						0x3F, 0x00, 0xC0, 0xFF, 0x07, 0xFC, 0x7F, 0x00, 0xC0,
-						0xFF, 0x07, 0xFC, 0x7F, 0x00, 0x00, 0xFE, 0x03, 0xF8,
-						0x0F, 0x00, 0x00, 0xC0, 0x03, 0x78, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x00,
-						0x00, 0x1F, 0x1F, 0x00, 0x00, 0x00, 0x80, 0xBF, 0x3F,
-						0x00, 0x00, 0x00, 0xC0, 0x1F, 0x7F, 0x00, 0x00, 0x00,
-						0xE0, 0x0F, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0xFE,
-						0x01, 0x00, 0x00, 0xF8, 0x07, 0xFC, 0x03, 0x00, 0x00,
-						0xFC, 0x07, 0xFC, 0x07, 0x00, 0x00, 0xF8, 0x03, 0xF8,
-						0x03, 0x00, 0x00, 0xF0, 0x01, 0xF0, 0x01, 0x00, 0x00,
-						0xC0, 0x01, 0x70, 0x00, 0x00, 0x00, 0x80, 0x00, 0x20,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2A '*'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0xF0,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF0, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x01, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2B '+'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2C ','
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
-						0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xFF, 0xFF, 0xFF,
-						0x1F, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
-						0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2D '-'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xFE, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2E '.'
-				{ 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01,
-						0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x2F '/'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x1F,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-						0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
-						0x01, 0x00, 0x00, 0xFC, 0x0F, 0xFE, 0x03, 0x00, 0x00,
-						0xFC, 0x03, 0xF8, 0x07, 0x00, 0x00, 0xFE, 0x01, 0xF0,
-						0x0F, 0x00, 0x00, 0xFF, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0x7F, 0x00, 0xC0, 0x1F, 0x00, 0x80, 0x7F, 0x00, 0xC0,
-						0x3F, 0x00, 0x80, 0x3F, 0x00, 0x80, 0x3F, 0x00, 0xC0,
-						0x3F, 0x00, 0x80, 0x7F, 0x00, 0xC0, 0x3F, 0x00, 0x80,
-						0x7F, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0x7F, 0x00, 0xE0,
-						0x1F, 0x00, 0x00, 0xFF, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0xFF, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0xE0,
-						0x1F, 0x00, 0x00, 0xFF, 0x00, 0xE0, 0x0F, 0x00, 0x00,
-						0xFE, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0xFE, 0x01, 0xF0,
-						0x0F, 0x00, 0x00, 0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00,
-						0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0xFE, 0x01, 0xF0,
-						0x0F, 0x00, 0x00, 0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00,
-						0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0xFE, 0x01, 0xF0,
-						0x0F, 0x00, 0x00, 0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00,
-						0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0xFE, 0x01, 0xF0,
-						0x0F, 0x00, 0x00, 0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00,
-						0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00, 0xFE, 0x01, 0xF0,
-						0x0F, 0x00, 0x00, 0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00,
-						0xFE, 0x01, 0xE0, 0x0F, 0x00, 0x00, 0xFE, 0x00, 0xE0,
-						0x0F, 0x00, 0x00, 0xFF, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0xFF, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0xE0,
-						0x1F, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0x1F, 0x00, 0x00,
-						0x7F, 0x00, 0xC0, 0x3F, 0x00, 0x80, 0x7F, 0x00, 0xC0,
-						0x3F, 0x00, 0x80, 0x7F, 0x00, 0x80, 0x3F, 0x00, 0x80,
-						0x3F, 0x00, 0x80, 0x7F, 0x00, 0xC0, 0x3F, 0x00, 0x00,
-						0x7F, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0xE0,
-						0x1F, 0x00, 0x00, 0xFE, 0x01, 0xF0, 0x0F, 0x00, 0x00,
-						0xFC, 0x03, 0xF8, 0x07, 0x00, 0x00, 0xFC, 0x07, 0xFE,
-						0x07, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x03, 0x00, 0x00,
-						0xF0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x7F,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0x1F, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x30 '0'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x0F, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0F,
-						0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0xFE, 0xFF, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x0F,
-						0x00, 0x00, 0x80, 0xFF, 0xEF, 0x0F, 0x00, 0x00, 0x80,
-						0xFF, 0xE1, 0x0F, 0x00, 0x00, 0x80, 0x3F, 0xE0, 0x0F,
-						0x00, 0x00, 0x80, 0x07, 0xE0, 0x0F, 0x00, 0x00, 0x80,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x80,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x31 '1'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F,
-						0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x80,
-						0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
-						0x01, 0x00, 0x80, 0xFF, 0x80, 0xFF, 0x03, 0x00, 0x80,
-						0x0F, 0x00, 0xFE, 0x07, 0x00, 0x80, 0x03, 0x00, 0xFC,
-						0x07, 0x00, 0x80, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
-						0x1F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xC0,
-						0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF,
-						0x1F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x32 '2'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F,
-						0x00, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-						0xFE, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0xFF,
-						0x01, 0x00, 0x00, 0xFE, 0x00, 0xFF, 0x03, 0x00, 0x00,
-						0x1E, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x02, 0x00, 0xF8,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x7F,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0x1F, 0x00, 0x00, 0x00,
-						0xE0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x0F,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0x3F, 0x00, 0x00, 0x00,
-						0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x03, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x0F, 0x00, 0x00, 0x01, 0x00, 0xFC, 0x0F, 0x00, 0x00,
-						0x0F, 0x00, 0xFE, 0x07, 0x00, 0x00, 0x7F, 0x80, 0xFF,
-						0x03, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-						0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0xFC, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x33 '3'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFF,
-						0x01, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0xC0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xC0, 0xFF,
-						0x01, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xF0, 0xFF,
-						0x01, 0x00, 0x00, 0x00, 0xF8, 0xFD, 0x01, 0x00, 0x00,
-						0x00, 0xFC, 0xFD, 0x01, 0x00, 0x00, 0x00, 0xFC, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0xFE, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x7F, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x3F, 0xFC,
-						0x01, 0x00, 0x00, 0x80, 0x3F, 0xFC, 0x01, 0x00, 0x00,
-						0xC0, 0x1F, 0xFC, 0x01, 0x00, 0x00, 0xC0, 0x0F, 0xFC,
-						0x01, 0x00, 0x00, 0xE0, 0x0F, 0xFC, 0x01, 0x00, 0x00,
-						0xF0, 0x07, 0xFC, 0x01, 0x00, 0x00, 0xF0, 0x03, 0xFC,
-						0x01, 0x00, 0x00, 0xF8, 0x03, 0xFC, 0x01, 0x00, 0x00,
-						0xFC, 0x01, 0xFC, 0x01, 0x00, 0x00, 0xFC, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0xFE, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x7E, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x3F, 0x00, 0xFC,
-						0x01, 0x00, 0x80, 0x3F, 0x00, 0xFC, 0x01, 0x00, 0x80,
-						0x1F, 0x00, 0xFC, 0x01, 0x00, 0xC0, 0x0F, 0x00, 0xFC,
-						0x01, 0x00, 0xE0, 0x0F, 0x00, 0xFC, 0x01, 0x00, 0xE0,
-						0x07, 0x00, 0xFC, 0x01, 0x00, 0xF0, 0x03, 0x00, 0xFC,
-						0x01, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x00, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF0,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFC,
-						0x01, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x34 '4'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
-						0x1F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
-						0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
-						0x1F, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00,
-						0xF8, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0xF8, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x03,
-						0x00, 0x00, 0x00, 0xF8, 0xFF, 0x1F, 0x00, 0x00, 0x00,
-						0xF8, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x0F, 0x00, 0x00, 0x04, 0x00, 0xFC, 0x07, 0x00, 0x00,
-						0x1C, 0x00, 0xFE, 0x07, 0x00, 0x00, 0xFC, 0x80, 0xFF,
-						0x03, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x01, 0x00, 0x00,
-						0xFC, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0xF0, 0xFF, 0x0F, 0x00, 0x00, 0x00,
-						0x80, 0xFF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x35 '5'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x80, 0xFF, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF,
-						0x0F, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x3F, 0x00, 0x00,
-						0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x80, 0xFF, 0xFF,
-						0x3F, 0x00, 0x00, 0xC0, 0xFF, 0x80, 0x3F, 0x00, 0x00,
-						0xE0, 0x3F, 0x00, 0x3C, 0x00, 0x00, 0xF0, 0x0F, 0x00,
-						0x20, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00,
-						0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0x3F, 0xC0, 0x3F, 0x00, 0x00, 0xC0,
-						0x3F, 0xF0, 0xFF, 0x00, 0x00, 0xC0, 0x3F, 0xFC, 0xFF,
-						0x03, 0x00, 0xC0, 0x3F, 0xFE, 0xFF, 0x07, 0x00, 0xC0,
-						0x3F, 0xFF, 0xFF, 0x0F, 0x00, 0xC0, 0xBF, 0x1F, 0xF8,
-						0x1F, 0x00, 0xC0, 0xFF, 0x0F, 0xE0, 0x3F, 0x00, 0xC0,
-						0xFF, 0x03, 0xC0, 0x7F, 0x00, 0xC0, 0xFF, 0x01, 0x80,
-						0x7F, 0x00, 0xC0, 0xFF, 0x01, 0x00, 0xFF, 0x00, 0xC0,
-						0xFF, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0xFF, 0x00, 0x00,
-						0xFE, 0x00, 0xC0, 0xFF, 0x00, 0x00, 0xFE, 0x01, 0xC0,
-						0x7F, 0x00, 0x00, 0xFE, 0x01, 0xC0, 0x7F, 0x00, 0x00,
-						0xFC, 0x01, 0xC0, 0x7F, 0x00, 0x00, 0xFC, 0x01, 0x80,
-						0x7F, 0x00, 0x00, 0xFC, 0x01, 0x80, 0x7F, 0x00, 0x00,
-						0xFC, 0x01, 0x80, 0x7F, 0x00, 0x00, 0xFC, 0x01, 0x80,
-						0x7F, 0x00, 0x00, 0xFC, 0x01, 0x80, 0x7F, 0x00, 0x00,
-						0xFC, 0x01, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x00, 0x00,
-						0xFF, 0x00, 0x00, 0xFE, 0x00, 0x00, 0xFF, 0x00, 0x00,
-						0xFE, 0x00, 0x00, 0xFE, 0x01, 0x00, 0xFE, 0x00, 0x00,
-						0xFE, 0x01, 0x00, 0x7F, 0x00, 0x00, 0xFC, 0x03, 0x00,
-						0x7F, 0x00, 0x00, 0xFC, 0x07, 0x80, 0x3F, 0x00, 0x00,
-						0xF8, 0x0F, 0xC0, 0x1F, 0x00, 0x00, 0xF0, 0x3F, 0xF0,
-						0x0F, 0x00, 0x00, 0xF0, 0xFF, 0xFF, 0x0F, 0x00, 0x00,
-						0xC0, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x80, 0xFF, 0xFF,
-						0x01, 0x00, 0x00, 0x00, 0xFE, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x36 '6'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF,
-						0xFF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x80,
-						0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0,
-						0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00,
-						0x00, 0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x03, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00,
-						0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F,
-						0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00,
-						0x00, 0xC0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x1F,
-						0x00, 0x00, 0x00, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00,
-						0x00, 0xE0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x07,
-						0x00, 0x00, 0x00, 0x00, 0xF0, 0x07, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x03,
-						0x00, 0x00, 0x00, 0x00, 0xFC, 0x01, 0x00, 0x00, 0x00,
-						0x00, 0xFE, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x7F, 0x00,
-						0x00, 0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00,
-						0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x3F, 0x00,
-						0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00,
-						0xE0, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00,
-						0x00, 0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00,
-						0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x0F, 0x00,
-						0x00, 0x00, 0x00, 0xF8, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xF8, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF8, 0x07, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00,
-						0xFC, 0x03, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x03, 0x00,
-						0x00, 0x00, 0x00, 0xFC, 0x03, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x37 '7'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xF8, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF,
-						0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x03, 0x00, 0x00,
-						0xE0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xF0, 0xFF, 0xFF,
-						0x0F, 0x00, 0x00, 0xF8, 0x0F, 0xF8, 0x1F, 0x00, 0x00,
-						0xF8, 0x03, 0xF0, 0x1F, 0x00, 0x00, 0xFC, 0x01, 0xE0,
-						0x1F, 0x00, 0x00, 0xFC, 0x01, 0xC0, 0x3F, 0x00, 0x00,
-						0xFE, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xFE, 0x00, 0x80,
-						0x3F, 0x00, 0x00, 0xFE, 0x00, 0x80, 0x3F, 0x00, 0x00,
-						0xFE, 0x00, 0x80, 0x3F, 0x00, 0x00, 0xFE, 0x00, 0x80,
-						0x3F, 0x00, 0x00, 0xFE, 0x01, 0x80, 0x3F, 0x00, 0x00,
-						0xFE, 0x01, 0xC0, 0x1F, 0x00, 0x00, 0xFE, 0x03, 0xC0,
-						0x1F, 0x00, 0x00, 0xFC, 0x07, 0xC0, 0x0F, 0x00, 0x00,
-						0xFC, 0x0F, 0xE0, 0x0F, 0x00, 0x00, 0xF8, 0x1F, 0xF0,
-						0x07, 0x00, 0x00, 0xF8, 0x3F, 0xF8, 0x03, 0x00, 0x00,
-						0xF0, 0xFF, 0xFC, 0x01, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-						0xE0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF0, 0xCF, 0xFF,
-						0x03, 0x00, 0x00, 0xF8, 0x83, 0xFF, 0x07, 0x00, 0x00,
-						0xFC, 0x01, 0xFE, 0x0F, 0x00, 0x00, 0xFE, 0x00, 0xFC,
-						0x1F, 0x00, 0x00, 0xFF, 0x00, 0xF0, 0x3F, 0x00, 0x00,
-						0x7F, 0x00, 0xE0, 0x7F, 0x00, 0x80, 0x3F, 0x00, 0xC0,
-						0x7F, 0x00, 0x80, 0x3F, 0x00, 0x80, 0x7F, 0x00, 0x80,
-						0x3F, 0x00, 0x80, 0xFF, 0x00, 0xC0, 0x1F, 0x00, 0x00,
-						0xFF, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xFF, 0x00, 0xC0,
-						0x1F, 0x00, 0x00, 0xFE, 0x00, 0xC0, 0x1F, 0x00, 0x00,
-						0xFE, 0x00, 0xC0, 0x1F, 0x00, 0x00, 0xFE, 0x00, 0xC0,
-						0x1F, 0x00, 0x00, 0xFE, 0x00, 0xC0, 0x3F, 0x00, 0x00,
-						0xFE, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x7F, 0x00, 0x80,
-						0x7F, 0x00, 0x00, 0x7F, 0x00, 0x80, 0x7F, 0x00, 0x80,
-						0x3F, 0x00, 0x00, 0xFF, 0x00, 0xC0, 0x3F, 0x00, 0x00,
-						0xFF, 0x03, 0xE0, 0x1F, 0x00, 0x00, 0xFE, 0x0F, 0xF8,
-						0x0F, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0x07, 0x00, 0x00,
-						0xF8, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xE0, 0xFF, 0xFF,
-						0x01, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // 0x38 '8'
-				{ 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0xFC, 0x07, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x3F,
-						0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-						0xF0, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0xF8, 0xFF, 0xFF,
-						0x03, 0x00, 0x00, 0xFC, 0x07, 0xFE, 0x07, 0x00, 0x00,
-						0xFE, 0x01, 0xF8, 0x0F, 0x00, 0x00, 0x7F, 0x00, 0xF0,
-						0x1F, 0x00, 0x80, 0x3F, 0x00, 0xE0, 0x1F, 0x00, 0x80,
-						0x3F, 0x00, 0xC0, 0x3F, 0x00, 0xC0, 0x1F, 0x00, 0xC0,
-						0x3F, 0x00, 0xC0, 0x1F, 0x00, 0x80, 0x7F, 0x00, 0xC0,
-						0x1F, 0x00, 0x80, 0x7F, 0x00, 0xC0, 0x0F, 0x00, 0x80,
-						0x7F, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0xE0,
-						0x0F, 0x00, 0x00, 0xFF, 0x00, 0xE0, 0x0F, 0x00, 0x00,
-						0xFF, 0x00, 0xE0, 0x0F, 0x00, 0x00, 0xFF, 0x00, 0xE0,
-						0x0F, 0x00, 0x00, 0xFF, 0x00, 0xE0, 0x0F, 0x00, 0x00,
-						0xFF, 0x01, 0xE0, 0x0F, 0x00, 0x00, 0xFF, 0x01, 0xE0,
-						0x0F, 0x00, 0x00, 0xFF, 0x01, 0xE0, 0x1F, 0x00, 0x80,
-						0xFF, 0x01, 0xC0, 0x1F, 0x00, 0x80, 0xFF, 0x01, 0xC0,
-						0x3F, 0x00, 0x80, 0xFF, 0x01, 0xC0, 0x3F, 0x00, 0xC0,
-						0xFF, 0x01, 0x80, 0x7F, 0x00, 0xE0, 0xFF, 0x01, 0x80,
-						0xFF, 0x00, 0xF0, 0xFF, 0x01, 0x00, 0xFF, 0x01, 0xF8,
-						0xFF, 0x01, 0x00, 0xFE, 0x07, 0xFE, 0xFE, 0x01, 0x00,
-						0xFC, 0xFF, 0x7F, 0xFE, 0x01, 0x00, 0xF8, 0xFF, 0x3F,
-						0xFE, 0x01, 0x00, 0xF0, 0xFF, 0x1F, 0xFE, 0x01, 0x00,
-						0xC0, 0xFF, 0x07, 0xFE, 0x01, 0x00, 0x00, 0xFF, 0x00,
-						0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00,
-						0x00, 0x00, 0x80, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x80,
-						0x7F, 0x00, 0x00, 0x00, 0x00, 0x80, 0x3F, 0x00, 0x00,
-						0x00, 0x00, 0xC0, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xC0,
-						0x1F, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x1F, 0x00, 0x00,
-						0x00, 0x00, 0xF0, 0x0F, 0x00, 0x00, 0x00, 0x00, 0xF8,
-						0x0F, 0x00, 0x00, 0x01, 0x00, 0xFC, 0x07, 0x00, 0x00,
-						0x0F, 0x00, 0xFE, 0x03, 0x00, 0x00, 0x7F, 0xC0, 0xFF,
-						0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0x00, 0x00, 0x00,
-						0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0x1F,
-						0x00, 0x00, 0x00, 0xFC, 0xFF, 0x07, 0x00, 0x00, 0x00,
-						0xC0, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-						0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 } // 0x39 '9'
-		};
-static UG_U8 WITHS_FONT_45X72[] = { 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45,
-		45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45, 45 };
-const UG_FONT FONT_45X72 = { (unsigned char*) BITS_FONT_45X72, FONT_TYPE_1BPP,
-		45, 72, 32, 58, WITHS_FONT_45X72 };
+static __UG_FONT_DATA unsigned char BITS_FONT_45X72[] = {
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x27, // 0x20 ' '
+  0x3F,0x3F,0x3F,0x06,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x26,0x45,0x26,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x3F,0x3F,0x3F,0x3F,0x3F,0x20,0x48,0x23,0x48,0x23,0x48,0x23,0x48,0x23,0x48,0x23,0x48,0x23,0x48,0x23,0x48,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x34, // 0x21 '!'
+  0x09,0x47,0x08,0x47,0x13,0x47,0x08,0x47,0x13,0x47,0x08,0x47,0x13,0x47,0x08,0x47,0x13,0x47,0x08,0x47,0x14,0x45,0x0A,0x45,0x15,0x45,0x0A,0x45,0x15,0x45,0x0A,0x45,0x15,0x45,0x0A,0x45,0x15,0x45,0x0A,0x45,0x15,0x45,0x0A,0x45,0x15,0x45,0x0A,0x45,0x15,0x45,0x0A,0x45,0x15,0x45,0x0A,0x45,0x15,0x45,0x0A,0x45,0x16,0x43,0x0C,0x43,0x17,0x43,0x0C,0x43,0x17,0x43,0x0C,0x43,0x17,0x43,0x0C,0x43,0x17,0x43,0x0C,0x43,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x2F, // 0x22 '"'
+  0x3F,0x3F,0x3F,0x07,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x44,0x08,0x44,0x19,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x44,0x08,0x44,0x19,0x44,0x08,0x44,0x10,0x63,0x08,0x63,0x08,0x63,0x07,0x63,0x08,0x63,0x10,0x45,0x07,0x45,0x18,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x44,0x19,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x10,0x63,0x08,0x63,0x07,0x63,0x08,0x63,0x08,0x63,0x10,0x44,0x08,0x44,0x19,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x44,0x08,0x44,0x19,0x44,0x08,0x44,0x18,0x45,0x07,0x45,0x18,0x45,0x07,0x45,0x18,0x44,0x08,0x44,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x36, // 0x23 '#'
+  0x14,0x43,0x28,0x43,0x28,0x43,0x28,0x43,0x25,0x4A,0x1F,0x51,0x18,0x55,0x15,0x56,0x14,0x57,0x13,0x4D,0x02,0x47,0x13,0x47,0x01,0x43,0x06,0x43,0x12,0x47,0x02,0x43,0x09,0x40,0x12,0x46,0x03,0x43,0x1C,0x47,0x03,0x43,0x1C,0x46,0x04,0x43,0x1C,0x46,0x04,0x43,0x1C,0x46,0x04,0x43,0x1C,0x46,0x04,0x43,0x1C,0x46,0x04,0x43,0x1C,0x46,0x04,0x43,0x1C,0x47,0x03,0x43,0x1D,0x47,0x02,0x43,0x1D,0x47,0x02,0x43,0x1E,0x47,0x01,0x43,0x1E,0x4D,0x1F,0x4C,0x20,0x4B,0x21,0x4A,0x22,0x4B,0x21,0x4B,0x21,0x4C,0x21,0x4B,0x22,0x4A,0x21,0x4B,0x20,0x4C,0x1F,0x4D,0x1E,0x43,0x00,0x48,0x1E,0x43,0x01,0x48,0x1D,0x43,0x02,0x47,0x1D,0x43,0x03,0x47,0x1C,0x43,0x03,0x47,0x1C,0x43,0x04,0x46,0x1C,0x43,0x04,0x46,0x1C,0x43,0x04,0x46,0x1C,0x43,0x04,0x46,0x1C,0x43,0x04,0x46,0x1C,0x43,0x04,0x46,0x1C,0x43,0x03,0x46,0x10,0x40,0x0B,0x43,0x03,0x46,0x10,0x42,0x09,0x43,0x02,0x47,0x10,0x45,0x06,0x43,0x02,0x46,0x11,0x48,0x03,0x43,0x00,0x47,0x12,0x59,0x12,0x58,0x14,0x55,0x19,0x51,0x1E,0x4A,0x26,0x43,0x28,0x43,0x28,0x43,0x28,0x43,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x02, // 0x24 '$'
+  0x3F,0x3F,0x2D,0x45,0x07,0x45,0x18,0x44,0x05,0x4A,0x15,0x44,0x05,0x4D,0x12,0x45,0x04,0x4F,0x10,0x45,0x04,0x46,0x03,0x46,0x0F,0x44,0x05,0x44,0x07,0x44,0x0E,0x45,0x04,0x45,0x07,0x45,0x0C,0x45,0x05,0x44,0x09,0x44,0x0C,0x44,0x05,0x45,0x09,0x44,0x0B,0x44,0x06,0x44,0x0B,0x44,0x09,0x45,0x06,0x44,0x0B,0x44,0x08,0x45,0x07,0x44,0x0B,0x44,0x08,0x44,0x08,0x44,0x0B,0x44,0x07,0x44,0x09,0x44,0x0B,0x44,0x06,0x45,0x09,0x44,0x0B,0x44,0x05,0x45,0x0A,0x44,0x0B,0x44,0x05,0x44,0x0B,0x45,0x09,0x45,0x04,0x45,0x0C,0x44,0x09,0x44,0x04,0x45,0x0D,0x45,0x07,0x45,0x04,0x44,0x0F,0x44,0x07,0x44,0x04,0x44,0x10,0x46,0x03,0x46,0x03,0x45,0x11,0x4F,0x03,0x45,0x13,0x4D,0x04,0x44,0x15,0x4B,0x04,0x44,0x18,0x46,0x06,0x45,0x25,0x45,0x26,0x44,0x26,0x45,0x25,0x45,0x06,0x45,0x19,0x44,0x04,0x4A,0x16,0x44,0x04,0x4D,0x13,0x45,0x03,0x4F,0x11,0x45,0x03,0x46,0x03,0x46,0x10,0x44,0x04,0x44,0x07,0x44,0x0F,0x44,0x04,0x45,0x07,0x45,0x0D,0x45,0x04,0x44,0x09,0x44,0x0C,0x45,0x04,0x45,0x09,0x44,0x0C,0x44,0x05,0x44,0x0B,0x44,0x0A,0x45,0x05,0x44,0x0B,0x44,0x09,0x45,0x06,0x44,0x0B,0x44,0x09,0x44,0x07,0x44,0x0B,0x44,0x08,0x44,0x08,0x44,0x0B,0x44,0x07,0x45,0x08,0x44,0x0B,0x44,0x06,0x45,0x09,0x44,0x0B,0x44,0x06,0x44,0x0A,0x45,0x09,0x45,0x05,0x44,0x0C,0x44,0x09,0x44,0x05,0x45,0x0C,0x45,0x07,0x45,0x04,0x45,0x0E,0x44,0x07,0x44,0x05,0x44,0x0F,0x46,0x03,0x46,0x04,0x45,0x10,0x4F,0x04,0x45,0x12,0x4D,0x05,0x44,0x14,0x4B,0x05,0x44,0x17,0x46,0x07,0x45,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1C, // 0x25 '%'
+  0x3F,0x3F,0x19,0x46,0x23,0x4B,0x1E,0x4E,0x1C,0x50,0x1A,0x52,0x18,0x48,0x03,0x47,0x17,0x47,0x05,0x46,0x17,0x46,0x06,0x47,0x15,0x46,0x08,0x46,0x15,0x46,0x08,0x46,0x15,0x46,0x08,0x46,0x15,0x46,0x08,0x46,0x15,0x46,0x08,0x46,0x15,0x46,0x08,0x46,0x15,0x47,0x06,0x46,0x16,0x47,0x06,0x46,0x17,0x46,0x05,0x46,0x18,0x46,0x04,0x46,0x19,0x47,0x02,0x47,0x1A,0x46,0x00,0x48,0x1B,0x4F,0x1C,0x4E,0x1E,0x4B,0x1F,0x4B,0x1E,0x4B,0x1E,0x4D,0x1D,0x4F,0x0D,0x46,0x05,0x51,0x0D,0x46,0x04,0x48,0x02,0x47,0x0C,0x46,0x03,0x47,0x04,0x47,0x0C,0x46,0x03,0x46,0x06,0x47,0x0B,0x46,0x02,0x46,0x07,0x48,0x0A,0x45,0x02,0x46,0x09,0x47,0x0A,0x45,0x02,0x46,0x0A,0x47,0x09,0x45,0x02,0x45,0x0B,0x48,0x08,0x45,0x01,0x46,0x0C,0x47,0x07,0x45,0x02,0x46,0x0D,0x47,0x06,0x45,0x02,0x46,0x0D,0x48,0x05,0x45,0x02,0x46,0x0E,0x48,0x03,0x45,0x03,0x46,0x0F,0x48,0x02,0x45,0x03,0x46,0x0F,0x48,0x01,0x46,0x03,0x47,0x0F,0x48,0x00,0x45,0x04,0x47,0x10,0x4D,0x06,0x46,0x11,0x4C,0x06,0x47,0x10,0x4B,0x07,0x48,0x10,0x49,0x09,0x48,0x10,0x48,0x09,0x49,0x0E,0x4A,0x09,0x49,0x0B,0x4D,0x09,0x4A,0x06,0x51,0x09,0x63,0x09,0x57,0x01,0x49,0x0A,0x54,0x03,0x49,0x0B,0x4F,0x07,0x49,0x0D,0x49,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x0A, // 0x26 '&'
+  0x11,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x22,0x48,0x23,0x48,0x23,0x48,0x23,0x48,0x23,0x48,0x23,0x48,0x23,0x48,0x23,0x48,0x24,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x26,0x44,0x27,0x44,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1C, // 0x27 '''
+  0x22,0x43,0x25,0x46,0x23,0x48,0x21,0x4A,0x1F,0x4A,0x20,0x48,0x22,0x47,0x22,0x47,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x25,0x45,0x25,0x46,0x24,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x25,0x45,0x25,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x26,0x45,0x26,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x26,0x46,0x25,0x46,0x26,0x45,0x26,0x46,0x25,0x46,0x26,0x45,0x26,0x46,0x26,0x46,0x26,0x45,0x26,0x46,0x26,0x46,0x26,0x46,0x26,0x46,0x25,0x47,0x25,0x47,0x26,0x47,0x25,0x48,0x24,0x49,0x24,0x4A,0x23,0x48,0x25,0x46,0x28,0x43,0x3F,0x3F,0x39, // 0x28 '('
+  0x05,0x43,0x28,0x46,0x25,0x48,0x23,0x4A,0x23,0x4A,0x24,0x48,0x25,0x47,0x26,0x46,0x26,0x46,0x26,0x46,0x26,0x46,0x26,0x46,0x26,0x46,0x26,0x45,0x26,0x46,0x26,0x46,0x25,0x46,0x26,0x46,0x25,0x46,0x26,0x45,0x26,0x46,0x25,0x46,0x26,0x45,0x26,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x26,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x45,0x25,0x46,0x25,0x46,0x25,0x45,0x25,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x24,0x46,0x25,0x45,0x25,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x23,0x47,0x22,0x48,0x21,0x49,0x1F,0x4A,0x21,0x48,0x23,0x46,0x25,0x43,0x3F,0x3F,0x3F,0x16, // 0x29 ')'
+  0x3F,0x3F,0x3F,0x06,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x26,0x44,0x27,0x44,0x27,0x44,0x1B,0x40,0x0A,0x44,0x0A,0x40,0x0F,0x43,0x07,0x44,0x07,0x43,0x0E,0x46,0x05,0x44,0x05,0x46,0x0D,0x48,0x03,0x44,0x03,0x48,0x0D,0x4A,0x08,0x4A,0x0C,0x4C,0x06,0x4C,0x0B,0x4C,0x06,0x4C,0x0E,0x48,0x08,0x48,0x16,0x43,0x08,0x43,0x3F,0x38,0x41,0x06,0x41,0x20,0x44,0x02,0x44,0x1E,0x46,0x00,0x46,0x1C,0x46,0x02,0x46,0x1A,0x46,0x04,0x46,0x18,0x47,0x04,0x47,0x16,0x47,0x06,0x47,0x14,0x48,0x06,0x48,0x14,0x46,0x08,0x46,0x16,0x44,0x0A,0x44,0x19,0x42,0x0A,0x42,0x1C,0x40,0x0C,0x40,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x0F, // 0x2A '*'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x17,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x17,0x64,0x07,0x64,0x07,0x64,0x07,0x64,0x07,0x64,0x17,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x36, // 0x2B '+'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x26,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x26,0x45,0x26,0x45,0x26,0x44,0x27,0x44,0x26,0x45,0x26,0x45,0x25,0x45,0x25,0x46,0x24,0x46,0x25,0x45,0x26,0x44,0x27,0x41,0x3F,0x3F,0x1F, // 0x2C ','
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x27,0x5C,0x0F,0x5C,0x0F,0x5C,0x0F,0x5C,0x0F,0x5C,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x2E, // 0x2D '-'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x26,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x21,0x4A,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x33, // 0x2E '.'
+  0x23,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x25,0x45,0x26,0x45,0x3F,0x3F,0x3F,0x17, // 0x2F '/'
+  0x3F,0x3F,0x18,0x48,0x21,0x4C,0x1D,0x50,0x1A,0x52,0x17,0x55,0x15,0x49,0x04,0x48,0x14,0x47,0x08,0x47,0x12,0x47,0x0A,0x47,0x10,0x47,0x0C,0x47,0x0F,0x46,0x0E,0x46,0x0E,0x47,0x0E,0x47,0x0D,0x46,0x10,0x46,0x0C,0x47,0x10,0x47,0x0B,0x47,0x10,0x47,0x0B,0x46,0x12,0x46,0x0A,0x47,0x12,0x47,0x09,0x47,0x12,0x47,0x09,0x47,0x12,0x47,0x09,0x47,0x12,0x47,0x09,0x46,0x14,0x46,0x08,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x07,0x47,0x14,0x47,0x08,0x46,0x14,0x46,0x09,0x46,0x13,0x47,0x09,0x47,0x12,0x47,0x09,0x47,0x12,0x47,0x09,0x47,0x12,0x47,0x0A,0x46,0x12,0x46,0x0B,0x47,0x10,0x47,0x0B,0x47,0x10,0x47,0x0C,0x46,0x10,0x46,0x0D,0x47,0x0E,0x47,0x0E,0x46,0x0E,0x46,0x0F,0x47,0x0C,0x47,0x10,0x47,0x0A,0x47,0x12,0x47,0x08,0x47,0x13,0x48,0x05,0x49,0x14,0x56,0x16,0x53,0x1A,0x50,0x1C,0x4D,0x21,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x08, // 0x30 '0'
+  0x3F,0x3F,0x21,0x40,0x28,0x43,0x25,0x46,0x22,0x49,0x1F,0x4C,0x1C,0x4F,0x19,0x52,0x17,0x54,0x17,0x4C,0x00,0x46,0x17,0x49,0x03,0x46,0x17,0x46,0x06,0x46,0x17,0x43,0x09,0x46,0x17,0x40,0x0C,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x17,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x09,0x62,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x25, // 0x31 '1'
+  0x3F,0x3F,0x15,0x49,0x1E,0x51,0x17,0x55,0x15,0x58,0x13,0x59,0x12,0x48,0x06,0x4A,0x11,0x44,0x0C,0x49,0x10,0x42,0x0F,0x48,0x10,0x40,0x12,0x48,0x24,0x47,0x24,0x48,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x23,0x47,0x24,0x47,0x24,0x46,0x24,0x47,0x24,0x46,0x24,0x47,0x23,0x47,0x23,0x47,0x23,0x47,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x46,0x24,0x47,0x24,0x46,0x24,0x46,0x24,0x47,0x24,0x46,0x24,0x47,0x23,0x47,0x24,0x47,0x23,0x48,0x23,0x5E,0x0D,0x5E,0x0D,0x5E,0x0D,0x5E,0x0D,0x5E,0x0D,0x5E,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x2A, // 0x32 '2'
+  0x3F,0x3F,0x15,0x4A,0x1D,0x51,0x18,0x55,0x16,0x56,0x15,0x57,0x14,0x46,0x07,0x49,0x13,0x43,0x0C,0x48,0x12,0x40,0x10,0x47,0x25,0x47,0x24,0x47,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x25,0x45,0x25,0x46,0x24,0x46,0x23,0x47,0x21,0x49,0x1A,0x4F,0x1C,0x4D,0x1E,0x4E,0x1D,0x50,0x1B,0x52,0x21,0x4B,0x23,0x49,0x24,0x48,0x24,0x48,0x24,0x47,0x25,0x47,0x24,0x47,0x25,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x23,0x47,0x24,0x47,0x23,0x48,0x22,0x48,0x10,0x40,0x10,0x49,0x10,0x43,0x0C,0x49,0x11,0x46,0x07,0x4A,0x12,0x58,0x13,0x57,0x14,0x55,0x18,0x51,0x1E,0x4A,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x09, // 0x33 '3'
+  0x3F,0x3F,0x3F,0x0D,0x46,0x24,0x47,0x23,0x48,0x23,0x48,0x22,0x49,0x21,0x4A,0x21,0x4A,0x20,0x4B,0x1F,0x4C,0x1F,0x4C,0x1E,0x45,0x00,0x46,0x1D,0x46,0x00,0x46,0x1D,0x45,0x01,0x46,0x1C,0x46,0x01,0x46,0x1B,0x46,0x02,0x46,0x1B,0x45,0x03,0x46,0x1A,0x46,0x03,0x46,0x19,0x46,0x04,0x46,0x19,0x45,0x05,0x46,0x18,0x46,0x05,0x46,0x17,0x46,0x06,0x46,0x17,0x45,0x07,0x46,0x16,0x46,0x07,0x46,0x15,0x46,0x08,0x46,0x15,0x45,0x09,0x46,0x14,0x46,0x09,0x46,0x14,0x45,0x0A,0x46,0x13,0x45,0x0B,0x46,0x12,0x46,0x0B,0x46,0x12,0x45,0x0C,0x46,0x11,0x45,0x0D,0x46,0x10,0x46,0x0D,0x46,0x10,0x45,0x0E,0x46,0x0F,0x45,0x0F,0x46,0x0F,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x08,0x63,0x1E,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x25,0x46,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x2E, // 0x34 '4'
+  0x3F,0x3F,0x3E,0x59,0x12,0x59,0x12,0x59,0x12,0x59,0x12,0x59,0x12,0x59,0x12,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x44,0x27,0x4A,0x21,0x4E,0x1D,0x51,0x1A,0x52,0x19,0x54,0x20,0x4C,0x22,0x4A,0x23,0x49,0x24,0x48,0x24,0x47,0x24,0x48,0x24,0x47,0x24,0x47,0x25,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x47,0x23,0x48,0x23,0x47,0x23,0x48,0x23,0x47,0x23,0x48,0x12,0x40,0x0E,0x48,0x13,0x42,0x0B,0x49,0x13,0x45,0x06,0x4A,0x14,0x56,0x15,0x54,0x17,0x53,0x1A,0x4F,0x1F,0x49,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x09, // 0x35 '5'
+  0x3F,0x3F,0x1D,0x48,0x1F,0x50,0x19,0x54,0x16,0x55,0x15,0x56,0x14,0x49,0x06,0x46,0x13,0x48,0x0B,0x43,0x12,0x47,0x10,0x40,0x11,0x47,0x24,0x47,0x23,0x47,0x23,0x47,0x24,0x47,0x24,0x46,0x24,0x47,0x24,0x46,0x25,0x46,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x46,0x07,0x47,0x14,0x47,0x05,0x4B,0x12,0x47,0x03,0x4F,0x10,0x47,0x02,0x51,0x0F,0x47,0x01,0x53,0x0E,0x47,0x00,0x45,0x05,0x49,0x0D,0x4D,0x08,0x48,0x0C,0x4B,0x0B,0x48,0x0B,0x4A,0x0D,0x47,0x0B,0x4A,0x0E,0x47,0x0A,0x49,0x0F,0x47,0x0A,0x49,0x10,0x46,0x0A,0x49,0x10,0x47,0x09,0x48,0x11,0x47,0x09,0x48,0x12,0x46,0x09,0x48,0x12,0x46,0x0A,0x47,0x12,0x46,0x0A,0x47,0x12,0x46,0x0A,0x47,0x12,0x46,0x0A,0x47,0x12,0x46,0x0A,0x47,0x12,0x46,0x0B,0x46,0x12,0x45,0x0C,0x47,0x10,0x46,0x0C,0x47,0x10,0x46,0x0D,0x47,0x0F,0x46,0x0D,0x47,0x0E,0x46,0x0F,0x47,0x0D,0x46,0x0F,0x48,0x0B,0x46,0x11,0x48,0x09,0x46,0x13,0x49,0x05,0x47,0x14,0x57,0x16,0x53,0x19,0x51,0x1C,0x4D,0x21,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x06, // 0x36 '6'
+  0x3F,0x3F,0x3A,0x60,0x0B,0x60,0x0B,0x60,0x0B,0x60,0x0B,0x60,0x0B,0x60,0x24,0x46,0x24,0x47,0x24,0x46,0x24,0x46,0x25,0x46,0x24,0x46,0x24,0x47,0x24,0x46,0x24,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x24,0x46,0x25,0x45,0x25,0x46,0x24,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x24,0x46,0x25,0x46,0x24,0x46,0x24,0x47,0x24,0x46,0x24,0x47,0x24,0x46,0x24,0x47,0x24,0x47,0x23,0x47,0x24,0x47,0x23,0x47,0x24,0x47,0x24,0x47,0x23,0x47,0x24,0x47,0x23,0x48,0x23,0x47,0x24,0x47,0x24,0x47,0x23,0x48,0x23,0x47,0x24,0x47,0x24,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3D, // 0x37 '7'
+  0x3F,0x3F,0x19,0x49,0x1F,0x4F,0x1B,0x52,0x17,0x55,0x15,0x57,0x13,0x48,0x06,0x49,0x12,0x46,0x09,0x48,0x11,0x46,0x0B,0x47,0x11,0x46,0x0C,0x47,0x0F,0x46,0x0E,0x46,0x0F,0x46,0x0E,0x46,0x0F,0x46,0x0E,0x46,0x0F,0x46,0x0E,0x46,0x0F,0x46,0x0E,0x46,0x0F,0x47,0x0D,0x46,0x0F,0x47,0x0C,0x46,0x10,0x48,0x0B,0x46,0x11,0x48,0x0A,0x45,0x12,0x49,0x08,0x46,0x13,0x49,0x06,0x46,0x14,0x4A,0x04,0x46,0x16,0x4B,0x01,0x46,0x18,0x52,0x1A,0x50,0x1D,0x4C,0x1F,0x4D,0x1C,0x51,0x19,0x53,0x17,0x47,0x01,0x4B,0x15,0x46,0x04,0x4B,0x13,0x46,0x07,0x4A,0x11,0x46,0x09,0x4A,0x0F,0x47,0x0B,0x49,0x0E,0x46,0x0D,0x49,0x0C,0x46,0x0F,0x48,0x0C,0x46,0x10,0x47,0x0C,0x46,0x10,0x48,0x0A,0x46,0x12,0x47,0x0A,0x46,0x12,0x47,0x0A,0x46,0x13,0x46,0x0A,0x46,0x13,0x46,0x0A,0x46,0x13,0x46,0x0A,0x46,0x13,0x46,0x0A,0x47,0x12,0x46,0x0A,0x47,0x11,0x46,0x0C,0x47,0x10,0x46,0x0C,0x47,0x0F,0x46,0x0E,0x47,0x0D,0x47,0x0E,0x49,0x0A,0x47,0x10,0x4A,0x06,0x48,0x12,0x58,0x14,0x56,0x17,0x53,0x1A,0x4F,0x1F,0x48,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x07, // 0x38 '8'
+  0x3F,0x3F,0x18,0x48,0x20,0x4E,0x1B,0x52,0x18,0x54,0x16,0x56,0x14,0x48,0x05,0x49,0x12,0x47,0x09,0x48,0x10,0x46,0x0C,0x48,0x0E,0x46,0x0E,0x47,0x0E,0x46,0x0F,0x47,0x0C,0x46,0x10,0x47,0x0C,0x46,0x11,0x47,0x0B,0x46,0x11,0x47,0x0B,0x45,0x12,0x47,0x0A,0x46,0x13,0x47,0x09,0x46,0x13,0x47,0x09,0x46,0x13,0x47,0x09,0x46,0x13,0x47,0x09,0x46,0x13,0x47,0x09,0x46,0x13,0x48,0x08,0x46,0x13,0x48,0x08,0x46,0x13,0x48,0x08,0x47,0x11,0x49,0x09,0x46,0x11,0x49,0x09,0x47,0x10,0x49,0x09,0x47,0x0F,0x4A,0x0A,0x47,0x0D,0x4B,0x0A,0x48,0x0B,0x4C,0x0B,0x48,0x09,0x4D,0x0C,0x49,0x05,0x46,0x00,0x47,0x0D,0x54,0x01,0x47,0x0E,0x52,0x02,0x47,0x0F,0x50,0x03,0x47,0x11,0x4C,0x05,0x47,0x13,0x47,0x08,0x46,0x24,0x47,0x24,0x47,0x24,0x47,0x24,0x46,0x24,0x47,0x24,0x47,0x24,0x46,0x24,0x47,0x24,0x46,0x24,0x47,0x23,0x47,0x23,0x48,0x10,0x40,0x10,0x48,0x11,0x43,0x0C,0x48,0x12,0x46,0x06,0x4A,0x13,0x57,0x14,0x56,0x15,0x54,0x19,0x50,0x1F,0x49,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x0A, // 0x39 '9'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x27, // 0x3A ':'
+};
+static const UG_U16 OFFSETS_FONT_45X72[] = {
+  0,51,162,279,485,690,981,1216,1296,1435,1575,1714,1813,1894,1951,2016,
+  2156,2369,2500,2629,2764,2932,3059,3250,3369,3570,3761,3812 };
+static const UG_U8 WIDTHS_FONT_45X72[] = {
+  45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,45,
+  45,45,45,45,45,45,45,45,45,45,45 };
+const UG_FONT FONT_45X72 = { (unsigned char*)BITS_FONT_45X72, FONT_TYPE_RLE, 45, 72, 32, 58, (UG_U8*)WIDTHS_FONT_45X72, OFFSETS_FONT_45X72 };
 #endif
 
 #ifdef USE_FONT_CURSORS
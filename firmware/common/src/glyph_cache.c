@@ -0,0 +1,274 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * Cache of the glyphs drawn by _UG_PutChar() as runs of same color pixels.
+ *
+ * Without it every pixel of a glyph is decoded from the font bits, anti-aliased fonts are also blended, and sent
+ * with a call to push_pixel(). A cached glyph is sent with one FILL_RUN driver call per run instead, which on the
+ * 850C sets the bus once and then only toggles WR for each pixel. The big numbers of the main screen are
+ * FONT_TYPE_RLE, their runs are read from flash the same way and caching them only made them slower: recording
+ * 3000 to 6000 pixels of each one, and their 300 bytes pushing the small glyphs out.
+ *
+ * Runs follow the FILL_AREA window order, so they continue from the end of a row to the start of the next one and
+ * the blank rows above and under the digits cost a few bytes. A run of the foreground or background color is one
+ * byte, any other color, like the blended edges of anti-aliased fonts, is stored after the run byte. A glyph is
+ * recorded while it is drawn the first time. The runs of all entries are packed at the start of ui8_m_runs:
+ * dropping an entry moves the runs after it down, that is a memmove of a few kbytes only when a glyph doesn't fit,
+ * and no space is lost to fragmentation.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "glyph_cache.h"
+#include "profile.h"
+
+// A run byte is RUN_COLOR with the run length - 1 and the color in the next two bytes, or RUN_FC or 0 for the
+// foreground or background color with the length - 1
+#define RUN_COLOR   0x80
+#define RUN_FC      0x40
+#define RUN_MAX_LEN 64 // of fc or bc, twice that with RUN_COLOR
+
+typedef struct {
+  const unsigned char *p_font; // the font bits, the UG_FONT may be a copy in gui->font, NULL if the entry is free
+  UG_COLOR fc;
+  UG_COLOR bc;
+  uint8_t ui8_char;
+  uint16_t ui16_first_byte;
+  uint16_t ui16_num_bytes;
+  uint32_t ui32_last_use;
+} glyph_entry_t;
+
+glyph_cache_stats_t g_glyph_cache_stats;
+
+static uint8_t ui8_m_runs[GLYPH_CACHE_BYTES];
+static uint16_t ui16_m_bytes_used;
+static glyph_entry_t m_entries[GLYPH_CACHE_ENTRIES];
+static uint32_t ui32_m_use_counter;
+
+// the glyph being recorded by record_pixel(), NULL if none or if it didn't fit
+static glyph_entry_t *p_m_recording;
+static UG_COLOR m_run_color; // the run being recorded, not yet in ui8_m_runs
+static uint16_t ui16_m_run_len;
+static void (*m_push_pixel)(UG_COLOR);
+static bool m_began;
+static uint32_t ui32_m_start_cycles;
+
+static void drop(glyph_entry_t *p_entry)
+{
+  uint16_t ui16_first = p_entry->ui16_first_byte;
+  uint16_t ui16_num = p_entry->ui16_num_bytes;
+
+  memmove(&ui8_m_runs[ui16_first], &ui8_m_runs[ui16_first + ui16_num], ui16_m_bytes_used - ui16_first - ui16_num);
+  ui16_m_bytes_used -= ui16_num;
+
+  for (int i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+    if (m_entries[i].p_font && m_entries[i].ui16_first_byte > ui16_first)
+      m_entries[i].ui16_first_byte -= ui16_num;
+  }
+
+  p_entry->p_font = NULL;
+}
+
+/// The least recently used entry but the one being recorded, NULL if there is none
+static glyph_entry_t* least_recently_used(void)
+{
+  glyph_entry_t *p_lru = NULL;
+
+  for (int i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+    glyph_entry_t *p_entry = &m_entries[i];
+
+    if (p_entry->p_font && p_entry != p_m_recording &&
+        (!p_lru || (int32_t) (p_entry->ui32_last_use - p_lru->ui32_last_use) < 0))
+      p_lru = p_entry;
+  }
+
+  return p_lru;
+}
+
+/// Makes room for ui8_num more bytes of the glyph being recorded, gives up on it if it is bigger than the cache
+static bool reserve(uint8_t ui8_num)
+{
+  while (ui16_m_bytes_used + ui8_num > GLYPH_CACHE_BYTES) {
+    glyph_entry_t *p_lru = least_recently_used();
+
+    if (!p_lru) {
+      drop(p_m_recording);
+      p_m_recording = NULL;
+      return false;
+    }
+
+    drop(p_lru);
+  }
+
+  p_m_recording->ui16_num_bytes += ui8_num;
+  return true;
+}
+
+static void record_run(void)
+{
+  bool other_color = m_run_color != p_m_recording->fc && m_run_color != p_m_recording->bc;
+  uint8_t ui8_max_len = other_color ? RUN_MAX_LEN * 2 : RUN_MAX_LEN;
+
+  while (ui16_m_run_len) {
+    uint8_t ui8_len = ui16_m_run_len > ui8_max_len ? ui8_max_len : ui16_m_run_len;
+    uint8_t *p_byte;
+
+    if (!reserve(other_color ? 3 : 1))
+      return;
+
+    p_byte = &ui8_m_runs[ui16_m_bytes_used];
+
+    if (other_color) {
+      p_byte[0] = RUN_COLOR | (ui8_len - 1);
+      p_byte[1] = m_run_color;
+      p_byte[2] = m_run_color >> 8;
+    } else {
+      p_byte[0] = (m_run_color == p_m_recording->fc ? RUN_FC : 0) | (ui8_len - 1);
+    }
+
+    ui16_m_bytes_used += other_color ? 3 : 1;
+    ui16_m_run_len -= ui8_len;
+  }
+}
+
+static void record_pixel(UG_COLOR color)
+{
+  m_push_pixel(color);
+
+  if (!p_m_recording)
+    return;
+
+  if (ui16_m_run_len && color == m_run_color) {
+    ui16_m_run_len++;
+    return;
+  }
+
+  if (ui16_m_run_len)
+    record_run();
+
+  m_run_color = color;
+  ui16_m_run_len = 1;
+}
+
+static void draw(const glyph_entry_t *p_entry, void (*p_fill_run)(UG_COLOR, UG_U16))
+{
+  const uint8_t *p_byte = &ui8_m_runs[p_entry->ui16_first_byte];
+  const uint8_t *p_end = p_byte + p_entry->ui16_num_bytes;
+  UG_COLOR run_color = 0;
+  UG_U16 run_len = 0;
+
+  while (p_byte < p_end) {
+    uint8_t b = *p_byte++;
+    UG_COLOR color;
+
+    if (b & RUN_COLOR) {
+      color = p_byte[0] | (p_byte[1] << 8);
+      p_byte += 2;
+      b &= ~RUN_COLOR;
+    } else {
+      color = (b & RUN_FC) ? p_entry->fc : p_entry->bc;
+      b &= ~RUN_FC;
+    }
+
+    // runs longer than a byte can count were split, send them back in one go
+    if (run_len && color != run_color) {
+      p_fill_run(run_color, run_len);
+      run_len = 0;
+    }
+
+    run_color = color;
+    run_len += b + 1;
+  }
+
+  if (run_len)
+    p_fill_run(run_color, run_len);
+}
+
+static void count(bool hit)
+{
+  static uint32_t ui32_hits, ui32_glyphs, ui32_cycles; // at the last stats update
+  uint32_t ui32_cycles_now = profile_hw_ticks() - ui32_m_start_cycles;
+  uint32_t ui32_total_glyphs, ui32_total_cycles;
+
+  if (hit) {
+    g_glyph_cache_stats.ui32_hits++;
+    g_glyph_cache_stats.ui32_hit_cycles += ui32_cycles_now;
+  } else {
+    g_glyph_cache_stats.ui32_misses++;
+    g_glyph_cache_stats.ui32_miss_cycles += ui32_cycles_now;
+  }
+
+  ui32_total_glyphs = g_glyph_cache_stats.ui32_hits + g_glyph_cache_stats.ui32_misses;
+  if (ui32_total_glyphs - ui32_glyphs < GLYPH_CACHE_STATS_GLYPHS)
+    return;
+
+  ui32_total_cycles = g_glyph_cache_stats.ui32_hit_cycles + g_glyph_cache_stats.ui32_miss_cycles;
+  g_glyph_cache_stats.ui8_hit_percent = (g_glyph_cache_stats.ui32_hits - ui32_hits) * 100 / GLYPH_CACHE_STATS_GLYPHS;
+  g_glyph_cache_stats.ui32_cycles_per_glyph = (ui32_total_cycles - ui32_cycles) / GLYPH_CACHE_STATS_GLYPHS;
+
+  ui32_hits = g_glyph_cache_stats.ui32_hits;
+  ui32_glyphs = ui32_total_glyphs;
+  ui32_cycles = ui32_total_cycles;
+}
+
+bool glyph_cache_begin(const UG_FONT *p_font, uint8_t ui8_char, UG_COLOR fc, UG_COLOR bc,
+    void (**p_push_pixel)(UG_COLOR), void (*p_fill_run)(UG_COLOR, UG_U16))
+{
+  glyph_entry_t *p_free = NULL;
+
+  ui32_m_start_cycles = profile_hw_ticks();
+  ui32_m_use_counter++;
+
+  for (int i = 0; i < GLYPH_CACHE_ENTRIES; i++) {
+    glyph_entry_t *p_entry = &m_entries[i];
+
+    if (!p_entry->p_font) {
+      p_free = p_entry;
+    } else if (p_entry->p_font == p_font->p && p_entry->ui8_char == ui8_char && p_entry->fc == fc &&
+        p_entry->bc == bc) {
+      draw(p_entry, p_fill_run);
+      p_entry->ui32_last_use = ui32_m_use_counter;
+      count(true);
+      return true;
+    }
+  }
+
+  if (!p_free) {
+    p_free = least_recently_used();
+    drop(p_free);
+  }
+
+  p_free->p_font = p_font->p;
+  p_free->ui8_char = ui8_char;
+  p_free->fc = fc;
+  p_free->bc = bc;
+  p_free->ui16_first_byte = ui16_m_bytes_used;
+  p_free->ui16_num_bytes = 0;
+  p_free->ui32_last_use = ui32_m_use_counter;
+
+  p_m_recording = p_free;
+  ui16_m_run_len = 0;
+  m_push_pixel = *p_push_pixel;
+  *p_push_pixel = record_pixel;
+  m_began = true;
+
+  return false;
+}
+
+void glyph_cache_end(void)
+{
+  if (!m_began)
+    return;
+
+  if (p_m_recording && ui16_m_run_len)
+    record_run();
+
+  p_m_recording = NULL;
+  m_began = false;
+  count(false);
+}
@@ -0,0 +1,275 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * The graph points of all the timescales, kept once.
+ *
+ * graph_data_push() runs from rt_graph_process() in the realtime ISR and only adds the point to level 0. When level
+ * 0 is full its oldest point is discarded to the sum of level 1, and every GRAPH_LEVEL_FACTOR_1 of them make the
+ * next point of level 1, which discards its own oldest point to level 2 the same way. So each level only keeps the
+ * points the level below no longer has, and the newest points of a level are the mean of the points of the level
+ * below when they are read, the last one maybe with the discarded sum for the part already gone. They come out the
+ * same as when they get kept, the sums are of the same points.
+ *
+ * The max/min of a level come from block summaries, so drawing a graph does not read all its points twice. Each
+ * point of a level, kept or not, goes to the summary of its block when it is made: graph_data_push() also sums the
+ * new points of each level to make the next point of the level above, the same mean the discarded sums make later.
+ * The blocks of a level are a ring of GRAPH_BLOCKS, and a block summary is reset when its first point is made. The
+ * blocks from the first one that starts after the oldest point of the level up to the newest point are all there;
+ * the oldest points before it are read one by one, at most GRAPH_BLOCK_POINTS - 1 of them.
+ *
+ * The points are stored in the int8_t, int16_t or int32_t of the GraphStore, minus its offset. The sums and means
+ * are of the values, so they come out the same as with int32_t points for the values the store holds.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "graph_data.h"
+
+#if GRAPH_LEVELS != 3
+#error "the tables below have an entry per level"
+#endif
+
+#if GRAPH_LEVEL_FACTOR_1 < 2 || GRAPH_LEVEL_FACTOR_2 < 2
+#error "a point of a level above 0 is the mean of at least 2 points of the level below"
+#endif
+
+const uint8_t ui8_g_graph_level_factor[GRAPH_LEVELS] = { 1, GRAPH_LEVEL_FACTOR_1, GRAPH_LEVEL_FACTOR_2 };
+
+// The points each level keeps, and the slot of its first one
+static const uint16_t ui16_m_level_kept[GRAPH_LEVELS] = { GRAPH_MAX_POINTS, GRAPH_LEVEL_POINTS(GRAPH_LEVEL_FACTOR_1),
+    GRAPH_LEVEL_POINTS(GRAPH_LEVEL_FACTOR_2) };
+static const uint16_t ui16_m_level_first[GRAPH_LEVELS] = { 0, GRAPH_MAX_POINTS,
+    GRAPH_MAX_POINTS + GRAPH_LEVEL_POINTS(GRAPH_LEVEL_FACTOR_1) };
+
+void graph_data_init(GraphData *p_graph, const GraphStore *p_store, int32_t i32_min_threshold)
+{
+  memset(p_graph, 0, sizeof(*p_graph));
+  if (p_store)
+    p_graph->store = *p_store;
+  p_graph->min_threshold = i32_min_threshold;
+}
+
+static int32_t point_get(const GraphData *p_graph, uint16_t ui16_slot)
+{
+  const GraphStore *p_store = &p_graph->store;
+
+  switch (p_store->size) {
+    case 1:
+      return ((const int8_t *) p_store->points)[ui16_slot] + p_store->offset;
+
+    case 2:
+      return ((const int16_t *) p_store->points)[ui16_slot] + p_store->offset;
+
+    default:
+      return ((const int32_t *) p_store->points)[ui16_slot] + p_store->offset;
+  }
+}
+
+static int32_t saturate(int32_t i32_value, int32_t i32_min, int32_t i32_max)
+{
+  return i32_value < i32_min ? i32_min : i32_value > i32_max ? i32_max : i32_value;
+}
+
+static void point_set(GraphData *p_graph, uint16_t ui16_slot, int32_t i32_value)
+{
+  const GraphStore *p_store = &p_graph->store;
+  int32_t i32_offset = p_store->offset;
+
+  switch (p_store->size) {
+    case 1:
+      ((int8_t *) p_store->points)[ui16_slot] = saturate(i32_value, INT8_MIN + i32_offset, INT8_MAX + i32_offset)
+          - i32_offset;
+      break;
+
+    case 2:
+      ((int16_t *) p_store->points)[ui16_slot] = saturate(i32_value, INT16_MIN + i32_offset,
+          INT16_MAX + i32_offset) - i32_offset;
+      break;
+
+    default:
+      ((int32_t *) p_store->points)[ui16_slot] = i32_value - i32_offset;
+      break;
+  }
+}
+
+// The slot of a point of a level, in its own ring of points
+static uint16_t level_slot(uint8_t ui8_level, uint32_t ui32_point)
+{
+  return ui16_m_level_first[ui8_level] + ui32_point % ui16_m_level_kept[ui8_level];
+}
+
+// A point of a level was made, add it to the summary of its block
+static void block_add(GraphData *p_graph, uint8_t ui8_level, uint32_t ui32_point, int32_t i32_value)
+{
+  uint8_t ui8_block = (ui32_point / GRAPH_BLOCK_POINTS) % GRAPH_BLOCKS;
+  int32_t *p_max = &p_graph->block_max[ui8_level][ui8_block], *p_min = &p_graph->block_min[ui8_level][ui8_block];
+
+  // first point of the block, forget what it held the previous time around
+  if (ui32_point % GRAPH_BLOCK_POINTS == 0) {
+    *p_max = INT32_MIN;
+    *p_min = INT32_MAX;
+  }
+
+  if (i32_value > *p_max)
+    *p_max = i32_value;
+
+  if (i32_value < *p_min && i32_value >= p_graph->min_threshold)
+    *p_min = i32_value;
+}
+
+// The new point of level 0 and the points of the levels above it completes
+static void levels_made(GraphData *p_graph, uint32_t ui32_made, int32_t i32_value)
+{
+  block_add(p_graph, 0, ui32_made - 1, i32_value);
+
+  for (uint8_t i = 0; i < GRAPH_LEVELS - 1; i++) {
+    uint8_t ui8_factor = ui8_g_graph_level_factor[i + 1];
+
+    p_graph->made_sum[i] += i32_value;
+    if (ui32_made % ui8_factor != 0)
+      return;
+
+    i32_value = p_graph->made_sum[i] / ui8_factor;
+    p_graph->made_sum[i] = 0;
+
+    ui32_made /= ui8_factor;
+    block_add(p_graph, i + 1, ui32_made - 1, i32_value);
+  }
+}
+
+void graph_data_push(GraphData *p_graph, int32_t i32_value)
+{
+  uint32_t ui32_point = p_graph->pushed;
+  uint16_t ui16_slot = level_slot(0, ui32_point);
+  int32_t i32_discarded = point_get(p_graph, ui16_slot);
+
+  point_set(p_graph, ui16_slot, i32_value);
+  levels_made(p_graph, ui32_point + 1, point_get(p_graph, ui16_slot)); // as stored, it may be saturated
+  p_graph->pushed++;
+  if (ui32_point < GRAPH_MAX_POINTS)
+    return;
+
+  // the discarded point, in its level, goes to the level above
+  ui32_point -= GRAPH_MAX_POINTS;
+  for (uint8_t i = 0; i < GRAPH_LEVELS - 1; i++) {
+    uint8_t ui8_factor = ui8_g_graph_level_factor[i + 1];
+
+    p_graph->discarded_sum[i] += i32_discarded;
+    if (ui32_point % ui8_factor != ui8_factor - 1)
+      return;
+
+    i32_value = p_graph->discarded_sum[i] / ui8_factor;
+    p_graph->discarded_sum[i] = 0;
+
+    ui32_point /= ui8_factor;
+    ui16_slot = level_slot(i + 1, ui32_point);
+    i32_discarded = point_get(p_graph, ui16_slot);
+    point_set(p_graph, ui16_slot, i32_value);
+    if (ui32_point < ui16_m_level_kept[i + 1])
+      return;
+
+    ui32_point -= ui16_m_level_kept[i + 1];
+  }
+}
+
+// The points each level discarded to the level above, from the points pushed
+static void levels_discarded(uint32_t ui32_pushed, uint32_t *p_discarded)
+{
+  for (uint8_t i = 0; i < GRAPH_LEVELS; i++) {
+    p_discarded[i] = ui32_pushed > ui16_m_level_kept[i] ? ui32_pushed - ui16_m_level_kept[i] : 0;
+    if (i < GRAPH_LEVELS - 1)
+      ui32_pushed = p_discarded[i] / ui8_g_graph_level_factor[i + 1]; // the points that went to the level above
+  }
+}
+
+static int32_t level_point(const GraphData *p_graph, const uint32_t *p_discarded, uint8_t ui8_level,
+    uint32_t ui32_point)
+{
+  uint8_t ui8_factor = ui8_g_graph_level_factor[ui8_level];
+  uint32_t ui32_below, ui32_end;
+  int32_t i32_sum = 0;
+
+  if (ui8_level == 0 || ui32_point < p_discarded[ui8_level - 1] / ui8_factor)
+    return point_get(p_graph, level_slot(ui8_level, ui32_point));
+
+  // not kept yet, made from the level below
+  ui32_below = ui32_point * ui8_factor;
+  ui32_end = ui32_below + ui8_factor;
+  if (ui32_below < p_discarded[ui8_level - 1]) {
+    i32_sum = p_graph->discarded_sum[ui8_level - 1];
+    ui32_below = p_discarded[ui8_level - 1];
+  }
+
+  for (; ui32_below < ui32_end; ui32_below++)
+    i32_sum += level_point(p_graph, p_discarded, ui8_level - 1, ui32_below);
+
+  return i32_sum / ui8_factor;
+}
+
+// The points of the level so far, graph_data_points() are the last ones
+static uint32_t level_made(uint32_t ui32_pushed, uint8_t ui8_level)
+{
+  for (uint8_t i = 1; i <= ui8_level; i++)
+    ui32_pushed /= ui8_g_graph_level_factor[i];
+
+  return ui32_pushed;
+}
+
+uint16_t graph_data_points(const GraphData *p_graph, uint8_t ui8_level)
+{
+  uint32_t ui32_made = level_made(p_graph->pushed, ui8_level);
+
+  return ui32_made < GRAPH_MAX_POINTS ? ui32_made : GRAPH_MAX_POINTS;
+}
+
+int32_t graph_data_point(const GraphData *p_graph, uint8_t ui8_level, uint16_t ui16_point)
+{
+  uint32_t ui32_pushed = p_graph->pushed; // the realtime ISR pushes meanwhile
+  uint32_t ui32_made = level_made(ui32_pushed, ui8_level);
+  uint32_t ui32_discarded[GRAPH_LEVELS];
+  uint32_t ui32_first = ui32_made > GRAPH_MAX_POINTS ? ui32_made - GRAPH_MAX_POINTS : 0;
+
+  levels_discarded(ui32_pushed, ui32_discarded);
+
+  return level_point(p_graph, ui32_discarded, ui8_level, ui32_first + ui16_point);
+}
+
+void graph_data_max_min(const GraphData *p_graph, uint8_t ui8_level, int32_t *p_max, int32_t *p_min)
+{
+  uint32_t ui32_pushed = p_graph->pushed;
+  uint32_t ui32_made = level_made(ui32_pushed, ui8_level);
+  uint32_t ui32_discarded[GRAPH_LEVELS];
+  uint32_t ui32_point = ui32_made > GRAPH_MAX_POINTS ? ui32_made - GRAPH_MAX_POINTS : 0;
+
+  levels_discarded(ui32_pushed, ui32_discarded);
+
+  *p_max = INT32_MIN;
+  *p_min = INT32_MAX;
+
+  // the oldest points, up to the first block that has no older ones
+  for (; ui32_point < ui32_made && ui32_point % GRAPH_BLOCK_POINTS != 0; ui32_point++) {
+    int32_t i32_value = level_point(p_graph, ui32_discarded, ui8_level, ui32_point);
+
+    if (i32_value > *p_max)
+      *p_max = i32_value;
+
+    if (i32_value < *p_min && i32_value >= p_graph->min_threshold)
+      *p_min = i32_value;
+  }
+
+  // then the summaries of the blocks, the last one up to the newest point
+  for (; ui32_point < ui32_made; ui32_point += GRAPH_BLOCK_POINTS) {
+    uint8_t ui8_block = (ui32_point / GRAPH_BLOCK_POINTS) % GRAPH_BLOCKS;
+
+    if (p_graph->block_max[ui8_level][ui8_block] > *p_max)
+      *p_max = p_graph->block_max[ui8_level][ui8_block];
+
+    if (p_graph->block_min[ui8_level][ui8_block] < *p_min)
+      *p_min = p_graph->block_min[ui8_level][ui8_block];
+  }
+}
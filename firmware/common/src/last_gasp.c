@@ -0,0 +1,139 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * The records of last_gasp.h are appended to the area, which is only erased once more than half of it is used and
+ * the newest record is merged, at boot or at a settings save. last_gasp_save() never waits for an erase of its
+ * own. A record is:
+ *
+ *   odometer, Wh, magic and CRC16 of the two, merged
+ *
+ * The magic and CRC word is programmed last, a record cut short by the supply is not valid. The merged word stays
+ * erased until the settings hold the record's counters, then it is programmed to 0, which flash allows on a
+ * programmed word as well. If the supply came back after a record was written, the next settings save marks it
+ * merged, so an old record never overwrites newer settings.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "utils.h"
+#include "last_gasp.h"
+
+#define LAST_GASP_ERASED    0xffffffff
+#define LAST_GASP_MAGIC     0x4c47 // "LG"
+#define LAST_GASP_NONE      0xffff
+
+#define record_merged(p_record) ((p_record)[3])
+
+static uint16_t ui16_m_free; // the first free record, LAST_GASP_RECORDS if none
+static uint16_t ui16_m_newest; // the newest valid record
+// the SW102 SoftDevice programs them after last_gasp_hw_program() returned
+static uint32_t ui32_m_record[LAST_GASP_WRITE_WORDS];
+static const uint32_t ui32_m_zero = 0;
+
+static const uint32_t* record_at(uint16_t ui16_record)
+{
+  return last_gasp_hw_area() + ui16_record * LAST_GASP_RECORD_WORDS;
+}
+
+static uint32_t record_check(const uint32_t *p_record)
+{
+  return ((uint32_t) LAST_GASP_MAGIC << 16) | crc16_update(0xffff, (const uint8_t *) p_record, 2 * sizeof(uint32_t));
+}
+
+static bool record_blank(const uint32_t *p_record)
+{
+  for (uint8_t i = 0; i < LAST_GASP_RECORD_WORDS; i++) {
+    if (p_record[i] != LAST_GASP_ERASED)
+      return false;
+  }
+
+  return true;
+}
+
+// Erase the area when more than half of it is used, with nothing left to merge
+static void area_free(void)
+{
+  uint16_t ui16_used = ui16_m_free;
+
+  if (ui16_used <= LAST_GASP_RECORDS / 2 || !last_gasp_hw_area())
+    return;
+
+  // no record while it is erased, the flash is too busy for one anyway
+  ui16_m_free = LAST_GASP_RECORDS;
+
+  // an erase cut short can leave merged words erased again, so the records are made not valid first. From the
+  // oldest, if this is cut short the newest valid one is still the one that was merged
+  for (uint16_t i = 0; i < ui16_used; i++) {
+    if (record_at(i)[2])
+      last_gasp_hw_program(i * LAST_GASP_RECORD_WORDS + 2, &ui32_m_zero, 1);
+  }
+
+  if (last_gasp_hw_erase()) {
+    ui16_m_free = 0;
+    ui16_m_newest = LAST_GASP_NONE;
+  }
+}
+
+void last_gasp_init(void)
+{
+  ui16_m_free = LAST_GASP_RECORDS;
+  ui16_m_newest = LAST_GASP_NONE;
+
+  if (!last_gasp_hw_area())
+    return;
+
+  // the records are appended, everything after the last one that is not blank is free
+  while (ui16_m_free && record_blank(record_at(ui16_m_free - 1)))
+    ui16_m_free--;
+
+  for (uint16_t i = ui16_m_free; i--; ) {
+    if (record_at(i)[2] == record_check(record_at(i))) {
+      ui16_m_newest = i;
+      break;
+    }
+  }
+
+  // a record to merge is kept until last_gasp_merged()
+  if (!last_gasp_read(NULL))
+    area_free();
+}
+
+bool last_gasp_read(last_gasp_record_t *p_record)
+{
+  if (ui16_m_newest == LAST_GASP_NONE || record_merged(record_at(ui16_m_newest)) != LAST_GASP_ERASED)
+    return false;
+
+  if (p_record) {
+    p_record->ui32_odometer_x10 = record_at(ui16_m_newest)[0];
+    p_record->ui32_wh_x10 = record_at(ui16_m_newest)[1];
+  }
+
+  return true;
+}
+
+void last_gasp_merged(void)
+{
+  if (last_gasp_read(NULL))
+    last_gasp_hw_program(ui16_m_newest * LAST_GASP_RECORD_WORDS + 3, &ui32_m_zero, 1);
+
+  area_free();
+}
+
+void last_gasp_save(uint32_t ui32_odometer_x10, uint32_t ui32_wh_x10)
+{
+  if (ui16_m_free >= LAST_GASP_RECORDS)
+    return;
+
+  ui32_m_record[0] = ui32_odometer_x10;
+  ui32_m_record[1] = ui32_wh_x10;
+  ui32_m_record[2] = record_check(ui32_m_record);
+
+  if (last_gasp_hw_program(ui16_m_free * LAST_GASP_RECORD_WORDS, ui32_m_record, LAST_GASP_WRITE_WORDS))
+    ui16_m_newest = ui16_m_free;
+  ui16_m_free++;
+}
@@ -24,6 +24,12 @@
 #include "configscreen.h"
 #include "state.h"
 #include "timer.h"
+#include "profile.h"
+#include "events.h"
+#include "ride_log.h"
+#ifdef SW102
+#include "data_export.h"
+#endif
 
 uint8_t ui8_m_wheel_speed_decimal;
 
@@ -137,20 +143,22 @@ Field motorFOCFieldGraph = FIELD_READONLY_UINT("motor foc", &rt_vars.ui8_foc_ang
 
 #ifndef SW102 // we don't have any graphs yet on SW102, possibly move this into mainscreen_850.c
 
-Field wheelSpeedGraph = FIELD_GRAPH(&wheelSpeedFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsWheelSpeed]);
-Field tripDistanceGraph = FIELD_GRAPH(&tripDistanceFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsTripDistance]);
-Field odoGraph = FIELD_GRAPH(&odoFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsOdometer]);
-Field cadenceGraph = FIELD_GRAPH(&cadenceFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsCadence]);
-Field humanPowerGraph = FIELD_GRAPH(&humanPowerFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsHumanPower]);
-Field batteryPowerGraph = FIELD_GRAPH(&batteryPowerFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsBatteryPower]);
-Field batteryVoltageGraph = FIELD_GRAPH(&batteryVoltageFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsBatteryVoltage]);
-Field batteryCurrentGraph = FIELD_GRAPH(&batteryCurrentFieldGraph, .filter = FilterSquare, .min_threshold = -1, .graph_vars = &g_graphVars[VarsBatteryCurrent]);
-Field motorCurrentGraph = FIELD_GRAPH(&motorCurrentFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsMotorCurrent]);
-Field batterySOCGraph = FIELD_GRAPH(&batterySOCFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsBatterySOC]);
-Field motorTempGraph = FIELD_GRAPH(&motorTempFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsMotorTemp]);
-Field motorErpsGraph = FIELD_GRAPH(&motorErpsFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsMotorERPS]);
-Field pwmDutyGraph = FIELD_GRAPH(&pwmDutyFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsMotorPWM]);
-Field motorFOCGraph = FIELD_GRAPH(&motorFOCFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsMotorFOC]);
+// The points are stored in the type of the value getEditableNumber() gives: 2 bytes sources are read as int16_t,
+// 1 byte ones as uint8_t, so those are int8_t offset by 128. Motor temperature in F needs an int16_t
+Field wheelSpeedGraph = FIELD_GRAPH(&wheelSpeedFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsWheelSpeed], .store = GRAPH_STORE(int16_t, 0));
+Field tripDistanceGraph = FIELD_GRAPH(&tripDistanceFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsTripDistance], .store = GRAPH_STORE(int32_t, 0));
+Field odoGraph = FIELD_GRAPH(&odoFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsOdometer], .store = GRAPH_STORE(int32_t, 0));
+Field cadenceGraph = FIELD_GRAPH(&cadenceFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsCadence], .store = GRAPH_STORE(int8_t, 128));
+Field humanPowerGraph = FIELD_GRAPH(&humanPowerFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsHumanPower], .store = GRAPH_STORE(int16_t, 0));
+Field batteryPowerGraph = FIELD_GRAPH(&batteryPowerFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsBatteryPower], .store = GRAPH_STORE(int16_t, 0));
+Field batteryVoltageGraph = FIELD_GRAPH(&batteryVoltageFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsBatteryVoltage], .store = GRAPH_STORE(int16_t, 0));
+Field batteryCurrentGraph = FIELD_GRAPH(&batteryCurrentFieldGraph, .filter = FilterSquare, .min_threshold = -1, .graph_vars = &g_graphVars[VarsBatteryCurrent], .store = GRAPH_STORE(int16_t, 0));
+Field motorCurrentGraph = FIELD_GRAPH(&motorCurrentFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsMotorCurrent], .store = GRAPH_STORE(int16_t, 0));
+Field batterySOCGraph = FIELD_GRAPH(&batterySOCFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsBatterySOC], .store = GRAPH_STORE(int8_t, 128));
+Field motorTempGraph = FIELD_GRAPH(&motorTempFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsMotorTemp], .store = GRAPH_STORE(int16_t, 0));
+Field motorErpsGraph = FIELD_GRAPH(&motorErpsFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsMotorERPS], .store = GRAPH_STORE(int16_t, 0));
+Field pwmDutyGraph = FIELD_GRAPH(&pwmDutyFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsMotorPWM], .store = GRAPH_STORE(int8_t, 128));
+Field motorFOCGraph = FIELD_GRAPH(&motorFOCFieldGraph, .min_threshold = -1, .graph_vars = &g_graphVars[VarsMotorFOC], .store = GRAPH_STORE(int8_t, 128));
 
 // Note: the number of graphs in this collection must equal GRAPH_VARIANT_SIZE (for now)
 Field graphs = FIELD_CUSTOMIZABLE(&ui_vars.field_selectors[0],
@@ -385,10 +393,10 @@ void power(void) {
   else
   {
     // because this click envent can happens and will block the detection of button_onoff_long_click_event
-    buttons_clear_onoff_click_event();
+    buttons_clear_events(ONOFF_CLICK);
 
     // leave this menu with a button_onoff_long_click
-    if(buttons_get_onoff_long_click_event())
+    if(buttons_get_events() & ONOFF_LONG_CLICK)
     {
       buttons_clear_all_events();
       m_lcd_vars.ui8_lcd_menu_max_power = 0;
@@ -402,7 +410,7 @@ void power(void) {
       return;
     }
 
-    if(buttons_get_up_click_event())
+    if(buttons_get_events() & UP_CLICK)
     {
       buttons_clear_all_events();
 
@@ -419,7 +427,7 @@ void power(void) {
       if(ui_vars.ui8_target_max_battery_power > 100) { ui_vars.ui8_target_max_battery_power = 100; }
     }
 
-    if(buttons_get_down_click_event ())
+    if(buttons_get_events() & DOWN_CLICK)
     {
       buttons_clear_all_events();
 
@@ -468,38 +476,28 @@ void power(void) {
 #endif
 }
 
+/// EVENT_RT_TICK handler, every 100ms as the data comming from the motor is only updated every 100ms, not less
 void screen_clock(void) {
-  static int counter_time_ms = 0;
-  int time_ms = 0;
-
-  // No point to processing less than every 100ms, as the data comming from the motor is only updated every 100ms, not less
-  time_ms = get_time_base_counter_1ms();
-  if((time_ms - counter_time_ms) >= 100) // not least than evey 100ms
-  {
-    counter_time_ms = time_ms;
-
-    // exchange data from realtime layer to UI layer
-    // do this in atomic way, disabling the real time layer (should be no problem as
-    // copy_rt_to_ui_vars() should be fast and take a small piece of the 100ms periodic realtime layer processing
-    rt_processing_stop();
-    copy_rt_to_ui_vars();
-    rt_processing_start();
-
-    lcd_main_screen();
+  uint32_t ui32_profile_start = profile_begin();
+
+  // exchange data from realtime layer to UI layer, this reads a consistent snapshot without stopping the
+  // real time layer, see copy_rt_to_ui_vars()
+  copy_rt_to_ui_vars();
+
+  automatic_power_off_management();
+  lcd_main_screen();
+  DisplayResetToDefaults();
+  batteryTotalWh();
+  batteryCurrent();
+  motorCurrent();
+  batteryPower();
+  pedalPower();
 #ifndef SW102
-    clock_time();
+  thresholds();
 #endif
-    DisplayResetToDefaults();
-    batteryTotalWh();
-    batteryCurrent();
-    motorCurrent();
-    batteryPower();
-    pedalPower();
-#ifndef SW102
-    thresholds();
-#endif
-    screenUpdate();
-  }
+  screenUpdate();
+
+  profile_end(PROFILE_SCREEN_CLOCK, ui32_profile_start);
 }
 
 void thresholds(void) {
@@ -822,20 +820,25 @@ static bool appwide_onpress(buttons_events_t events)
     return true;
   }
 
+  if (events & SCREENCLICK_DIAGNOSTICS) {
+    screenShow(&diagnosticsScreen);
+    return true;
+  }
+
 	return false;
 }
 
-/// Called every 20ms to check for button events and dispatch to our handlers
+/// Called on each button edge and every 20ms while they are busy, to dispatch the button events to our handlers
 static void handle_buttons() {
 
   static uint8_t firstTime = 1;
 
+  buttons_clock(); // first, so a click is handled as soon as the button is released
+
   // keep tracking of first time release of onoff button
   if(firstTime && buttons_get_onoff_state() == 0) {
     firstTime = 0;
-    buttons_clear_onoff_click_event();
-    buttons_clear_onoff_long_click_event();
-    buttons_clear_onoff_click_long_click_event();
+    buttons_clear_events(ONOFF_CLICK | ONOFF_LONG_CLICK | ONOFF_CLICK_LONG_CLICK);
   }
 
   if (buttons_events && firstTime == 0)
@@ -849,28 +852,38 @@ static void handle_buttons() {
 		if (!handled)
 			handled |= appwide_onpress(buttons_events);
 
-		if (handled)
+		if (handled) {
 			buttons_clear_all_events();
+			screenUpdate(); // show what the press changed now instead of on the next EVENT_RT_TICK
+		}
+		else
+			buttons_events = 0; // nobody wants them, don't keep the buttons busy and offer them again with the next press
 	}
-
-	buttons_clock(); // Note: this is done _after_ button events is checked to provide a 20ms debounce
 }
 
-/// Call every 20ms from the main thread.
-void main_idle() {
-  static int counter_time_ms = 0;
-  int time_ms = 0;
+/// Call from the main thread each time it wakes up, runs the handlers of the events the interrupts posted since.
+/// Returns false if there were none, then the main thread can sleep until the next interrupt.
+bool main_idle() {
+  static const event_handler_t handlers[EVENTS_NUM] = {
+    [EVENT_BUTTONS] = handle_buttons,
+    [EVENT_RT_TICK] = screen_clock,
+#ifndef SW102
+    [EVENT_RTC_MINUTE] = clock_time,
+#endif
+    [EVENT_RIDE_LOG] = ride_log_flush,
+#ifdef SW102
+    [EVENT_EXPORT] = data_export_pump,
+#endif
+  };
+  uint32_t ui32_profile_start = profile_begin();
 
-  // no point to processing less than every 100ms, as the data comming from the motor is only updated every 100ms, not less
-  time_ms = get_time_base_counter_1ms();
-  if((time_ms - counter_time_ms) >= 100) // not least than evey 100ms
-  {
-    counter_time_ms = time_ms;
-    automatic_power_off_management();
-  }
+	if (!events_dispatch(handlers)) {
+		ride_log_idle(); // nothing else to do, a flash erase stalls nobody now
+		return false;
+	}
 
-	handle_buttons();
-	screen_clock(); // This is _after_ handle_buttons so if a button was pressed this tick, we immediately update the GUI
+	profile_end(PROFILE_MAIN_IDLE, ui32_profile_start);
+	return true;
 }
 
 void batteryTotalWh(void) {
@@ -0,0 +1,155 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * Time spent in main_idle(), screen_clock(), screenUpdate(), renderLayouts(), each field renderer, communications()
+ * and rt_processing(), kept as count, min, average, max and a histogram for each of them.
+ *
+ * rt_processing() runs from a timer interrupt, so the main loop times include it when it preempted them.
+ *
+ * diagnosticsScreen shows one of them per page, DOWN click + long click on any screen opens it: UP and DOWN go to
+ * the previous and next ones, a long UP clears them all and ONOFF goes back to the main screen.
+ */
+
+#include <string.h>
+#include "screen.h"
+#include "mainscreen.h"
+#include "fonts.h"
+#include "profile.h"
+
+profile_stats_t g_profile_stats[PROFILE_POINTS];
+
+const char *const g_profile_names[PROFILE_POINTS] = {
+  [PROFILE_MAIN_IDLE] = "main_idle",
+  [PROFILE_SCREEN_CLOCK] = "scr_clock",
+  [PROFILE_SCREEN_UPDATE] = "scrUpdate",
+  [PROFILE_RENDER_LAYOUTS] = "layouts",
+  [PROFILE_RENDER_FIELD + FieldDrawTextRW] = "r:textRW",
+  [PROFILE_RENDER_FIELD + FieldDrawTextRO] = "r:textRO",
+  [PROFILE_RENDER_FIELD + FieldFill] = "r:fill",
+  [PROFILE_RENDER_FIELD + FieldMesh] = "r:mesh",
+  [PROFILE_RENDER_FIELD + FieldScrollable] = "r:scroll",
+  [PROFILE_RENDER_FIELD + FieldEditable] = "r:edit",
+  [PROFILE_RENDER_FIELD + FieldCustom] = "r:custom",
+  [PROFILE_RENDER_FIELD + FieldGraph] = "r:graph",
+  [PROFILE_RENDER_FIELD + FieldCustomizable] = "r:custmz",
+  [PROFILE_RENDER_FIELD + FieldEnd] = "r:end",
+  [PROFILE_COMMUNICATIONS] = "comms",
+  [PROFILE_RT_PROCESSING] = "rt_proc",
+};
+
+static const char *const m_bucket_names[PROFILE_BUCKETS] = { "<64u", "<512u", "<4m", "<32m", ">32m" };
+
+void profile_end(profile_point_t point, uint32_t ui32_start) {
+  uint32_t ui32_us = PROFILE_TICKS_TO_US((profile_hw_ticks() - ui32_start) & PROFILE_TICKS_MASK);
+  profile_stats_t *p_stats = &g_profile_stats[point];
+  uint8_t ui8_bucket = 0;
+
+  if (p_stats->ui32_count == 0 || ui32_us < p_stats->ui32_min_us)
+    p_stats->ui32_min_us = ui32_us;
+  if (ui32_us > p_stats->ui32_max_us)
+    p_stats->ui32_max_us = ui32_us;
+
+  p_stats->ui32_count++;
+  p_stats->ui64_total_us += ui32_us;
+
+  while (ui8_bucket < PROFILE_BUCKETS - 1 && ui32_us >= (64UL << (3 * ui8_bucket)))
+    ui8_bucket++;
+  p_stats->ui32_buckets[ui8_bucket]++;
+}
+
+void profile_reset(void) {
+  memset(g_profile_stats, 0, sizeof(g_profile_stats));
+}
+
+// diagnosticsScreen, the lines fit the 10 characters of the SW102
+static uint8_t ui8_m_point;
+
+static Field nameHeading = FIELD_DRAWTEXT_RW();
+static Field countLine = FIELD_DRAWTEXT_RW();
+static Field minLine = FIELD_DRAWTEXT_RW();
+static Field avgLine = FIELD_DRAWTEXT_RW();
+static Field maxLine = FIELD_DRAWTEXT_RW();
+static Field bucketLines[PROFILE_BUCKETS] = { FIELD_DRAWTEXT_RW(), FIELD_DRAWTEXT_RW(), FIELD_DRAWTEXT_RW(),
+    FIELD_DRAWTEXT_RW(), FIELD_DRAWTEXT_RW() };
+
+static void printTime(Field *field, const char *label, uint32_t us) {
+  if (us < 1000)
+    fieldPrintf(field, "%s %uus", label, (unsigned) us);
+  else if (us < 10000)
+    fieldPrintf(field, "%s %u.%ums", label, (unsigned) (us / 1000), (unsigned) (us / 100 % 10));
+  else
+    fieldPrintf(field, "%s %ums", label, (unsigned) (us / 1000));
+}
+
+static void diagnosticsScreenOnPreUpdate() {
+  const profile_stats_t *p_stats = &g_profile_stats[ui8_m_point];
+  uint32_t ui32_count = p_stats->ui32_count; // rt_processing() might be updating it
+
+  fieldPrintf(&nameHeading, "%s", g_profile_names[ui8_m_point]);
+  fieldPrintf(&countLine, "n %u", (unsigned) ui32_count);
+  printTime(&minLine, "min", ui32_count ? p_stats->ui32_min_us : 0);
+  printTime(&avgLine, "avg", ui32_count ? (uint32_t) (p_stats->ui64_total_us / ui32_count) : 0);
+  printTime(&maxLine, "max", p_stats->ui32_max_us);
+
+  for (int i = 0; i < PROFILE_BUCKETS; i++)
+    fieldPrintf(&bucketLines[i], "%-5s%3u%%", m_bucket_names[i],
+        (unsigned) (ui32_count ? p_stats->ui32_buckets[i] * 100 / ui32_count : 0));
+}
+
+// the next point that was timed at least once, the renderers of fields not on any screen never are
+static void diagnosticsNextPoint(int8_t i8_step) {
+  for (uint8_t i = 0; i < PROFILE_POINTS; i++) {
+    ui8_m_point = (ui8_m_point + PROFILE_POINTS + i8_step) % PROFILE_POINTS;
+    if (g_profile_stats[ui8_m_point].ui32_count)
+      break;
+  }
+}
+
+static bool diagnosticsScreenOnPress(buttons_events_t events) {
+  if (events & UP_CLICK) {
+    diagnosticsNextPoint(-1);
+    return true;
+  }
+
+  if (events & DOWN_CLICK) {
+    diagnosticsNextPoint(1);
+    return true;
+  }
+
+  if (events & UP_LONG_CLICK) {
+    profile_reset();
+    return true;
+  }
+
+  if (events & ONOFF_CLICK) {
+    screenShow(&mainScreen);
+    return true;
+  }
+
+  return false;
+}
+
+#define DIAGNOSTICS_LINE(f) { .y = -1, .height = -1, .color = ColorNormal, .field = &f, .font = &REGULAR_TEXT_FONT }
+
+Screen diagnosticsScreen = {
+  .onPreUpdate = diagnosticsScreenOnPreUpdate,
+  .onPress = diagnosticsScreenOnPress,
+
+  .fields = {
+    { .height = -1, .color = ColorInvert, .field = &nameHeading, .font = &REGULAR_TEXT_FONT },
+    DIAGNOSTICS_LINE(countLine),
+    DIAGNOSTICS_LINE(minLine),
+    DIAGNOSTICS_LINE(avgLine),
+    DIAGNOSTICS_LINE(maxLine),
+    DIAGNOSTICS_LINE(bucketLines[0]),
+    DIAGNOSTICS_LINE(bucketLines[1]),
+    DIAGNOSTICS_LINE(bucketLines[2]),
+    DIAGNOSTICS_LINE(bucketLines[3]),
+    DIAGNOSTICS_LINE(bucketLines[4]),
+    { .field = NULL }
+  }
+};
@@ -0,0 +1,281 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * Ride logger: every RIDE_LOG_INTERVAL_MS rt_processing() encodes the RIDE_LOG_CHANNELS of rt_vars into a block
+ * in RAM (see ride_log_header_t for the format), a few bytes per sample as most channels change by little or not
+ * at all. A full block is sealed with its CRC and EVENT_RIDE_LOG makes the main loop store it, a short step at
+ * a time so the UI and the realtime tick are never held up for long, while the samples go to the other block.
+ * If both are still waiting for flash the samples are dropped.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+#include "utils.h"
+#include "rtc.h"
+#include "screen.h"
+#include "events.h"
+#include "ride_log.h"
+
+#define RIDE_LOG_PAYLOAD_BYTES    (RIDE_LOG_BLOCK_BYTES - sizeof(ride_log_header_t))
+#define RIDE_LOG_SAMPLE_MAX_BYTES (3 + RIDE_LOG_CHANNELS_NUM * 5) // the changed bits, then 5 bytes per 32 bits varint
+#define RIDE_LOG_CHANNELS_MASK    (RIDE_LOG_CHANNELS & ((1 << RIDE_LOG_CHANNELS_NUM) - 1))
+
+// keeps the compiler from moving the plain stores to a block past the m_full flag that hands it over
+#define compiler_barrier() __asm volatile ("" ::: "memory")
+
+#if RIDE_LOG_INTERVAL_MS % REALTIME_INTERVAL_MS
+#error "RIDE_LOG_INTERVAL_MS must be a multiple of REALTIME_INTERVAL_MS"
+#endif
+
+static const struct {
+  uint16_t ui16_offset;
+  uint8_t ui8_size;
+} m_channels[RIDE_LOG_CHANNELS_NUM] = {
+#define RIDE_LOG_CHANNEL_FIELD(name, field, divisor) { offsetof(rt_vars_t, field), sizeof(((rt_vars_t *) 0)->field) },
+  RIDE_LOG_CHANNEL_LIST(RIDE_LOG_CHANNEL_FIELD)
+};
+
+// one is filled by rt_processing() while the other one waits for the main loop to store it
+static uint32_t ui32_m_blocks[2][RIDE_LOG_BLOCK_WORDS];
+static volatile bool m_full[2];
+static uint8_t ui8_m_filling;
+static uint32_t ui32_m_last[RIDE_LOG_CHANNELS_NUM]; // the values of the previous sample of the block
+static uint32_t ui32_m_seq;
+static uint8_t ui8_m_flags;
+static uint8_t ui8_m_ticks;
+static volatile bool m_stopped;
+
+uint32_t ui32_g_ride_log_samples_dropped;
+
+static uint16_t block_crc(const uint32_t *p_block)
+{
+  const uint8_t *p_bytes = (const uint8_t *) p_block;
+  static const uint8_t ui8_zero[sizeof(uint16_t)];
+  uint16_t ui16_crc;
+
+  ui16_crc = crc16_update(0xffff, p_bytes, offsetof(ride_log_header_t, ui16_crc));
+  ui16_crc = crc16_update(ui16_crc, ui8_zero, sizeof(ui8_zero));
+  return crc16_update(ui16_crc, p_bytes + offsetof(ride_log_header_t, ui32_seq),
+      RIDE_LOG_BLOCK_BYTES - offsetof(ride_log_header_t, ui32_seq));
+}
+
+static uint8_t* put_varint(uint8_t *p_dest, uint32_t ui32_value)
+{
+  while (ui32_value >= 0x80) {
+    *p_dest++ = (uint8_t) ui32_value | 0x80;
+    ui32_value >>= 7;
+  }
+  *p_dest++ = (uint8_t) ui32_value;
+
+  return p_dest;
+}
+
+static bool get_varint(const uint8_t **pp_src, const uint8_t *p_end, uint32_t *p_value)
+{
+  uint32_t ui32_value = 0;
+
+  for (int shift = 0; shift < 35; shift += 7) {
+    if (*pp_src >= p_end)
+      return false;
+
+    uint8_t ui8_byte = *(*pp_src)++;
+    ui32_value |= (uint32_t) (ui8_byte & 0x7f) << shift;
+    if (!(ui8_byte & 0x80)) {
+      *p_value = ui32_value;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+static uint32_t channel_value(const rt_vars_t *p_rt_vars, uint8_t ui8_channel)
+{
+  const uint8_t *p_field = (const uint8_t *) p_rt_vars + m_channels[ui8_channel].ui16_offset;
+
+  switch (m_channels[ui8_channel].ui8_size) {
+    case 1:
+      return *p_field;
+    case 2:
+      return *(const uint16_t *) p_field;
+    default:
+      return *(const uint32_t *) p_field;
+  }
+}
+
+static void block_begin(ride_log_header_t *p_header)
+{
+  memset(p_header, 0xff, RIDE_LOG_BLOCK_BYTES); // the unused tail stays erased in flash
+  memset(p_header, 0, sizeof(*p_header));
+  p_header->ui16_magic = RIDE_LOG_BLOCK_MAGIC;
+  p_header->ui32_seq = ui32_m_seq++;
+  p_header->ui32_time_s = ui32_seconds_since_startup;
+  p_header->ui16_interval_ms = RIDE_LOG_INTERVAL_MS;
+  p_header->ui16_channels = RIDE_LOG_CHANNELS_MASK;
+  p_header->ui8_flags = ui8_m_flags;
+  ui8_m_flags = 0;
+
+  memset(ui32_m_last, 0, sizeof(ui32_m_last));
+}
+
+static void block_seal(void)
+{
+  ride_log_header_t *p_header = (ride_log_header_t *) ui32_m_blocks[ui8_m_filling];
+
+  p_header->ui16_crc = block_crc(ui32_m_blocks[ui8_m_filling]);
+  m_full[ui8_m_filling] = true;
+  ui8_m_filling ^= 1;
+
+  event_post(EVENT_RIDE_LOG);
+}
+
+void ride_log_init(void)
+{
+  for (int i = 0; i < 2; i++) {
+    m_full[i] = false;
+    ((ride_log_header_t *) ui32_m_blocks[i])->ui16_samples = 0;
+  }
+  ui8_m_filling = 0;
+  ui8_m_ticks = 0;
+  m_stopped = false;
+
+  ui32_m_seq = ride_log_store_init();
+  ui8_m_flags = RIDE_LOG_FLAG_BOOT;
+}
+
+// Note: this called from ISR context every 100ms
+void ride_log_sample(const rt_vars_t *p_rt_vars)
+{
+  ride_log_header_t *p_header = (ride_log_header_t *) ui32_m_blocks[ui8_m_filling];
+
+  if (m_stopped || ++ui8_m_ticks < RIDE_LOG_INTERVAL_MS / REALTIME_INTERVAL_MS)
+    return;
+  ui8_m_ticks = 0;
+
+  if (!m_full[ui8_m_filling] && p_header->ui16_samples
+      && p_header->ui16_bytes + RIDE_LOG_SAMPLE_MAX_BYTES > RIDE_LOG_PAYLOAD_BYTES) {
+    block_seal();
+    p_header = (ride_log_header_t *) ui32_m_blocks[ui8_m_filling];
+  }
+
+  if (m_full[ui8_m_filling]) {
+    ui32_g_ride_log_samples_dropped++; // flash is still busy with both blocks
+    return;
+  }
+
+  if (!p_header->ui16_samples)
+    block_begin(p_header);
+
+  uint8_t *p_samples = (uint8_t *) ui32_m_blocks[ui8_m_filling] + sizeof(ride_log_header_t);
+  uint8_t *p_dest = p_samples + p_header->ui16_bytes;
+  uint32_t ui32_values[RIDE_LOG_CHANNELS_NUM];
+  uint32_t ui32_changed = 0;
+
+  for (uint8_t i = 0; i < RIDE_LOG_CHANNELS_NUM; i++) {
+    ui32_values[i] = channel_value(p_rt_vars, i);
+    if (((RIDE_LOG_CHANNELS_MASK >> i) & 1) && ui32_values[i] != ui32_m_last[i])
+      ui32_changed |= 1UL << i;
+  }
+
+  p_dest = put_varint(p_dest, ui32_changed);
+  for (uint8_t i = 0; i < RIDE_LOG_CHANNELS_NUM; i++) {
+    if (!((ui32_changed >> i) & 1))
+      continue;
+
+    int32_t i32_delta = (int32_t) (ui32_values[i] - ui32_m_last[i]);
+    p_dest = put_varint(p_dest, ((uint32_t) i32_delta << 1) ^ (uint32_t) (i32_delta >> 31)); // zigzag
+    ui32_m_last[i] = ui32_values[i];
+  }
+
+  p_header->ui16_bytes = p_dest - p_samples;
+  p_header->ui16_samples++;
+}
+
+void ride_log_flush(void)
+{
+  int8_t i8_block = -1;
+
+  // the older one first
+  for (int i = 0; i < 2; i++) {
+    if (m_full[i] && (i8_block < 0 || ((ride_log_header_t *) ui32_m_blocks[i])->ui32_seq
+        < ((ride_log_header_t *) ui32_m_blocks[i8_block])->ui32_seq))
+      i8_block = i;
+  }
+
+  if (i8_block < 0)
+    return;
+
+  if (ride_log_store_write(ui32_m_blocks[i8_block])) {
+    // rt_processing() may fill it as soon as it is not full, it must find it empty then
+    ((ride_log_header_t *) ui32_m_blocks[i8_block])->ui16_samples = 0;
+    compiler_barrier();
+    m_full[i8_block] = false;
+
+    if (!m_full[i8_block ^ 1])
+      return;
+  }
+
+  event_post(EVENT_RIDE_LOG); // more to do
+}
+
+void ride_log_idle(void)
+{
+  if (!m_stopped)
+    ride_log_store_prepare();
+}
+
+void ride_log_power_off(void)
+{
+  m_stopped = true; // rt_processing() might still run
+
+  if (!m_full[ui8_m_filling] && ((ride_log_header_t *) ui32_m_blocks[ui8_m_filling])->ui16_samples)
+    block_seal();
+
+  while (m_full[0] || m_full[1])
+    ride_log_flush();
+}
+
+bool ride_log_block_valid(const uint32_t *p_block)
+{
+  const ride_log_header_t *p_header = (const ride_log_header_t *) p_block;
+
+  return p_header->ui16_magic == RIDE_LOG_BLOCK_MAGIC && p_header->ui16_bytes <= RIDE_LOG_PAYLOAD_BYTES
+      && p_header->ui16_crc == block_crc(p_block);
+}
+
+bool ride_log_decode(const uint32_t *p_block, ride_log_sample_cb_t cb, void *p_context)
+{
+  const ride_log_header_t *p_header = (const ride_log_header_t *) p_block;
+  const uint8_t *p_src = (const uint8_t *) p_block + sizeof(ride_log_header_t);
+  const uint8_t *p_end = p_src + p_header->ui16_bytes;
+  uint32_t ui32_values[RIDE_LOG_CHANNELS_NUM] = { 0 };
+
+  if (!ride_log_block_valid(p_block))
+    return false;
+
+  for (uint16_t ui16_sample = 0; ui16_sample < p_header->ui16_samples; ui16_sample++) {
+    uint32_t ui32_changed, ui32_zigzag;
+
+    if (!get_varint(&p_src, p_end, &ui32_changed))
+      return false;
+
+    for (uint8_t i = 0; i < RIDE_LOG_CHANNELS_NUM; i++) {
+      if (!((ui32_changed >> i) & 1))
+        continue;
+
+      if (!get_varint(&p_src, p_end, &ui32_zigzag))
+        return false;
+      ui32_values[i] += (ui32_zigzag >> 1) ^ -(ui32_zigzag & 1);
+    }
+
+    cb(p_context, p_header, ui16_sample, ui32_values);
+  }
+
+  return true;
+}
@@ -0,0 +1,143 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * Ride log blocks in a ring of RIDE_LOG_PAGES pages of flash, RIDE_LOG_PAGE_SLOTS blocks per page, where the
+ * oldest page is erased when the ring wraps.
+ *
+ * A block is programmed a few words per ride_log_store_write() call, the samples first and the header last, so a
+ * block cut by a power loss has no valid header (magic and CRC) and is skipped. The next page is erased ahead of
+ * time by ride_log_store_prepare() from the idle main loop, so the flushes only program. If it didn't run yet the
+ * erase is a ride_log_store_write() call of its own.
+ * At boot the slot after the block with the highest sequence number is the next one, slots that are not erased
+ * (a cut block) are skipped.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "ride_log.h"
+
+#define RIDE_LOG_ERASED          0xffffffff
+#define RIDE_LOG_PAGE_SLOTS      (RIDE_LOG_PAGE_WORDS / RIDE_LOG_BLOCK_WORDS)
+#define RIDE_LOG_SLOTS           (RIDE_LOG_PAGES * RIDE_LOG_PAGE_SLOTS)
+#define RIDE_LOG_PROGRAM_WORDS   16 // per call, about 2ms on the 850C
+
+#define slot_block(slot)         (ride_log_hw_page((slot) / RIDE_LOG_PAGE_SLOTS) \
+                                  + ((slot) % RIDE_LOG_PAGE_SLOTS) * RIDE_LOG_BLOCK_WORDS)
+
+static uint16_t ui16_m_slot; // the next block goes here
+static uint16_t ui16_m_programmed; // words of it, the header is the last ones
+static bool m_erased; // the page of ui16_m_slot was erased, or it is not at the start of a page
+
+static bool slot_is_erased(uint16_t ui16_slot)
+{
+  const uint32_t *p_block = slot_block(ui16_slot);
+
+  for (uint16_t i = 0; i < RIDE_LOG_BLOCK_WORDS; i++)
+    if (p_block[i] != RIDE_LOG_ERASED)
+      return false;
+
+  return true;
+}
+
+static void slot_next(void)
+{
+  ui16_m_slot = (ui16_m_slot + 1) % RIDE_LOG_SLOTS;
+  ui16_m_programmed = 0;
+  m_erased = ui16_m_slot % RIDE_LOG_PAGE_SLOTS != 0;
+}
+
+uint32_t ride_log_store_init(void)
+{
+  uint32_t ui32_seq = 0;
+  bool found = false;
+
+  ui16_m_slot = RIDE_LOG_SLOTS - 1; // so the first one is slot 0
+  for (uint16_t ui16_slot = 0; ui16_slot < RIDE_LOG_SLOTS; ui16_slot++) {
+    const uint32_t *p_block = slot_block(ui16_slot);
+    const ride_log_header_t *p_header = (const ride_log_header_t *) p_block;
+
+    if (p_block[0] == RIDE_LOG_ERASED || !ride_log_block_valid(p_block))
+      continue;
+
+    if (!found || p_header->ui32_seq >= ui32_seq) {
+      ui32_seq = p_header->ui32_seq + 1;
+      ui16_m_slot = ui16_slot;
+      found = true;
+    }
+  }
+
+  slot_next();
+  return ui32_seq;
+}
+
+bool ride_log_store_write(const uint32_t *p_block)
+{
+  uint16_t ui16_page = ui16_m_slot / RIDE_LOG_PAGE_SLOTS;
+  uint16_t ui16_offset = (ui16_m_slot % RIDE_LOG_PAGE_SLOTS) * RIDE_LOG_BLOCK_WORDS;
+
+  if (!m_erased) {
+    ride_log_store_prepare();
+    return false;
+  }
+
+  if (ui16_m_programmed == 0) {
+    // a block that was cut short, the page is erased when the ring gets back to it
+    if (!slot_is_erased(ui16_m_slot)) {
+      slot_next();
+      return false;
+    }
+
+    ui16_m_programmed = RIDE_LOG_HEADER_WORDS;
+  }
+
+  if (ui16_m_programmed < RIDE_LOG_BLOCK_WORDS) {
+    uint16_t ui16_num = RIDE_LOG_BLOCK_WORDS - ui16_m_programmed;
+
+    if (ui16_num > RIDE_LOG_PROGRAM_WORDS)
+      ui16_num = RIDE_LOG_PROGRAM_WORDS;
+
+    if (!ride_log_hw_program(ui16_page, ui16_offset + ui16_m_programmed, p_block + ui16_m_programmed, ui16_num)) {
+      slot_next(); // bad flash, try the block again in the next slot
+      return false;
+    }
+
+    ui16_m_programmed += ui16_num;
+    return false;
+  }
+
+  // the header makes the block valid
+  bool ok = ride_log_hw_program(ui16_page, ui16_offset, p_block, RIDE_LOG_HEADER_WORDS);
+  slot_next();
+
+  return ok;
+}
+
+void ride_log_store_prepare(void)
+{
+  if (!m_erased) {
+    ride_log_hw_erase(ui16_m_slot / RIDE_LOG_PAGE_SLOTS);
+    m_erased = true;
+  }
+}
+
+const uint32_t* ride_log_store_next(ride_log_iter_t *p_iter)
+{
+  // the oldest blocks are in the page after the one being written, or in that one if it is still to be erased
+  uint16_t ui16_first = ((ui16_m_slot / RIDE_LOG_PAGE_SLOTS + (m_erased ? 1 : 0)) % RIDE_LOG_PAGES)
+      * RIDE_LOG_PAGE_SLOTS;
+
+  while (p_iter->ui32_a < RIDE_LOG_SLOTS) {
+    uint16_t ui16_slot = (ui16_first + p_iter->ui32_a++) % RIDE_LOG_SLOTS;
+    const uint32_t *p_block = slot_block(ui16_slot);
+
+    if (p_block[0] != RIDE_LOG_ERASED && ride_log_block_valid(p_block))
+      return p_block;
+  }
+
+  return NULL;
+}
@@ -33,14 +33,16 @@
 #include "state.h"
 #include "mainscreen.h"
 #include "utils.h"
+#include "profile.h"
+#include "timer.h"
 
 uint8_t g_customizableFieldIndex;
-volatile bool g_graphs_ui_update[3] = { false, false, false };
+volatile bool g_graphs_ui_update[GRAPH_LEVELS];
 
 variables_t g_vars[VARS_SIZE];
 #ifndef SW102
 GraphVars g_graphVars[VARS_SIZE];
-GraphData g_graphData[VARS_SIZE][3];
+GraphData g_graphData[VARS_SIZE];
 #endif
 
 extern UG_GUI gui;
@@ -70,8 +72,6 @@ static const FieldRenderFn renderers[];
 static bool blinkChanged;
 static bool blinkOn;
 
-static uint32_t screenUpdateCounter;
-
 /**
  * Used to map from FieldVariant enums to rendering functions
  */
@@ -81,6 +81,11 @@ static bool screenDirty;
 
 bool graphNeedUpdate = false;
 
+uint32_t ui32_g_lcd_pixels_written;
+uint32_t ui32_g_screen_frame_pixels;
+uint32_t ui32_g_editables_formatted;
+uint32_t ui32_g_editables_skipped;
+
 #ifdef SW102
 #define HEADING_FONT FONT_5X12
 #else
@@ -210,7 +215,7 @@ static void drawSelectionMarkerForced(FieldLayout *layout) {
     UG_FontSelect(&FONT_CURSORS);
     UG_PutChar('0', layout->x + layout->width - FONT_CURSORS.char_width, // draw on ride side of line
         layout->y + (layout->height - FONT_CURSORS.char_height) / 2, // draw centered vertially within the box
-        layout->field->rw->is_selected && blinkOn ? EDITABLE_CURSOR_COLOR : getBackColor(ColorNormal),
+        layout->field->rw->is_selected && blinkOn ? EDITABLE_CURSOR_COLOR : getBackColor(layout),
             C_TRANSPARENT);
   }
 }
@@ -304,8 +309,18 @@ static bool needsRender(Field *field) {
 		if (field && field->rw->is_selected)
 			return true; // we also do a blink animation for our selection cursor
 	}
-	if (field->variant == FieldEditable)
-		return true; // Editables are smart enough to do their own rendering shortcuts based on cached values
+	if (field->variant == FieldEditable) {
+		// Editables are smart enough to do their own rendering shortcuts based on cached values, but when they
+		// show a ui_vars member from the realtime layer we know if it changed without even calling them
+		if (!field->rw->watch)
+			field->rw->watch = ui_vars_watch_index(field->editable.target) + 2;
+
+		if (field->rw->watch == 1 || field == curActiveEditable || forceLabels != oldForceLabels
+				|| (blinkChanged && g_curCustomizingField))
+			return true;
+
+		return (ui64_g_ui_vars_changed >> (field->rw->watch - 2)) & 1;
+	}
 
 	return false;
 }
@@ -316,10 +331,15 @@ static bool needsRender(Field *field) {
  *
  */
 static bool renderField(FieldLayout *layout, Field *field) {
-	return renderers[field->variant](layout);
+	uint32_t ui32_profile_start = profile_begin();
+	bool didDraw = renderers[field->variant](layout);
+
+	profile_end(PROFILE_RENDER_FIELD + field->variant, ui32_profile_start);
+	return didDraw;
 }
 
 const bool renderLayouts(FieldLayout *layouts, bool forceRender) {
+	uint32_t ui32_profile_start = profile_begin();
 	bool didDraw = false; // we only render to hardware if something changed
 
 	Coord maxy = 0;
@@ -350,17 +370,19 @@ const bool renderLayouts(FieldLayout *layouts, bool forceRender) {
 
 			// if user specified width in terms of characters, change it to pixels
 			if (layout->width < 0) {
-			  if (field->variant != FieldCustom)
-			    assert(layout->font); // you must specify a font to use this feature
-				layout->width = -layout->width
-						* (layout->font->char_width + gui.char_h_space);
+				if (field->variant != FieldCustom)
+					assert(layout->font); // you must specify a font to use this feature
+				if (layout->font) // custom renderers without a font (battery) set their own width
+					layout->width = -layout->width
+							* (layout->font->char_width + gui.char_h_space);
 			}
 
 			// a y <0 means, start just below the previous lowest point on the screen, -1 is immediately below, -2 has one blank line, -3 etc...
 			if (layout->y < 0)
 				layout->y = maxy + -layout->y - 1;
 
-			didDraw |= renderField(layout, field);
+			bool fieldDidDraw = renderField(layout, field);
+			didDraw |= fieldDidDraw;
 
 //			assert(layout->height != -1); // by the time we reach here this must be set
 
@@ -369,7 +391,8 @@ const bool renderLayouts(FieldLayout *layouts, bool forceRender) {
 				maxy = layout->y + layout->height;
 
 			drawSelectionMarker(layout);
-			drawBorder(layout);
+			if (fieldDidDraw) // if the renderer didn't touch the box our border is still there
+				drawBorder(layout);
 		}
 	}
 
@@ -381,6 +404,7 @@ const bool renderLayouts(FieldLayout *layouts, bool forceRender) {
 	if (didChangeForceLabels)
 		oldForceLabels = forceLabels;
 
+	profile_end(PROFILE_RENDER_LAYOUTS, ui32_profile_start);
 	return didDraw;
 }
 
@@ -837,9 +861,57 @@ static void getEditableString(Field *field, int32_t num, char *outbuf) {
 	}
 }
 
+/// The part of num getEditableString() shows, so values that only differ in a hidden fraction are the same
+static int32_t getShownNumber(Field *field, int32_t num) {
+	if (field->editable.typ == EditUInt && field->editable.number.hide_fraction) {
+		int divd = field->editable.number.div_digits;
+		while (divd--)
+			num /= 10;
+	}
+
+	return num;
+}
+
 // Sometimes we want to know where we just draw a string, so I have this FIXME ugly hack here
 static int renderedStrX, renderedStrY;
 
+// If !NULL the string that is on the screen where the next one is put, its glyphs at the same x are not drawn again
+static const char *sameStr;
+
+static int glyphAdvance(const UG_FONT *font, char chr) {
+	if (chr < font->start_char || chr > font->end_char)
+		return 0; // UG_PutString() skips it
+
+	return (font->widths ? font->widths[chr - font->start_char] : font->char_width) + gui.char_h_space;
+}
+
+// UG_PutString_with_length() of the runs of glyphs that differ from sameStr
+static void putStringChanged(int x, int y, const UG_FONT *font, const char *str, int maxchars) {
+	const char *same = sameStr;
+	int xsame = x;
+	int start = -1, xstart = x; // the run not drawn yet
+	int i;
+
+	for (i = 0; i < maxchars && str[i]; i++) {
+		bool changed = !same || str[i] != *same || x != xsame;
+
+		if (changed && start < 0) {
+			start = i;
+			xstart = x;
+		} else if (!changed && start >= 0) {
+			UG_PutString_with_length(xstart, y, (char*) str + start, i - start);
+			start = -1;
+		}
+
+		x += glyphAdvance(font, str[i]);
+		if (same && *same)
+			xsame += glyphAdvance(font, *same++);
+	}
+
+	if (start >= 0)
+		UG_PutString_with_length(xstart, y, (char*) str + start, i - start);
+}
+
 // Center justify a string on a line of specified width
 static void putStringCentered(int x, int y, int width, const UG_FONT *font,
 		const char *str) {
@@ -858,7 +930,7 @@ static void putStringCentered(int x, int y, int width, const UG_FONT *font,
 		x += (width - strwidth) / 2; // if we have extra space put half of it before the string
 
 	UG_FontSelect(font);
-	UG_PutString_with_length(x, y, (char*) str, maxchars);
+	putStringChanged(x, y, font, str, maxchars);
 	renderedStrX = x;
 	renderedStrY = y;
 }
@@ -870,14 +942,14 @@ static void putStringRight(int x, int y, const UG_FONT *font, const char *str) {
 	x -= strwidth;
 
 	UG_FontSelect(font);
-	UG_PutString(x, y, (char*) str);
+	putStringChanged(x, y, font, str, strlen(str));
 	renderedStrX = x;
 	renderedStrY = y;
 }
 
 static void putStringLeft(int x, int y, const UG_FONT *font, const char *str) {
 	UG_FontSelect(font);
-	UG_PutString(x, y, (char*) str);
+	putStringChanged(x, y, font, str, strlen(str));
 	renderedStrX = x;
 	renderedStrY = y;
 }
@@ -1114,25 +1186,31 @@ static bool renderEditable(FieldLayout *layout) {
 					curEditableValueConverted : getEditableNumber(field, true);
 
 	// If we are customizing this value, we don't check for changes of the value because that causes glitches in the display with extra
-	// redraws
-	bool valueChanged = num != layout->old_editable && !isCustomizing;
-	char valuestr[MAX_FIELD_LEN];
+	// redraws. The value is already converted to the current units, so a units change is a value change.
+	bool valueChanged = getShownNumber(field, num) != getShownNumber(field, layout->old_editable) && !isCustomizing;
+	char valuestr[MAX_FIELD_LEN], oldstr[MAX_FIELD_LEN];
+	int32_t old_num = 0;
 
 	// Do we need to handle a blink transition right now?
 	bool needBlink = blinkChanged
 			&& (isActive || field->rw->is_selected || isCustomizing);
 
-	// If the value numerically changed, see if it also changed as a string (much more expensive)
-	bool showValue = !forceLabels && (valueChanged || dirty || needBlink); // default to not drawing the value
-	if (showValue) {
-		char oldvaluestr[MAX_FIELD_LEN];
-		getEditableString(field, layout->old_editable, oldvaluestr);
+	bool forceLabelsChanged = forceLabels != oldForceLabels;
 
+	// Only format the value if it changed as shown, that is a vsnprintf we can skip most ticks. When the labels stop
+	// being forced the box was blanked, so the value must come back even if it didn't change.
+	bool showValue = !forceLabels && (valueChanged || dirty || needBlink || forceLabelsChanged); // default to not drawing the value
+	if (showValue) {
+		old_num = layout->old_editable;
 		layout->old_editable = num;
 
 		getEditableString(field, num, valuestr);
-		if (strlen(valuestr) != strlen(oldvaluestr))
+		ui32_g_editables_formatted++;
+
+		uint8_t len = strlen(valuestr);
+		if (len != layout->old_editable_len)
 			dirty = true; // Force a complete redraw (because alignment of str in field might have changed and we don't want to leave turds on the screen
+		layout->old_editable_len = len;
 	}
 
 	bool thresholds_color = field->rw->editable.number.auto_thresholds != FIELD_THRESHOLD_DISABLED;
@@ -1151,10 +1229,10 @@ static bool renderEditable(FieldLayout *layout) {
   }
 
 	// If not dirty, labels didn't change and we aren't animating then exit
-	bool forceLabelsChanged = forceLabels != oldForceLabels;
-
-	if (!dirty && !valueChanged && !forceLabelsChanged && !needBlink)
+	if (!dirty && !valueChanged && !forceLabelsChanged && !needBlink) {
+		ui32_g_editables_skipped++;
 		return false; // We didn't actually change so don't try to draw anything
+	}
 
 	// fill our entire box with blankspace (if we must)
 	bool blankAll = EDITABLE_BLANKALL || forceLabelsChanged || dirty
@@ -1228,7 +1306,15 @@ static bool renderEditable(FieldLayout *layout) {
 		}
 
 	  UG_SetForecolor(color);
+
+		// Only the value changed, at the same length and color: the glyphs it has in common with the old one are on
+		// the screen already (the 850C, the SW102 blanks all and its driver only sends the columns that changed)
+		if (!blankAll && valueChanged && !needBlink) {
+			getEditableString(field, old_num, oldstr);
+			sameStr = oldstr;
+		}
 		putAligned(layout, layout->align_x, align_y, x, y, font, valuestr);
+		sameStr = NULL;
 
 		// Blinking underline cursor when editing, just below value and drawing to the right edge of the box
 		if (isActive) {
@@ -1273,6 +1359,46 @@ static int graphX, // upper left of graph
 		graphYmax, // y loc of max value
 		graphLabelY; // y loc of the label for field name
 
+// What we last drew in each column of the graph, so a new sample only costs the pixels that actually changed
+typedef struct {
+	int16_t y_line; // rows above graphYmin drawn in color
+	int16_t y_contour; // rows above y_line drawn in GRAPH_COLOR_ACCENT, -1 for none
+	UG_COLOR color;
+} GraphColumn;
+
+static GraphColumn graphColumns[GRAPH_MAX_POINTS];
+static GraphData *graphColumnsData; // the data graphColumns shows, NULL if the screen no longer matches graphColumns
+static uint8_t graphColumnsLevel; // and its level
+
+static int32_t graphMaxVal, graphMinVal; // the max/min the graph is scaled to
+
+// Scale to the points of the level shown
+static void graphScale(Field *field) {
+  GraphVars *vars = field->graph.graph_vars;
+  int32_t max, min;
+
+  graph_data_max_min(field->rw->graph.data, field->rw->graph.x_axis_scale, &max, &min);
+
+  if (vars->auto_max_min == GRAPH_AUTO_MAX_MIN_YES) {
+    graphMaxVal = max;
+    graphMinVal = min;
+  } else {
+    // see if real max and mins are over predefined values and if so, override
+    graphMaxVal = max > vars->max ? max : vars->max;
+    graphMinVal = min < vars->min ? min : vars->min;
+  }
+}
+
+// A level got a new point since the graph was drawn
+static bool graphsUiUpdate(void) {
+  for (int i = 0; i < GRAPH_LEVELS; i++) {
+    if (g_graphs_ui_update[i])
+      return true;
+  }
+
+  return false;
+}
+
 // Clear our box completely if needed
 static void graphClear(Field *field) {
 	UG_SetForecolor(GRAPH_COLOR_ACCENT);
@@ -1282,6 +1408,7 @@ static void graphClear(Field *field) {
 		// clear all
 		UG_FillFrame(graphX, graphY, graphX + graphWidth - 1,
 				graphY + graphHeight, GRAPH_COLOR_BACKGROUND);
+		graphColumnsData = NULL;
 	}
 }
 
@@ -1342,16 +1469,17 @@ static void graphLabelAxisCustomize(Field *field) {
   static int32_t min_val_pre = INT32_MIN;
   bool draw_y_label_max = true;
   bool draw_y_label_min = true;
-  uint8_t x_axis_scale;
-  x_axis_scale = field->rw->graph.x_axis_scale;
   Field *source = field->graph.source;
-  GraphData *graph = field->rw->graph.data[x_axis_scale];
+  GraphData *graph = field->rw->graph.data;
   if(!graph) // no data yet
     return;
 
+  // of the x axis scale, that may have just changed
+  graphScale(field);
+
   // the graph would be an horizontal line at bottom, so, put Y axis labels specific if value is 0 or higher
-  if (graph->min_val == graph->max_val) {
-    if (graph->min_val > 0)
+  if (graphMinVal == graphMaxVal) {
+    if (graphMinVal > 0)
       draw_y_label_min = false;
     else
       draw_y_label_max = false;
@@ -1360,28 +1488,28 @@ static void graphLabelAxisCustomize(Field *field) {
   char valstr[MAX_FIELD_LEN];
 
   // draw if value changed or dirty
-  if((graph->max_val != max_val_pre ||
+  if((graphMaxVal != max_val_pre ||
       blinkChanged ||
       g_changeXAxisTrigger) &&
       draw_y_label_max) {
-    max_val_pre = graph->max_val;
+    max_val_pre = graphMaxVal;
 
-    if (graph->max_val != INT32_MIN) {
-      getEditableString(source, graph->max_val, valstr);
+    if (graphMaxVal != INT32_MIN) {
+      getEditableString(source, graphMaxVal, valstr);
       putStringRight((GRAPH_MAXVAL_FONT.char_width * 4) + 4,
                      graphYmax, &GRAPH_MAXVAL_FONT, valstr);
     }
   }
 
   // draw if value changed or dirty
-  if((graph->min_val != min_val_pre ||
+  if((graphMinVal != min_val_pre ||
       blinkChanged ||
       g_changeXAxisTrigger) &&
       draw_y_label_min) {
-    min_val_pre = graph->min_val;
+    min_val_pre = graphMinVal;
 
-    if (graph->min_val != INT32_MAX) {
-      getEditableString(source, graph->min_val, valstr);
+    if (graphMinVal != INT32_MAX) {
+      getEditableString(source, graphMinVal, valstr);
       putStringRight((GRAPH_MAXVAL_FONT.char_width * 4) + 4,
                      graphYmin - GRAPH_MAXVAL_FONT.char_height,
           &GRAPH_MAXVAL_FONT, valstr);
@@ -1399,20 +1527,22 @@ static void graphLabelAxis(Field *field) {
 	// Only need to draw labels and axis if dirty
 	Field *source = field->graph.source;
 	if (field->rw->dirty ||
-	    g_graphs_ui_update[0] == true ||
-      g_graphs_ui_update[1] == true ||
-      g_graphs_ui_update[2] == true) {
+	    graphsUiUpdate()) {
 		UG_SetForecolor(LABEL_COLOR);
 		putStringCentered(graphX, graphLabelY, graphWidth, &GRAPH_LABEL_FONT,
 				source->editable.label);
 		UG_SetForecolor(LABEL_COLOR);
 
-		// vertical axis line
-    UG_DrawLine(graphXmin, graphYmin, graphXmin, graphYmax,
-    GRAPH_COLOR_AXIS);
+		// the axis lines only need drawing after a clear, nothing else draws over them and the points keep the
+		// horizontal one up to date (see graphColumnEmpty)
+		if (field->rw->dirty) {
+			// vertical axis line
+			UG_DrawLine(graphXmin, graphYmin, graphXmin, graphYmax,
+			GRAPH_COLOR_AXIS);
 
-		// horiz axis line
-    UG_DrawLine(graphXmin, graphYmin, graphXmin + GRAPH_MAX_POINTS, graphYmin, C_DIM_GRAY);
+			// horiz axis line
+			UG_DrawLine(graphXmin, graphYmin, graphXmin + GRAPH_MAX_POINTS, graphYmin, C_DIM_GRAY);
+		}
 
 		// x axis scale
     uint8_t x_axis_scale;
@@ -1435,13 +1565,13 @@ static void graphLabelAxis(Field *field) {
     }
 
     // draw max value
-    GraphData *graph = field->rw->graph.data[x_axis_scale];
+    GraphData *graph = field->rw->graph.data;
     if(!graph) // no data yet
       return;
 
     // the graph would be an horizontal line at bottom, so, put Y axis labels specific if value is 0 or higher
-    if (graph->min_val == graph->max_val) {
-      if (graph->min_val > 0)
+    if (graphMinVal == graphMaxVal) {
+      if (graphMinVal > 0)
         draw_y_label_min = false;
       else
         draw_y_label_max = false;
@@ -1450,26 +1580,26 @@ static void graphLabelAxis(Field *field) {
     char valstr[MAX_FIELD_LEN];
 
     // draw if value changed or dirty
-    if((graph->max_val != max_val_pre ||
+    if((graphMaxVal != max_val_pre ||
         field->rw->dirty) &&
         draw_y_label_max) {
-      max_val_pre = graph->max_val;
+      max_val_pre = graphMaxVal;
 
-      if (graph->max_val != INT32_MIN) {
-        getEditableString(source, graph->max_val, valstr);
+      if (graphMaxVal != INT32_MIN) {
+        getEditableString(source, graphMaxVal, valstr);
         putStringRight((GRAPH_MAXVAL_FONT.char_width * 4) + 4,
                        graphYmax, &GRAPH_MAXVAL_FONT, valstr);
       }
     }
 
     // draw if value changed or dirty
-    if((graph->min_val != min_val_pre ||
+    if((graphMinVal != min_val_pre ||
         field->rw->dirty) &&
         draw_y_label_min) {
-      min_val_pre = graph->min_val;
+      min_val_pre = graphMinVal;
 
-      if (graph->min_val != INT32_MAX) {
-        getEditableString(source, graph->min_val, valstr);
+      if (graphMinVal != INT32_MAX) {
+        getEditableString(source, graphMinVal, valstr);
         putStringRight((GRAPH_MAXVAL_FONT.char_width * 4) + 4,
                        graphYmin - GRAPH_MAXVAL_FONT.char_height,
             &GRAPH_MAXVAL_FONT, valstr);
@@ -1479,7 +1609,7 @@ static void graphLabelAxis(Field *field) {
 }
 
 // Linear  interpolated between the min/max values to generate a y coordinate for plotting a particular value x
-static inline int32_t graphScaleY(GraphData *graph, int32_t x) {
+static inline int32_t graphScaleY(int32_t x) {
 //	if (graph->max_val == graph->min_val) // Until there is a span everything is at wmin
 //		return graphYmin;
 //
@@ -1488,35 +1618,94 @@ static inline int32_t graphScaleY(GraphData *graph, int32_t x) {
 //			+ graphYmax * (x - graph->min_val))
 //			/ (graph->max_val - graph->min_val);
 
+	// Until there is a span everything is at the bottom, which is what the division by 0 of map() gives on the
+	// Cortex-M3, the host traps on it
+	if (graphMaxVal == graphMinVal)
+		return 0;
+
 	return map(x,
-	    graph->min_val,
-	    graph->max_val,
+	    graphMinVal,
+	    graphMaxVal,
 	    0,
 	    graphYmin - graphYmax);
 }
 
+// A column without a sample only shows the horizontal axis
+static const GraphColumn graphColumnEmpty = { 1, -1, C_DIM_GRAY };
+
+static UG_COLOR graphColumnColorAt(const GraphColumn *col, int row) {
+	if (row < col->y_line)
+		return col->color;
+	if (row <= col->y_line + col->y_contour)
+		return GRAPH_COLOR_ACCENT;
+	return GRAPH_COLOR_BACKGROUND;
+}
+
+/**
+ * Draw column i of the points area, only the rows that differ from what graphColumns says is on screen.
+ *
+ * Both the old and the new column are at most three runs of color, so the color can only change at their
+ * boundaries.  When the graph shifts left by one sample each column usually only moves its top by a few rows.
+ */
+static void graphDrawColumn(int i, const GraphColumn *col) {
+	GraphColumn *old = &graphColumns[i];
+	if (old->y_line == col->y_line && old->y_contour == col->y_contour
+			&& old->color == col->color)
+		return;
+
+	int top = graphYmin - graphYmax;
+	int cuts[6] = { 0, old->y_line, old->y_line + old->y_contour + 1, col->y_line,
+			col->y_line + col->y_contour + 1, top + 1 };
+
+	// insertion sort, it is only 6 entries
+	for (int j = 1; j < 6; j++) {
+		int cut = cuts[j], k = j;
+		for (; k > 0 && cuts[k - 1] > cut; k--)
+			cuts[k] = cuts[k - 1];
+		cuts[k] = cut;
+	}
+
+	int x = graphXmin + 1 + i;
+	for (int j = 0; j < 5; j++) {
+		int from = cuts[j] < 0 ? 0 : cuts[j];
+		int to = (cuts[j + 1] > top + 1 ? top + 1 : cuts[j + 1]) - 1;
+
+		if (from > to)
+			continue;
+
+		UG_COLOR c = graphColumnColorAt(col, from);
+		if (c != graphColumnColorAt(old, from))
+			UG_DrawLine(x, graphYmin - from, x, graphYmin - to, c);
+	}
+
+	*old = *col;
+}
+
 static void graphDrawPoints(Field *field) {
-  static bool end_valid_overflow = 0;
   uint8_t x_axis_scale = field->rw->graph.x_axis_scale;
-	GraphData *graph = field->rw->graph.data[x_axis_scale];
+	GraphData *graph = field->rw->graph.data;
   Field *source = field->graph.source;
 	if(!graph)
 		return; // no data yet
 
-	int ptr = graph->start_valid;
-	if (ptr == graph->end_valid)
-		return; // ring buffer is empty
-
-	uint32_t end_valid = graph->end_valid;
-	if (end_valid == 0)
-	  end_valid_overflow = true;
+	uint16_t points = graph_data_points(graph, x_axis_scale);
+	if (points == 0)
+		return; // level is empty
 
-	if (end_valid_overflow)
-	  end_valid = GRAPH_MAX_POINTS;
+  // if we don't know what is on screen, erase the full points draw area (including the horizontal axis, the columns
+  // draw that) and redraw all columns, otherwise only the rows that changed get drawn
+  if (graphColumnsData != graph || graphColumnsLevel != x_axis_scale) {
+    UG_FillFrame(graphXmin + 1, graphYmin, graphXmin + GRAPH_MAX_POINTS,
+                 graphYmax, GRAPH_COLOR_BACKGROUND);
 
-  // first, erase the full points draw area
-  UG_FillFrame(graphXmin + 1, graphYmin - 1, graphXmin + GRAPH_MAX_POINTS,
-               graphYmax, GRAPH_COLOR_BACKGROUND);
+    for (int i = 0; i < GRAPH_MAX_POINTS; i++) {
+      graphColumns[i].y_line = 0;
+      graphColumns[i].y_contour = -1;
+      graphColumns[i].color = GRAPH_COLOR_BACKGROUND;
+    }
+    graphColumnsData = graph;
+    graphColumnsLevel = x_axis_scale;
+  }
 
 	int x = graphXmin; // the vertical axis line
 
@@ -1542,20 +1731,21 @@ static void graphDrawPoints(Field *field) {
 	int threshold_delta = (error_threshold - warn_threshold) / 2;
 
 	static int y_previous;
-	do {
+	for (uint16_t ptr = 0; ptr < points; ptr++) {
 		x++; // drawing a new vertical line now
-		int val = graph->points[ptr];
-		int y = graphScaleY(graph, val);
+		int val = graph_data_point(graph, x_axis_scale, ptr);
+		int y = graphScaleY(val);
 
     // the graph would be an horizontal line at bottom, but so force line to be max value
-    if (graph->min_val == graph->max_val &&
-        graph->min_val > 0 &&
-        (graph->end_valid > 2)) // ignore very first value as graph->min_val == graph->max_val would always be true
+    if (graphMinVal == graphMaxVal &&
+        graphMinVal > 0 &&
+        (points > 2)) // ignore very first value as graphMinVal == graphMaxVal would always be true
       y = graphYmin - graphYmax;
 
 		int y_contour;
 		int y_line;
 		int y_temp;
+		UG_COLOR color = GRAPH_COLOR_NORMAL;
 
     // force first line to not be full white
     if(x == (graphXmin + 1)) {
@@ -1576,10 +1766,9 @@ static void graphDrawPoints(Field *field) {
     if (threshold_inverted == false) {
       // blue zone
       if (val < (warn_threshold - threshold_delta) ||
-          graph->min_val == graph->max_val ||
+          graphMinVal == graphMaxVal ||
           threshold_invalid != 0) {
-        UG_DrawLine(x, graphYmin, x, graphYmin - y_line, GRAPH_COLOR_NORMAL);
-        UG_DrawLine(x, graphYmin - y_line, x, graphYmin - y_line - y_contour, GRAPH_COLOR_ACCENT);
+        color = GRAPH_COLOR_NORMAL;
       // transition zone from blue to yellow
       } else if (val >= (warn_threshold - threshold_delta) &&
           val < (warn_threshold)) {
@@ -1596,22 +1785,19 @@ static void graphDrawPoints(Field *field) {
                         0x1f, // min output value
                         0); // max output value: 5 bits for blue color
 
-        int color = color_blue |
+        color = color_blue |
             (color_yellow << 5) | // 6 green bits
             ((color_yellow / 2) << 11); // 5 red bits
 
-        UG_DrawLine(x, graphYmin, x, graphYmin - y_line, color);
-        UG_DrawLine(x, graphYmin - y_line, x, graphYmin - y_line - y_contour, GRAPH_COLOR_ACCENT);
       // yellow zone
       } else if (val >= (warn_threshold) &&
                  val < (error_threshold - threshold_delta)) {
-        UG_DrawLine(x, graphYmin, x, graphYmin - y_line, GRAPH_COLOR_WARN);
-        UG_DrawLine(x, graphYmin - y_line, x, graphYmin - y_line - y_contour, GRAPH_COLOR_ACCENT);
+        color = GRAPH_COLOR_WARN;
       // transition zone from yellow to red
       } else if (val >= (error_threshold - threshold_delta) &&
                 val < (error_threshold)) {
         // calculate color, linear transition from blue to yellow (RGB565)
-        int color = map(val, // our actual input
+        color = map(val, // our actual input
                        error_threshold - threshold_delta, // start at 0
                        error_threshold, // max transition value
                        0x3f, // min output value: 6 bits for green color
@@ -1620,24 +1806,20 @@ static void graphDrawPoints(Field *field) {
         color = (color << 5) | // 6 green bits
            (0x1f << 11); // 5 red bits all enable
 
-        UG_DrawLine(x, graphYmin, x, graphYmin - y_line, color);
-        UG_DrawLine(x, graphYmin - y_line, x, graphYmin - y_line - y_contour, GRAPH_COLOR_ACCENT);
         // red zone
       } else if (val >= (error_threshold)) {
-        UG_DrawLine(x, graphYmin, x, graphYmin - y_line, GRAPH_COLOR_ERROR);
-        UG_DrawLine(x, graphYmin - y_line, x, graphYmin - y_line - y_contour, GRAPH_COLOR_ACCENT);
+        color = GRAPH_COLOR_ERROR;
       }
     } else {
       // red zone
       if (val <= (warn_threshold)) {
-        UG_DrawLine(x, graphYmin, x, graphYmin - y_line, GRAPH_COLOR_ERROR);
-        UG_DrawLine(x, graphYmin - y_line, x, graphYmin - y_line - y_contour, GRAPH_COLOR_ACCENT);
+        color = GRAPH_COLOR_ERROR;
 
       // transition zone from red to yellow
       } else if (val > warn_threshold &&
                val <= (warn_threshold + threshold_delta)) {
       // calculate color, linear transition from blue to yellow (RGB565)
-      int color = map(val, // our actual input
+      color = map(val, // our actual input
                      warn_threshold,
                      warn_threshold + threshold_delta,
                      0,
@@ -1646,14 +1828,10 @@ static void graphDrawPoints(Field *field) {
       color = (color << 5) | // 6 green bits
          (0x1f << 11); // 5 red bits all enable
 
-      UG_DrawLine(x, graphYmin, x, graphYmin - y_line, color);
-      UG_DrawLine(x, graphYmin - y_line, x, graphYmin - y_line - y_contour, GRAPH_COLOR_ACCENT);
-
       // yellow zone
       } else if (val > (warn_threshold + threshold_delta) &&
                  val <= error_threshold) {
-        UG_DrawLine(x, graphYmin, x, graphYmin - y_line, GRAPH_COLOR_WARN);
-        UG_DrawLine(x, graphYmin - y_line, x, graphYmin - y_line - y_contour, GRAPH_COLOR_ACCENT);
+        color = GRAPH_COLOR_WARN;
 
       // transition zone from yellow to blue
       } else if (val > error_threshold &&
@@ -1671,24 +1849,25 @@ static void graphDrawPoints(Field *field) {
                         0, // min output value
                         0x1f); // max output value: 5 bits for blue color
 
-        int color = color_blue |
+        color = color_blue |
             (color_yellow << 5) | // 6 green bits
             ((color_yellow / 2) << 11); // 5 red bits
 
-        UG_DrawLine(x, graphYmin, x, graphYmin - y_line, color);
-        UG_DrawLine(x, graphYmin - y_line, x, graphYmin - y_line - y_contour, GRAPH_COLOR_ACCENT);
-
         // blue zone
       } else if (val > (error_threshold + threshold_delta) ||
-            graph->min_val == graph->max_val ||
+            graphMinVal == graphMaxVal ||
             threshold_invalid != 0) {
-        UG_DrawLine(x, graphYmin, x, graphYmin - y_line, GRAPH_COLOR_NORMAL);
-        UG_DrawLine(x, graphYmin - y_line, x, graphYmin - y_line - y_contour, GRAPH_COLOR_ACCENT);
+        color = GRAPH_COLOR_NORMAL;
       }
     }
 
-    ptr = (ptr + 1) % GRAPH_MAX_POINTS; // increment and wrap
-	} while (ptr != graph->end_valid); // we just did the last entry?
+    GraphColumn col = { y_line, y_contour, color };
+    graphDrawColumn(x - graphXmin - 1, &col);
+	}
+
+	// columns that no longer have a sample go back to just the axis
+	for (int i = x - graphXmin; i < GRAPH_MAX_POINTS; i++)
+		graphDrawColumn(i, &graphColumnEmpty);
 }
 
 /**
@@ -1708,10 +1887,7 @@ static bool renderGraph(FieldLayout *layout) {
 		field->rw->dirty = true; // Force a complete redraw if blink changed
 
   // If we are not dirty and we don't need an update, just return
-	if ((!(g_graphs_ui_update[0] == true ||
-	    g_graphs_ui_update[1] == true ||
-	    g_graphs_ui_update[2] == true)) &&
-	        !field->rw->dirty)
+	if (!graphsUiUpdate() && !field->rw->dirty)
 		return false;
 
 	Field *source = field->graph.source;
@@ -1741,13 +1917,15 @@ static bool renderGraph(FieldLayout *layout) {
 	if(needBlink && !blinkOn)
 		return true; // If we are supposed to be blinking return before we actually draw the graph contents
 
+	if (field->rw->graph.data)
+		graphScale(field);
+
 	graphLabelAxis(field);
 	graphDrawPoints(field);
 
 	g_changeXAxisTrigger = false;
-  g_graphs_ui_update[0] = false;
-  g_graphs_ui_update[1] = false;
-  g_graphs_ui_update[2] = false;
+	for (int i = 0; i < GRAPH_LEVELS; i++)
+		g_graphs_ui_update[i] = false;
 
 	return true;
 }
@@ -2143,21 +2321,22 @@ Screen* getCurrentScreen() {
 }
 
 void screenUpdate() {
+	uint32_t ui32_profile_start;
+
 	if (!curScreen)
 		return;
 
+	ui32_profile_start = profile_begin();
 	if (curScreen->onPreUpdate)
 		(*curScreen->onPreUpdate)();
 
 	bool didDraw = false; // we only render to hardware if something changed
+	uint32_t ui32_pixels_written = ui32_g_lcd_pixels_written;
 
-	// Every 300ms toggle any blinking animations
-	screenUpdateCounter++;
-	blinkChanged = (screenUpdateCounter
-			% (BLINK_INTERVAL_MS / UPDATE_INTERVAL_MS) == 0);
-	if (blinkChanged) {
-		blinkOn = !blinkOn;
-	}
+	// Every 300ms toggle any blinking animations, by time because a button press updates the screen in between
+	bool blink = (get_time_base_counter_1ms() / BLINK_INTERVAL_MS) & 1;
+	blinkChanged = blink != blinkOn;
+	blinkOn = blink;
 
 	if (screenDirty) {
 		// clear screen (to prevent turds from old screen staying around)
@@ -2170,6 +2349,7 @@ void screenUpdate() {
 
 // For each field if that field is dirty (or the screen is) redraw it
 	didDraw |= renderLayouts(curScreen->fields, screenDirty);
+	ui64_g_ui_vars_changed = 0; // every editable showing them was drawn
 
 	if (didDraw) {
 		if (curScreen->onPostUpdate)
@@ -2177,14 +2357,17 @@ void screenUpdate() {
 	}
 
 #ifdef SW102
-// flush the screen to the hardware
+// flush the screen to the hardware, the driver only sends what changed since the last flush
   if (didDraw)
   {
     lcd_refresh();
   }
 #endif
 
+	ui32_g_screen_frame_pixels = ui32_g_lcd_pixels_written - ui32_pixels_written;
 	screenDirty = false;
+
+	profile_end(PROFILE_SCREEN_UPDATE, ui32_profile_start);
 }
 
 void fieldPrintf(Field *field, const char *fmt, ...) {
@@ -2202,7 +2385,7 @@ void fieldPrintf(Field *field, const char *fmt, ...) {
 	va_end(argp);
 }
 
-void updateGraphData(uint8_t index, uint16_t sumDivisor) {
+void updateGraphData(uint16_t sumDivisor) {
   int32_t filtered;
 
   // for now, reference the graphs global to find all possible data sources
@@ -2210,7 +2393,7 @@ void updateGraphData(uint8_t index, uint16_t sumDivisor) {
 
   for (int i = 0; activeGraphs->customizable.choices[i]; i++) {
     Field *f = activeGraphs->customizable.choices[i];
-    GraphData *graphData = f->rw->graph.data[index];
+    GraphData *graphData = f->rw->graph.data;
     assert(graphData); // better be !NULL by now or we screwed up
 
     // filter
@@ -2226,74 +2409,33 @@ void updateGraphData(uint8_t index, uint16_t sumDivisor) {
     }
     graphData->sum = 0;
 
-    // Now add the point to the graph point array
-    // add the point
-    graphData->points[graphData->end_valid] = filtered;
-    graphData->end_valid = (graphData->end_valid + 1) % GRAPH_MAX_POINTS; // inc ptr with wrap
-
-    // discard old point if needed and find new max/mins
-    bool overfull = graphData->start_valid == graphData->end_valid;
-    if (overfull) {
-      if (graphData->points[graphData->start_valid] == graphData->max_val_bck) {
-        // TODO: find new max
-      } else if (graphData->points[graphData->start_valid] == graphData->min_val_bck) {
-        // TODO: find new min
-      }
+    // Now add the point to level 0, the levels above get theirs from it
+    graph_data_push(graphData, filtered);
 
-      graphData->start_valid = (graphData->start_valid + 1) % GRAPH_MAX_POINTS;
+    // store reference x axis scale, the levels that are full
+    if (graph_data_points(graphData, GRAPH_X_AXIS_SCALE_15M) == GRAPH_MAX_POINTS)
+      g_xAxisReferenceScale |= 1;
 
-      // store reference x axis scale
-      switch (index) {
-        case GRAPH_X_AXIS_SCALE_15M:
-          g_xAxisReferenceScale |= 1;
-          break;
+    if (graph_data_points(graphData, GRAPH_X_AXIS_SCALE_1H) == GRAPH_MAX_POINTS)
+      g_xAxisReferenceScale |= 2;
 
-        case GRAPH_X_AXIS_SCALE_1H:
-          g_xAxisReferenceScale |= 2;
-          break;
-      }
-
-      // increase X axis scale when graph is full
-      if (f->rw->graph.x_axis_scale_config == GRAPH_X_AXIS_SCALE_AUTO) {
-        // use reference scale for the auto mode
-        // bits of g_xAxisReferenceScale are set dependind on reference the scale
-        if (g_xAxisReferenceScale & 2) {
-          if (f->rw->graph.x_axis_scale != GRAPH_X_AXIS_SCALE_4H) {
-            f->rw->graph.x_axis_scale = GRAPH_X_AXIS_SCALE_4H;
-            g_changeXAxisTrigger = true;
-          }
+    // increase X axis scale when graph is full
+    if (f->rw->graph.x_axis_scale_config == GRAPH_X_AXIS_SCALE_AUTO) {
+      // use reference scale for the auto mode
+      // bits of g_xAxisReferenceScale are set dependind on reference the scale
+      if (g_xAxisReferenceScale & 2) {
+        if (f->rw->graph.x_axis_scale != GRAPH_X_AXIS_SCALE_4H) {
+          f->rw->graph.x_axis_scale = GRAPH_X_AXIS_SCALE_4H;
+          g_changeXAxisTrigger = true;
         }
-        else if (g_xAxisReferenceScale & 1) {
-          if (f->rw->graph.x_axis_scale != GRAPH_X_AXIS_SCALE_1H) {
-            f->rw->graph.x_axis_scale = GRAPH_X_AXIS_SCALE_1H;
-            g_changeXAxisTrigger = true;
-          }
+      }
+      else if (g_xAxisReferenceScale & 1) {
+        if (f->rw->graph.x_axis_scale != GRAPH_X_AXIS_SCALE_1H) {
+          f->rw->graph.x_axis_scale = GRAPH_X_AXIS_SCALE_1H;
+          g_changeXAxisTrigger = true;
         }
       }
     }
-
-    // update invariants
-    if (filtered > graphData->max_val_bck)
-      graphData->max_val_bck = filtered;
-
-    if (filtered < graphData->min_val_bck && filtered >= f->graph.min_threshold)
-      graphData->min_val_bck = filtered;
-
-    if (f->graph.graph_vars->auto_max_min == GRAPH_AUTO_MAX_MIN_YES) {
-      graphData->max_val = graphData->max_val_bck;
-      graphData->min_val = graphData->min_val_bck;
-    } else {
-      // see if real max and mins are over predefined values and if so, override
-      if (graphData->max_val_bck > graphData->max)
-        graphData->max_val = graphData->max_val_bck;
-      else
-        graphData->max_val = graphData->max;
-
-      if (graphData->min_val_bck < graphData->min)
-        graphData->min_val = graphData->min_val_bck;
-      else
-        graphData->min_val = graphData->min;
-    }
   }
 }
 
@@ -2301,7 +2443,8 @@ void rt_graph_process(void) {
 #ifndef SW102
   static int numGraphs = 0;
   static uint32_t counter_1 = 0;
-  static uint16_t counter_2[3] = {0, 0 , 0};
+  static uint16_t counter_2 = 0;
+  static uint32_t points = 0;
 
   // for now, reference the graphs global to find all possible data sources
   extern Field *activeGraphs;
@@ -2310,9 +2453,7 @@ void rt_graph_process(void) {
   if (activeGraphs) {
     // track the number of data process cycles
     counter_1++;
-    counter_2[0]++;
-    counter_2[1]++;
-    counter_2[2]++;
+    counter_2++;
 
     // keep summing every 100ms
     for (int i = 0; activeGraphs->customizable.choices[i]; i++) {
@@ -2320,52 +2461,33 @@ void rt_graph_process(void) {
     	assert(f->variant == FieldGraph);
 
     	// Select a data pool from our cache
-    	if(!f->rw->graph.data[0]) {
+    	if(!f->rw->graph.data) {
         assert(numGraphs < VARS_SIZE);
-        f->rw->graph.data[0] = &g_graphData[numGraphs][0];
-        f->rw->graph.data[1] = &g_graphData[numGraphs][1];
-        f->rw->graph.data[2] = &g_graphData[numGraphs][2];
+        f->rw->graph.data = &g_graphData[numGraphs];
+        graph_data_init(f->rw->graph.data, &f->graph.store, f->graph.min_threshold);
         numGraphs++;
     	}
 
     	Field *fieldGraphEditable = f->graph.source; // get the backing data source for this graph
 
     	int32_t target = getEditableNumber(fieldGraphEditable, true);
-    	f->rw->graph.data[0]->sum += target;
-    	f->rw->graph.data[1]->sum += target;
-    	f->rw->graph.data[2]->sum += target;
+    	f->rw->graph.data->sum += target;
     }
 
-    // @casainho if you define something like NUM_TIMESCALES 3 (see my comment in screen.h), you don't need to do this copypasta and can instead just have one bit of code
-    // inside of a loop.  Which also has the nice property of letting you at compile time change the number of possible timescales and everything will just work.
-
-    // now calculate the filtered value for each new point and add to graph data array
-    uint32_t update_graph_data;
-    update_graph_data = (counter_1 % (GRAPH_DATA_0_INTERVAL_MS / REALTIME_INTERVAL_MS) == 0);
-    if (update_graph_data) {
-      updateGraphData(0, counter_2[0]);
-      counter_2[0] = 0;
-
-      // signal that UI can now update the graph and so access his data (should have plenty of time to access the data)
-      g_graphs_ui_update[0] = true;
-    }
-
-    update_graph_data = (counter_1 % (GRAPH_DATA_1_INTERVAL_MS / REALTIME_INTERVAL_MS) == 0);
-    if (update_graph_data) {
-      updateGraphData(1, counter_2[1]);
-      counter_2[1] = 0;
-
-      // signal that UI can now update the graph and so access his data (should have plenty of time to access the data)
-      g_graphs_ui_update[1] = true;
-    }
-
-    update_graph_data = (counter_1 % (GRAPH_DATA_2_INTERVAL_MS / REALTIME_INTERVAL_MS) == 0);
-    if (update_graph_data) {
-      updateGraphData(2, counter_2[2]);
-      counter_2[2] = 0;
-
-      // signal that UI can now update the graph and so access his data (should have plenty of time to access the data)
-      g_graphs_ui_update[2] = true;
+    // now calculate the filtered value for the new point and add to graph data
+    if (counter_1 % (GRAPH_DATA_INTERVAL_MS / REALTIME_INTERVAL_MS) == 0) {
+      updateGraphData(counter_2);
+      counter_2 = 0;
+
+      // signal that UI can now update the graph and so access his data (should have plenty of time to access the data),
+      // for each level that got a new point
+      points++;
+      uint32_t interval = 1;
+      for (int i = 0; i < GRAPH_LEVELS; i++) {
+        interval *= ui8_g_graph_level_factor[i];
+        if (points % interval == 0)
+          g_graphs_ui_update[i] = true;
+      }
     }
   }
 #endif
@@ -2374,14 +2496,8 @@ void rt_graph_process(void) {
 void graph_init(void) {
 #ifndef SW102
   // Init graphs to empty
-  for (int i = 0; i < VARS_SIZE; i++) {
-    for (int j = 0; j < 3; j++) {
-      g_graphData[i][j].max_val = INT32_MIN;
-      g_graphData[i][j].min_val = INT32_MAX;
-      g_graphData[i][j].start_valid = 0;
-      g_graphData[i][j].end_valid = 0;
-    }
-  }
+  for (int i = 0; i < VARS_SIZE; i++)
+    graph_data_init(&g_graphData[i], NULL, 0); // the points of its field when a graph takes it
 #endif
 }
 
@@ -20,7 +20,13 @@
 #include "fault.h"
 #include "state.h"
 #include "adc.h"
+#include "seqlock.h"
+#include "profile.h"
+#include "events.h"
+#include "ride_log.h"
 #include <stdlib.h>
+#include <stddef.h>
+#include <string.h>
 
 static uint8_t ui8_m_usart1_received_first_package = 0;
 uint8_t ui8_g_battery_soc;
@@ -36,6 +42,11 @@ tsdz2_firmware_version_t g_tsdz2_firmware_version = { 0xff, 0, 0 };
 // kevinh: I don't think volatile is probably needed here
 rt_vars_t rt_vars;
 
+// Copy of rt_vars taken at the end of each rt_processing(), the UI reads it through m_rt_vars_snapshot_seq
+// so it never has to stop the realtime layer
+static rt_vars_t rt_vars_snapshot;
+static seqlock_t m_rt_vars_snapshot_seq;
+
 ui_vars_t ui_vars;
 
 ui_vars_t* get_ui_vars(void) {
@@ -258,10 +269,7 @@ void rt_send_tx_package(uint8_t type) {
 	}
 
 	// prepare crc of the package
-	uint16_t ui16_crc_tx = 0xffff;
-	for (uint8_t ui8_i = 0; ui8_i < crc_len; ui8_i++) {
-		crc16(ui8_usart1_tx_buffer[ui8_i], &ui16_crc_tx);
-	}
+	uint16_t ui16_crc_tx = crc16_update(0xffff, ui8_usart1_tx_buffer, crc_len);
 	ui8_usart1_tx_buffer[crc_len] =
 			(uint8_t) (ui16_crc_tx & 0xff);
 	ui8_usart1_tx_buffer[crc_len + 1] =
@@ -508,49 +516,150 @@ void rt_processing_start(void) {
 #endif
 }
 
+/**
+ * Called from rt_processing() every 100ms, publish the results for copy_rt_to_ui_vars()
+ */
+static void rt_vars_publish_snapshot(void) {
+	seqlock_write_begin(&m_rt_vars_snapshot_seq);
+	rt_vars_snapshot = rt_vars;
+	seqlock_write_end(&m_rt_vars_snapshot_seq);
+}
+
+/**
+ * The ui_vars members copy_rt_to_ui_vars() writes. A Field showing one of them only needs to render when the
+ * member was written with a new value, see ui64_g_ui_vars_changed.
+ */
+#define UI_VAR_WATCH(m) { offsetof(ui_vars_t, m), sizeof(ui_vars.m) }
+
+// no more than 64, a bit each in ui64_g_ui_vars_changed
+static const struct {
+  uint16_t ui16_offset;
+  uint8_t ui8_size;
+} m_ui_vars_watch[] = {
+  UI_VAR_WATCH(ui16_adc_battery_voltage),
+  UI_VAR_WATCH(ui8_battery_current_x5),
+  UI_VAR_WATCH(ui16_battery_power_loss),
+  UI_VAR_WATCH(ui8_motor_current_x5),
+  UI_VAR_WATCH(ui8_throttle),
+  UI_VAR_WATCH(ui16_adc_pedal_torque_sensor),
+  UI_VAR_WATCH(ui8_pedal_weight_with_offset),
+  UI_VAR_WATCH(ui8_pedal_weight),
+  UI_VAR_WATCH(ui8_duty_cycle),
+  UI_VAR_WATCH(ui8_error_states),
+  UI_VAR_WATCH(ui16_wheel_speed_x10),
+  UI_VAR_WATCH(ui8_pedal_cadence),
+  UI_VAR_WATCH(ui8_pedal_cadence_filtered),
+  UI_VAR_WATCH(ui16_motor_speed_erps),
+  UI_VAR_WATCH(ui8_motor_hall_sensors),
+  UI_VAR_WATCH(ui8_pas_pedal_right),
+  UI_VAR_WATCH(ui8_motor_temperature),
+  UI_VAR_WATCH(ui32_wheel_speed_sensor_tick_counter),
+  UI_VAR_WATCH(ui16_battery_voltage_filtered_x10),
+  UI_VAR_WATCH(ui16_battery_current_filtered_x5),
+  UI_VAR_WATCH(ui16_motor_current_filtered_x5),
+  UI_VAR_WATCH(ui16_full_battery_power_filtered_x50),
+  UI_VAR_WATCH(ui16_battery_power),
+  UI_VAR_WATCH(ui16_pedal_power),
+  UI_VAR_WATCH(ui16_battery_voltage_soc_x10),
+  UI_VAR_WATCH(ui32_wh_sum_x5),
+  UI_VAR_WATCH(ui32_wh_sum_counter),
+  UI_VAR_WATCH(ui32_wh_x10),
+  UI_VAR_WATCH(ui8_braking),
+  UI_VAR_WATCH(ui8_foc_angle),
+  UI_VAR_WATCH(ui32_trip_x10),
+  UI_VAR_WATCH(ui32_odometer_x10),
+};
+
+#define UI_VARS_WATCHED (sizeof(m_ui_vars_watch) / sizeof(m_ui_vars_watch[0]))
+
+// the watched members at the last copy_rt_to_ui_vars(), packed
+static uint8_t ui8_m_ui_vars_watch_old[UI_VARS_WATCHED * 4];
+
+uint64_t ui64_g_ui_vars_changed;
+
+int8_t ui_vars_watch_index(const void *p_member) {
+	for (uint8_t i = 0; i < UI_VARS_WATCHED; i++) {
+		if ((const uint8_t*) p_member == (const uint8_t*) &ui_vars + m_ui_vars_watch[i].ui16_offset)
+			return i;
+	}
+
+	return -1;
+}
+
+/// Set the bit of each watched member that changed since the last call
+static void ui_vars_watch_update(void) {
+	uint8_t *p_old = ui8_m_ui_vars_watch_old;
+
+	for (uint8_t i = 0; i < UI_VARS_WATCHED; i++) {
+		const uint8_t *p_new = (const uint8_t*) &ui_vars + m_ui_vars_watch[i].ui16_offset;
+
+		if (memcmp(p_new, p_old, m_ui_vars_watch[i].ui8_size) != 0) {
+			memcpy(p_old, p_new, m_ui_vars_watch[i].ui8_size);
+			ui64_g_ui_vars_changed |= 1ULL << i;
+		}
+
+		p_old += m_ui_vars_watch[i].ui8_size;
+	}
+}
+
 /**
  * Called from the main thread every 100ms
  *
  */
 void copy_rt_to_ui_vars(void) {
-	ui_vars.ui16_adc_battery_voltage = rt_vars.ui16_adc_battery_voltage;
-	ui_vars.ui8_battery_current_x5 = rt_vars.ui8_battery_current_x5;
-	ui_vars.ui16_battery_power_loss = rt_vars.ui16_battery_power_loss;
-	ui_vars.ui8_motor_current_x5 = rt_vars.ui8_motor_current_x5;
-	ui_vars.ui8_throttle = rt_vars.ui8_throttle;
-	ui_vars.ui16_adc_pedal_torque_sensor = rt_vars.ui16_adc_pedal_torque_sensor;
-	ui_vars.ui8_pedal_weight_with_offset = rt_vars.ui8_pedal_weight_with_offset;
-	ui_vars.ui8_pedal_weight = rt_vars.ui8_pedal_weight;
-	ui_vars.ui8_duty_cycle = rt_vars.ui8_duty_cycle;
-	ui_vars.ui8_error_states = rt_vars.ui8_error_states;
-	ui_vars.ui16_wheel_speed_x10 = rt_vars.ui16_wheel_speed_x10;
-	ui_vars.ui8_pedal_cadence = rt_vars.ui8_pedal_cadence;
-	ui_vars.ui8_pedal_cadence_filtered = rt_vars.ui8_pedal_cadence_filtered;
-	ui_vars.ui16_motor_speed_erps = rt_vars.ui16_motor_speed_erps;
-	ui_vars.ui8_motor_hall_sensors = rt_vars.ui8_motor_hall_sensors;
-	ui_vars.ui8_pas_pedal_right = rt_vars.ui8_pas_pedal_right;
-	ui_vars.ui8_motor_temperature = rt_vars.ui8_motor_temperature;
-	ui_vars.ui32_wheel_speed_sensor_tick_counter =
-			rt_vars.ui32_wheel_speed_sensor_tick_counter;
-	ui_vars.ui16_battery_voltage_filtered_x10 =
-			rt_vars.ui16_battery_voltage_filtered_x10;
-	ui_vars.ui16_battery_current_filtered_x5 =
-			rt_vars.ui16_battery_current_filtered_x5;
-  ui_vars.ui16_motor_current_filtered_x5 =
-      rt_vars.ui16_motor_current_filtered_x5;
-	ui_vars.ui16_full_battery_power_filtered_x50 =
-			rt_vars.ui16_full_battery_power_filtered_x50;
-	ui_vars.ui16_battery_power = rt_vars.ui16_battery_power_filtered;
-	ui_vars.ui16_pedal_power = rt_vars.ui16_pedal_power_filtered;
-	ui_vars.ui16_battery_voltage_soc_x10 = rt_vars.ui16_battery_voltage_soc_x10;
-	ui_vars.ui32_wh_sum_x5 = rt_vars.ui32_wh_sum_x5;
-	ui_vars.ui32_wh_sum_counter = rt_vars.ui32_wh_sum_counter;
-	ui_vars.ui32_wh_x10 = rt_vars.ui32_wh_x10;
-	ui_vars.ui8_braking = rt_vars.ui8_braking;
-	ui_vars.ui8_foc_angle = (((uint16_t) rt_vars.ui8_foc_angle) * 14) / 10; // each units is equal to 1.4 degrees ((360 degrees / 256) = 1.4)
-	ui_vars.ui32_trip_x10 = rt_vars.ui32_trip_x10;
-	ui_vars.ui32_odometer_x10 = rt_vars.ui32_odometer_x10;
-
+	uint32_t ui32_seq;
+	const rt_vars_t *p_rt;
+
+	// if the realtime layer published a new snapshot while we were copying, copy again
+	do {
+		ui32_seq = seqlock_read_begin(&m_rt_vars_snapshot_seq);
+
+		// until the first rt_processing() rt_vars only has what we loaded from the EEPROM
+		p_rt = ui32_seq ? &rt_vars_snapshot : &rt_vars;
+
+		ui_vars.ui16_adc_battery_voltage = p_rt->ui16_adc_battery_voltage;
+		ui_vars.ui8_battery_current_x5 = p_rt->ui8_battery_current_x5;
+		ui_vars.ui16_battery_power_loss = p_rt->ui16_battery_power_loss;
+		ui_vars.ui8_motor_current_x5 = p_rt->ui8_motor_current_x5;
+		ui_vars.ui8_throttle = p_rt->ui8_throttle;
+		ui_vars.ui16_adc_pedal_torque_sensor = p_rt->ui16_adc_pedal_torque_sensor;
+		ui_vars.ui8_pedal_weight_with_offset = p_rt->ui8_pedal_weight_with_offset;
+		ui_vars.ui8_pedal_weight = p_rt->ui8_pedal_weight;
+		ui_vars.ui8_duty_cycle = p_rt->ui8_duty_cycle;
+		ui_vars.ui8_error_states = p_rt->ui8_error_states;
+		ui_vars.ui16_wheel_speed_x10 = p_rt->ui16_wheel_speed_x10;
+		ui_vars.ui8_pedal_cadence = p_rt->ui8_pedal_cadence;
+		ui_vars.ui8_pedal_cadence_filtered = p_rt->ui8_pedal_cadence_filtered;
+		ui_vars.ui16_motor_speed_erps = p_rt->ui16_motor_speed_erps;
+		ui_vars.ui8_motor_hall_sensors = p_rt->ui8_motor_hall_sensors;
+		ui_vars.ui8_pas_pedal_right = p_rt->ui8_pas_pedal_right;
+		ui_vars.ui8_motor_temperature = p_rt->ui8_motor_temperature;
+		ui_vars.ui32_wheel_speed_sensor_tick_counter =
+				p_rt->ui32_wheel_speed_sensor_tick_counter;
+		ui_vars.ui16_battery_voltage_filtered_x10 =
+				p_rt->ui16_battery_voltage_filtered_x10;
+		ui_vars.ui16_battery_current_filtered_x5 =
+				p_rt->ui16_battery_current_filtered_x5;
+	  ui_vars.ui16_motor_current_filtered_x5 =
+	      p_rt->ui16_motor_current_filtered_x5;
+		ui_vars.ui16_full_battery_power_filtered_x50 =
+				p_rt->ui16_full_battery_power_filtered_x50;
+		ui_vars.ui16_battery_power = p_rt->ui16_battery_power_filtered;
+		ui_vars.ui16_pedal_power = p_rt->ui16_pedal_power_filtered;
+		ui_vars.ui16_battery_voltage_soc_x10 = p_rt->ui16_battery_voltage_soc_x10;
+		ui_vars.ui32_wh_sum_x5 = p_rt->ui32_wh_sum_x5;
+		ui_vars.ui32_wh_sum_counter = p_rt->ui32_wh_sum_counter;
+		ui_vars.ui32_wh_x10 = p_rt->ui32_wh_x10;
+		ui_vars.ui8_braking = p_rt->ui8_braking;
+		ui_vars.ui8_foc_angle = (((uint16_t) p_rt->ui8_foc_angle) * 14) / 10; // each units is equal to 1.4 degrees ((360 degrees / 256) = 1.4)
+		ui_vars.ui32_trip_x10 = p_rt->ui32_trip_x10;
+		ui_vars.ui32_odometer_x10 = p_rt->ui32_odometer_x10;
+	} while (seqlock_read_retry(&m_rt_vars_snapshot_seq, ui32_seq));
+
+	ui_vars_watch_update();
+
+	// the configurations are single aligned stores, each one is atomic for the realtime layer and they are
+	// taken into account on its next run
   rt_vars.ui32_wh_x10_100_percent = ui_vars.ui32_wh_x10_100_percent;
 	rt_vars.ui32_wh_x10_offset = ui_vars.ui32_wh_x10_offset;
 	rt_vars.ui16_battery_pack_resistance_x1000 = ui_vars.ui16_battery_pack_resistance_x1000;
@@ -653,66 +762,69 @@ void communications(void) {
       // now process rx data
       num_missed_packets = 0; // reset missed packet count
 
-      ui8_frame_type = p_rx_buffer[2];
-      switch (ui8_frame_type) {
-        case 0:
-          rt_vars.ui16_adc_battery_voltage = p_rx_buffer[3] | (((uint16_t) (p_rx_buffer[4] & 0x30)) << 4);
-          rt_vars.ui8_battery_current_x5 = p_rx_buffer[5];
-          rt_vars.ui16_wheel_speed_x10 = ((uint16_t) p_rx_buffer[6]) | (((uint16_t) p_rx_buffer[7] << 8));
-
-          // for some reason, the previous value of rt_vars.ui16_wheel_speed_x10 is 16384, because p_rx_buffer[7] is 64,
-          // this even when rx_buffer[6] and rx_buffer[7] are both 0 on the motor controller
-          rt_vars.ui16_wheel_speed_x10 = rt_vars.ui16_wheel_speed_x10 & 0x7ff; // 0x7ff = 204.7km/h
-
-          uint8_t ui8_temp = p_rx_buffer[8];
-          rt_vars.ui8_braking = ui8_temp & 1;
-          rt_vars.ui8_motor_hall_sensors = (ui8_temp >> 1) & 7;
-          rt_vars.ui8_pas_pedal_right = (ui8_temp >> 4) & 1;
-          rt_vars.ui8_adc_throttle = p_rx_buffer[9];
-
-          if (rt_vars.ui8_temperature_limit_feature_enabled) {
-            rt_vars.ui8_motor_temperature = p_rx_buffer[10];
-          } else {
-            rt_vars.ui8_throttle = p_rx_buffer[10];
-          }
-
-          rt_vars.ui16_adc_pedal_torque_sensor = ((uint16_t) p_rx_buffer[11]) | (((uint16_t) (p_rx_buffer[7] & 0xC0)) << 2);
-          rt_vars.ui8_pedal_weight_with_offset = p_rx_buffer[12];
-          rt_vars.ui8_pedal_weight = p_rx_buffer[13];
-
-          rt_vars.ui8_pedal_cadence = p_rx_buffer[14];
-          rt_vars.ui8_duty_cycle = p_rx_buffer[15];
-          rt_vars.ui16_motor_speed_erps = ((uint16_t) p_rx_buffer[16]) | ((uint16_t) p_rx_buffer[17] << 8);
-          rt_vars.ui8_foc_angle = p_rx_buffer[18];
-          rt_vars.ui8_error_states = p_rx_buffer[19];
-          rt_vars.ui8_motor_current_x5 = p_rx_buffer[20];
-
-          uint32_t ui32_wheel_speed_sensor_tick_temp;
-          ui32_wheel_speed_sensor_tick_temp = ((uint32_t) p_rx_buffer[21]) |
-              (((uint32_t) p_rx_buffer[22]) << 8) | (((uint32_t) p_rx_buffer[23]) << 16);
-          rt_vars.ui32_wheel_speed_sensor_tick_counter = ui32_wheel_speed_sensor_tick_temp;
-
-          rt_vars.ui16_pedal_power_x10 = ((uint16_t) p_rx_buffer[24]) | ((uint16_t) p_rx_buffer[25] << 8);
-
-          g_motor_init_state |= MOTOR_INIT_MOTOR_TX_OK;
-          periodic_answer_received = true;
-          break;
-
-        // confirmation that motor firmware received the configurations
-        case 1:
-          g_motor_init_state &= ~MOTOR_INIT_SET_CONFIGURATIONS;
-          g_motor_init_state |= MOTOR_INIT_READY;
-          break;
-
-        // firmware version
-        case 2:
-          g_tsdz2_firmware_version.major = p_rx_buffer[3];
-          g_tsdz2_firmware_version.minor = p_rx_buffer[4];
-          g_tsdz2_firmware_version.patch = p_rx_buffer[5];
-          g_motor_init_state &= ~MOTOR_INIT_GET_MOTOR_FIRMWARE_VERSION;
-          g_motor_init_state |= MOTOR_INIT_RECEIVED_MOTOR_FIRMWARE_VERSION;
-          break;
-      }
+      // the UART may have queued a few packages while we were busy, process all of them in order
+      do {
+        ui8_frame_type = p_rx_buffer[2];
+        switch (ui8_frame_type) {
+          case 0:
+            rt_vars.ui16_adc_battery_voltage = p_rx_buffer[3] | (((uint16_t) (p_rx_buffer[4] & 0x30)) << 4);
+            rt_vars.ui8_battery_current_x5 = p_rx_buffer[5];
+            rt_vars.ui16_wheel_speed_x10 = ((uint16_t) p_rx_buffer[6]) | (((uint16_t) p_rx_buffer[7] << 8));
+
+            // for some reason, the previous value of rt_vars.ui16_wheel_speed_x10 is 16384, because p_rx_buffer[7] is 64,
+            // this even when rx_buffer[6] and rx_buffer[7] are both 0 on the motor controller
+            rt_vars.ui16_wheel_speed_x10 = rt_vars.ui16_wheel_speed_x10 & 0x7ff; // 0x7ff = 204.7km/h
+
+            uint8_t ui8_temp = p_rx_buffer[8];
+            rt_vars.ui8_braking = ui8_temp & 1;
+            rt_vars.ui8_motor_hall_sensors = (ui8_temp >> 1) & 7;
+            rt_vars.ui8_pas_pedal_right = (ui8_temp >> 4) & 1;
+            rt_vars.ui8_adc_throttle = p_rx_buffer[9];
+
+            if (rt_vars.ui8_temperature_limit_feature_enabled) {
+              rt_vars.ui8_motor_temperature = p_rx_buffer[10];
+            } else {
+              rt_vars.ui8_throttle = p_rx_buffer[10];
+            }
+
+            rt_vars.ui16_adc_pedal_torque_sensor = ((uint16_t) p_rx_buffer[11]) | (((uint16_t) (p_rx_buffer[7] & 0xC0)) << 2);
+            rt_vars.ui8_pedal_weight_with_offset = p_rx_buffer[12];
+            rt_vars.ui8_pedal_weight = p_rx_buffer[13];
+
+            rt_vars.ui8_pedal_cadence = p_rx_buffer[14];
+            rt_vars.ui8_duty_cycle = p_rx_buffer[15];
+            rt_vars.ui16_motor_speed_erps = ((uint16_t) p_rx_buffer[16]) | ((uint16_t) p_rx_buffer[17] << 8);
+            rt_vars.ui8_foc_angle = p_rx_buffer[18];
+            rt_vars.ui8_error_states = p_rx_buffer[19];
+            rt_vars.ui8_motor_current_x5 = p_rx_buffer[20];
+
+            uint32_t ui32_wheel_speed_sensor_tick_temp;
+            ui32_wheel_speed_sensor_tick_temp = ((uint32_t) p_rx_buffer[21]) |
+                (((uint32_t) p_rx_buffer[22]) << 8) | (((uint32_t) p_rx_buffer[23]) << 16);
+            rt_vars.ui32_wheel_speed_sensor_tick_counter = ui32_wheel_speed_sensor_tick_temp;
+
+            rt_vars.ui16_pedal_power_x10 = ((uint16_t) p_rx_buffer[24]) | ((uint16_t) p_rx_buffer[25] << 8);
+
+            g_motor_init_state |= MOTOR_INIT_MOTOR_TX_OK;
+            periodic_answer_received = true;
+            break;
+
+          // confirmation that motor firmware received the configurations
+          case 1:
+            g_motor_init_state &= ~MOTOR_INIT_SET_CONFIGURATIONS;
+            g_motor_init_state |= MOTOR_INIT_READY;
+            break;
+
+          // firmware version
+          case 2:
+            g_tsdz2_firmware_version.major = p_rx_buffer[3];
+            g_tsdz2_firmware_version.minor = p_rx_buffer[4];
+            g_tsdz2_firmware_version.patch = p_rx_buffer[5];
+            g_motor_init_state &= ~MOTOR_INIT_GET_MOTOR_FIRMWARE_VERSION;
+            g_motor_init_state |= MOTOR_INIT_RECEIVED_MOTOR_FIRMWARE_VERSION;
+            break;
+        }
+      } while ((p_rx_buffer = uart_get_rx_buffer_rdy()) != NULL);
     }
 
     // let's wait for 10 packages, seems that first ADC battery voltages have incorrect values
@@ -745,7 +857,11 @@ void communications(void) {
 // Note: this called from ISR context every 100ms
 void rt_processing(void)
 {
+  uint32_t ui32_profile_start = profile_begin();
+
   communications();
+  profile_end(PROFILE_COMMUNICATIONS, ui32_profile_start);
+
   /************************************************************************************************/
   // now do all the calculations that must be done every 100ms
   rt_low_pass_filter_battery_voltage_current_power();
@@ -758,6 +874,13 @@ void rt_processing(void)
   /************************************************************************************************/
   rt_first_time_management();
   rt_calc_battery_soc();
+
+  rt_vars_publish_snapshot();
+  event_post(EVENT_RT_TICK); // the UI shows the new snapshot
+
+  ride_log_sample(&rt_vars);
+
+  profile_end(PROFILE_RT_PROCESSING, ui32_profile_start);
 }
 
 void prepare_torque_sensor_calibration_table(void) {
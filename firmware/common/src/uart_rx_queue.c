@@ -0,0 +1,202 @@
+/*
+ * Bafang LCD 850C firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+/*
+ * Single producer / single consumer queue of received motor frames.
+ *
+ * The consumer is communications() (TIM4 ISR on 850C, app_timer on SW102). The producer is the UART RX interrupt
+ * on SW102, which has a higher priority, and usart1_rx_dma_poll() on 850C, which runs right before the consumer.
+ * The producer only writes the head index and the consumer only writes the tail index, so no locking is needed. The frame returned by uart_rx_queue_pop() stays in the queue, and untouched by
+ * the producer, until the next call to uart_rx_queue_pop().
+ *
+ * uart_rx_queue_parse() frames the raw bytes from the motor and pushes the good frames, it accepts any chunk size
+ * so it can be fed one byte at a time from the RX interrupt (SW102) or in chunks from a DMA ring (850C). It is
+ * part of the producer, so it must always be called from the same context.
+ *
+ * uart_rx_dma_ring_parse() feeds it the bytes of a DMA ring, the same code for usart1.c and the sim.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "uart.h"
+#include "utils.h"
+#include "uart_rx_queue.h"
+
+#if (UART_RX_QUEUE_FRAMES < 2) || (UART_RX_QUEUE_FRAMES & (UART_RX_QUEUE_FRAMES - 1))
+#error "UART_RX_QUEUE_FRAMES must be a power of 2 and at least 2"
+#endif
+
+#define UART_RX_QUEUE_MASK (UART_RX_QUEUE_FRAMES - 1)
+
+// We are single core, the frame data only has to be written/read before the index that publishes/releases it
+#define compiler_barrier() __asm volatile ("" ::: "memory")
+
+static uint8_t ui8_m_frames[UART_RX_QUEUE_FRAMES][UART_NUMBER_DATA_BYTES_TO_RECEIVE];
+static volatile uint8_t ui8_m_head; // free running, only written by the producer
+static volatile uint8_t ui8_m_tail; // free running, only written by the consumer
+static bool m_frame_in_use; // the consumer is holding the frame at tail
+
+// frame being received by uart_rx_queue_parse()
+static uint8_t ui8_m_rx[UART_NUMBER_DATA_BYTES_TO_RECEIVE];
+static uint8_t ui8_m_rx_state;
+static uint8_t ui8_m_rx_cnt;
+
+uart_rx_queue_stats_t g_uart_rx_queue_stats;
+
+/**
+ * @brief Queue a frame that passed the CRC check, to be called from the UART RX interrupt only
+ */
+void uart_rx_queue_push(const uint8_t *p_frame)
+{
+  uint8_t ui8_head = ui8_m_head;
+  uint8_t ui8_queued = ui8_head - ui8_m_tail;
+  uint8_t ui8_len = p_frame[1] + 2;
+
+  if (ui8_len > UART_NUMBER_DATA_BYTES_TO_RECEIVE)
+    ui8_len = UART_NUMBER_DATA_BYTES_TO_RECEIVE;
+
+  g_uart_rx_queue_stats.ui32_received++;
+
+  if (ui8_queued >= UART_RX_QUEUE_FRAMES) {
+    g_uart_rx_queue_stats.ui32_lost++;
+
+#if UART_RX_QUEUE_LATEST_WINS
+    // the newest queued frame is never the one the consumer is holding, as there are at least 2 frames
+    memcpy(ui8_m_frames[(ui8_head - 1) & UART_RX_QUEUE_MASK], p_frame, ui8_len);
+#endif
+    return;
+  }
+
+  memcpy(ui8_m_frames[ui8_head & UART_RX_QUEUE_MASK], p_frame, ui8_len);
+  compiler_barrier();
+  ui8_m_head = ui8_head + 1;
+
+  if (ui8_queued + 1 > g_uart_rx_queue_stats.ui8_max_queued)
+    g_uart_rx_queue_stats.ui8_max_queued = ui8_queued + 1;
+}
+
+/**
+ * @brief Release the previously returned frame and return the oldest queued one, or NULL if the queue is empty
+ */
+const uint8_t* uart_rx_queue_pop(void)
+{
+  uint8_t ui8_tail = ui8_m_tail;
+
+  if (m_frame_in_use) {
+    m_frame_in_use = false;
+    compiler_barrier();
+    ui8_m_tail = ++ui8_tail;
+  }
+
+  if (ui8_m_head == ui8_tail)
+    return NULL;
+
+  compiler_barrier();
+  m_frame_in_use = true;
+  return ui8_m_frames[ui8_tail & UART_RX_QUEUE_MASK];
+}
+
+/**
+ * @brief Frame the bytes received from the motor: 0x43, length, data, CRC16 low and high byte
+ */
+void uart_rx_queue_parse(const uint8_t *p_data, uint16_t ui16_len)
+{
+  uint8_t ui8_byte_received;
+  uint16_t ui16_crc_rx;
+
+  while (ui16_len--) {
+    ui8_byte_received = *p_data++;
+
+    switch (ui8_m_rx_state)
+    {
+      case 0:
+        if (ui8_byte_received == 0x43) { // see if we get start package byte
+          ui8_m_rx[0] = ui8_byte_received;
+          ui8_m_rx_state = 1;
+        }
+        break;
+
+      case 1:
+        // the length must leave room for the CRC and include the frame type
+        if (ui8_byte_received < 3 || ui8_byte_received > UART_NUMBER_DATA_BYTES_TO_RECEIVE - 2) {
+          g_uart_rx_queue_stats.ui32_crc_errors++;
+          ui8_m_rx_state = 0;
+          break;
+        }
+
+        ui8_m_rx[1] = ui8_byte_received;
+        ui8_m_rx_cnt = 0;
+        ui8_m_rx_state = 2;
+        break;
+
+      case 2:
+        ui8_m_rx[ui8_m_rx_cnt + 2] = ui8_byte_received;
+        ++ui8_m_rx_cnt;
+
+        // reset if it is the last byte of the package and index is out of bounds
+        if (ui8_m_rx_cnt >= ui8_m_rx[1])
+        {
+          ui8_m_rx_state = 0;
+
+          ui16_crc_rx = crc16_update(0xffff, ui8_m_rx, ui8_m_rx[1]);
+
+          // if CRC is correct queue the package for communications()
+          if (((((uint16_t) ui8_m_rx[ui8_m_rx[1] + 1]) << 8) +
+                ((uint16_t) ui8_m_rx[ui8_m_rx[1]])) == ui16_crc_rx)
+            uart_rx_queue_push(ui8_m_rx);
+          else
+            g_uart_rx_queue_stats.ui32_crc_errors++;
+        }
+        break;
+
+      default:
+        ui8_m_rx_state = 0;
+        break;
+    }
+  }
+}
+
+/**
+ * @brief Received bytes were lost, drop the frame being parsed and wait for the next start byte
+ */
+void uart_rx_queue_overrun(void)
+{
+  ui8_m_rx_state = 0;
+  g_uart_rx_queue_stats.ui32_overruns++;
+}
+
+void uart_rx_dma_ring_update(uart_rx_dma_ring_t *p_ring, uint16_t ui16_pos)
+{
+  // can't be a full lap, we get half and full transfer interrupts
+  p_ring->ui32_written += (uint16_t) (ui16_pos - p_ring->ui16_last_pos) & (p_ring->ui16_size - 1);
+  p_ring->ui16_last_pos = ui16_pos;
+}
+
+void uart_rx_dma_ring_parse(uart_rx_dma_ring_t *p_ring)
+{
+  uint32_t ui32_written = p_ring->ui32_written;
+  uint16_t ui16_start;
+  uint16_t ui16_len;
+
+  // the DMA went around the buffer and overwrote bytes we didn't parse yet
+  if (ui32_written - p_ring->ui32_read > p_ring->ui16_size) {
+    p_ring->ui32_read = ui32_written;
+    uart_rx_queue_overrun();
+    return;
+  }
+
+  // at most two chunks, before and after the end of the buffer
+  while (p_ring->ui32_read != ui32_written) {
+    ui16_start = p_ring->ui32_read & (p_ring->ui16_size - 1);
+    ui16_len = p_ring->ui16_size - ui16_start;
+    if (ui16_len > ui32_written - p_ring->ui32_read)
+      ui16_len = ui32_written - p_ring->ui32_read;
+
+    uart_rx_queue_parse(&p_ring->p_buffer[ui16_start], ui16_len);
+    p_ring->ui32_read += ui16_len;
+  }
+}
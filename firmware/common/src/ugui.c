@@ -54,6 +54,9 @@
 //
 /* -------------------------------------------------------------------------------- */
 #include "ugui.h"
+#ifdef USE_GLYPH_CACHE
+#include "glyph_cache.h"
+#endif
 
 /* SW102 Extensions */
 static void (*p_refresh)( void ) = (void *)0;
@@ -3990,264 +3993,299 @@ __UG_FONT_DATA unsigned char font_22x36[256][108]={
 #endif
 
 #ifdef USE_FONT_24X40
-__UG_FONT_DATA unsigned char font_24x40[256][120]={
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x00
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0xC0,0xFF,0x03,0xE0,0x81,0x07,0x70,0x00,0x0E,0x38,0x00,0x1C,0x1C,0x00,0x38,0x8C,0xC3,0x31,0x8E,0xC3,0x71,0x86,0xC3,0x61,0x06,0x00,0x60,0x06,0x00,0x60,0x66,0x00,0x66,0x46,0x00,0x62,0xCE,0x00,0x73,0x8C,0x81,0x31,0x1C,0xFF,0x38,0x38,0x7E,0x1C,0x70,0x00,0x0E,0xE0,0x81,0x07,0xC0,0xFF,0x03,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x01
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0xFF,0x0F,0xF8,0xFF,0x1F,0xFC,0xFF,0x3F,0x7C,0x3C,0x3E,0x7E,0x3C,0x7E,0x7E,0x3C,0x7E,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0x9E,0xFF,0x79,0xBE,0xFF,0x7D,0x3E,0xFF,0x7C,0x7C,0x7E,0x3E,0xFC,0x00,0x3F,0xF8,0x81,0x1F,0xF0,0xFF,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x02
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x0F,0xFC,0xC3,0x3F,0xFC,0xE7,0x3F,0xFE,0xE7,0x7F,0xFE,0xFF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x03
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x7C,0x00,0x00,0x7E,0x00,0x00,0xFE,0x00,0x00,0xFF,0x01,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0xFF,0x0F,0xF8,0xFF,0x1F,0xFC,0xFF,0x3F,0xFE,0xFF,0x7F,0xFF,0xFF,0xFF,0xFE,0xFF,0x7F,0xFC,0xFF,0x3F,0xF8,0xFF,0x1F,0xF0,0xFF,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x80,0xFF,0x03,0x00,0xFF,0x01,0x00,0xFE,0x00,0x00,0x7E,0x00,0x00,0x7C,0x00,0x00,0x38,0x00,0x00,0x18,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x04
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x80,0xFF,0x01,0x80,0xFF,0x01,0xF8,0xFF,0x1F,0xFC,0xFF,0x3F,0xFE,0xFF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xDB,0x7F,0xFC,0x99,0x3F,0xF8,0x3C,0x1F,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x05
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x18,0x00,0x00,0x1C,0x00,0x00,0x3E,0x00,0x00,0x7F,0x00,0x00,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xFF,0x07,0xF8,0xFF,0x1F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFE,0xFF,0x7F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFE,0xDB,0x7F,0xFC,0x99,0x3F,0x78,0x3C,0x1E,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x06
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x07
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x08
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x09
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x0A
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x80,0x3F,0x00,0xF0,0x3F,0x00,0xF8,0x3F,0x00,0x78,0x3E,0x00,0x00,0x77,0x00,0x80,0x77,0x00,0x80,0x73,0x00,0xC0,0xF3,0x00,0xC0,0xE1,0xC0,0xFF,0x20,0xF0,0xFF,0x00,0xF8,0xFF,0x00,0x7C,0xF0,0x01,0x1E,0xC0,0x03,0x0E,0x80,0x03,0x0F,0x80,0x07,0x07,0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x07,0x0F,0x80,0x07,0x0E,0x80,0x03,0x1E,0xC0,0x03,0x7C,0xF0,0x01,0xF8,0xFF,0x00,0xF0,0x7F,0x00,0xC0,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x0B
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0xC0,0xFF,0x01,0xE0,0xFF,0x03,0xF0,0xC1,0x07,0x78,0x00,0x0F,0x38,0x00,0x0E,0x3C,0x00,0x1E,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x3C,0x00,0x1E,0x38,0x00,0x0E,0x78,0x00,0x0F,0xF0,0xC1,0x07,0xE0,0xFF,0x03,0xC0,0xFF,0x01,0x00,0x7F,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0xE0,0xFF,0x03,0xE0,0xFF,0x03,0xE0,0xFF,0x03,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x0C
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x0D
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x38,0x00,0x00,0x3E,0x00,0x80,0x3F,0x00,0xE0,0x3F,0x00,0xFC,0x37,0x00,0xFF,0x31,0x00,0x7F,0x30,0x00,0x1F,0x30,0x00,0x07,0x30,0x00,0x03,0x30,0x00,0x03,0x30,0x00,0x03,0x30,0x00,0x03,0x30,0x00,0x03,0x30,0x00,0x03,0x30,0x00,0x03,0x30,0x00,0x03,0x30,0x00,0x03,0x30,0x00,0x03,0x30,0x00,0x03,0x30,0x00,0x83,0x3F,0x00,0xE3,0x3F,0x00,0xE3,0x3F,0x00,0xF3,0x1F,0x00,0xF3,0x1F,0x00,0xF3,0x0F,0x00,0xE3,0x03,0xF8,0x03,0x00,0xFE,0x03,0x00,0xFE,0x01,0x00,0xFF,0x01,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x0E
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x30,0x38,0x0C,0x78,0xFE,0x1C,0xF0,0xFF,0x1F,0xE0,0xFF,0x0F,0xE0,0xC3,0x07,0xE0,0x00,0x0F,0xF0,0x00,0x0F,0x7E,0x00,0x7E,0x7E,0x00,0x7E,0x7E,0x00,0x7E,0xF0,0x00,0x0F,0xE0,0x00,0x0F,0xE0,0xC3,0x07,0xE0,0xFF,0x07,0xF0,0xFF,0x1F,0x78,0xFE,0x1E,0x30,0x38,0x0C,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x0F
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x02,0x00,0x00,0x0E,0x00,0x00,0x3E,0x00,0x00,0xFE,0x00,0x00,0xFE,0x03,0x00,0xFE,0x0F,0x00,0xFE,0x1F,0x00,0xFE,0x7F,0x00,0xFE,0xFF,0x01,0xFE,0xFF,0x07,0xFE,0xFF,0x1F,0xFE,0xFF,0x7F,0xFE,0xFF,0x1F,0xFE,0xFF,0x07,0xFE,0xFF,0x01,0xFE,0x7F,0x00,0xFE,0x1F,0x00,0xFE,0x0F,0x00,0xFE,0x03,0x00,0xFE,0x00,0x00,0x3E,0x00,0x00,0x0E,0x00,0x00,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x10
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x00,0x70,0x00,0x00,0x7C,0x00,0x00,0x7F,0x00,0xC0,0x7F,0x00,0xF0,0x7F,0x00,0xF8,0x7F,0x00,0xFE,0x7F,0x80,0xFF,0x7F,0xE0,0xFF,0x7F,0xF8,0xFF,0x7F,0xFE,0xFF,0x7F,0xF8,0xFF,0x7F,0xE0,0xFF,0x7F,0x80,0xFF,0x7F,0x00,0xFE,0x7F,0x00,0xF8,0x7F,0x00,0xF0,0x7F,0x00,0xC0,0x7F,0x00,0x00,0x7F,0x00,0x00,0x7C,0x00,0x00,0x70,0x00,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x11
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xFF,0x01,0x80,0xBB,0x03,0x80,0x38,0x02,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x80,0x38,0x02,0x80,0xBB,0x03,0x00,0xFF,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x12
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0xC0,0x83,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x13
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x07,0xE0,0xFF,0x07,0xF0,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF0,0x0F,0x06,0xF0,0x0F,0x06,0xE0,0x0F,0x06,0xC0,0x0F,0x06,0x00,0x0F,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x14
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0xFF,0x07,0x80,0xFF,0x07,0xC0,0x03,0x06,0xE0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x03,0x00,0xC0,0x07,0x00,0x80,0x3F,0x00,0x80,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xF1,0x03,0xC0,0xC0,0x07,0xE0,0x80,0x0F,0xE0,0x00,0x0F,0xE0,0x00,0x0E,0xE0,0x01,0x0E,0xC0,0x07,0x0E,0xC0,0x0F,0x07,0x80,0x7F,0x07,0x00,0xFE,0x03,0x00,0xF8,0x03,0x00,0xE0,0x07,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x20,0x00,0x0F,0xE0,0x81,0x07,0xE0,0xFF,0x03,0xE0,0xFF,0x01,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x15
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x16
-{0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xFF,0x01,0x80,0xBB,0x03,0x80,0x38,0x02,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x80,0x38,0x02,0x80,0xBB,0x03,0x00,0xFF,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x03,0x80,0xFF,0x03,0x80,0xFF,0x03}, // 0x17
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xFF,0x01,0x80,0xBB,0x03,0x80,0x38,0x02,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x18
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x80,0x38,0x02,0x80,0xBB,0x03,0x00,0xFF,0x01,0x00,0xFE,0x00,0x00,0x7C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x19
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x00,0x00,0x80,0x01,0x00,0x80,0x03,0x00,0x00,0x07,0xFC,0xFF,0x1F,0xFC,0xFF,0x3F,0xFC,0xFF,0x1F,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x80,0x01,0x00,0xC0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x1A
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x80,0x01,0x00,0xC0,0x01,0x00,0xE0,0x00,0x00,0xF8,0xFF,0x3F,0xFC,0xFF,0x3F,0xF8,0xFF,0x3F,0xE0,0x00,0x00,0xC0,0x01,0x00,0x80,0x01,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x1B
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x1C
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC3,0x00,0x80,0x81,0x01,0xC0,0x81,0x03,0xE0,0x00,0x07,0xF8,0xFF,0x1F,0xFC,0xFF,0x3F,0xF8,0xFF,0x1F,0xE0,0x00,0x07,0xC0,0x81,0x03,0x80,0x81,0x01,0x00,0xC3,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x1D
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x7E,0x00,0x00,0x7F,0x00,0x00,0xFF,0x00,0x80,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x1E
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x7F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xF0,0xFF,0x07,0xE0,0xFF,0x07,0xE0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x01,0x80,0xFF,0x01,0x80,0xFF,0x00,0x00,0xFF,0x00,0x00,0x7F,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x1F
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x20
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x21
-{0x00,0x00,0x00,0xE0,0x83,0x0F,0xE0,0x83,0x0F,0xE0,0x83,0x0F,0xE0,0x83,0x0F,0xE0,0x83,0x0F,0xE0,0x83,0x0F,0xC0,0x01,0x07,0xC0,0x01,0x07,0xC0,0x01,0x07,0xC0,0x01,0x07,0xC0,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x22
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x0E,0x0E,0x00,0x0E,0x0E,0x00,0x0E,0x0E,0x00,0x0E,0x0E,0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x07,0x07,0xF8,0xFF,0x7F,0xF8,0xFF,0x7F,0xF8,0xFF,0x7F,0x80,0x83,0x03,0x80,0x83,0x03,0x80,0xC3,0x01,0xC0,0xC1,0x01,0xC0,0xC1,0x01,0xFE,0xFF,0x3F,0xFE,0xFF,0x3F,0xFE,0xFF,0x3F,0xE0,0xE0,0x00,0xE0,0xE0,0x00,0xE0,0xE0,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0x70,0x70,0x00,0x38,0x38,0x00,0x38,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x23
-{0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xFC,0x01,0x00,0xFF,0x0F,0x80,0xFF,0x0F,0xC0,0x37,0x0E,0xE0,0x33,0x00,0xE0,0x31,0x00,0xE0,0x31,0x00,0xE0,0x31,0x00,0xE0,0x31,0x00,0xE0,0x33,0x00,0xC0,0x37,0x00,0x80,0x3F,0x00,0x00,0x3F,0x00,0x00,0x7E,0x00,0x00,0xFC,0x00,0x00,0xF0,0x03,0x00,0xF0,0x07,0x00,0xB0,0x0F,0x00,0x30,0x0F,0x00,0x30,0x1F,0x00,0x30,0x1E,0x00,0x30,0x1E,0x00,0x30,0x1E,0x00,0x30,0x1E,0x10,0x30,0x0F,0xF0,0xB0,0x0F,0xF0,0xFF,0x07,0xF0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x24
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x00,0xE0,0xFC,0x03,0x70,0x8E,0x07,0x38,0x0E,0x07,0x38,0x07,0x0E,0x1C,0x07,0x0E,0x0E,0x07,0x0E,0x07,0x07,0x0E,0x07,0x07,0x8E,0x03,0x0E,0xC7,0x01,0x9E,0xC7,0x01,0xFC,0xE3,0x00,0xF0,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0E,0x0F,0x00,0xCE,0x3F,0x00,0xE7,0x78,0x80,0xE3,0x70,0x80,0x73,0xE0,0xC0,0x71,0xE0,0xE0,0x70,0xE0,0xE0,0x70,0xE0,0x70,0x70,0xE0,0x38,0xE0,0x70,0x1C,0xE0,0x79,0x1C,0xC0,0x3F,0x0E,0x00,0x0F,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x25
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x80,0xFF,0x00,0xC0,0xFF,0x01,0xC0,0xE3,0x03,0xE0,0xC1,0x03,0xE0,0xC1,0x03,0xE0,0xC1,0x03,0xE0,0xC1,0x03,0xE0,0xE3,0x01,0xC0,0xF3,0x00,0xC0,0x7B,0x00,0xC0,0x3F,0x00,0xC0,0x1F,0x00,0xF0,0x0F,0x00,0xF8,0x0F,0xF0,0x3C,0x1F,0xF0,0x1E,0x3E,0xF0,0x1E,0x3C,0xF0,0x0F,0x7C,0x70,0x0F,0xF8,0x70,0x0F,0xF0,0x79,0x0F,0xF0,0x39,0x0F,0xE0,0x3F,0x1F,0xC0,0x1F,0x1E,0x80,0x0F,0x3E,0x80,0x1F,0xFC,0xE0,0x3F,0xF8,0xFF,0x7F,0xF0,0x7F,0xFC,0xC0,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x26
-{0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x27
-{0x00,0x00,0x00,0x00,0x00,0x1C,0x00,0x00,0x1F,0x00,0xC0,0x1F,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0x7C,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x00,0xC0,0x1F,0x00,0x00,0x1F,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x28
-{0x00,0x00,0x00,0x38,0x00,0x00,0xF8,0x00,0x00,0xF8,0x03,0x00,0xE0,0x07,0x00,0x80,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x3E,0x00,0x00,0x1F,0x00,0x80,0x0F,0x00,0xE0,0x07,0x00,0xF8,0x03,0x00,0xF8,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x29
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x10,0x18,0x08,0x70,0x18,0x0E,0xF8,0x81,0x1F,0xF8,0xC3,0x1F,0xC0,0xC3,0x03,0x00,0x00,0x00,0x00,0x42,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0xC3,0x03,0xC0,0xC3,0x03,0xC0,0x81,0x03,0x00,0x81,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x2A
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x2B
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x38,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x2C
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x2D
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x2E
-{0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x2F
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x03,0xE0,0xC3,0x07,0xF0,0x81,0x0F,0xF0,0x00,0x0F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x38,0x00,0x1C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x38,0x00,0x1C,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF0,0x00,0x0F,0xF0,0x81,0x0F,0xE0,0xC3,0x07,0xC0,0xFF,0x03,0x80,0xFF,0x01,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x30
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x00,0x7C,0x00,0x80,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7B,0x00,0x18,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0xF8,0xFF,0x7F,0xF8,0xFF,0x7F,0xF8,0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x31
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x3F,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x01,0x70,0xE0,0x03,0x10,0xC0,0x03,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x80,0x03,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF8,0x00,0x00,0xF8,0xFF,0x07,0xF8,0xFF,0x07,0xF8,0xFF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x32
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x7F,0x00,0xE0,0xFF,0x03,0xE0,0xFF,0x07,0xE0,0xC0,0x07,0x00,0x80,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0xE0,0x03,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x03,0x00,0xE0,0x07,0x00,0x80,0x0F,0x00,0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x80,0x0F,0xE0,0xC0,0x07,0xE0,0xFF,0x03,0xE0,0xFF,0x01,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x33
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xF0,0x03,0x00,0xF0,0x03,0x00,0xF8,0x03,0x00,0xFC,0x03,0x00,0xDC,0x03,0x00,0xCE,0x03,0x00,0xCF,0x03,0x00,0xC7,0x03,0x80,0xC3,0x03,0xC0,0xC3,0x03,0xC0,0xC1,0x03,0xE0,0xC0,0x03,0xF0,0xC0,0x03,0x70,0xC0,0x03,0x38,0xC0,0x03,0x3C,0xC0,0x03,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x34
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x07,0xC0,0xFF,0x07,0xC0,0xFF,0x07,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x1F,0x00,0xC0,0x7F,0x00,0xC0,0xFF,0x01,0x00,0xF0,0x03,0x00,0xC0,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x80,0x0F,0x00,0x80,0x07,0x00,0xC0,0x07,0x60,0xE0,0x03,0xE0,0xFF,0x01,0xE0,0xFF,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x35
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x03,0x00,0xFE,0x0F,0x00,0xFF,0x0F,0x80,0x0F,0x0E,0xC0,0x03,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x78,0xF8,0x01,0x78,0xFE,0x03,0x78,0xFF,0x0F,0xF8,0x83,0x0F,0xF8,0x01,0x1F,0xF8,0x00,0x1E,0xF8,0x00,0x3E,0xF8,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x1C,0xE0,0x01,0x1E,0xE0,0x01,0x1F,0xC0,0x87,0x0F,0x80,0xFF,0x07,0x00,0xFF,0x03,0x00,0xFC,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x36
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x80,0x07,0x00,0x80,0x03,0x00,0xC0,0x03,0x00,0xC0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x00,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x78,0x00,0x00,0x38,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x37
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0x80,0xFF,0x07,0xC0,0xFF,0x0F,0xE0,0x83,0x0F,0xF0,0x01,0x1F,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x01,0x1E,0xF0,0x01,0x0F,0xE0,0x83,0x07,0xC0,0xCF,0x03,0x80,0xFF,0x01,0x00,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xFB,0x07,0xE0,0xE1,0x0F,0xF0,0xC0,0x1F,0xF0,0x00,0x1F,0x78,0x00,0x3E,0x78,0x00,0x3E,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0xF8,0x00,0x3C,0xF0,0x01,0x1E,0xF0,0x83,0x0F,0xE0,0xFF,0x07,0x80,0xFF,0x03,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x38
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x80,0xFF,0x01,0xC0,0xFF,0x07,0xE0,0xC3,0x07,0xF0,0x01,0x0F,0xF0,0x00,0x0F,0x70,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3E,0xF8,0x00,0x3E,0xF0,0x00,0x3E,0xF0,0x01,0x3F,0xE0,0x83,0x3F,0xC0,0xFF,0x3D,0x80,0xFF,0x3C,0x00,0x3F,0x3C,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x80,0x07,0xE0,0xE0,0x03,0xE0,0xFF,0x01,0xE0,0xFF,0x00,0x80,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x39
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x3A
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x38,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x3B
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x20,0x00,0x00,0x38,0x00,0x00,0x3E,0x00,0x80,0x1F,0x00,0xE0,0x07,0x00,0xF0,0x01,0x00,0xFC,0x00,0x00,0x3F,0x00,0xC0,0x0F,0x00,0xF0,0x03,0x00,0xFC,0x00,0x00,0xF0,0x03,0x00,0xC0,0x0F,0x00,0x00,0x3F,0x00,0x00,0xFC,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x00,0x80,0x1F,0x00,0x00,0x3E,0x00,0x00,0x38,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x3C
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x3D
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x00,0x00,0x1C,0x00,0x00,0x7C,0x00,0x00,0xF8,0x01,0x00,0xE0,0x07,0x00,0x80,0x0F,0x00,0x00,0x3F,0x00,0x00,0xFC,0x00,0x00,0xF0,0x03,0x00,0xC0,0x0F,0x00,0x00,0x3F,0x00,0xC0,0x0F,0x00,0xF0,0x03,0x00,0xFC,0x00,0x00,0x3F,0x00,0x80,0x0F,0x00,0xE0,0x07,0x00,0xF8,0x01,0x00,0x7C,0x00,0x00,0x1C,0x00,0x00,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x3E
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0xFF,0x00,0xF8,0xFF,0x03,0xF8,0xFF,0x0F,0x38,0xC0,0x0F,0x38,0x00,0x1F,0x38,0x00,0x1E,0x38,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x3F
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x01,0x00,0xFF,0x03,0xC0,0x87,0x07,0xE0,0x01,0x0E,0xF0,0x00,0x0E,0x70,0x00,0x1C,0x38,0xE0,0x1F,0x38,0xF0,0x1F,0x1C,0x38,0x1E,0x1C,0x1C,0x1C,0x1C,0x0E,0x1C,0x0E,0x0E,0x1C,0x0E,0x06,0x1C,0x0E,0x07,0x1C,0x0E,0x07,0x1E,0x0E,0x07,0x1E,0x0E,0x07,0x1F,0x0E,0x07,0x1F,0x0E,0x87,0x1F,0x0E,0x87,0x1D,0x1E,0xCE,0x1D,0x1C,0xFE,0x1C,0x1C,0x7C,0xFC,0x38,0x38,0xFC,0x38,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xC0,0x03,0x03,0x80,0xFF,0x03,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x40
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xF7,0x00,0x00,0xF7,0x00,0x80,0xE7,0x01,0x80,0xE3,0x01,0x80,0xE3,0x01,0xC0,0xC3,0x03,0xC0,0xC1,0x03,0xE0,0x81,0x07,0xE0,0x81,0x07,0xE0,0x80,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x0F,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x41
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x07,0xF0,0xFF,0x0F,0xF0,0x80,0x1F,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x0F,0xF0,0xC0,0x07,0xF0,0xFF,0x03,0xF0,0xFF,0x00,0xF0,0xFF,0x03,0xF0,0xC0,0x0F,0xF0,0x00,0x1F,0xF0,0x00,0x1E,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3E,0xF0,0x00,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x07,0xF0,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x42
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0xFE,0x7F,0x80,0xFF,0x7F,0xC0,0x0F,0x78,0xE0,0x03,0x40,0xF0,0x01,0x00,0xF8,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xC0,0x1F,0x70,0x80,0xFF,0x7F,0x00,0xFE,0x7F,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x43
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0xF8,0xFF,0x03,0xF8,0xFF,0x07,0x78,0xC0,0x0F,0x78,0x00,0x1F,0x78,0x00,0x3E,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x38,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x1E,0x78,0x00,0x1F,0x78,0xE0,0x0F,0xF8,0xFF,0x07,0xF8,0xFF,0x01,0xF8,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x44
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x3F,0xF0,0xFF,0x3F,0xF0,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x45
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x7F,0xE0,0xFF,0x7F,0xE0,0xFF,0x7F,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0xFF,0x1F,0xE0,0xFF,0x1F,0xE0,0xFF,0x1F,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x46
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0xFE,0x7F,0x80,0xFF,0x7F,0xC0,0x0F,0x78,0xE0,0x03,0x40,0xF0,0x01,0x00,0xF8,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0xC0,0x7F,0x3C,0xC0,0x7F,0x3C,0xC0,0x7F,0x3C,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x78,0xF8,0x00,0x78,0xF0,0x01,0x78,0xE0,0x03,0x78,0xC0,0x1F,0x78,0x80,0xFF,0x7F,0x00,0xFE,0x7F,0x00,0xF8,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x47
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x48
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x49
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x03,0xE0,0xFF,0x03,0xE0,0xFF,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xE0,0x03,0x00,0xE0,0x01,0x18,0xF0,0x01,0xF8,0xFF,0x00,0xF8,0x7F,0x00,0xE0,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x4A
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x80,0x1F,0x78,0x80,0x0F,0x78,0xC0,0x07,0x78,0xE0,0x03,0x78,0xE0,0x01,0x78,0xF0,0x00,0x78,0xF8,0x00,0x78,0x7C,0x00,0x78,0x3C,0x00,0x78,0x1E,0x00,0x78,0x0F,0x00,0x78,0x07,0x00,0xF8,0x0F,0x00,0x78,0x1F,0x00,0x78,0x3E,0x00,0x78,0x3C,0x00,0x78,0x78,0x00,0x78,0xF8,0x00,0x78,0xF0,0x01,0x78,0xE0,0x03,0x78,0xC0,0x07,0x78,0x80,0x0F,0x78,0x00,0x1F,0x78,0x00,0x3F,0x78,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x4B
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x4C
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x3E,0x7C,0x00,0x3E,0xFC,0x00,0x3E,0xFC,0x00,0x3F,0xFC,0x00,0x3F,0xDC,0x01,0x3B,0xDC,0x81,0x3B,0xDC,0x81,0x3B,0x9C,0x83,0x39,0x9C,0xC3,0x39,0x9C,0xC3,0x39,0x1C,0xC7,0x38,0x1C,0xE7,0x38,0x1C,0xE7,0x38,0x1C,0x6E,0x38,0x1C,0x7E,0x38,0x1C,0x7E,0x38,0x1C,0x3C,0x38,0x1C,0x3C,0x38,0x1C,0x3C,0x38,0x1C,0x00,0x38,0x1C,0x00,0x38,0x1C,0x00,0x38,0x1C,0x00,0x38,0x1C,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x4D
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x1C,0x78,0x00,0x1C,0xF8,0x00,0x1C,0xF8,0x01,0x1C,0xF8,0x01,0x1C,0xF8,0x03,0x1C,0xF8,0x07,0x1C,0xB8,0x07,0x1C,0xB8,0x0F,0x1C,0x38,0x1F,0x1C,0x38,0x1F,0x1C,0x38,0x3E,0x1C,0x38,0x3C,0x1C,0x38,0x7C,0x1C,0x38,0xF8,0x1C,0x38,0xF0,0x1C,0x38,0xF0,0x1D,0x38,0xE0,0x1F,0x38,0xE0,0x1F,0x38,0xC0,0x1F,0x38,0x80,0x1F,0x38,0x80,0x1F,0x38,0x00,0x1F,0x38,0x00,0x1E,0x38,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x4E
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x4F
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x07,0xF0,0xFF,0x1F,0xF0,0x00,0x1F,0xF0,0x00,0x3E,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x1E,0xF0,0x00,0x1F,0xF0,0xC0,0x0F,0xF0,0xFF,0x07,0xF0,0xFF,0x03,0xF0,0x7F,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x50
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x03,0x00,0xC0,0x07,0x00,0x80,0x1F,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x78,0x00,0x00,0x20,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x51
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x07,0xF0,0xFF,0x0F,0xF0,0x80,0x0F,0xF0,0x00,0x1F,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x0F,0xF0,0x80,0x0F,0xF0,0xE0,0x07,0xF0,0xFF,0x03,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xF0,0x01,0xF0,0xF0,0x01,0xF0,0xE0,0x03,0xF0,0xC0,0x07,0xF0,0x80,0x0F,0xF0,0x80,0x0F,0xF0,0x00,0x1F,0xF0,0x00,0x3E,0xF0,0x00,0x7C,0xF0,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x52
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0xC0,0xFF,0x0F,0xE0,0xFF,0x0F,0xF0,0x01,0x0F,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0xF8,0x00,0x00,0xF0,0x03,0x00,0xF0,0x1F,0x00,0xC0,0xFF,0x00,0x00,0xFF,0x07,0x00,0xFC,0x0F,0x00,0xE0,0x1F,0x00,0x00,0x3F,0x00,0x00,0x3E,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x18,0x00,0x1E,0xF8,0x80,0x1F,0xF8,0xFF,0x0F,0xF8,0xFF,0x03,0x80,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x53
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x54
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0xF0,0x00,0x1E,0xF0,0x00,0x1F,0xE0,0x83,0x0F,0xE0,0xFF,0x0F,0x80,0xFF,0x03,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x55
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0xF0,0x1E,0x00,0x78,0x1E,0x00,0x78,0x3E,0x00,0x7C,0x3C,0x00,0x3C,0x7C,0x00,0x3C,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0x00,0x1E,0xF0,0x00,0x0F,0xF0,0x01,0x0F,0xE0,0x81,0x07,0xE0,0x81,0x07,0xE0,0x83,0x07,0xC0,0xC3,0x03,0xC0,0xC7,0x03,0x80,0xC7,0x01,0x80,0xE7,0x01,0x80,0xEF,0x01,0x00,0xEF,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x56
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xE0,0x0F,0x00,0xE0,0x0F,0x00,0xE0,0x0E,0x00,0x70,0x0E,0x00,0x70,0x0E,0x3C,0x70,0x0E,0x3C,0x70,0x0E,0x7C,0x70,0x1E,0x7E,0x70,0x1E,0x7E,0x38,0x1C,0x7E,0x38,0x1C,0xFE,0x38,0x1C,0xE7,0x38,0x1C,0xE7,0x38,0x3C,0xE7,0x38,0x3C,0xE7,0x1C,0x38,0xE3,0x1D,0xB8,0xC3,0x1D,0xB8,0xC3,0x1D,0xB8,0xC3,0x1D,0xB8,0xC1,0x1F,0xF8,0x81,0x0F,0xF8,0x81,0x0F,0xF0,0x81,0x0F,0xF0,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x57
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x78,0x7C,0x00,0x3C,0xF8,0x00,0x1C,0xF0,0x00,0x0E,0xF0,0x01,0x0F,0xE0,0x83,0x07,0xC0,0x87,0x03,0xC0,0xC7,0x01,0x80,0xEF,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0x00,0xFE,0x00,0x00,0xFF,0x00,0x80,0xF7,0x01,0x80,0xE3,0x03,0xC0,0xC3,0x07,0xE0,0xC1,0x07,0xF0,0x80,0x0F,0x70,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3E,0x1E,0x00,0x7C,0x0F,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x58
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0xF0,0x3C,0x00,0x78,0x78,0x00,0x38,0xF8,0x00,0x3C,0xF0,0x00,0x1C,0xE0,0x01,0x1E,0xE0,0x03,0x0F,0xC0,0x07,0x07,0x80,0x87,0x07,0x80,0x8F,0x03,0x00,0xDF,0x03,0x00,0xFE,0x01,0x00,0xFE,0x00,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x59
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0x00,0x00,0x3E,0x00,0x00,0x1F,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x1F,0x00,0x80,0x0F,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0xF8,0x00,0x00,0x7C,0x00,0x00,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0xFC,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x5A
-{0x00,0x00,0x00,0x00,0xFE,0x1F,0x00,0xFE,0x1F,0x00,0xFE,0x1F,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0xFE,0x1F,0x00,0xFE,0x1F,0x00,0xFE,0x1F,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x5B
-{0x00,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x5C
-{0x00,0x00,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x5D
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x08,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x3C,0x00,0x00,0x3E,0x00,0x00,0x3E,0x00,0x00,0x77,0x00,0x00,0x77,0x00,0x00,0xE7,0x00,0x80,0xE3,0x00,0x80,0xC3,0x01,0xC0,0xC1,0x01,0xC0,0xC1,0x03,0xC0,0x80,0x03,0xE0,0x80,0x07,0xE0,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x0E,0x38,0x00,0x0E,0x38,0x00,0x1C,0x38,0x00,0x1C,0x1C,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x5E
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x5F
-{0x00,0x0F,0x00,0x00,0x1E,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x60
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xFF,0x07,0xE0,0x80,0x0F,0x20,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0xFE,0x0F,0x80,0xFF,0x0F,0xE0,0xFF,0x0F,0xF0,0x03,0x0F,0xF0,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0xF8,0xE1,0x1F,0xF0,0xFF,0xFE,0xE0,0x7F,0xFE,0x80,0x1F,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x61
-{0x00,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0xF8,0x00,0x78,0xFE,0x03,0x78,0xFF,0x07,0x78,0x87,0x0F,0xF8,0x01,0x0F,0xF8,0x00,0x0F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x0F,0x78,0x00,0x0F,0xF8,0x80,0x0F,0xF8,0xC3,0x07,0xF8,0xFF,0x03,0x78,0xFF,0x01,0x38,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x62
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0xFF,0x1F,0xC0,0xFF,0x1F,0xE0,0x07,0x1C,0xE0,0x03,0x00,0xF0,0x01,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xF0,0x01,0x00,0xF0,0x03,0x00,0xE0,0x0F,0x1C,0xC0,0xFF,0x1F,0x00,0xFF,0x1F,0x00,0xFC,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x63
-{0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x3F,0x1E,0xC0,0xFF,0x1E,0xE0,0xFF,0x1F,0xF0,0xC1,0x1F,0xF0,0x00,0x1F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x78,0x00,0x1F,0x78,0x80,0x1F,0xF0,0xE0,0x1F,0xF0,0xFF,0x1E,0xE0,0x7F,0x1E,0x80,0x1F,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x64
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x07,0xE0,0x83,0x0F,0xE0,0x01,0x0F,0xF0,0x00,0x0E,0xF0,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x78,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x1C,0xC0,0xFF,0x1F,0x80,0xFF,0x1F,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x65
-{0x00,0x00,0x00,0x00,0xC0,0x7F,0x00,0xF0,0xFF,0x00,0xFC,0xFF,0x00,0x7C,0xC0,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0xF8,0xFF,0x7F,0xF8,0xFF,0x7F,0xF8,0xFF,0x7F,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x66
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x1E,0xC0,0xFF,0x1E,0xE0,0xFF,0x1F,0xF0,0xC1,0x1F,0xF0,0x00,0x1F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x78,0x00,0x1F,0xF8,0x80,0x1F,0xF0,0xE1,0x1E,0xF0,0xFF,0x1E,0xE0,0x7F,0x1E,0x80,0x1F,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x0F,0x00,0x00,0x0F,0x70,0xC0,0x07,0xF0,0xFF,0x03,0xF0,0xFF,0x01,0x80,0x7F,0x00}, // 0x67
-{0x00,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xE0,0x07,0xF0,0xF8,0x0F,0xF0,0xFC,0x1F,0xF0,0x0E,0x1E,0xF0,0x07,0x3E,0xF0,0x03,0x3C,0xF0,0x01,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x68
-{0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x69
-{0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0xF0,0x01,0x00,0xF0,0x01,0x00,0xF0,0x01,0x00,0xF0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x01,0xF0,0xFF,0x01,0xF0,0xFF,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xE0,0x01,0x00,0xF0,0x00,0x18,0xF8,0x00,0xF8,0x7F,0x00,0xF8,0x3F,0x00,0xE0,0x0F,0x00}, // 0x6A
-{0x00,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x80,0x1F,0xF0,0x80,0x0F,0xF0,0xC0,0x07,0xF0,0xE0,0x03,0xF0,0xF0,0x01,0xF0,0xF8,0x01,0xF0,0xF8,0x00,0xF0,0x7C,0x00,0xF0,0x3E,0x00,0xF0,0x1F,0x00,0xF0,0x1F,0x00,0xF0,0x3E,0x00,0xF0,0x7C,0x00,0xF0,0xF8,0x00,0xF0,0xF0,0x01,0xF0,0xE0,0x03,0xF0,0xC0,0x07,0xF0,0x80,0x0F,0xF0,0x80,0x1F,0xF0,0x00,0x3F,0xF0,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x6B
-{0x00,0x00,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0xF0,0xFF,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x6C
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1C,0x0F,0x0E,0x9C,0x1F,0x1F,0xDC,0x9F,0x3F,0xFC,0xF8,0x39,0x7C,0xF8,0x38,0x3C,0x78,0x38,0x3C,0x78,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x1C,0x38,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x6D
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xE0,0x07,0xF0,0xF8,0x0F,0xF0,0xFC,0x1F,0xF0,0x0E,0x1E,0xF0,0x07,0x3E,0xF0,0x03,0x3C,0xF0,0x01,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x6E
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x6F
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xF0,0x01,0xF0,0xFC,0x07,0xF0,0xFE,0x0F,0xF0,0x0F,0x1F,0xF0,0x03,0x1E,0xF0,0x01,0x1E,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x01,0x1F,0xF0,0x87,0x0F,0xF0,0xFF,0x07,0xF0,0xFE,0x03,0xF0,0xF8,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00}, // 0x70
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3F,0x1C,0xC0,0xFF,0x1E,0xE0,0xFF,0x1F,0xF0,0xC1,0x1F,0xF0,0x00,0x1F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x78,0x00,0x1F,0x78,0x80,0x1F,0xF0,0xE0,0x1E,0xF0,0x7F,0x1E,0xE0,0x3F,0x1E,0x80,0x1F,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E}, // 0x71
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xC0,0x83,0x3F,0xC0,0xE3,0x3F,0xC0,0xF3,0x3F,0xC0,0x7B,0x38,0xC0,0x1F,0x38,0xC0,0x0F,0x38,0xC0,0x07,0x38,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0xC0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x72
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x03,0xC0,0xFF,0x0F,0xE0,0xFF,0x0F,0xF0,0x03,0x0E,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x03,0x00,0xE0,0x1F,0x00,0xC0,0xFF,0x00,0x00,0xFF,0x03,0x00,0xF8,0x0F,0x00,0xC0,0x0F,0x00,0x00,0x1F,0x00,0x00,0x1E,0x00,0x00,0x1E,0x08,0x00,0x1F,0x78,0x80,0x0F,0xF8,0xFF,0x07,0xF8,0xFF,0x03,0xC0,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x73
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x1F,0x00,0x00,0x3E,0x00,0x00,0xFE,0x3F,0x00,0xFC,0x3F,0x00,0xF0,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x74
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0x78,0xC0,0x0F,0x78,0xE0,0x0F,0xF8,0x70,0x0F,0xF0,0x7F,0x0F,0xE0,0x1F,0x0F,0xC0,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x75
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1E,0x00,0x7C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x7C,0x00,0x3E,0x78,0x00,0x1E,0xF8,0x00,0x1E,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xE0,0x81,0x07,0xE0,0x81,0x07,0xE0,0x83,0x07,0xC0,0xC3,0x03,0xC0,0xC3,0x03,0x80,0xC7,0x01,0x80,0xE7,0x01,0x00,0xEF,0x00,0x00,0xFF,0x00,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x76
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x00,0xE0,0x0F,0x00,0xE0,0x0F,0x3C,0x60,0x0E,0x7C,0x70,0x0E,0x7C,0x70,0x1E,0x7E,0x70,0x1E,0x7E,0x70,0x1E,0x66,0x30,0x1C,0xE6,0x38,0x1C,0xE7,0x38,0x1C,0xE7,0x38,0x3C,0xC3,0x38,0x3C,0xC3,0x19,0xB8,0xC3,0x1D,0xB8,0xC3,0x1D,0xB8,0x81,0x1D,0xF8,0x81,0x1F,0xF8,0x81,0x0F,0xF8,0x80,0x0F,0xF0,0x80,0x0F,0xF0,0x00,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x77
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x1E,0xF8,0x00,0x0E,0xF0,0x01,0x07,0xE0,0x81,0x07,0xE0,0x83,0x03,0xC0,0xC7,0x01,0x80,0xEF,0x01,0x80,0xEF,0x00,0x00,0x7F,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xF7,0x01,0x80,0xF3,0x01,0xC0,0xE3,0x03,0xE0,0xC1,0x07,0xE0,0x80,0x07,0xF0,0x80,0x0F,0x78,0x00,0x1F,0x3C,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x78
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x78,0x3C,0x00,0x38,0x7C,0x00,0x3C,0x78,0x00,0x1C,0x78,0x00,0x1E,0xF8,0x00,0x0E,0xF0,0x00,0x0F,0xF0,0x01,0x0F,0xE0,0x81,0x07,0xE0,0x83,0x07,0xC0,0xC3,0x03,0xC0,0xC7,0x03,0x80,0xE7,0x01,0x80,0xE7,0x01,0x00,0xEF,0x00,0x00,0xFF,0x00,0x00,0x7F,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0xFC,0x03,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00}, // 0x79
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0x00,0x00,0x3E,0x00,0x00,0x1F,0x00,0x80,0x0F,0x00,0xC0,0x07,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x1F,0x00,0x80,0x0F,0x00,0xC0,0x07,0x00,0xE0,0x03,0x00,0xF0,0x01,0x00,0xF8,0x00,0x00,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0xF8,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x7A
-{0x00,0x00,0x00,0x00,0xC0,0x0F,0x00,0xF0,0x0F,0x00,0xF8,0x0F,0x00,0x7C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x7C,0x00,0x00,0x3E,0x00,0xE0,0x1F,0x00,0xE0,0x07,0x00,0xE0,0x1F,0x00,0x00,0x3E,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x7C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x7C,0x00,0x00,0xF8,0x0F,0x00,0xF0,0x0F,0x00,0xC0,0x0F,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x7B
-{0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x7C
-{0x00,0x00,0x00,0xF0,0x03,0x00,0xF0,0x0F,0x00,0xF0,0x1F,0x00,0x00,0x3E,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x3E,0x00,0x00,0x7C,0x00,0x00,0xF8,0x07,0x00,0xE0,0x07,0x00,0xF8,0x07,0x00,0x7C,0x00,0x00,0x3E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x3E,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3E,0x00,0xF0,0x1F,0x00,0xF0,0x0F,0x00,0xF0,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x7D
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x01,0x00,0xF8,0x07,0x70,0xFC,0x0F,0x70,0x1C,0x3F,0x70,0x0E,0xFC,0x38,0x0E,0xF0,0x3F,0x0E,0xE0,0x1F,0x00,0x80,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x7E
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0xFF,0x07,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0x20,0x00,0x04,0xE0,0xFF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x7F
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x0F,0x00,0xFE,0x7F,0x80,0xFF,0x7F,0xC0,0x0F,0x78,0xE0,0x03,0x40,0xF0,0x01,0x00,0xF8,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0xF8,0x00,0x00,0xF0,0x01,0x00,0xE0,0x03,0x00,0xC0,0x1F,0x70,0x80,0xFF,0x7F,0x00,0xFE,0x7F,0x00,0xF8,0x0F,0x00,0x60,0x00,0x00,0x30,0x00,0x00,0xF0,0x00,0x00,0xC0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xF8,0x01,0x00,0xF8,0x00}, // 0x80
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x83,0x03,0x80,0x83,0x03,0x80,0x83,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0x78,0xC0,0x0F,0x78,0xE0,0x0F,0xF8,0x70,0x0F,0xF0,0x7F,0x0F,0xE0,0x1F,0x0F,0xC0,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x81
-{0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x07,0xE0,0x83,0x0F,0xE0,0x01,0x0F,0xF0,0x00,0x0E,0xF0,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x78,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x1C,0xC0,0xFF,0x1F,0x80,0xFF,0x1F,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x82
-{0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0xC3,0x03,0xE0,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xFF,0x07,0xE0,0x80,0x0F,0x20,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0xFE,0x0F,0x80,0xFF,0x0F,0xE0,0xFF,0x0F,0xF0,0x03,0x0F,0xF0,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0xF8,0xE1,0x1F,0xF0,0xFF,0xFE,0xE0,0x7F,0xFE,0x80,0x1F,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x83
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xFF,0x07,0xE0,0x80,0x0F,0x20,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0xFE,0x0F,0x80,0xFF,0x0F,0xE0,0xFF,0x0F,0xF0,0x03,0x0F,0xF0,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0xF8,0xE1,0x1F,0xF0,0xFF,0xFE,0xE0,0x7F,0xFE,0x80,0x1F,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x84
-{0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xFF,0x07,0xE0,0x80,0x0F,0x20,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0xFE,0x0F,0x80,0xFF,0x0F,0xE0,0xFF,0x0F,0xF0,0x03,0x0F,0xF0,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0xF8,0xE1,0x1F,0xF0,0xFF,0xFE,0xE0,0x7F,0xFE,0x80,0x1F,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x85
-{0x00,0x1C,0x00,0x00,0x22,0x00,0x00,0x41,0x00,0x00,0x41,0x00,0x00,0x41,0x00,0x00,0x22,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xFF,0x07,0xE0,0x80,0x0F,0x20,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0xFE,0x0F,0x80,0xFF,0x0F,0xE0,0xFF,0x0F,0xF0,0x03,0x0F,0xF0,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0xF8,0xE1,0x1F,0xF0,0xFF,0xFE,0xE0,0x7F,0xFE,0x80,0x1F,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x86
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x07,0x00,0xFF,0x1F,0xC0,0xFF,0x1F,0xE0,0x07,0x1C,0xE0,0x03,0x00,0xF0,0x01,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xF0,0x01,0x00,0xF0,0x03,0x00,0xE0,0x0F,0x1C,0xC0,0xFF,0x1F,0x00,0xFF,0x1F,0x00,0xFC,0x07,0x00,0x18,0x00,0x00,0x0C,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00}, // 0x87
-{0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xCF,0x03,0x80,0x87,0x07,0xC0,0x01,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x07,0xE0,0x83,0x0F,0xE0,0x01,0x0F,0xF0,0x00,0x0E,0xF0,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x78,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x1C,0xC0,0xFF,0x1F,0x80,0xFF,0x1F,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x88
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0E,0x0E,0x00,0x0E,0x0E,0x00,0x0E,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x07,0xE0,0x83,0x0F,0xE0,0x01,0x0F,0xF0,0x00,0x0E,0xF0,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x78,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x1C,0xC0,0xFF,0x1F,0x80,0xFF,0x1F,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x89
-{0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x00,0x80,0xFF,0x03,0xC0,0xFF,0x07,0xE0,0x83,0x0F,0xE0,0x01,0x0F,0xF0,0x00,0x0E,0xF0,0x00,0x1E,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x78,0x00,0x00,0x78,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x01,0x00,0xE0,0x07,0x1C,0xC0,0xFF,0x1F,0x80,0xFF,0x1F,0x00,0xFC,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x8A
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x8B
-{0x00,0x00,0x00,0x00,0xFC,0x00,0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xCF,0x03,0x80,0x87,0x07,0xC0,0x01,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x8C
-{0x00,0x00,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x8D
-{0xC0,0x01,0x07,0xC0,0x01,0x07,0xC0,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xF7,0x00,0x00,0xF7,0x00,0x80,0xE7,0x01,0x80,0xE3,0x01,0x80,0xE3,0x01,0xC0,0xC3,0x03,0xC0,0xC1,0x03,0xE0,0x81,0x07,0xE0,0x81,0x07,0xE0,0x80,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x0F,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x8E
-{0x00,0x3C,0x00,0x00,0x42,0x00,0x00,0x81,0x00,0x00,0x81,0x00,0x00,0x81,0x00,0x00,0xC3,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xF7,0x00,0x00,0xF7,0x00,0x80,0xE7,0x01,0x80,0xE3,0x01,0x80,0xE3,0x01,0xC0,0xC3,0x03,0xC0,0xC1,0x03,0xE0,0x81,0x07,0xE0,0x81,0x07,0xE0,0x80,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x0F,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x8F
-{0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x3F,0xF0,0xFF,0x3F,0xF0,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x90
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x87,0x0F,0xF8,0xCF,0x3F,0xF8,0xFF,0x3F,0x08,0xFE,0x78,0x00,0x7C,0x70,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0xC0,0xFF,0xFF,0xF0,0xFF,0xFF,0xF8,0xFF,0xFF,0x7C,0x3C,0x00,0x3E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x3C,0x00,0x1E,0x7C,0x00,0x1E,0x7C,0x00,0x3E,0xFE,0xC0,0xFC,0xF7,0xFF,0xF8,0xE3,0xFF,0xF0,0xC1,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x91
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x3F,0x00,0xFC,0x3F,0x00,0xFC,0x3F,0x00,0xFE,0x00,0x00,0xFE,0x00,0x00,0xFF,0x00,0x00,0xF7,0x00,0x00,0xF7,0x00,0x80,0xF3,0x00,0x80,0xF3,0x00,0xC0,0xF3,0x00,0xC0,0xF1,0x1F,0xE0,0xF1,0x1F,0xE0,0xF0,0x1F,0xE0,0xF0,0x00,0x70,0xF0,0x00,0x70,0xF0,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x00,0xFC,0xFF,0x00,0x1C,0xF0,0x00,0x1C,0xF0,0x00,0x0E,0xF0,0x7F,0x0E,0xF0,0x7F,0x0F,0xF0,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x92
-{0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0xC3,0x03,0xE0,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x93
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0x83,0x03,0x80,0x83,0x03,0x80,0x83,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x94
-{0x00,0x00,0x00,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x95
-{0x00,0x00,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0xC3,0x03,0xE0,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0x78,0xC0,0x0F,0x78,0xE0,0x0F,0xF8,0x70,0x0F,0xF0,0x7F,0x0F,0xE0,0x1F,0x0F,0xC0,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x96
-{0x00,0x00,0x00,0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0x78,0xC0,0x0F,0x78,0xE0,0x0F,0xF8,0x70,0x0F,0xF0,0x7F,0x0F,0xE0,0x1F,0x0F,0xC0,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x97
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x07,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x78,0x3C,0x00,0x38,0x7C,0x00,0x3C,0x78,0x00,0x1C,0x78,0x00,0x1E,0xF8,0x00,0x0E,0xF0,0x00,0x0F,0xF0,0x01,0x0F,0xE0,0x81,0x07,0xE0,0x83,0x07,0xC0,0xC3,0x03,0xC0,0xC7,0x03,0x80,0xE7,0x01,0x80,0xE7,0x01,0x00,0xEF,0x00,0x00,0xFF,0x00,0x00,0x7F,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0xFC,0x03,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00}, // 0x98
-{0xC0,0x01,0x07,0xC0,0x01,0x07,0xC0,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x99
-{0x80,0x03,0x0E,0x80,0x03,0x0E,0x80,0x03,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0xF0,0x00,0x1E,0xF0,0x00,0x1F,0xE0,0x83,0x0F,0xE0,0xFF,0x0F,0x80,0xFF,0x03,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x9A
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x38,0xC0,0xFF,0x1F,0xE0,0xFF,0x0F,0xF0,0xC1,0x0F,0xF8,0x00,0x1F,0x78,0x80,0x1F,0x78,0xC0,0x1F,0x3C,0xE0,0x3C,0x3C,0x70,0x3C,0x3C,0x38,0x3C,0x3C,0x3C,0x3C,0x3C,0x1C,0x3C,0x3C,0x0E,0x3C,0x3C,0x07,0x3C,0xF8,0x03,0x1E,0xF8,0x01,0x1E,0xF8,0x00,0x1F,0xF0,0x83,0x0F,0xF0,0xFF,0x07,0xF8,0xFF,0x03,0x1C,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x9B
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xE0,0x1F,0x00,0xF0,0x1F,0x00,0xF8,0x1F,0x00,0x3C,0x10,0x00,0x3C,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0xC0,0xFF,0x01,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xE0,0xFF,0x1F,0xE0,0xFF,0x1F,0xE0,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x9C
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x70,0xC0,0xFF,0x3B,0xE0,0xFF,0x1F,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1F,0x3C,0x80,0x3F,0x3C,0xC0,0x3F,0x1E,0xC0,0x79,0x1E,0xE0,0x78,0x1E,0x70,0x78,0x1E,0x38,0x78,0x1E,0x3C,0x78,0x1E,0x1C,0x78,0x1E,0x0E,0x78,0x1E,0x07,0x78,0x9E,0x03,0x78,0xFC,0x03,0x3C,0xFC,0x01,0x3C,0xF8,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xF8,0xFF,0x07,0xDC,0xFF,0x03,0x0E,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x9D
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x08,0x1C,0x00,0x1C,0x3E,0x00,0x3E,0x7C,0x00,0x1F,0xF8,0x80,0x0F,0xF0,0xC1,0x07,0xE0,0xE3,0x03,0xC0,0xF7,0x01,0x80,0xFF,0x00,0x00,0x7F,0x00,0x00,0x3E,0x00,0x00,0x7F,0x00,0x80,0xFF,0x00,0xC0,0xF7,0x01,0xE0,0xE3,0x03,0xF0,0xC1,0x07,0xF8,0x80,0x0F,0x7C,0x00,0x1F,0x3E,0x00,0x3E,0x1C,0x00,0x1C,0x08,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0x9E
-{0x00,0x00,0x00,0x00,0xE0,0x0F,0x00,0xF8,0x1F,0x00,0xFC,0x1F,0x00,0x3C,0x10,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0xE0,0xFF,0x07,0xE0,0xFF,0x07,0xE0,0xFF,0x07,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x00,0x1E,0x00,0x02,0x0F,0x00,0xFE,0x0F,0x00,0xFE,0x07,0x00,0xFC,0x01,0x00}, // 0x9F
-{0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xFF,0x07,0xE0,0x80,0x0F,0x20,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0xFE,0x0F,0x80,0xFF,0x0F,0xE0,0xFF,0x0F,0xF0,0x03,0x0F,0xF0,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0xF8,0xE1,0x1F,0xF0,0xFF,0xFE,0xE0,0x7F,0xFE,0x80,0x1F,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xA0
-{0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xA1
-{0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xA2
-{0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0x78,0xC0,0x0F,0x78,0xE0,0x0F,0xF8,0x70,0x0F,0xF0,0x7F,0x0F,0xE0,0x1F,0x0F,0xC0,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xA3
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x06,0x80,0x3F,0x06,0xC0,0xFF,0x07,0xC0,0xF8,0x03,0xC0,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xE0,0x07,0xF0,0xF8,0x0F,0xF0,0xFC,0x1F,0xF0,0x0E,0x1E,0xF0,0x07,0x3E,0xF0,0x03,0x3C,0xF0,0x01,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xA4
-{0x00,0x0F,0x06,0x80,0x3F,0x07,0xC0,0xF9,0x03,0xC0,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x1C,0x78,0x00,0x1C,0xF8,0x00,0x1C,0xF8,0x01,0x1C,0xF8,0x01,0x1C,0xF8,0x03,0x1C,0xF8,0x07,0x1C,0xB8,0x07,0x1C,0xB8,0x0F,0x1C,0x38,0x1F,0x1C,0x38,0x1F,0x1C,0x38,0x3E,0x1C,0x38,0x3C,0x1C,0x38,0x7C,0x1C,0x38,0xF8,0x1C,0x38,0xF0,0x1C,0x38,0xF0,0x1D,0x38,0xE0,0x1F,0x38,0xE0,0x1F,0x38,0xC0,0x1F,0x38,0x80,0x1F,0x38,0x80,0x1F,0x38,0x00,0x1F,0x38,0x00,0x1E,0x38,0x00,0x1E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xA5
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0xC0,0xFF,0x01,0xC0,0xC1,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xFE,0x03,0x80,0xFF,0x03,0xC0,0x83,0x03,0xE0,0x80,0x03,0xE0,0x80,0x03,0xE0,0x80,0x03,0xE0,0xE1,0x03,0xC0,0x3F,0x0F,0x80,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xA6
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0xC0,0xFF,0x01,0xE0,0xC1,0x03,0xE0,0x80,0x03,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0x70,0x00,0x07,0xE0,0x80,0x03,0xE0,0xC1,0x03,0xC0,0xFF,0x01,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xA7
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x3E,0x00,0x00,0x1F,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x1C,0x78,0x00,0x1C,0xF8,0x00,0x1C,0xF0,0x03,0x1C,0xF0,0xFF,0x1F,0xC0,0xFF,0x1F,0x00,0xFF,0x03}, // 0xA8
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x80,0xFF,0x00,0xE0,0xC1,0x03,0x60,0x3F,0x03,0x30,0x63,0x06,0x30,0x63,0x06,0x18,0x63,0x0C,0x18,0x33,0x0C,0x18,0x1F,0x0C,0x18,0x13,0x0C,0x18,0x33,0x0C,0x30,0x33,0x06,0x30,0x63,0x06,0x60,0x00,0x03,0xE0,0xC1,0x03,0x80,0xFF,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xA9
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xAA
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x07,0x3F,0x80,0x03,0x3F,0x80,0x03,0x38,0xC0,0x01,0x38,0xC0,0x01,0x38,0xE0,0x00,0x38,0xE0,0x00,0x38,0x70,0x00,0x38,0x38,0x00,0x38,0x38,0x00,0x38,0x1C,0x00,0x38,0x1C,0x00,0x38,0x0E,0x00,0x38,0x0E,0x00,0x38,0x87,0x1F,0x00,0xC7,0x7F,0x80,0x43,0xF0,0x80,0x03,0xE0,0xC0,0x01,0xE0,0xC0,0x01,0xE0,0xE0,0x00,0x70,0xE0,0x00,0x3C,0x70,0x00,0x1E,0x38,0x00,0x07,0x38,0x80,0x03,0x1C,0xC0,0x01,0x1C,0xC0,0xFF,0x0E,0xC0,0xFF,0x0E,0xC0,0xFF,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xAB
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x0E,0x3F,0x00,0x07,0x3F,0x00,0x07,0x38,0x80,0x03,0x38,0x80,0x03,0x38,0xC0,0x01,0x38,0xC0,0x01,0x38,0xE0,0x00,0x38,0x70,0x00,0x38,0x70,0x00,0x38,0x38,0x00,0x38,0x38,0x00,0x38,0x1C,0x00,0x38,0x1C,0x00,0x38,0x0E,0x1E,0x00,0x0E,0x1F,0x00,0x07,0x1F,0x00,0x87,0x1D,0x80,0xC3,0x1C,0x80,0xE3,0x1C,0xC0,0x71,0x1C,0xC0,0x31,0x1C,0xE0,0x18,0x1C,0x70,0xF8,0x7F,0x70,0xF8,0x7F,0x38,0x00,0x1C,0x38,0x00,0x1C,0x1C,0x00,0x1C,0x1C,0x00,0x1C,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xAC
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00}, // 0xAD
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x04,0x04,0x00,0x0E,0x0E,0x00,0x07,0x07,0x80,0x83,0x03,0xC0,0xC1,0x01,0xE0,0xE0,0x00,0x70,0x70,0x00,0x38,0x38,0x00,0x1C,0x1C,0x00,0x38,0x38,0x00,0x70,0x70,0x00,0xE0,0xE0,0x00,0xC0,0xC1,0x01,0x80,0x83,0x03,0x00,0x07,0x07,0x00,0x0E,0x0E,0x00,0x04,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xAE
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x10,0x00,0x1C,0x38,0x00,0x78,0x70,0x00,0xF0,0xE0,0x00,0xE0,0xC1,0x01,0xC0,0x83,0x03,0x80,0x07,0x07,0x00,0x0E,0x0E,0x00,0x1E,0x1C,0x00,0x0F,0x0E,0x80,0x07,0x07,0xC0,0x83,0x03,0xE0,0xC1,0x01,0xF0,0xE0,0x00,0x78,0x70,0x00,0x3C,0x38,0x00,0x08,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xAF
-{0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xB0
-{0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0xF0,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F}, // 0xB1
-{0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F,0x0F}, // 0xB2
-{0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00}, // 0xB3
-{0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0xFF,0x3F,0x00,0xFF,0x3F,0x00,0xFF,0x3F,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00}, // 0xB4
-{0x00,0xF0,0x00,0x00,0x78,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xF7,0x00,0x00,0xF7,0x00,0x80,0xE7,0x01,0x80,0xE3,0x01,0x80,0xE3,0x01,0xC0,0xC3,0x03,0xC0,0xC1,0x03,0xE0,0x81,0x07,0xE0,0x81,0x07,0xE0,0x80,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x0F,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xB5
-{0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0x81,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xF7,0x00,0x00,0xF7,0x00,0x80,0xE7,0x01,0x80,0xE3,0x01,0x80,0xE3,0x01,0xC0,0xC3,0x03,0xC0,0xC1,0x03,0xE0,0x81,0x07,0xE0,0x81,0x07,0xE0,0x80,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x0F,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xB6
-{0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xF7,0x00,0x00,0xF7,0x00,0x80,0xE7,0x01,0x80,0xE3,0x01,0x80,0xE3,0x01,0xC0,0xC3,0x03,0xC0,0xC1,0x03,0xE0,0x81,0x07,0xE0,0x81,0x07,0xE0,0x80,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x0F,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xB7
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0xC0,0xFF,0x01,0xE0,0x80,0x03,0x70,0x00,0x07,0x38,0x00,0x0E,0x18,0x00,0x0C,0x0C,0x00,0x18,0x0C,0xFC,0x18,0x0C,0xFF,0x19,0x86,0xFF,0x31,0xC6,0x83,0x31,0xC6,0x01,0x30,0xE6,0x00,0x30,0xE6,0x00,0x30,0xE6,0x00,0x30,0xE6,0x00,0x30,0xE6,0x00,0x30,0xE6,0x01,0x30,0xC6,0x01,0x30,0xC6,0x07,0x31,0x86,0xFF,0x31,0x0C,0xFF,0x19,0x0C,0x7E,0x18,0x0C,0x00,0x18,0x18,0x00,0x0C,0x38,0x00,0x0E,0x70,0x00,0x07,0xE0,0x80,0x03,0xC0,0xFF,0x01,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xB8
-{0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0xFF,0xC7,0x01,0xFF,0xC7,0x01,0xFF,0xC7,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0xFF,0xC7,0x01,0xFF,0xC7,0x01,0xFF,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01}, // 0xB9
-{0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01}, // 0xBA
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0xFF,0xC7,0x01,0xFF,0xC7,0x01,0xFF,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01}, // 0xBB
-{0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0xFF,0xC7,0x01,0xFF,0xC7,0x01,0xFF,0xC7,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0x00,0xC0,0x01,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0xFF,0xFF,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xBC
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0xFC,0x01,0x00,0xFF,0x07,0x80,0xFF,0x07,0xC0,0x37,0x07,0xE0,0x31,0x00,0xF0,0x30,0x00,0xF0,0x30,0x00,0xF8,0x30,0x00,0x78,0x30,0x00,0x78,0x30,0x00,0x78,0x30,0x00,0x78,0x30,0x00,0x78,0x30,0x00,0x78,0x30,0x00,0x78,0x30,0x00,0xF8,0x30,0x00,0xF0,0x30,0x00,0xF0,0x31,0x00,0xE0,0x33,0x00,0xE0,0x3F,0x06,0xC0,0xFF,0x07,0x00,0xFF,0x07,0x00,0xFC,0x01,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xBD
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0xF0,0x7C,0x00,0x70,0x78,0x00,0x38,0xF8,0x00,0x3C,0xF0,0x00,0x1E,0xE0,0x01,0x0E,0xE0,0x03,0x07,0xC0,0x83,0x07,0xC0,0x87,0x03,0x80,0xCF,0x01,0x00,0xEF,0x01,0x00,0xFF,0x00,0x00,0x7E,0x00,0x00,0x7C,0x00,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xBE
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x3F,0x00,0xFF,0x3F,0x00,0xFF,0x3F,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00}, // 0xBF
-{0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xC0
-{0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xC1
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00}, // 0xC2
-{0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00}, // 0xC3
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xC4
-{0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00}, // 0xC5
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x06,0x80,0x3F,0x06,0xC0,0xFF,0x07,0xC0,0xF8,0x03,0xC0,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x01,0xE0,0xFF,0x03,0xE0,0xFF,0x07,0xE0,0x80,0x0F,0x20,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0x00,0x0F,0x00,0xFE,0x0F,0x80,0xFF,0x0F,0xE0,0xFF,0x0F,0xF0,0x03,0x0F,0xF0,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x00,0x0F,0x78,0x80,0x0F,0xF8,0xE1,0x1F,0xF0,0xFF,0xFE,0xE0,0x7F,0xFE,0x80,0x1F,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xC6
-{0x00,0x0F,0x06,0x80,0x3F,0x07,0xC0,0xF9,0x03,0xC0,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0xF7,0x00,0x00,0xF7,0x00,0x80,0xE7,0x01,0x80,0xE3,0x01,0x80,0xE3,0x01,0xC0,0xC3,0x03,0xC0,0xC1,0x03,0xE0,0x81,0x07,0xE0,0x81,0x07,0xE0,0x80,0x07,0xF0,0x00,0x0F,0xF0,0x00,0x0F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3E,0x00,0x7C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x0F,0x00,0xF8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xC7
-{0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0xFF,0x00,0xC7,0xFF,0x00,0xC7,0xFF,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xC8
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0xFF,0xFF,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0xC7,0xFF,0x00,0xC7,0xFF,0x00,0xC7,0xFF,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01}, // 0xC9
-{0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xCA
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01}, // 0xCB
-{0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0xFF,0x00,0xC7,0xFF,0x00,0xC7,0xFF,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0x07,0x00,0x00,0xC7,0xFF,0x00,0xC7,0xFF,0x00,0xC7,0xFF,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01}, // 0xCC
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xCD
-{0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0xFF,0xC7,0xFF,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01,0x00,0xC7,0x01}, // 0xCE
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x10,0x00,0x10,0x38,0x00,0x38,0x70,0x7C,0x1C,0xE0,0xFF,0x0F,0xC0,0xFF,0x07,0xC0,0x83,0x07,0xC0,0x01,0x07,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xE0,0x00,0x0E,0xC0,0x01,0x07,0xC0,0x83,0x07,0xC0,0xFF,0x07,0xE0,0xFF,0x0F,0x70,0x7C,0x1C,0x38,0x00,0x38,0x10,0x00,0x10,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xCF
-{0x00,0x00,0x00,0x7C,0x40,0x00,0xFC,0xF3,0x00,0xFC,0x7F,0x00,0xE0,0x3F,0x00,0x00,0x3F,0x00,0x80,0x7F,0x00,0xE0,0xFB,0x01,0xE0,0xF0,0x01,0x60,0xE0,0x03,0x00,0xC0,0x07,0x00,0xFF,0x0F,0xC0,0xFF,0x0F,0xE0,0xFF,0x1F,0xF0,0x83,0x1F,0xF0,0x00,0x1F,0x78,0x00,0x3E,0x78,0x00,0x3E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF0,0x00,0x0F,0xF0,0xC3,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x01,0x00,0x7E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xD0
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0xF8,0xFF,0x03,0xF8,0xFF,0x07,0x78,0xC0,0x0F,0x78,0x00,0x1F,0x78,0x00,0x3E,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x78,0x78,0x00,0x78,0xFF,0x0F,0x78,0xFF,0x0F,0x78,0xFF,0x0F,0x78,0x78,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x78,0x78,0x00,0x38,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x1E,0x78,0x00,0x1F,0x78,0xE0,0x0F,0xF8,0xFF,0x07,0xF8,0xFF,0x01,0xF8,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xD1
-{0x00,0xFC,0x00,0x00,0xFE,0x01,0x00,0xCF,0x03,0x80,0x03,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x3F,0xF0,0xFF,0x3F,0xF0,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xD2
-{0x80,0x03,0x0E,0x80,0x03,0x0E,0x80,0x03,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x3F,0xF0,0xFF,0x3F,0xF0,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xD3
-{0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0xFF,0x1F,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0xFF,0x07,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x3F,0xF0,0xFF,0x3F,0xF0,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xD4
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0xF8,0x7F,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xD5
-{0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xD6
-{0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0x81,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xD7
-{0xC0,0x01,0x07,0xC0,0x01,0x07,0xC0,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xD8
-{0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0xFF,0x3F,0x00,0xFF,0x3F,0x00,0xFF,0x3F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xD9
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x00,0xF8,0xFF,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00}, // 0xDA
-{0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF}, // 0xDB
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF}, // 0xDC
-{0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xDD
-{0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0xF8,0xFF,0x1F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xDE
-{0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xDF
-{0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xE0
-{0x00,0x00,0x00,0x80,0x3F,0x00,0xE0,0xFF,0x00,0xF0,0xFF,0x01,0xF0,0xE1,0x03,0xF8,0xC0,0x03,0x78,0xC0,0x03,0x78,0xC0,0x03,0x78,0xC0,0x01,0x78,0xE0,0x01,0x78,0xF0,0x00,0x78,0xF0,0x00,0x78,0x78,0x00,0x78,0x3C,0x00,0x78,0x3C,0x00,0x78,0x3C,0x00,0x78,0x7C,0x00,0x78,0xF8,0x00,0x78,0xF8,0x01,0x78,0xF0,0x07,0x78,0xE0,0x0F,0x78,0x80,0x0F,0x78,0x00,0x1F,0x78,0x00,0x3E,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x0E,0x1E,0x78,0xFE,0x1F,0x78,0xFE,0x0F,0x78,0xF8,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xE1
-{0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0x81,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xE2
-{0xC0,0x03,0x00,0x80,0x07,0x00,0x00,0x0E,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xE3
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0F,0x06,0x80,0x3F,0x06,0xC0,0xFF,0x07,0xC0,0xF8,0x03,0xC0,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xE4
-{0x00,0x0F,0x06,0x80,0x3F,0x07,0xC0,0xF9,0x03,0xC0,0xE0,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x03,0xE0,0xFF,0x07,0xF0,0x81,0x0F,0xF8,0x00,0x1F,0x78,0x00,0x1E,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x1E,0x00,0x78,0x3C,0x00,0x3C,0x3C,0x00,0x3C,0x78,0x00,0x1E,0xF8,0x00,0x1F,0xF0,0x81,0x0F,0xE0,0xFF,0x07,0xC0,0xFF,0x03,0x00,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xE5
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x00,0x1F,0xF0,0x01,0x1F,0xF0,0x81,0x1F,0xF0,0xC7,0x1F,0xF0,0xFF,0x1E,0xF0,0x7E,0x3E,0xF0,0x3C,0x3C,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00}, // 0xE6
-{0x00,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xF0,0x01,0xF0,0xFC,0x07,0xF0,0xFE,0x0F,0xF0,0x0E,0x1F,0xF0,0x03,0x1E,0xF0,0x01,0x1E,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x1E,0xF0,0x00,0x1E,0xF0,0x01,0x1F,0xF0,0x87,0x0F,0xF0,0xFF,0x07,0xF0,0xFE,0x03,0xF0,0xF8,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00}, // 0xE7
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0xFF,0x03,0xF0,0xFF,0x0F,0xF0,0xFF,0x1F,0xF0,0x00,0x1F,0xF0,0x00,0x3E,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3C,0xF0,0x00,0x3E,0xF0,0x00,0x1F,0xF0,0xC0,0x0F,0xF0,0xFF,0x07,0xF0,0xFF,0x03,0xF0,0x7F,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0xF0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xE8
-{0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0xF0,0x00,0x1E,0xF0,0x00,0x1F,0xE0,0x83,0x0F,0xE0,0xFF,0x0F,0x80,0xFF,0x03,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xE9
-{0x00,0x7E,0x00,0x00,0xFF,0x00,0x80,0xE7,0x01,0xC0,0x81,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0xF0,0x00,0x1E,0xF0,0x00,0x1F,0xE0,0x83,0x0F,0xE0,0xFF,0x0F,0x80,0xFF,0x03,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xEA
-{0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x1C,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0x78,0x00,0x3C,0xF0,0x00,0x1E,0xF0,0x00,0x1F,0xE0,0x83,0x0F,0xE0,0xFF,0x0F,0x80,0xFF,0x03,0x00,0xFE,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xEB
-{0x00,0x00,0x00,0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x70,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x78,0x3C,0x00,0x38,0x7C,0x00,0x3C,0x78,0x00,0x1C,0x78,0x00,0x1E,0xF8,0x00,0x0E,0xF0,0x00,0x0F,0xF0,0x01,0x0F,0xE0,0x81,0x07,0xE0,0x83,0x07,0xC0,0xC3,0x03,0xC0,0xC7,0x03,0x80,0xE7,0x01,0x80,0xE7,0x01,0x00,0xEF,0x00,0x00,0xFF,0x00,0x00,0x7F,0x00,0x00,0x7E,0x00,0x00,0x7E,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x1C,0x00,0x00,0x1E,0x00,0x00,0x0E,0x00,0x00,0x0F,0x00,0x80,0x07,0x00,0xFC,0x03,0x00,0xFC,0x01,0x00,0xFC,0x00,0x00}, // 0xEC
-{0x00,0xE0,0x01,0x00,0xF0,0x00,0x00,0x38,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0xF0,0x3C,0x00,0x78,0x78,0x00,0x38,0xF8,0x00,0x3C,0xF0,0x00,0x1C,0xE0,0x01,0x1E,0xE0,0x03,0x0F,0xC0,0x07,0x07,0x80,0x87,0x07,0x80,0x8F,0x03,0x00,0xDF,0x03,0x00,0xFE,0x01,0x00,0xFE,0x00,0x00,0xFC,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xED
-{0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xEE
-{0x00,0x78,0x00,0x00,0x3C,0x00,0x00,0x0E,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xEF
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0xF0,0xFF,0x0F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xF0
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xF1
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0xFF,0xFF,0xFF,0xFF,0xFF}, // 0xF2
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0x01,0xE0,0xFE,0x03,0x70,0x82,0x07,0x38,0x00,0x07,0x38,0x00,0x07,0x1C,0x80,0x03,0x0E,0xF8,0x01,0x0E,0xF8,0x00,0x07,0xE0,0x83,0x03,0x80,0x87,0x03,0x00,0xC7,0x01,0x00,0xE7,0x00,0x82,0xE7,0x00,0xFE,0x73,0x00,0xFE,0x38,0x3C,0x00,0x38,0x3E,0x00,0x1C,0x3E,0x00,0x0E,0x3B,0x00,0x8E,0x39,0x00,0xC7,0x39,0x80,0xE3,0x38,0x80,0x63,0x38,0xC0,0x31,0x38,0xE0,0xF0,0xFF,0xE0,0xF0,0xFF,0x70,0x00,0x38,0x38,0x00,0x38,0x38,0x00,0x38,0x1C,0x00,0x38,0x0E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xF3
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x80,0xFF,0x07,0xE0,0xFF,0x07,0xF0,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF8,0x0F,0x06,0xF0,0x0F,0x06,0xF0,0x0F,0x06,0xE0,0x0F,0x06,0xC0,0x0F,0x06,0x00,0x0F,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x0C,0x06,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xF4
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0x03,0x00,0xFF,0x07,0x80,0xFF,0x07,0xC0,0x03,0x06,0xE0,0x01,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0xE0,0x03,0x00,0xC0,0x07,0x00,0x80,0x3F,0x00,0x80,0xFF,0x00,0x80,0xFF,0x01,0xC0,0xF1,0x03,0xC0,0xC0,0x07,0xE0,0x80,0x0F,0xE0,0x00,0x0F,0xE0,0x00,0x0E,0xE0,0x01,0x0E,0xC0,0x07,0x0E,0xC0,0x0F,0x07,0x80,0x7F,0x07,0x00,0xFE,0x03,0x00,0xF8,0x03,0x00,0xE0,0x07,0x00,0x80,0x07,0x00,0x00,0x0F,0x00,0x00,0x0E,0x00,0x00,0x0E,0x00,0x00,0x0E,0x20,0x00,0x0F,0xE0,0x81,0x07,0xE0,0xFF,0x03,0xE0,0xFF,0x01,0x00,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xF5
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0xFC,0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x3C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xF6
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x0C,0x00,0x00,0x3C,0x00,0x00,0x70,0x00,0x00,0xE0,0x00,0x00,0xE0,0x00,0x00,0x7E,0x00,0x00,0x3E,0x00}, // 0xF7
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3E,0x00,0x00,0x7F,0x00,0x80,0xE3,0x00,0x80,0xC1,0x00,0x80,0xC1,0x00,0x80,0xC1,0x00,0x80,0xE3,0x00,0x00,0x7F,0x00,0x00,0x3E,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xF8
-{0xC0,0x01,0x07,0xC0,0x01,0x07,0xC0,0x01,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xF9
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x7C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xFA
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1F,0x00,0xC0,0x1F,0x00,0xC0,0x1F,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x1C,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xFB
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFF,0x00,0xC0,0xFF,0x01,0xC0,0xC1,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xE0,0x01,0x00,0xFF,0x00,0x00,0x7F,0x00,0x00,0xE0,0x01,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0xC0,0xC1,0x03,0xC0,0xFF,0x01,0x80,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xFC
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7F,0x00,0xC0,0xFF,0x01,0xC0,0xC0,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0x80,0x03,0x00,0xC0,0x01,0x00,0xF0,0x00,0x00,0x7C,0x00,0x00,0x1E,0x00,0x80,0x07,0x00,0xC0,0x03,0x00,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0xC0,0xFF,0x03,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xFD
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0xFE,0xFF,0x7F,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}, // 0xFE
-{0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00}  // 0xFF
+static __UG_FONT_DATA unsigned char font_24x40[] = {
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F, // 0x0 ' '
+  0x3F,0x3F,0x3F,0x3F,0x10,0x45,0x0E,0x4B,0x0A,0x43,0x05,0x43,0x08,0x42,0x09,0x42,0x06,0x42,0x0B,0x42,0x04,0x42,0x0D,0x42,0x03,0x41,0x02,0x42,0x03,0x42,0x02,0x41,0x02,0x42,0x02,0x42,0x03,0x42,0x02,0x42,0x01,0x41,0x03,0x42,0x03,0x42,0x03,0x41,0x01,0x41,0x11,0x41,0x01,0x41,0x11,0x41,0x01,0x41,0x01,0x41,0x09,0x41,0x01,0x41,0x01,0x41,0x02,0x40,0x09,0x40,0x02,0x41,0x01,0x42,0x01,0x41,0x07,0x41,0x01,0x42,0x02,0x41,0x02,0x41,0x05,0x41,0x02,0x41,0x03,0x42,0x02,0x47,0x02,0x42,0x04,0x42,0x02,0x45,0x02,0x42,0x06,0x42,0x09,0x42,0x08,0x43,0x05,0x43,0x0A,0x4B,0x0E,0x45,0x3F,0x3F,0x3F,0x08, // 0x1 ' '
+  0x3F,0x3F,0x3F,0x3F,0x10,0x45,0x0E,0x4B,0x0A,0x4D,0x08,0x4F,0x06,0x51,0x04,0x53,0x03,0x44,0x02,0x43,0x02,0x44,0x02,0x45,0x02,0x43,0x02,0x45,0x01,0x45,0x02,0x43,0x02,0x45,0x01,0x55,0x01,0x55,0x01,0x43,0x01,0x49,0x01,0x43,0x01,0x44,0x00,0x49,0x00,0x44,0x01,0x44,0x01,0x47,0x01,0x44,0x02,0x44,0x01,0x45,0x01,0x44,0x03,0x45,0x07,0x45,0x04,0x45,0x05,0x45,0x06,0x4F,0x08,0x4D,0x0A,0x4B,0x0E,0x45,0x3F,0x3F,0x3F,0x08, // 0x2 ' '
+  0x3F,0x0B,0x43,0x07,0x43,0x05,0x47,0x03,0x47,0x03,0x48,0x01,0x48,0x02,0x49,0x01,0x49,0x01,0x55,0x00,0x7F,0x7F,0x67,0x00,0x55,0x01,0x55,0x01,0x55,0x02,0x53,0x03,0x53,0x04,0x51,0x05,0x51,0x06,0x4F,0x07,0x4F,0x08,0x4D,0x0A,0x4B,0x0B,0x4B,0x0C,0x49,0x0E,0x47,0x10,0x45,0x12,0x43,0x14,0x41,0x3F,0x3F,0x3F,0x0A, // 0x3 ' '
+  0x3F,0x13,0x40,0x16,0x40,0x15,0x42,0x13,0x44,0x11,0x45,0x11,0x46,0x0F,0x48,0x0D,0x49,0x0C,0x4B,0x0A,0x4D,0x08,0x4F,0x06,0x51,0x04,0x53,0x02,0x55,0x00,0x57,0x00,0x55,0x02,0x53,0x04,0x51,0x06,0x4F,0x08,0x4D,0x0A,0x4B,0x0C,0x4A,0x0D,0x48,0x0F,0x46,0x10,0x45,0x12,0x44,0x13,0x42,0x14,0x41,0x16,0x40,0x3F,0x3F,0x3F,0x0A, // 0x4 ' '
+  0x3F,0x10,0x45,0x10,0x47,0x0E,0x49,0x0C,0x4B,0x0B,0x4B,0x0B,0x4B,0x0B,0x4B,0x0B,0x4B,0x0C,0x49,0x0D,0x49,0x09,0x51,0x04,0x53,0x02,0x55,0x00,0x7F,0x77,0x00,0x48,0x00,0x41,0x00,0x48,0x02,0x46,0x01,0x41,0x01,0x46,0x04,0x44,0x01,0x43,0x01,0x44,0x0C,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x45,0x11,0x45,0x11,0x45,0x3F,0x3F,0x3F,0x08, // 0x5 ' '
+  0x3F,0x12,0x40,0x16,0x41,0x14,0x42,0x13,0x44,0x11,0x46,0x10,0x47,0x0E,0x49,0x0C,0x4A,0x0B,0x4C,0x09,0x4E,0x07,0x51,0x04,0x53,0x03,0x53,0x02,0x55,0x00,0x7F,0x77,0x00,0x48,0x00,0x41,0x00,0x48,0x02,0x46,0x01,0x41,0x01,0x46,0x04,0x43,0x02,0x43,0x02,0x43,0x0C,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x45,0x11,0x45,0x11,0x45,0x3F,0x3F,0x3F,0x08, // 0x6 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F, // 0x7 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F, // 0x8 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F, // 0x9 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F, // 0xA ' '
+  0x3F,0x1A,0x41,0x11,0x46,0x0D,0x49,0x0C,0x4A,0x0C,0x43,0x01,0x44,0x11,0x42,0x00,0x42,0x0F,0x43,0x00,0x42,0x0F,0x42,0x01,0x42,0x0E,0x43,0x01,0x43,0x0D,0x42,0x03,0x42,0x05,0x49,0x04,0x40,0x05,0x4B,0x0A,0x4C,0x09,0x44,0x04,0x44,0x07,0x43,0x08,0x43,0x06,0x42,0x0A,0x42,0x05,0x43,0x0A,0x43,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x43,0x0A,0x43,0x05,0x42,0x0A,0x42,0x06,0x43,0x08,0x43,0x07,0x44,0x04,0x44,0x09,0x4C,0x0B,0x4A,0x0E,0x46,0x3F,0x3F,0x3F,0x0A, // 0xB ' '
+  0x3F,0x0F,0x46,0x0E,0x4A,0x0B,0x4C,0x09,0x44,0x04,0x44,0x07,0x43,0x08,0x43,0x06,0x42,0x0A,0x42,0x05,0x43,0x0A,0x43,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x43,0x0A,0x43,0x05,0x42,0x0A,0x42,0x06,0x43,0x08,0x43,0x07,0x44,0x04,0x44,0x09,0x4C,0x0B,0x4A,0x0E,0x46,0x12,0x42,0x14,0x42,0x14,0x42,0x0F,0x4C,0x0A,0x4C,0x0A,0x4C,0x0F,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x3F,0x3F,0x3F,0x0A, // 0xC ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F, // 0xD ' '
+  0x3F,0x1C,0x40,0x14,0x42,0x12,0x44,0x10,0x46,0x0E,0x48,0x0B,0x48,0x00,0x41,0x09,0x48,0x02,0x41,0x09,0x46,0x04,0x41,0x09,0x44,0x06,0x41,0x09,0x42,0x08,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x09,0x41,0x04,0x46,0x09,0x41,0x02,0x48,0x09,0x41,0x02,0x48,0x09,0x41,0x01,0x48,0x0A,0x41,0x01,0x48,0x0A,0x41,0x01,0x47,0x0B,0x41,0x02,0x44,0x08,0x46,0x0E,0x48,0x0E,0x47,0x0E,0x48,0x0E,0x47,0x0F,0x47,0x10,0x44,0x3F,0x01, // 0xE ' '
+  0x3F,0x3F,0x3F,0x0A,0x42,0x14,0x42,0x0D,0x41,0x04,0x42,0x03,0x41,0x06,0x43,0x01,0x46,0x01,0x42,0x06,0x50,0x07,0x4E,0x08,0x44,0x03,0x44,0x09,0x42,0x07,0x43,0x07,0x43,0x07,0x43,0x04,0x45,0x09,0x45,0x01,0x45,0x09,0x45,0x01,0x45,0x09,0x45,0x04,0x43,0x07,0x43,0x08,0x42,0x07,0x43,0x08,0x44,0x03,0x44,0x09,0x4D,0x08,0x50,0x05,0x43,0x01,0x46,0x00,0x43,0x06,0x41,0x04,0x42,0x03,0x41,0x0E,0x42,0x14,0x42,0x3F,0x3F,0x3F,0x3F,0x11, // 0xF ' '
+  0x3F,0x3F,0x3F,0x18,0x40,0x16,0x42,0x14,0x44,0x12,0x46,0x10,0x48,0x0E,0x4A,0x0C,0x4B,0x0B,0x4D,0x09,0x4F,0x07,0x51,0x05,0x53,0x03,0x55,0x01,0x53,0x03,0x51,0x05,0x4F,0x07,0x4D,0x09,0x4B,0x0B,0x4A,0x0C,0x48,0x0E,0x46,0x10,0x44,0x12,0x42,0x14,0x40,0x3F,0x3F,0x3F,0x15, // 0x10 ' '
+  0x3F,0x3F,0x3F,0x2D,0x40,0x14,0x42,0x12,0x44,0x10,0x46,0x0E,0x48,0x0C,0x4A,0x0B,0x4B,0x09,0x4D,0x07,0x4F,0x05,0x51,0x03,0x53,0x01,0x55,0x03,0x53,0x05,0x51,0x07,0x4F,0x09,0x4D,0x0B,0x4B,0x0C,0x4A,0x0E,0x48,0x10,0x46,0x12,0x44,0x14,0x42,0x16,0x40,0x3F,0x3F,0x3F,0x00, // 0x11 ' '
+  0x3F,0x13,0x40,0x15,0x42,0x14,0x42,0x13,0x44,0x11,0x46,0x0F,0x48,0x0D,0x42,0x00,0x42,0x00,0x42,0x0C,0x40,0x02,0x42,0x02,0x40,0x10,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x10,0x40,0x02,0x42,0x02,0x40,0x0C,0x42,0x00,0x42,0x00,0x42,0x0D,0x48,0x0F,0x46,0x11,0x44,0x13,0x42,0x14,0x42,0x15,0x40,0x3A, // 0x12 ' '
+  0x3F,0x0D,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x3F,0x2A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x3F,0x3F,0x3F,0x04, // 0x13 ' '
+  0x3F,0x0E,0x4B,0x09,0x4D,0x08,0x47,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x08,0x47,0x04,0x41,0x08,0x47,0x04,0x41,0x09,0x46,0x04,0x41,0x0A,0x45,0x04,0x41,0x0C,0x43,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x34, // 0x14 ' '
+  0x3F,0x11,0x47,0x0D,0x4A,0x0B,0x4B,0x0A,0x43,0x06,0x41,0x09,0x43,0x13,0x42,0x14,0x42,0x14,0x42,0x14,0x44,0x13,0x44,0x13,0x46,0x10,0x48,0x0E,0x49,0x0C,0x42,0x02,0x45,0x0B,0x41,0x05,0x44,0x09,0x42,0x06,0x44,0x08,0x42,0x07,0x43,0x08,0x42,0x08,0x42,0x08,0x43,0x07,0x42,0x09,0x44,0x05,0x42,0x09,0x45,0x03,0x42,0x0B,0x47,0x00,0x42,0x0D,0x48,0x10,0x46,0x12,0x45,0x13,0x43,0x14,0x43,0x14,0x42,0x14,0x42,0x14,0x42,0x08,0x40,0x09,0x43,0x08,0x43,0x05,0x43,0x09,0x4C,0x0A,0x4B,0x0E,0x46,0x38, // 0x15 ' '
+  0x3F,0x3F,0x3F,0x3F,0x38,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x20, // 0x16 ' '
+  0x23,0x40,0x15,0x42,0x14,0x42,0x13,0x44,0x11,0x46,0x0F,0x48,0x0D,0x42,0x00,0x42,0x00,0x42,0x0C,0x40,0x02,0x42,0x02,0x40,0x10,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x10,0x40,0x02,0x42,0x02,0x40,0x0C,0x42,0x00,0x42,0x00,0x42,0x0D,0x48,0x0F,0x46,0x11,0x44,0x13,0x42,0x14,0x42,0x15,0x40,0x3F,0x01,0x4A,0x0C,0x4A,0x0C,0x4A,0x05, // 0x17 ' '
+  0x3F,0x13,0x40,0x15,0x42,0x14,0x42,0x13,0x44,0x11,0x46,0x0F,0x48,0x0D,0x42,0x00,0x42,0x00,0x42,0x0C,0x40,0x02,0x42,0x02,0x40,0x10,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x39, // 0x18 ' '
+  0x3F,0x12,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x10,0x40,0x02,0x42,0x02,0x40,0x0C,0x42,0x00,0x42,0x00,0x42,0x0D,0x48,0x0F,0x46,0x11,0x44,0x13,0x42,0x14,0x42,0x15,0x40,0x3A, // 0x19 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x35,0x41,0x16,0x41,0x15,0x42,0x15,0x42,0x06,0x52,0x04,0x53,0x03,0x52,0x12,0x42,0x13,0x42,0x14,0x41,0x14,0x41,0x3F,0x3F,0x3F,0x3F,0x3F,0x17, // 0x1A ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x2F,0x41,0x14,0x41,0x14,0x42,0x13,0x42,0x12,0x52,0x03,0x53,0x04,0x52,0x06,0x42,0x15,0x42,0x15,0x41,0x16,0x41,0x3F,0x3F,0x3F,0x3F,0x3F,0x1D, // 0x1B ' '
+  0x3F,0x3F,0x3F,0x3F,0x09,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x53,0x03,0x53,0x03,0x53,0x3F,0x3F,0x3F,0x01, // 0x1C ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x2F,0x41,0x03,0x41,0x0E,0x41,0x05,0x41,0x0C,0x42,0x05,0x42,0x0A,0x42,0x07,0x42,0x07,0x51,0x04,0x53,0x04,0x51,0x07,0x42,0x07,0x42,0x0A,0x42,0x05,0x42,0x0C,0x41,0x05,0x41,0x0E,0x41,0x03,0x41,0x3F,0x3F,0x3F,0x3F,0x3F,0x17, // 0x1D ' '
+  0x3F,0x3F,0x3F,0x22,0x40,0x16,0x40,0x15,0x42,0x14,0x42,0x13,0x44,0x12,0x44,0x12,0x45,0x10,0x46,0x10,0x47,0x0E,0x48,0x0E,0x49,0x0C,0x4A,0x0C,0x4B,0x0A,0x4C,0x0A,0x4D,0x08,0x4E,0x08,0x4F,0x07,0x4F,0x06,0x51,0x05,0x51,0x04,0x53,0x03,0x53,0x02,0x55,0x3F,0x3F,0x3F,0x00, // 0x1E ' '
+  0x3F,0x3F,0x3F,0x18,0x55,0x02,0x53,0x03,0x53,0x04,0x51,0x05,0x51,0x06,0x4F,0x07,0x4F,0x07,0x4E,0x09,0x4D,0x09,0x4C,0x0B,0x4B,0x0B,0x4A,0x0D,0x49,0x0D,0x48,0x0F,0x47,0x0F,0x46,0x11,0x45,0x11,0x44,0x12,0x44,0x13,0x42,0x14,0x42,0x15,0x40,0x16,0x40,0x3F,0x3F,0x3F,0x0B, // 0x1F ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F, // 0x20 ' '
+  0x3F,0x11,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x33,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x09, // 0x21 '!'
+  0x1C,0x44,0x04,0x44,0x08,0x44,0x04,0x44,0x08,0x44,0x04,0x44,0x08,0x44,0x04,0x44,0x08,0x44,0x04,0x44,0x08,0x44,0x04,0x44,0x09,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x24, // 0x22 '"'
+  0x3F,0x11,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x07,0x53,0x03,0x53,0x03,0x53,0x07,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x03,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x07,0x54,0x02,0x54,0x02,0x54,0x06,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x3F,0x3F,0x3F,0x09, // 0x23 '#'
+  0x23,0x41,0x15,0x41,0x13,0x46,0x0E,0x4B,0x0A,0x4C,0x09,0x44,0x00,0x41,0x02,0x42,0x08,0x44,0x01,0x41,0x0E,0x43,0x02,0x41,0x0E,0x43,0x02,0x41,0x0E,0x43,0x02,0x41,0x0E,0x43,0x02,0x41,0x0E,0x44,0x01,0x41,0x0F,0x44,0x00,0x41,0x10,0x46,0x11,0x45,0x12,0x45,0x12,0x45,0x13,0x45,0x11,0x46,0x10,0x41,0x00,0x44,0x0F,0x41,0x01,0x43,0x0F,0x41,0x01,0x44,0x0E,0x41,0x02,0x43,0x0E,0x41,0x02,0x43,0x0E,0x41,0x02,0x43,0x0E,0x41,0x02,0x43,0x06,0x40,0x06,0x41,0x01,0x43,0x07,0x43,0x03,0x41,0x00,0x44,0x07,0x4E,0x08,0x4D,0x0D,0x47,0x13,0x41,0x15,0x41,0x3F,0x3F,0x19, // 0x24 '$'
+  0x3F,0x0A,0x44,0x0C,0x42,0x01,0x47,0x09,0x42,0x01,0x42,0x02,0x43,0x07,0x42,0x02,0x42,0x03,0x42,0x07,0x42,0x01,0x42,0x05,0x42,0x05,0x42,0x02,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x03,0x42,0x04,0x42,0x05,0x42,0x03,0x42,0x04,0x42,0x05,0x42,0x02,0x42,0x06,0x42,0x03,0x42,0x02,0x42,0x07,0x43,0x01,0x43,0x02,0x42,0x08,0x47,0x02,0x42,0x0B,0x43,0x03,0x42,0x14,0x42,0x13,0x42,0x13,0x42,0x13,0x42,0x03,0x43,0x0C,0x42,0x01,0x47,0x09,0x42,0x01,0x42,0x02,0x43,0x07,0x42,0x02,0x42,0x03,0x42,0x07,0x42,0x01,0x42,0x05,0x42,0x05,0x42,0x02,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x03,0x42,0x04,0x42,0x05,0x42,0x02,0x42,0x06,0x42,0x03,0x42,0x02,0x42,0x07,0x43,0x01,0x43,0x02,0x42,0x08,0x47,0x02,0x42,0x0B,0x43,0x03,0x42,0x3F,0x3F,0x3C, // 0x25 '%'
+  0x3F,0x10,0x45,0x0F,0x48,0x0D,0x4A,0x0C,0x43,0x02,0x44,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x44,0x02,0x43,0x0C,0x43,0x01,0x43,0x0D,0x43,0x00,0x43,0x0E,0x47,0x0F,0x46,0x0E,0x47,0x0E,0x48,0x07,0x43,0x01,0x43,0x01,0x44,0x06,0x43,0x00,0x43,0x03,0x44,0x05,0x43,0x00,0x43,0x04,0x43,0x05,0x47,0x05,0x44,0x04,0x42,0x00,0x43,0x06,0x44,0x03,0x42,0x00,0x43,0x07,0x44,0x01,0x43,0x00,0x43,0x07,0x44,0x01,0x42,0x01,0x43,0x08,0x48,0x01,0x44,0x08,0x46,0x03,0x43,0x09,0x44,0x04,0x44,0x08,0x45,0x04,0x45,0x04,0x48,0x04,0x53,0x04,0x4A,0x02,0x45,0x05,0x46,0x3F,0x3F,0x32, // 0x26 '&'
+  0x20,0x44,0x12,0x44,0x12,0x44,0x12,0x44,0x12,0x44,0x12,0x44,0x13,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x2A, // 0x27 '''
+  0x29,0x42,0x12,0x44,0x10,0x46,0x0F,0x45,0x10,0x44,0x11,0x44,0x11,0x44,0x12,0x43,0x12,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x14,0x43,0x13,0x44,0x13,0x44,0x13,0x44,0x13,0x45,0x12,0x46,0x12,0x44,0x14,0x42,0x32, // 0x28 '('
+  0x1A,0x42,0x14,0x44,0x12,0x46,0x12,0x45,0x13,0x44,0x13,0x44,0x13,0x44,0x13,0x43,0x14,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x12,0x43,0x12,0x44,0x11,0x44,0x11,0x44,0x10,0x45,0x0F,0x46,0x10,0x44,0x12,0x42,0x3F,0x01, // 0x29 ')'
+  0x3F,0x11,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0D,0x40,0x05,0x41,0x05,0x40,0x07,0x42,0x03,0x41,0x03,0x42,0x06,0x45,0x05,0x45,0x05,0x46,0x03,0x46,0x08,0x43,0x03,0x43,0x26,0x40,0x03,0x40,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x42,0x05,0x42,0x0D,0x40,0x05,0x40,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x27, // 0x2A '*'
+  0x3F,0x3F,0x3F,0x3F,0x12,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x0B,0x54,0x02,0x54,0x02,0x54,0x0B,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x3F,0x3F,0x3F,0x09, // 0x2B '+'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x38,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x13,0x43,0x13,0x43,0x13,0x42,0x13,0x43,0x12,0x43,0x13,0x41,0x3C, // 0x2C ','
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x33,0x4F,0x07,0x4F,0x07,0x4F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x0B, // 0x2D '-'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x38,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x3F,0x3F,0x3F,0x08, // 0x2E '.'
+  0x2B,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x14,0x42,0x13,0x42,0x3F,0x03, // 0x2F '/'
+  0x3F,0x10,0x45,0x0F,0x49,0x0C,0x4B,0x0A,0x44,0x03,0x44,0x08,0x44,0x05,0x44,0x07,0x43,0x07,0x43,0x06,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x42,0x0B,0x42,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x42,0x0B,0x42,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x06,0x43,0x07,0x43,0x07,0x44,0x05,0x44,0x08,0x44,0x03,0x44,0x0A,0x4B,0x0C,0x49,0x0F,0x45,0x3F,0x3F,0x30, // 0x30 '0'
+  0x3F,0x14,0x41,0x12,0x44,0x0F,0x47,0x0B,0x4B,0x0B,0x46,0x00,0x43,0x0B,0x41,0x05,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0B,0x53,0x03,0x53,0x03,0x53,0x3F,0x3F,0x3F,0x00, // 0x31 '1'
+  0x3F,0x0E,0x46,0x0D,0x4B,0x0B,0x4C,0x0A,0x42,0x05,0x44,0x09,0x40,0x08,0x43,0x14,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x12,0x43,0x12,0x43,0x12,0x43,0x12,0x43,0x12,0x43,0x12,0x43,0x12,0x43,0x13,0x42,0x13,0x43,0x12,0x43,0x12,0x43,0x13,0x43,0x12,0x44,0x12,0x4F,0x07,0x4F,0x07,0x4F,0x3F,0x3F,0x3F,0x04, // 0x32 '2'
+  0x3F,0x0E,0x47,0x0D,0x4C,0x0A,0x4D,0x09,0x42,0x05,0x44,0x13,0x44,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x11,0x44,0x0D,0x47,0x0F,0x47,0x0F,0x49,0x12,0x45,0x13,0x44,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x12,0x44,0x08,0x42,0x05,0x44,0x09,0x4C,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x30, // 0x33 '3'
+  0x3F,0x15,0x43,0x12,0x44,0x11,0x45,0x11,0x45,0x10,0x46,0x0F,0x47,0x0F,0x42,0x00,0x43,0x0E,0x42,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x42,0x02,0x43,0x0C,0x42,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x42,0x04,0x43,0x0A,0x42,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x42,0x06,0x43,0x08,0x42,0x07,0x43,0x07,0x43,0x07,0x43,0x07,0x53,0x03,0x53,0x03,0x53,0x0F,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x05, // 0x34 '4'
+  0x3F,0x0D,0x4C,0x0A,0x4C,0x0A,0x4C,0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x46,0x10,0x48,0x0E,0x4A,0x12,0x45,0x13,0x44,0x13,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x44,0x12,0x43,0x12,0x44,0x09,0x41,0x05,0x44,0x0A,0x4B,0x0B,0x4A,0x0E,0x46,0x3F,0x3F,0x31, // 0x35 '5'
+  0x3F,0x12,0x46,0x0E,0x4A,0x0B,0x4B,0x0A,0x44,0x04,0x42,0x09,0x43,0x12,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x03,0x45,0x09,0x43,0x01,0x48,0x08,0x43,0x00,0x4B,0x06,0x46,0x04,0x44,0x06,0x45,0x06,0x44,0x05,0x44,0x08,0x43,0x05,0x44,0x08,0x44,0x04,0x44,0x09,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x42,0x07,0x43,0x07,0x43,0x07,0x43,0x06,0x44,0x08,0x44,0x03,0x44,0x0A,0x4B,0x0C,0x49,0x0F,0x45,0x3F,0x3F,0x2F, // 0x36 '6'
+  0x3F,0x0B,0x50,0x06,0x50,0x06,0x50,0x06,0x50,0x13,0x42,0x14,0x42,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x0D, // 0x37 '7'
+  0x3F,0x10,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x04,0x44,0x07,0x44,0x06,0x44,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x44,0x07,0x43,0x06,0x44,0x06,0x43,0x08,0x44,0x04,0x43,0x0A,0x45,0x01,0x43,0x0C,0x49,0x0E,0x47,0x0E,0x49,0x0C,0x43,0x00,0x47,0x09,0x43,0x03,0x46,0x07,0x43,0x05,0x46,0x06,0x43,0x07,0x44,0x05,0x43,0x09,0x44,0x04,0x43,0x09,0x44,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x44,0x09,0x43,0x05,0x44,0x07,0x43,0x06,0x45,0x04,0x44,0x08,0x4D,0x0B,0x4A,0x0E,0x46,0x3F,0x3F,0x2F, // 0x38 '8'
+  0x3F,0x10,0x45,0x0F,0x49,0x0C,0x4C,0x09,0x44,0x03,0x44,0x08,0x44,0x06,0x43,0x07,0x43,0x07,0x43,0x07,0x42,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x09,0x44,0x04,0x44,0x08,0x44,0x05,0x43,0x08,0x44,0x05,0x44,0x06,0x45,0x06,0x44,0x04,0x46,0x07,0x4A,0x00,0x43,0x08,0x48,0x01,0x43,0x09,0x45,0x03,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x12,0x43,0x09,0x42,0x04,0x44,0x0A,0x4B,0x0B,0x4A,0x0E,0x46,0x3F,0x3F,0x31, // 0x39 '9'
+  0x3F,0x3F,0x3F,0x3F,0x10,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x3F,0x3F,0x3F,0x29,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x3F,0x3F,0x3F,0x08, // 0x3A ':'
+  0x3F,0x3F,0x3F,0x3F,0x10,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x3F,0x3F,0x3F,0x29,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x11,0x45,0x13,0x43,0x13,0x43,0x13,0x42,0x13,0x43,0x12,0x43,0x13,0x41,0x3C, // 0x3B ';'
+  0x3F,0x3F,0x3F,0x3F,0x1C,0x40,0x14,0x42,0x12,0x44,0x10,0x45,0x0F,0x45,0x10,0x44,0x10,0x45,0x0F,0x45,0x0F,0x45,0x0F,0x45,0x0F,0x45,0x13,0x45,0x13,0x45,0x13,0x45,0x13,0x45,0x13,0x44,0x13,0x45,0x13,0x45,0x13,0x44,0x14,0x42,0x16,0x40,0x3F,0x3F,0x3F,0x01, // 0x3C '<'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x01,0x53,0x03,0x53,0x03,0x53,0x3F,0x23,0x53,0x03,0x53,0x03,0x53,0x3F,0x3F,0x3F,0x3F,0x3F,0x11, // 0x3D '='
+  0x3F,0x3F,0x3F,0x3F,0x09,0x40,0x16,0x42,0x14,0x44,0x13,0x45,0x13,0x45,0x13,0x44,0x13,0x45,0x13,0x45,0x13,0x45,0x13,0x45,0x13,0x45,0x0F,0x45,0x0F,0x45,0x0F,0x45,0x0F,0x45,0x10,0x44,0x10,0x45,0x0F,0x45,0x10,0x44,0x12,0x42,0x14,0x40,0x3F,0x3F,0x3F,0x14, // 0x3E '>'
+  0x3F,0x0D,0x49,0x0A,0x4E,0x08,0x50,0x06,0x42,0x07,0x45,0x06,0x42,0x09,0x44,0x05,0x42,0x0A,0x43,0x05,0x42,0x0A,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x12,0x43,0x12,0x43,0x11,0x44,0x11,0x44,0x11,0x43,0x12,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x33,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x0B, // 0x3F '?'
+  0x3F,0x11,0x46,0x0E,0x49,0x0B,0x44,0x03,0x43,0x09,0x43,0x07,0x42,0x07,0x43,0x08,0x42,0x07,0x42,0x0A,0x42,0x05,0x42,0x06,0x47,0x05,0x42,0x05,0x48,0x04,0x42,0x05,0x42,0x02,0x43,0x04,0x42,0x04,0x42,0x04,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x03,0x42,0x04,0x42,0x05,0x42,0x03,0x42,0x04,0x41,0x06,0x42,0x03,0x42,0x03,0x42,0x06,0x42,0x03,0x42,0x03,0x42,0x05,0x43,0x03,0x42,0x03,0x42,0x05,0x43,0x03,0x42,0x03,0x42,0x04,0x44,0x03,0x42,0x03,0x42,0x04,0x44,0x03,0x42,0x03,0x42,0x03,0x45,0x03,0x42,0x03,0x42,0x03,0x41,0x00,0x42,0x03,0x43,0x03,0x42,0x01,0x42,0x00,0x42,0x04,0x42,0x03,0x46,0x01,0x42,0x04,0x42,0x04,0x44,0x02,0x45,0x02,0x42,0x04,0x42,0x03,0x45,0x02,0x42,0x15,0x42,0x15,0x42,0x15,0x43,0x05,0x41,0x0C,0x4A,0x0E,0x46,0x3F,0x3F,0x2F, // 0x40 '@'
+  0x3F,0x3F,0x31,0x43,0x12,0x45,0x11,0x45,0x11,0x45,0x10,0x42,0x00,0x43,0x0F,0x42,0x00,0x43,0x0E,0x43,0x01,0x43,0x0D,0x42,0x02,0x43,0x0D,0x42,0x02,0x43,0x0C,0x43,0x03,0x43,0x0B,0x42,0x04,0x43,0x0A,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x42,0x06,0x43,0x08,0x43,0x07,0x43,0x07,0x43,0x07,0x43,0x06,0x51,0x05,0x51,0x05,0x51,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x44,0x0B,0x44,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x00,0x43,0x0E,0x44,0x3F,0x3F,0x3F, // 0x41 'A'
+  0x3F,0x3F,0x2B,0x4C,0x0A,0x4E,0x08,0x4F,0x07,0x43,0x06,0x45,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x43,0x07,0x43,0x05,0x44,0x08,0x4D,0x09,0x4B,0x0B,0x4D,0x09,0x43,0x05,0x45,0x07,0x43,0x07,0x44,0x06,0x43,0x08,0x43,0x06,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x08,0x44,0x05,0x43,0x07,0x44,0x06,0x50,0x06,0x4E,0x08,0x4C,0x3F,0x3F,0x3F,0x06, // 0x42 'B'
+  0x3F,0x3F,0x32,0x48,0x0C,0x4D,0x07,0x4F,0x06,0x45,0x06,0x43,0x05,0x44,0x0B,0x40,0x04,0x44,0x11,0x44,0x12,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x44,0x13,0x44,0x13,0x44,0x13,0x46,0x06,0x42,0x07,0x4F,0x09,0x4D,0x0B,0x48,0x3F,0x3F,0x3F,0x03, // 0x43 'C'
+  0x3F,0x3F,0x2A,0x4B,0x0B,0x4E,0x08,0x4F,0x07,0x43,0x06,0x45,0x06,0x43,0x08,0x44,0x05,0x43,0x09,0x44,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x42,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x09,0x43,0x05,0x43,0x08,0x44,0x05,0x43,0x05,0x46,0x06,0x4F,0x07,0x4D,0x09,0x4B,0x3F,0x3F,0x3F,0x08, // 0x44 'D'
+  0x3F,0x3F,0x2B,0x50,0x06,0x50,0x06,0x50,0x06,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x4E,0x08,0x4E,0x08,0x4E,0x08,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x51,0x05,0x51,0x05,0x51,0x3F,0x3F,0x3F,0x01, // 0x45 'E'
+  0x3F,0x3F,0x2C,0x51,0x05,0x51,0x05,0x51,0x05,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x4F,0x07,0x4F,0x07,0x4F,0x07,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x0E, // 0x46 'F'
+  0x3F,0x3F,0x32,0x48,0x0C,0x4D,0x07,0x4F,0x06,0x45,0x06,0x43,0x05,0x44,0x0B,0x40,0x04,0x44,0x11,0x44,0x12,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x07,0x48,0x02,0x43,0x07,0x48,0x02,0x43,0x07,0x48,0x02,0x43,0x0C,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x44,0x0A,0x43,0x04,0x44,0x09,0x43,0x05,0x44,0x08,0x43,0x06,0x46,0x05,0x43,0x07,0x4F,0x09,0x4D,0x0B,0x48,0x3F,0x3F,0x3F,0x03, // 0x47 'G'
+  0x3F,0x3F,0x2A,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x51,0x05,0x51,0x05,0x51,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x3F,0x3F,0x3F,0x02, // 0x48 'H'
+  0x3F,0x3F,0x2A,0x51,0x05,0x51,0x05,0x51,0x0C,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x51,0x05,0x51,0x05,0x51,0x3F,0x3F,0x3F,0x02, // 0x49 'I'
+  0x3F,0x3F,0x2C,0x4C,0x0A,0x4C,0x0A,0x4C,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x44,0x12,0x43,0x09,0x41,0x06,0x44,0x09,0x4C,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x0A, // 0x4A 'J'
+  0x3F,0x3F,0x2A,0x43,0x07,0x45,0x05,0x43,0x07,0x44,0x06,0x43,0x06,0x44,0x07,0x43,0x05,0x44,0x08,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0A,0x43,0x03,0x44,0x0A,0x43,0x02,0x44,0x0B,0x43,0x02,0x43,0x0C,0x43,0x01,0x43,0x0D,0x43,0x00,0x43,0x0E,0x43,0x00,0x42,0x0F,0x48,0x0E,0x43,0x00,0x44,0x0D,0x43,0x01,0x44,0x0C,0x43,0x02,0x43,0x0C,0x43,0x03,0x43,0x0B,0x43,0x03,0x44,0x0A,0x43,0x04,0x44,0x09,0x43,0x05,0x44,0x08,0x43,0x06,0x44,0x07,0x43,0x07,0x44,0x06,0x43,0x08,0x44,0x05,0x43,0x08,0x45,0x04,0x43,0x09,0x45,0x3F,0x3F,0x3F,0x00, // 0x4B 'K'
+  0x3F,0x3F,0x2B,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x50,0x06,0x50,0x06,0x50,0x3F,0x3F,0x3F,0x02, // 0x4C 'L'
+  0x3F,0x3F,0x29,0x44,0x09,0x44,0x03,0x44,0x09,0x44,0x03,0x45,0x08,0x44,0x03,0x45,0x07,0x45,0x03,0x45,0x07,0x45,0x03,0x42,0x00,0x42,0x06,0x41,0x00,0x42,0x03,0x42,0x00,0x42,0x05,0x42,0x00,0x42,0x03,0x42,0x00,0x42,0x05,0x42,0x00,0x42,0x03,0x42,0x01,0x42,0x04,0x41,0x01,0x42,0x03,0x42,0x01,0x42,0x03,0x42,0x01,0x42,0x03,0x42,0x01,0x42,0x03,0x42,0x01,0x42,0x03,0x42,0x02,0x42,0x02,0x41,0x02,0x42,0x03,0x42,0x02,0x42,0x01,0x42,0x02,0x42,0x03,0x42,0x02,0x42,0x01,0x42,0x02,0x42,0x03,0x42,0x03,0x42,0x00,0x41,0x03,0x42,0x03,0x42,0x03,0x45,0x03,0x42,0x03,0x42,0x03,0x45,0x03,0x42,0x03,0x42,0x04,0x43,0x04,0x42,0x03,0x42,0x04,0x43,0x04,0x42,0x03,0x42,0x04,0x43,0x04,0x42,0x03,0x42,0x0D,0x42,0x03,0x42,0x0D,0x42,0x03,0x42,0x0D,0x42,0x03,0x42,0x0D,0x42,0x03,0x42,0x0D,0x42,0x3F,0x3F,0x3F,0x01, // 0x4D 'M'
+  0x3F,0x3F,0x2A,0x43,0x0A,0x42,0x05,0x43,0x0A,0x42,0x05,0x44,0x09,0x42,0x05,0x45,0x08,0x42,0x05,0x45,0x08,0x42,0x05,0x46,0x07,0x42,0x05,0x47,0x06,0x42,0x05,0x42,0x00,0x43,0x06,0x42,0x05,0x42,0x00,0x44,0x05,0x42,0x05,0x42,0x01,0x44,0x04,0x42,0x05,0x42,0x01,0x44,0x04,0x42,0x05,0x42,0x02,0x44,0x03,0x42,0x05,0x42,0x03,0x43,0x03,0x42,0x05,0x42,0x03,0x44,0x02,0x42,0x05,0x42,0x04,0x44,0x01,0x42,0x05,0x42,0x05,0x43,0x01,0x42,0x05,0x42,0x05,0x44,0x00,0x42,0x05,0x42,0x06,0x47,0x05,0x42,0x06,0x47,0x05,0x42,0x07,0x46,0x05,0x42,0x08,0x45,0x05,0x42,0x08,0x45,0x05,0x42,0x09,0x44,0x05,0x42,0x0A,0x43,0x05,0x42,0x0A,0x43,0x3F,0x3F,0x3F,0x02, // 0x4E 'N'
+  0x3F,0x3F,0x2F,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x02,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0x4F 'O'
+  0x3F,0x3F,0x2B,0x4C,0x0A,0x4E,0x08,0x50,0x06,0x43,0x07,0x44,0x06,0x43,0x08,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x43,0x05,0x45,0x07,0x4E,0x08,0x4D,0x09,0x4A,0x0C,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x0F, // 0x50 'P'
+  0x3F,0x3F,0x2F,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x02,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x49,0x13,0x44,0x13,0x45,0x12,0x47,0x10,0x45,0x13,0x43,0x15,0x40,0x31, // 0x51 'Q'
+  0x3F,0x3F,0x2B,0x4C,0x0A,0x4E,0x08,0x4F,0x07,0x43,0x06,0x44,0x07,0x43,0x07,0x44,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x43,0x07,0x43,0x06,0x44,0x07,0x43,0x04,0x45,0x08,0x4D,0x09,0x4B,0x0B,0x4B,0x0B,0x43,0x03,0x44,0x0A,0x43,0x03,0x44,0x0A,0x43,0x04,0x44,0x09,0x43,0x05,0x44,0x08,0x43,0x06,0x44,0x07,0x43,0x06,0x44,0x07,0x43,0x07,0x44,0x06,0x43,0x08,0x44,0x05,0x43,0x09,0x44,0x04,0x43,0x09,0x44,0x3F,0x3F,0x3F,0x00, // 0x52 'R'
+  0x3F,0x3F,0x2F,0x48,0x0C,0x4D,0x08,0x4E,0x07,0x44,0x06,0x43,0x06,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x44,0x13,0x45,0x11,0x48,0x10,0x49,0x0F,0x4A,0x0E,0x49,0x10,0x47,0x12,0x45,0x12,0x44,0x13,0x43,0x13,0x43,0x13,0x43,0x04,0x41,0x0B,0x43,0x05,0x44,0x06,0x45,0x05,0x50,0x06,0x4E,0x0C,0x48,0x3F,0x3F,0x3F,0x07, // 0x53 'S'
+  0x3F,0x3F,0x27,0x7F,0x47,0x09,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x09, // 0x54 'T'
+  0x3F,0x3F,0x2A,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x05,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x07,0x44,0x04,0x44,0x08,0x4E,0x0A,0x4A,0x0E,0x46,0x3F,0x3F,0x3F,0x07, // 0x55 'U'
+  0x3F,0x3F,0x27,0x44,0x0E,0x43,0x00,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x44,0x0B,0x44,0x02,0x43,0x0B,0x43,0x03,0x44,0x0A,0x43,0x04,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x44,0x08,0x43,0x06,0x43,0x07,0x43,0x07,0x44,0x06,0x43,0x08,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x44,0x04,0x43,0x0A,0x43,0x03,0x43,0x0B,0x44,0x02,0x43,0x0C,0x43,0x02,0x42,0x0D,0x43,0x01,0x43,0x0D,0x44,0x00,0x43,0x0E,0x43,0x00,0x42,0x0F,0x47,0x10,0x45,0x11,0x45,0x11,0x45,0x12,0x43,0x3F,0x3F,0x3F,0x09, // 0x56 'V'
+  0x3F,0x3F,0x27,0x42,0x11,0x46,0x10,0x46,0x10,0x42,0x00,0x42,0x0F,0x42,0x01,0x42,0x0F,0x42,0x01,0x42,0x05,0x43,0x05,0x42,0x01,0x42,0x05,0x43,0x05,0x42,0x01,0x42,0x05,0x44,0x04,0x42,0x01,0x43,0x03,0x45,0x04,0x42,0x01,0x43,0x03,0x45,0x03,0x42,0x03,0x42,0x03,0x45,0x03,0x42,0x03,0x42,0x03,0x46,0x02,0x42,0x03,0x42,0x02,0x42,0x01,0x42,0x02,0x42,0x03,0x42,0x02,0x42,0x01,0x42,0x02,0x42,0x03,0x43,0x01,0x42,0x01,0x42,0x02,0x42,0x03,0x43,0x01,0x42,0x01,0x42,0x01,0x42,0x05,0x42,0x01,0x41,0x02,0x43,0x00,0x42,0x05,0x42,0x00,0x42,0x03,0x42,0x00,0x42,0x05,0x42,0x00,0x42,0x03,0x42,0x00,0x42,0x05,0x42,0x00,0x42,0x03,0x42,0x00,0x42,0x05,0x42,0x00,0x41,0x04,0x46,0x05,0x45,0x05,0x44,0x06,0x45,0x05,0x44,0x07,0x44,0x05,0x44,0x07,0x43,0x06,0x44,0x3F,0x3F,0x3F,0x03, // 0x57 'W'
+  0x3F,0x3F,0x28,0x44,0x0C,0x43,0x02,0x44,0x0A,0x43,0x04,0x44,0x09,0x42,0x06,0x43,0x08,0x42,0x07,0x44,0x06,0x43,0x08,0x44,0x04,0x43,0x0A,0x44,0x03,0x42,0x0B,0x44,0x02,0x42,0x0D,0x44,0x00,0x43,0x0E,0x47,0x10,0x45,0x11,0x44,0x13,0x44,0x11,0x46,0x0F,0x47,0x0E,0x43,0x00,0x44,0x0D,0x42,0x02,0x44,0x0B,0x43,0x03,0x44,0x09,0x43,0x04,0x44,0x08,0x43,0x06,0x44,0x07,0x42,0x08,0x44,0x05,0x43,0x09,0x43,0x04,0x43,0x0A,0x44,0x02,0x43,0x0C,0x44,0x00,0x43,0x0E,0x44,0x3F,0x3F,0x3F, // 0x58 'X'
+  0x3F,0x3F,0x28,0x44,0x0D,0x43,0x01,0x43,0x0C,0x43,0x03,0x43,0x0B,0x42,0x04,0x44,0x09,0x43,0x05,0x43,0x09,0x42,0x07,0x43,0x07,0x43,0x07,0x44,0x05,0x43,0x09,0x44,0x04,0x42,0x0B,0x43,0x03,0x43,0x0B,0x44,0x02,0x42,0x0D,0x44,0x00,0x43,0x0E,0x47,0x0F,0x46,0x11,0x45,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x08, // 0x59 'Y'
+  0x3F,0x3F,0x2A,0x52,0x04,0x52,0x04,0x52,0x12,0x44,0x11,0x44,0x12,0x43,0x12,0x43,0x12,0x43,0x12,0x43,0x12,0x44,0x11,0x44,0x12,0x43,0x12,0x43,0x12,0x43,0x12,0x44,0x11,0x44,0x12,0x43,0x12,0x43,0x12,0x43,0x12,0x43,0x12,0x44,0x11,0x44,0x12,0x53,0x03,0x53,0x03,0x53,0x3F,0x3F,0x3F,0x01, // 0x5A 'Z'
+  0x20,0x4B,0x0B,0x4B,0x0B,0x4B,0x0B,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x4B,0x0B,0x4B,0x0B,0x4B,0x32, // 0x5B '['
+  0x18,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x43,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x14,0x42,0x15,0x42,0x30, // 0x5C '\'
+  0x1A,0x4B,0x0B,0x4B,0x0B,0x4B,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x0B,0x4B,0x0B,0x4B,0x0B,0x4B,0x38, // 0x5D ']'
+  0x3F,0x12,0x40,0x16,0x40,0x15,0x42,0x14,0x42,0x14,0x43,0x12,0x44,0x12,0x44,0x11,0x42,0x00,0x42,0x10,0x42,0x00,0x42,0x10,0x42,0x01,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x03,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x43,0x0B,0x41,0x06,0x42,0x0A,0x42,0x06,0x43,0x09,0x42,0x07,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x09,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0B,0x42,0x05,0x42,0x0B,0x42,0x04,0x42,0x0D,0x42,0x3F,0x3F,0x3F,0x3F,0x3F,0x11, // 0x5E '^'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x7F,0x47,0x3F,0x37, // 0x5F '_'
+  0x07,0x43,0x14,0x43,0x15,0x42,0x15,0x42,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x28, // 0x60 '`'
+  0x3F,0x3F,0x3F,0x3F,0x0F,0x48,0x0B,0x4C,0x0A,0x4D,0x09,0x42,0x06,0x44,0x08,0x40,0x09,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x4A,0x0A,0x4C,0x08,0x4E,0x07,0x45,0x05,0x43,0x07,0x43,0x07,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x45,0x03,0x47,0x06,0x4B,0x00,0x46,0x04,0x49,0x01,0x46,0x06,0x45,0x05,0x43,0x3F,0x3F,0x3F,0x00, // 0x61 'a'
+  0x1A,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x03,0x44,0x0A,0x43,0x01,0x48,0x08,0x43,0x00,0x4A,0x07,0x43,0x00,0x42,0x03,0x44,0x06,0x45,0x06,0x43,0x06,0x44,0x07,0x43,0x06,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x44,0x06,0x44,0x06,0x46,0x03,0x44,0x07,0x4E,0x08,0x43,0x00,0x48,0x09,0x42,0x03,0x44,0x3F,0x3F,0x3F,0x08, // 0x62 'b'
+  0x3F,0x3F,0x3F,0x3F,0x11,0x48,0x0C,0x4C,0x08,0x4E,0x07,0x45,0x06,0x42,0x07,0x44,0x11,0x44,0x12,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x14,0x43,0x13,0x44,0x12,0x45,0x12,0x46,0x05,0x42,0x08,0x4E,0x0A,0x4C,0x0C,0x48,0x3F,0x3F,0x3F,0x04, // 0x63 'c'
+  0x28,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0A,0x45,0x02,0x43,0x08,0x49,0x00,0x43,0x07,0x4F,0x06,0x44,0x04,0x46,0x06,0x43,0x07,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x05,0x43,0x08,0x44,0x05,0x43,0x07,0x45,0x06,0x43,0x04,0x47,0x06,0x4B,0x00,0x43,0x07,0x49,0x01,0x43,0x09,0x45,0x03,0x43,0x3F,0x3F,0x3F,0x02, // 0x64 'd'
+  0x3F,0x3F,0x3F,0x3F,0x11,0x45,0x0E,0x4A,0x0B,0x4C,0x09,0x44,0x04,0x44,0x08,0x43,0x06,0x43,0x07,0x43,0x08,0x42,0x07,0x43,0x08,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x51,0x05,0x51,0x05,0x51,0x05,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x44,0x13,0x45,0x06,0x42,0x08,0x4E,0x09,0x4D,0x0C,0x47,0x3F,0x3F,0x3F,0x05, // 0x65 'e'
+  0x25,0x48,0x0C,0x4B,0x09,0x4D,0x09,0x44,0x06,0x41,0x08,0x44,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0D,0x53,0x03,0x53,0x03,0x53,0x09,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x0A, // 0x66 'f'
+  0x3F,0x3F,0x3F,0x3F,0x0F,0x45,0x02,0x43,0x08,0x49,0x00,0x43,0x07,0x4F,0x06,0x44,0x04,0x46,0x06,0x43,0x07,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x05,0x43,0x08,0x44,0x05,0x44,0x06,0x45,0x06,0x44,0x03,0x42,0x00,0x43,0x06,0x4B,0x00,0x43,0x07,0x49,0x01,0x43,0x09,0x45,0x03,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x07,0x42,0x06,0x44,0x08,0x4D,0x09,0x4C,0x0D,0x47,0x08, // 0x67 'g'
+  0x1B,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x04,0x45,0x08,0x43,0x02,0x48,0x07,0x43,0x01,0x4A,0x06,0x43,0x00,0x42,0x04,0x43,0x06,0x46,0x05,0x44,0x05,0x45,0x07,0x43,0x05,0x44,0x08,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x3F,0x3F,0x3F,0x01, // 0x68 'h'
+  0x21,0x44,0x12,0x44,0x12,0x44,0x12,0x44,0x12,0x44,0x3F,0x3F,0x03,0x4B,0x0B,0x4B,0x0B,0x4B,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x08, // 0x69 'i'
+  0x23,0x44,0x12,0x44,0x12,0x44,0x12,0x44,0x12,0x44,0x3F,0x3F,0x02,0x4C,0x0A,0x4C,0x0A,0x4C,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x43,0x0A,0x41,0x05,0x44,0x0A,0x4B,0x0B,0x4A,0x0E,0x46,0x0B, // 0x6A 'j'
+  0x1B,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x06,0x45,0x06,0x43,0x06,0x44,0x07,0x43,0x05,0x44,0x08,0x43,0x04,0x44,0x09,0x43,0x03,0x44,0x0A,0x43,0x02,0x45,0x0A,0x43,0x02,0x44,0x0B,0x43,0x01,0x44,0x0C,0x43,0x00,0x44,0x0D,0x48,0x0E,0x48,0x0E,0x43,0x00,0x44,0x0D,0x43,0x01,0x44,0x0C,0x43,0x02,0x44,0x0B,0x43,0x03,0x44,0x0A,0x43,0x04,0x44,0x09,0x43,0x05,0x44,0x08,0x43,0x06,0x44,0x07,0x43,0x06,0x45,0x06,0x43,0x07,0x45,0x05,0x43,0x08,0x45,0x3F,0x3F,0x3F,0x00, // 0x6B 'k'
+  0x1B,0x4B,0x0B,0x4B,0x0B,0x4B,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x07, // 0x6C 'l'
+  0x3F,0x3F,0x3F,0x3F,0x09,0x42,0x02,0x43,0x04,0x42,0x05,0x42,0x01,0x45,0x02,0x44,0x04,0x42,0x00,0x46,0x01,0x46,0x03,0x45,0x02,0x45,0x01,0x42,0x03,0x44,0x03,0x44,0x02,0x42,0x03,0x43,0x04,0x43,0x03,0x42,0x03,0x43,0x04,0x43,0x03,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x03,0x42,0x05,0x42,0x04,0x42,0x3F,0x3F,0x3F,0x01, // 0x6D 'm'
+  0x3F,0x3F,0x3F,0x3F,0x0B,0x43,0x04,0x45,0x08,0x43,0x02,0x48,0x07,0x43,0x01,0x4A,0x06,0x43,0x00,0x42,0x04,0x43,0x06,0x46,0x05,0x44,0x05,0x45,0x07,0x43,0x05,0x44,0x08,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x3F,0x3F,0x3F,0x01, // 0x6E 'n'
+  0x3F,0x3F,0x3F,0x3F,0x0F,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0x6F 'o'
+  0x3F,0x3F,0x3F,0x3F,0x0B,0x43,0x03,0x44,0x0A,0x43,0x01,0x48,0x08,0x43,0x00,0x4A,0x07,0x47,0x03,0x44,0x06,0x45,0x06,0x43,0x06,0x44,0x07,0x43,0x06,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x44,0x06,0x44,0x06,0x46,0x03,0x44,0x07,0x4E,0x08,0x43,0x00,0x48,0x09,0x43,0x02,0x44,0x0B,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0F, // 0x70 'p'
+  0x3F,0x3F,0x3F,0x3F,0x0F,0x45,0x03,0x42,0x08,0x49,0x00,0x43,0x07,0x4F,0x06,0x44,0x04,0x46,0x06,0x43,0x07,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x05,0x43,0x08,0x44,0x05,0x43,0x07,0x45,0x06,0x43,0x04,0x42,0x00,0x43,0x06,0x4A,0x01,0x43,0x07,0x48,0x02,0x43,0x09,0x45,0x03,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x02, // 0x71 'q'
+  0x3F,0x3F,0x3F,0x3F,0x0D,0x43,0x04,0x46,0x07,0x43,0x02,0x48,0x07,0x43,0x01,0x49,0x07,0x43,0x00,0x43,0x03,0x42,0x07,0x46,0x05,0x42,0x07,0x45,0x06,0x42,0x07,0x44,0x07,0x42,0x07,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x0D, // 0x72 'r'
+  0x3F,0x3F,0x3F,0x3F,0x10,0x48,0x0B,0x4D,0x08,0x4E,0x07,0x45,0x06,0x42,0x07,0x43,0x13,0x43,0x13,0x43,0x13,0x45,0x12,0x47,0x10,0x49,0x0F,0x49,0x10,0x48,0x11,0x45,0x13,0x44,0x13,0x43,0x13,0x43,0x05,0x40,0x0B,0x44,0x05,0x43,0x07,0x44,0x06,0x4F,0x07,0x4E,0x0B,0x49,0x3F,0x3F,0x3F,0x07, // 0x73 's'
+  0x3F,0x3F,0x2F,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0E,0x52,0x04,0x52,0x04,0x52,0x09,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x44,0x13,0x44,0x12,0x4C,0x0B,0x4B,0x0D,0x49,0x3F,0x3F,0x3F,0x01, // 0x74 't'
+  0x3F,0x3F,0x3F,0x3F,0x0A,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x43,0x06,0x45,0x06,0x43,0x05,0x46,0x06,0x44,0x03,0x42,0x00,0x43,0x07,0x4A,0x00,0x43,0x08,0x47,0x02,0x43,0x09,0x45,0x03,0x43,0x3F,0x3F,0x3F,0x03, // 0x75 'u'
+  0x3F,0x3F,0x3F,0x3F,0x08,0x43,0x0C,0x44,0x02,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x44,0x09,0x44,0x04,0x43,0x09,0x43,0x05,0x44,0x08,0x43,0x06,0x43,0x07,0x43,0x07,0x43,0x07,0x43,0x08,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x44,0x04,0x43,0x0A,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0C,0x43,0x02,0x42,0x0D,0x43,0x01,0x43,0x0E,0x43,0x00,0x42,0x0F,0x47,0x0F,0x47,0x10,0x45,0x11,0x45,0x12,0x43,0x3F,0x3F,0x3F,0x09, // 0x76 'v'
+  0x3F,0x3F,0x3F,0x3F,0x07,0x43,0x10,0x46,0x10,0x46,0x05,0x43,0x06,0x41,0x01,0x42,0x05,0x44,0x04,0x42,0x01,0x42,0x05,0x44,0x04,0x42,0x01,0x43,0x03,0x45,0x04,0x42,0x01,0x43,0x03,0x45,0x04,0x42,0x01,0x43,0x03,0x41,0x01,0x41,0x04,0x41,0x03,0x42,0x03,0x41,0x01,0x42,0x02,0x42,0x03,0x42,0x02,0x42,0x01,0x42,0x02,0x42,0x03,0x42,0x02,0x42,0x01,0x42,0x02,0x42,0x03,0x43,0x01,0x41,0x03,0x41,0x02,0x42,0x03,0x43,0x01,0x41,0x03,0x42,0x01,0x41,0x05,0x42,0x00,0x42,0x03,0x42,0x00,0x42,0x05,0x42,0x00,0x42,0x03,0x42,0x00,0x42,0x05,0x42,0x00,0x41,0x05,0x41,0x00,0x42,0x05,0x45,0x05,0x45,0x05,0x45,0x05,0x44,0x06,0x44,0x06,0x44,0x07,0x43,0x06,0x44,0x07,0x43,0x07,0x43,0x3F,0x3F,0x3F,0x03, // 0x77 'w'
+  0x3F,0x3F,0x3F,0x3F,0x09,0x44,0x09,0x43,0x05,0x44,0x08,0x42,0x07,0x44,0x06,0x42,0x09,0x43,0x05,0x43,0x09,0x44,0x04,0x42,0x0B,0x44,0x02,0x42,0x0D,0x44,0x00,0x43,0x0D,0x44,0x00,0x42,0x0F,0x46,0x11,0x45,0x12,0x43,0x12,0x45,0x10,0x47,0x0E,0x43,0x00,0x44,0x0D,0x42,0x01,0x44,0x0C,0x43,0x02,0x44,0x0A,0x43,0x04,0x44,0x09,0x42,0x06,0x43,0x08,0x43,0x06,0x44,0x06,0x43,0x08,0x44,0x04,0x43,0x0A,0x44,0x3F,0x3F,0x3F,0x01, // 0x78 'x'
+  0x3F,0x3F,0x3F,0x3F,0x08,0x44,0x0C,0x43,0x02,0x43,0x0C,0x42,0x03,0x44,0x0A,0x43,0x04,0x43,0x0A,0x42,0x05,0x43,0x09,0x43,0x05,0x44,0x08,0x42,0x07,0x43,0x07,0x43,0x07,0x44,0x06,0x43,0x08,0x43,0x05,0x43,0x09,0x44,0x04,0x43,0x0A,0x43,0x03,0x43,0x0B,0x44,0x02,0x43,0x0C,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0E,0x43,0x00,0x42,0x0F,0x47,0x0F,0x46,0x11,0x45,0x11,0x45,0x12,0x43,0x13,0x43,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x43,0x12,0x43,0x0E,0x47,0x0F,0x46,0x10,0x45,0x0F, // 0x79 'y'
+  0x3F,0x3F,0x3F,0x3F,0x0A,0x52,0x04,0x52,0x04,0x52,0x12,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x11,0x44,0x12,0x52,0x04,0x52,0x04,0x52,0x3F,0x3F,0x3F,0x01, // 0x7A 'z'
+  0x25,0x45,0x0F,0x47,0x0E,0x48,0x0D,0x44,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x44,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x44,0x11,0x44,0x0E,0x47,0x0F,0x45,0x11,0x47,0x13,0x44,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x44,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x44,0x13,0x48,0x0F,0x47,0x11,0x45,0x33, // 0x7B '{'
+  0x22,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x39, // 0x7C '|'
+  0x1B,0x45,0x11,0x47,0x0F,0x48,0x13,0x44,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x44,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x44,0x13,0x44,0x13,0x47,0x11,0x45,0x0F,0x47,0x0E,0x44,0x11,0x44,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x44,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x12,0x44,0x0D,0x48,0x0E,0x47,0x0F,0x45,0x3D, // 0x7D '}'
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x33,0x44,0x11,0x47,0x08,0x42,0x02,0x49,0x07,0x42,0x02,0x42,0x02,0x45,0x05,0x42,0x01,0x42,0x05,0x45,0x02,0x42,0x02,0x42,0x07,0x49,0x02,0x42,0x08,0x47,0x11,0x44,0x3F,0x3F,0x3F,0x3F,0x3F,0x13, // 0x7E '~'
+  0x3F,0x3F,0x2C,0x4D,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x40,0x0B,0x40,0x09,0x4D,0x3F,0x3F,0x3F,0x04, // 0x7F ' '
+  0x3F,0x3F,0x32,0x48,0x0C,0x4D,0x07,0x4F,0x06,0x45,0x06,0x43,0x05,0x44,0x0B,0x40,0x04,0x44,0x11,0x44,0x12,0x43,0x13,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x44,0x13,0x44,0x13,0x44,0x13,0x46,0x06,0x42,0x07,0x4F,0x09,0x4D,0x0B,0x48,0x10,0x41,0x14,0x41,0x15,0x43,0x15,0x42,0x15,0x42,0x14,0x42,0x10,0x45,0x11,0x44,0x07, // 0x80 ' '
+  0x3F,0x26,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x3F,0x28,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x43,0x06,0x45,0x06,0x43,0x05,0x46,0x06,0x44,0x03,0x42,0x00,0x43,0x07,0x4A,0x00,0x43,0x08,0x47,0x02,0x43,0x09,0x45,0x03,0x43,0x3F,0x3F,0x3F,0x03, // 0x81 ' '
+  0x24,0x43,0x12,0x43,0x13,0x42,0x13,0x42,0x13,0x42,0x13,0x42,0x3F,0x35,0x45,0x0E,0x4A,0x0B,0x4C,0x09,0x44,0x04,0x44,0x08,0x43,0x06,0x43,0x07,0x43,0x08,0x42,0x07,0x43,0x08,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x51,0x05,0x51,0x05,0x51,0x05,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x44,0x13,0x45,0x06,0x42,0x08,0x4E,0x09,0x4D,0x0C,0x47,0x3F,0x3F,0x3F,0x05, // 0x82 ' '
+  0x20,0x45,0x11,0x45,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x43,0x03,0x43,0x0A,0x42,0x07,0x42,0x3F,0x2C,0x48,0x0B,0x4C,0x0A,0x4D,0x09,0x42,0x06,0x44,0x08,0x40,0x09,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x4A,0x0A,0x4C,0x08,0x4E,0x07,0x45,0x05,0x43,0x07,0x43,0x07,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x45,0x03,0x47,0x06,0x4B,0x00,0x46,0x04,0x49,0x01,0x46,0x06,0x45,0x05,0x43,0x3F,0x3F,0x3F,0x00, // 0x83 ' '
+  0x3F,0x27,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x3F,0x2C,0x48,0x0B,0x4C,0x0A,0x4D,0x09,0x42,0x06,0x44,0x08,0x40,0x09,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x4A,0x0A,0x4C,0x08,0x4E,0x07,0x45,0x05,0x43,0x07,0x43,0x07,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x45,0x03,0x47,0x06,0x4B,0x00,0x46,0x04,0x49,0x01,0x46,0x06,0x45,0x05,0x43,0x3F,0x3F,0x3F,0x00, // 0x84 ' '
+  0x1E,0x43,0x14,0x43,0x14,0x42,0x15,0x42,0x15,0x42,0x15,0x42,0x3F,0x30,0x48,0x0B,0x4C,0x0A,0x4D,0x09,0x42,0x06,0x44,0x08,0x40,0x09,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x4A,0x0A,0x4C,0x08,0x4E,0x07,0x45,0x05,0x43,0x07,0x43,0x07,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x45,0x03,0x47,0x06,0x4B,0x00,0x46,0x04,0x49,0x01,0x46,0x06,0x45,0x05,0x43,0x3F,0x3F,0x3F,0x00, // 0x85 ' '
+  0x09,0x42,0x13,0x40,0x02,0x40,0x11,0x40,0x04,0x40,0x10,0x40,0x04,0x40,0x10,0x40,0x04,0x40,0x11,0x40,0x02,0x40,0x13,0x42,0x3F,0x32,0x48,0x0B,0x4C,0x0A,0x4D,0x09,0x42,0x06,0x44,0x08,0x40,0x09,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x4A,0x0A,0x4C,0x08,0x4E,0x07,0x45,0x05,0x43,0x07,0x43,0x07,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x45,0x03,0x47,0x06,0x4B,0x00,0x46,0x04,0x49,0x01,0x46,0x06,0x45,0x05,0x43,0x3F,0x3F,0x3F,0x00, // 0x86 ' '
+  0x3F,0x3F,0x3F,0x3F,0x11,0x48,0x0C,0x4C,0x08,0x4E,0x07,0x45,0x06,0x42,0x07,0x44,0x11,0x44,0x12,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x14,0x43,0x13,0x44,0x12,0x45,0x12,0x46,0x05,0x42,0x08,0x4E,0x0A,0x4C,0x0C,0x48,0x0F,0x41,0x14,0x41,0x15,0x43,0x15,0x42,0x15,0x42,0x14,0x42,0x10,0x45,0x11,0x44,0x09, // 0x87 ' '
+  0x21,0x45,0x11,0x45,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x43,0x03,0x43,0x0A,0x42,0x07,0x42,0x3F,0x2D,0x45,0x0E,0x4A,0x0B,0x4C,0x09,0x44,0x04,0x44,0x08,0x43,0x06,0x43,0x07,0x43,0x08,0x42,0x07,0x43,0x08,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x51,0x05,0x51,0x05,0x51,0x05,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x44,0x13,0x45,0x06,0x42,0x08,0x4E,0x09,0x4D,0x0C,0x47,0x3F,0x3F,0x3F,0x05, // 0x88 ' '
+  0x3F,0x28,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x3F,0x2D,0x45,0x0E,0x4A,0x0B,0x4C,0x09,0x44,0x04,0x44,0x08,0x43,0x06,0x43,0x07,0x43,0x08,0x42,0x07,0x43,0x08,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x51,0x05,0x51,0x05,0x51,0x05,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x44,0x13,0x45,0x06,0x42,0x08,0x4E,0x09,0x4D,0x0C,0x47,0x3F,0x3F,0x3F,0x05, // 0x89 ' '
+  0x1E,0x43,0x14,0x43,0x14,0x42,0x15,0x42,0x15,0x42,0x15,0x42,0x3F,0x32,0x45,0x0E,0x4A,0x0B,0x4C,0x09,0x44,0x04,0x44,0x08,0x43,0x06,0x43,0x07,0x43,0x08,0x42,0x07,0x43,0x08,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x51,0x05,0x51,0x05,0x51,0x05,0x43,0x13,0x43,0x14,0x43,0x13,0x43,0x13,0x44,0x13,0x45,0x06,0x42,0x08,0x4E,0x09,0x4D,0x0C,0x47,0x3F,0x3F,0x3F,0x05, // 0x8A ' '
+  0x3F,0x27,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x3F,0x27,0x4B,0x0B,0x4B,0x0B,0x4B,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x08, // 0x8B ' '
+  0x21,0x45,0x11,0x45,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x43,0x03,0x43,0x0A,0x42,0x07,0x42,0x3F,0x26,0x4B,0x0B,0x4B,0x0B,0x4B,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x08, // 0x8C ' '
+  0x1E,0x43,0x14,0x43,0x14,0x42,0x15,0x42,0x15,0x42,0x15,0x42,0x3F,0x2B,0x4B,0x0B,0x4B,0x0B,0x4B,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x08, // 0x8D ' '
+  0x05,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x3F,0x2E,0x43,0x12,0x45,0x11,0x45,0x11,0x45,0x10,0x42,0x00,0x43,0x0F,0x42,0x00,0x43,0x0E,0x43,0x01,0x43,0x0D,0x42,0x02,0x43,0x0D,0x42,0x02,0x43,0x0C,0x43,0x03,0x43,0x0B,0x42,0x04,0x43,0x0A,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x42,0x06,0x43,0x08,0x43,0x07,0x43,0x07,0x43,0x07,0x43,0x06,0x51,0x05,0x51,0x05,0x51,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x44,0x0B,0x44,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x00,0x43,0x0E,0x44,0x3F,0x3F,0x3F, // 0x8E ' '
+  0x09,0x43,0x12,0x40,0x03,0x40,0x10,0x40,0x05,0x40,0x0F,0x40,0x05,0x40,0x0F,0x40,0x05,0x40,0x0F,0x41,0x03,0x41,0x10,0x45,0x12,0x43,0x12,0x45,0x11,0x45,0x11,0x45,0x10,0x42,0x00,0x43,0x0F,0x42,0x00,0x43,0x0E,0x43,0x01,0x43,0x0D,0x42,0x02,0x43,0x0D,0x42,0x02,0x43,0x0C,0x43,0x03,0x43,0x0B,0x42,0x04,0x43,0x0A,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x42,0x06,0x43,0x08,0x43,0x07,0x43,0x07,0x43,0x07,0x43,0x06,0x51,0x05,0x51,0x05,0x51,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x44,0x0B,0x44,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x00,0x43,0x0F,0x43,0x3F,0x3F,0x3F, // 0x8F ' '
+  0x0D,0x43,0x12,0x43,0x12,0x42,0x13,0x42,0x3F,0x15,0x50,0x06,0x50,0x06,0x50,0x06,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x4E,0x08,0x4E,0x08,0x4E,0x08,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x51,0x05,0x51,0x05,0x51,0x3F,0x3F,0x3F,0x01, // 0x90 ' '
+  0x3F,0x3F,0x3F,0x3F,0x0C,0x45,0x03,0x44,0x06,0x48,0x01,0x47,0x04,0x52,0x04,0x40,0x04,0x46,0x02,0x43,0x0A,0x44,0x04,0x42,0x0A,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x05,0x51,0x03,0x53,0x02,0x54,0x01,0x44,0x02,0x43,0x0A,0x44,0x03,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x44,0x09,0x43,0x04,0x44,0x09,0x44,0x02,0x46,0x05,0x41,0x01,0x48,0x00,0x4B,0x02,0x46,0x02,0x4A,0x03,0x44,0x04,0x46,0x3F,0x3F,0x3F,0x02, // 0x91 ' '
+  0x3F,0x3F,0x32,0x4A,0x0B,0x4B,0x0B,0x4B,0x0A,0x46,0x10,0x46,0x0F,0x47,0x0F,0x42,0x00,0x43,0x0F,0x42,0x00,0x43,0x0E,0x42,0x01,0x43,0x0E,0x42,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x42,0x02,0x48,0x07,0x43,0x02,0x48,0x07,0x42,0x03,0x48,0x07,0x42,0x03,0x43,0x0B,0x42,0x04,0x43,0x0B,0x42,0x04,0x43,0x0A,0x4C,0x0A,0x4C,0x09,0x4D,0x09,0x42,0x06,0x43,0x09,0x42,0x06,0x43,0x08,0x42,0x07,0x4A,0x01,0x42,0x07,0x4A,0x00,0x43,0x07,0x4A,0x3F,0x3F,0x3F,0x00, // 0x92 ' '
+  0x20,0x45,0x11,0x45,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x43,0x03,0x43,0x0A,0x42,0x07,0x42,0x3F,0x2C,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0x93 ' '
+  0x3F,0x26,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x3F,0x2D,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0x94 ' '
+  0x1D,0x43,0x14,0x43,0x14,0x42,0x15,0x42,0x15,0x42,0x15,0x42,0x3F,0x31,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0x95 ' '
+  0x20,0x45,0x11,0x45,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x43,0x03,0x43,0x0A,0x42,0x07,0x42,0x3F,0x27,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x43,0x06,0x45,0x06,0x43,0x05,0x46,0x06,0x44,0x03,0x42,0x00,0x43,0x07,0x4A,0x00,0x43,0x08,0x47,0x02,0x43,0x09,0x45,0x03,0x43,0x3F,0x3F,0x3F,0x03, // 0x96 ' '
+  0x1D,0x43,0x14,0x43,0x14,0x42,0x15,0x42,0x15,0x42,0x15,0x42,0x3F,0x2C,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x43,0x06,0x45,0x06,0x43,0x05,0x46,0x06,0x44,0x03,0x42,0x00,0x43,0x07,0x4A,0x00,0x43,0x08,0x47,0x02,0x43,0x09,0x45,0x03,0x43,0x3F,0x3F,0x3F,0x03, // 0x97 ' '
+  0x3F,0x27,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x3F,0x25,0x44,0x0C,0x43,0x02,0x43,0x0C,0x42,0x03,0x44,0x0A,0x43,0x04,0x43,0x0A,0x42,0x05,0x43,0x09,0x43,0x05,0x44,0x08,0x42,0x07,0x43,0x07,0x43,0x07,0x44,0x06,0x43,0x08,0x43,0x05,0x43,0x09,0x44,0x04,0x43,0x0A,0x43,0x03,0x43,0x0B,0x44,0x02,0x43,0x0C,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0E,0x43,0x00,0x42,0x0F,0x47,0x0F,0x46,0x11,0x45,0x11,0x45,0x12,0x43,0x13,0x43,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x43,0x12,0x43,0x0E,0x47,0x0F,0x46,0x10,0x45,0x0F, // 0x98 ' '
+  0x05,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x3F,0x2C,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x02,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0x99 ' '
+  0x06,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x3F,0x26,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x05,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x07,0x44,0x04,0x44,0x08,0x4E,0x0A,0x4A,0x0E,0x46,0x3F,0x3F,0x3F,0x07, // 0x9A ' '
+  0x3F,0x3F,0x3F,0x3F,0x0F,0x46,0x03,0x42,0x07,0x4E,0x07,0x4E,0x07,0x44,0x04,0x45,0x06,0x44,0x07,0x44,0x05,0x43,0x07,0x45,0x05,0x43,0x06,0x46,0x04,0x43,0x06,0x42,0x01,0x43,0x03,0x43,0x05,0x42,0x02,0x43,0x03,0x43,0x04,0x42,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x42,0x04,0x43,0x03,0x43,0x02,0x42,0x05,0x43,0x03,0x43,0x01,0x42,0x06,0x43,0x04,0x46,0x06,0x43,0x05,0x45,0x07,0x43,0x05,0x44,0x07,0x44,0x06,0x45,0x04,0x44,0x07,0x4E,0x07,0x4E,0x07,0x42,0x02,0x47,0x3F,0x3F,0x3F,0x07, // 0x9B ' '
+  0x3F,0x14,0x47,0x0E,0x48,0x0D,0x49,0x0C,0x43,0x05,0x40,0x0C,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x10,0x4A,0x0C,0x4A,0x0C,0x4A,0x0F,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x42,0x13,0x43,0x12,0x43,0x12,0x43,0x12,0x4F,0x07,0x4F,0x07,0x4F,0x3F,0x3F,0x3F,0x02, // 0x9C ' '
+  0x3F,0x3F,0x2F,0x47,0x03,0x42,0x06,0x4B,0x00,0x42,0x06,0x4F,0x06,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x08,0x44,0x04,0x43,0x08,0x46,0x03,0x43,0x07,0x47,0x02,0x43,0x08,0x42,0x01,0x43,0x01,0x43,0x07,0x42,0x02,0x43,0x01,0x43,0x06,0x42,0x03,0x43,0x01,0x43,0x05,0x42,0x04,0x43,0x01,0x43,0x04,0x43,0x04,0x43,0x01,0x43,0x04,0x42,0x05,0x43,0x01,0x43,0x03,0x42,0x06,0x43,0x01,0x43,0x02,0x42,0x07,0x43,0x01,0x43,0x01,0x42,0x08,0x43,0x02,0x47,0x07,0x43,0x03,0x46,0x08,0x43,0x04,0x44,0x08,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x06,0x4F,0x06,0x42,0x00,0x4B,0x06,0x42,0x03,0x47,0x3F,0x3F,0x3F,0x07, // 0x9D ' '
+  0x3F,0x3F,0x3F,0x3F,0x0A,0x40,0x0E,0x40,0x05,0x42,0x0C,0x42,0x03,0x44,0x0A,0x44,0x03,0x44,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x04,0x44,0x09,0x44,0x02,0x44,0x0B,0x44,0x00,0x44,0x0D,0x48,0x0F,0x46,0x11,0x44,0x11,0x46,0x0F,0x48,0x0D,0x44,0x00,0x44,0x0B,0x44,0x02,0x44,0x09,0x44,0x04,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x44,0x03,0x44,0x0A,0x44,0x03,0x42,0x0C,0x42,0x05,0x40,0x0E,0x40,0x3F,0x3F,0x3F,0x03, // 0x9E ' '
+  0x24,0x46,0x0E,0x49,0x0C,0x4A,0x0C,0x43,0x05,0x40,0x0B,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0F,0x4D,0x09,0x4D,0x09,0x4D,0x0D,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0B,0x40,0x05,0x43,0x0C,0x4A,0x0C,0x49,0x0E,0x46,0x0E, // 0x9F ' '
+  0x24,0x43,0x12,0x43,0x13,0x42,0x13,0x42,0x13,0x42,0x13,0x42,0x3F,0x33,0x48,0x0B,0x4C,0x0A,0x4D,0x09,0x42,0x06,0x44,0x08,0x40,0x09,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x4A,0x0A,0x4C,0x08,0x4E,0x07,0x45,0x05,0x43,0x07,0x43,0x07,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x45,0x03,0x47,0x06,0x4B,0x00,0x46,0x04,0x49,0x01,0x46,0x06,0x45,0x05,0x43,0x3F,0x3F,0x3F,0x00, // 0xA0 ' '
+  0x24,0x43,0x12,0x43,0x13,0x42,0x13,0x42,0x13,0x42,0x13,0x42,0x3F,0x2E,0x4B,0x0B,0x4B,0x0B,0x4B,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x08, // 0xA1 ' '
+  0x24,0x43,0x12,0x43,0x13,0x42,0x13,0x42,0x13,0x42,0x13,0x42,0x3F,0x33,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0xA2 ' '
+  0x24,0x43,0x12,0x43,0x13,0x42,0x13,0x42,0x13,0x42,0x13,0x42,0x3F,0x2E,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x43,0x06,0x45,0x06,0x43,0x05,0x46,0x06,0x44,0x03,0x42,0x00,0x43,0x07,0x4A,0x00,0x43,0x08,0x47,0x02,0x43,0x09,0x45,0x03,0x43,0x3F,0x3F,0x3F,0x03, // 0xA3 ' '
+  0x37,0x43,0x04,0x41,0x0B,0x46,0x02,0x41,0x0A,0x4C,0x0A,0x41,0x02,0x46,0x0B,0x41,0x04,0x43,0x3F,0x2A,0x43,0x04,0x45,0x08,0x43,0x02,0x48,0x07,0x43,0x01,0x4A,0x06,0x43,0x00,0x42,0x04,0x43,0x06,0x46,0x05,0x44,0x05,0x45,0x07,0x43,0x05,0x44,0x08,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x3F,0x3F,0x3F,0x01, // 0xA4 ' '
+  0x07,0x43,0x04,0x41,0x0B,0x46,0x01,0x42,0x0A,0x42,0x01,0x46,0x0B,0x41,0x04,0x43,0x3F,0x11,0x43,0x0A,0x42,0x05,0x43,0x0A,0x42,0x05,0x44,0x09,0x42,0x05,0x45,0x08,0x42,0x05,0x45,0x08,0x42,0x05,0x46,0x07,0x42,0x05,0x47,0x06,0x42,0x05,0x42,0x00,0x43,0x06,0x42,0x05,0x42,0x00,0x44,0x05,0x42,0x05,0x42,0x01,0x44,0x04,0x42,0x05,0x42,0x01,0x44,0x04,0x42,0x05,0x42,0x02,0x44,0x03,0x42,0x05,0x42,0x03,0x43,0x03,0x42,0x05,0x42,0x03,0x44,0x02,0x42,0x05,0x42,0x04,0x44,0x01,0x42,0x05,0x42,0x05,0x43,0x01,0x42,0x05,0x42,0x05,0x44,0x00,0x42,0x05,0x42,0x06,0x47,0x05,0x42,0x06,0x47,0x05,0x42,0x07,0x46,0x05,0x42,0x08,0x45,0x05,0x42,0x08,0x45,0x05,0x42,0x09,0x44,0x05,0x42,0x0A,0x43,0x05,0x42,0x0A,0x43,0x3F,0x3F,0x3F,0x02, // 0xA5 ' '
+  0x3F,0x0F,0x46,0x0E,0x4A,0x0C,0x42,0x04,0x43,0x14,0x42,0x14,0x42,0x14,0x42,0x0E,0x48,0x0C,0x4A,0x0B,0x43,0x04,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x43,0x03,0x44,0x0B,0x47,0x01,0x43,0x0A,0x44,0x03,0x43,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x13, // 0xA6 ' '
+  0x3F,0x0F,0x46,0x0E,0x4A,0x0B,0x43,0x04,0x43,0x0A,0x42,0x06,0x42,0x09,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x09,0x42,0x06,0x42,0x0A,0x43,0x04,0x43,0x0B,0x4A,0x0E,0x46,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x18, // 0xA7 ' '
+  0x3F,0x3F,0x3F,0x3F,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x33,0x43,0x13,0x43,0x13,0x43,0x13,0x42,0x13,0x43,0x12,0x43,0x12,0x44,0x11,0x44,0x11,0x43,0x12,0x43,0x12,0x43,0x12,0x43,0x12,0x43,0x13,0x43,0x13,0x43,0x0A,0x42,0x05,0x43,0x0A,0x42,0x05,0x44,0x09,0x42,0x06,0x45,0x07,0x42,0x06,0x50,0x08,0x4E,0x0A,0x49,0x05, // 0xA8 ' '
+  0x3F,0x10,0x44,0x10,0x48,0x0C,0x43,0x04,0x43,0x0A,0x41,0x00,0x45,0x01,0x41,0x09,0x41,0x01,0x41,0x02,0x41,0x01,0x41,0x08,0x41,0x01,0x41,0x02,0x41,0x01,0x41,0x07,0x41,0x02,0x41,0x02,0x41,0x02,0x41,0x06,0x41,0x02,0x41,0x01,0x41,0x03,0x41,0x06,0x41,0x02,0x44,0x04,0x41,0x06,0x41,0x02,0x41,0x01,0x40,0x04,0x41,0x06,0x41,0x02,0x41,0x01,0x41,0x03,0x41,0x07,0x41,0x01,0x41,0x01,0x41,0x02,0x41,0x08,0x41,0x01,0x41,0x02,0x41,0x01,0x41,0x09,0x41,0x08,0x41,0x0A,0x43,0x04,0x43,0x0C,0x48,0x10,0x44,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x29, // 0xA9 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x01,0x54,0x02,0x54,0x02,0x54,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x3F,0x3F,0x3F,0x3F,0x3F,0x10, // 0xAA ' '
+  0x3F,0x09,0x43,0x09,0x42,0x04,0x45,0x08,0x42,0x05,0x45,0x08,0x42,0x08,0x42,0x07,0x42,0x09,0x42,0x07,0x42,0x09,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x05,0x42,0x0B,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x03,0x42,0x0D,0x42,0x03,0x42,0x0D,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x01,0x42,0x03,0x45,0x0A,0x42,0x02,0x48,0x07,0x42,0x03,0x40,0x04,0x43,0x06,0x42,0x0A,0x42,0x05,0x42,0x0B,0x42,0x05,0x42,0x0B,0x42,0x04,0x42,0x0B,0x42,0x05,0x42,0x09,0x43,0x05,0x42,0x09,0x43,0x05,0x42,0x09,0x42,0x07,0x42,0x08,0x42,0x07,0x42,0x08,0x42,0x08,0x42,0x08,0x49,0x00,0x42,0x09,0x49,0x00,0x42,0x09,0x4C,0x3F,0x3F,0x3C, // 0xAB ' '
+  0x3F,0x09,0x43,0x0A,0x42,0x03,0x45,0x09,0x42,0x04,0x45,0x09,0x42,0x07,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x07,0x42,0x09,0x42,0x07,0x42,0x09,0x42,0x06,0x42,0x0A,0x42,0x05,0x42,0x0B,0x42,0x05,0x42,0x0B,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x03,0x42,0x0D,0x42,0x03,0x42,0x0D,0x42,0x02,0x42,0x04,0x43,0x0B,0x42,0x03,0x44,0x0A,0x42,0x04,0x44,0x0A,0x42,0x03,0x41,0x00,0x42,0x09,0x42,0x03,0x41,0x01,0x42,0x09,0x42,0x02,0x42,0x01,0x42,0x08,0x42,0x02,0x42,0x02,0x42,0x08,0x42,0x02,0x41,0x03,0x42,0x07,0x42,0x02,0x41,0x04,0x42,0x06,0x42,0x03,0x4B,0x04,0x42,0x03,0x4B,0x03,0x42,0x0B,0x42,0x05,0x42,0x0B,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x03,0x42,0x3F,0x3F,0x3B, // 0xAC ' '
+  0x3F,0x3F,0x3F,0x3F,0x11,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x33,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x09, // 0xAD ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x01,0x40,0x06,0x40,0x0D,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0B,0x42,0x04,0x42,0x0D,0x42,0x04,0x42,0x0D,0x42,0x04,0x42,0x0D,0x42,0x04,0x42,0x0D,0x42,0x04,0x42,0x0D,0x42,0x04,0x42,0x0D,0x42,0x04,0x42,0x0D,0x42,0x04,0x42,0x0D,0x40,0x06,0x40,0x3F,0x3F,0x3F,0x34, // 0xAE ' '
+  0x3F,0x3F,0x3F,0x3F,0x3A,0x40,0x07,0x40,0x0C,0x42,0x05,0x42,0x0C,0x43,0x04,0x42,0x0C,0x43,0x04,0x42,0x0C,0x43,0x04,0x42,0x0C,0x43,0x04,0x42,0x0C,0x43,0x04,0x42,0x0D,0x42,0x04,0x42,0x0C,0x43,0x04,0x42,0x0A,0x43,0x04,0x42,0x0A,0x43,0x04,0x42,0x0A,0x43,0x04,0x42,0x0A,0x43,0x04,0x42,0x0A,0x43,0x04,0x42,0x0A,0x43,0x04,0x42,0x0A,0x43,0x04,0x42,0x0C,0x40,0x07,0x40,0x3F,0x3F,0x3F,0x3A, // 0xAF ' '
+  0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x3F,0x23,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x3F,0x23,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x3F,0x23,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x3F,0x23,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x3F,0x23, // 0xB0 ' '
+  0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x47,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x07,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x47,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x07,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x47,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x07,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x47,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x07,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x47,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03, // 0xB1 ' '
+  0x7F,0x63,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x7F,0x63,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x7F,0x63,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x7F,0x63,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x7F,0x63,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03,0x43,0x03, // 0xB2 ' '
+  0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09, // 0xB3 ' '
+  0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09,0x4D,0x09,0x4D,0x09,0x4D,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09, // 0xB4 ' '
+  0x0B,0x43,0x12,0x43,0x12,0x42,0x13,0x42,0x3F,0x1D,0x43,0x12,0x45,0x11,0x45,0x11,0x45,0x10,0x42,0x00,0x43,0x0F,0x42,0x00,0x43,0x0E,0x43,0x01,0x43,0x0D,0x42,0x02,0x43,0x0D,0x42,0x02,0x43,0x0C,0x43,0x03,0x43,0x0B,0x42,0x04,0x43,0x0A,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x42,0x06,0x43,0x08,0x43,0x07,0x43,0x07,0x43,0x07,0x43,0x06,0x51,0x05,0x51,0x05,0x51,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x44,0x0B,0x44,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x00,0x43,0x0E,0x44,0x3F,0x3F,0x3F, // 0xB5 ' '
+  0x08,0x45,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x42,0x05,0x42,0x3F,0x17,0x43,0x12,0x45,0x11,0x45,0x11,0x45,0x10,0x42,0x00,0x43,0x0F,0x42,0x00,0x43,0x0E,0x43,0x01,0x43,0x0D,0x42,0x02,0x43,0x0D,0x42,0x02,0x43,0x0C,0x43,0x03,0x43,0x0B,0x42,0x04,0x43,0x0A,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x42,0x06,0x43,0x08,0x43,0x07,0x43,0x07,0x43,0x07,0x43,0x06,0x51,0x05,0x51,0x05,0x51,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x44,0x0B,0x44,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x00,0x43,0x0E,0x44,0x3F,0x3F,0x3F, // 0xB6 ' '
+  0x05,0x43,0x14,0x43,0x15,0x42,0x15,0x42,0x3F,0x1C,0x43,0x12,0x45,0x11,0x45,0x11,0x45,0x10,0x42,0x00,0x43,0x0F,0x42,0x00,0x43,0x0E,0x43,0x01,0x43,0x0D,0x42,0x02,0x43,0x0D,0x42,0x02,0x43,0x0C,0x43,0x03,0x43,0x0B,0x42,0x04,0x43,0x0A,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x42,0x06,0x43,0x08,0x43,0x07,0x43,0x07,0x43,0x07,0x43,0x06,0x51,0x05,0x51,0x05,0x51,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x44,0x0B,0x44,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x00,0x43,0x0E,0x44,0x3F,0x3F,0x3F, // 0xB7 ' '
+  0x3F,0x0F,0x46,0x0E,0x4A,0x0B,0x42,0x06,0x42,0x09,0x42,0x08,0x42,0x07,0x42,0x0A,0x42,0x06,0x41,0x0C,0x41,0x05,0x41,0x0E,0x41,0x04,0x41,0x05,0x45,0x02,0x41,0x04,0x41,0x03,0x48,0x01,0x41,0x03,0x41,0x03,0x49,0x02,0x41,0x02,0x41,0x02,0x43,0x04,0x41,0x02,0x41,0x02,0x41,0x02,0x42,0x0A,0x41,0x02,0x41,0x01,0x42,0x0B,0x41,0x02,0x41,0x01,0x42,0x0B,0x41,0x02,0x41,0x01,0x42,0x0B,0x41,0x02,0x41,0x01,0x42,0x0B,0x41,0x02,0x41,0x01,0x42,0x0B,0x41,0x02,0x41,0x01,0x43,0x0A,0x41,0x02,0x41,0x02,0x42,0x0A,0x41,0x02,0x41,0x02,0x44,0x04,0x40,0x02,0x41,0x02,0x41,0x03,0x49,0x02,0x41,0x03,0x41,0x03,0x48,0x01,0x41,0x04,0x41,0x04,0x45,0x03,0x41,0x04,0x41,0x0E,0x41,0x05,0x41,0x0C,0x41,0x06,0x42,0x0A,0x42,0x07,0x42,0x08,0x42,0x09,0x42,0x06,0x42,0x0B,0x4A,0x0E,0x46,0x3F,0x3F,0x30, // 0xB8 ' '
+  0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06,0x4A,0x02,0x42,0x06,0x4A,0x02,0x42,0x06,0x4A,0x02,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x06,0x4A,0x02,0x42,0x06,0x4A,0x02,0x42,0x06,0x4A,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06, // 0xB9 ' '
+  0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06, // 0xBA ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x50,0x06,0x50,0x06,0x50,0x14,0x42,0x14,0x42,0x14,0x42,0x06,0x4A,0x02,0x42,0x06,0x4A,0x02,0x42,0x06,0x4A,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06, // 0xBB ' '
+  0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06,0x4A,0x02,0x42,0x06,0x4A,0x02,0x42,0x06,0x4A,0x02,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x06,0x50,0x06,0x50,0x06,0x50,0x3F,0x3F,0x3F,0x3F,0x3F,0x2E, // 0xBC ' '
+  0x3F,0x13,0x41,0x15,0x41,0x15,0x41,0x13,0x46,0x0E,0x4A,0x0B,0x4B,0x0A,0x44,0x00,0x41,0x01,0x42,0x09,0x43,0x02,0x41,0x0D,0x43,0x03,0x41,0x0D,0x43,0x03,0x41,0x0C,0x44,0x03,0x41,0x0C,0x43,0x04,0x41,0x0C,0x43,0x04,0x41,0x0C,0x43,0x04,0x41,0x0C,0x43,0x04,0x41,0x0C,0x43,0x04,0x41,0x0C,0x43,0x04,0x41,0x0C,0x43,0x04,0x41,0x0C,0x44,0x03,0x41,0x0D,0x43,0x03,0x41,0x0D,0x44,0x02,0x41,0x0E,0x44,0x01,0x41,0x0E,0x48,0x02,0x41,0x0A,0x4C,0x0C,0x4A,0x0E,0x46,0x12,0x41,0x15,0x41,0x15,0x41,0x3F,0x3F,0x3F,0x09, // 0xBD ' '
+  0x3F,0x08,0x44,0x0D,0x43,0x01,0x44,0x0C,0x42,0x03,0x43,0x0B,0x42,0x04,0x44,0x09,0x43,0x05,0x43,0x08,0x43,0x07,0x43,0x07,0x42,0x08,0x44,0x05,0x42,0x0A,0x43,0x04,0x43,0x0A,0x44,0x03,0x42,0x0C,0x44,0x01,0x42,0x0E,0x43,0x00,0x43,0x0E,0x47,0x10,0x45,0x12,0x44,0x0C,0x4F,0x07,0x4F,0x07,0x4F,0x0D,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0D,0x4F,0x07,0x4F,0x07,0x4F,0x0D,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x09, // 0xBE ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x07,0x4D,0x09,0x4D,0x09,0x4D,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09, // 0xBF ' '
+  0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x4C,0x0A,0x4C,0x0A,0x4C,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x2F, // 0xC0 ' '
+  0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09,0x7F,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x2F, // 0xC1 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x07,0x7F,0x47,0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09, // 0xC2 ' '
+  0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x4C,0x0A,0x4C,0x0A,0x4C,0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09, // 0xC3 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x07,0x7F,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x2F, // 0xC4 ' '
+  0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09,0x7F,0x47,0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09, // 0xC5 ' '
+  0x37,0x43,0x04,0x41,0x0B,0x46,0x02,0x41,0x0A,0x4C,0x0A,0x41,0x02,0x46,0x0B,0x41,0x04,0x43,0x3F,0x2E,0x48,0x0B,0x4C,0x0A,0x4D,0x09,0x42,0x06,0x44,0x08,0x40,0x09,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x4A,0x0A,0x4C,0x08,0x4E,0x07,0x45,0x05,0x43,0x07,0x43,0x07,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x45,0x03,0x47,0x06,0x4B,0x00,0x46,0x04,0x49,0x01,0x46,0x06,0x45,0x05,0x43,0x3F,0x3F,0x3F,0x00, // 0xC6 ' '
+  0x07,0x43,0x04,0x41,0x0B,0x46,0x01,0x42,0x0A,0x42,0x01,0x46,0x0B,0x41,0x04,0x43,0x3F,0x18,0x43,0x12,0x45,0x11,0x45,0x11,0x45,0x10,0x42,0x00,0x43,0x0F,0x42,0x00,0x43,0x0E,0x43,0x01,0x43,0x0D,0x42,0x02,0x43,0x0D,0x42,0x02,0x43,0x0C,0x43,0x03,0x43,0x0B,0x42,0x04,0x43,0x0A,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x42,0x06,0x43,0x08,0x43,0x07,0x43,0x07,0x43,0x07,0x43,0x06,0x51,0x05,0x51,0x05,0x51,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x44,0x0B,0x44,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x00,0x43,0x0E,0x44,0x3F,0x3F,0x3F, // 0xC7 ' '
+  0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x49,0x07,0x42,0x02,0x49,0x07,0x42,0x02,0x49,0x07,0x42,0x14,0x42,0x14,0x42,0x14,0x4F,0x07,0x4F,0x07,0x4F,0x3F,0x3F,0x3F,0x3F,0x3F,0x27, // 0xC8 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x07,0x4F,0x07,0x4F,0x07,0x4F,0x07,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x02,0x49,0x07,0x42,0x02,0x49,0x07,0x42,0x02,0x49,0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06, // 0xC9 ' '
+  0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06,0x4A,0x02,0x54,0x02,0x54,0x02,0x49,0x3F,0x07,0x7F,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x27, // 0xCA ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x7F,0x47,0x3F,0x07,0x4A,0x02,0x54,0x02,0x54,0x02,0x49,0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06, // 0xCB ' '
+  0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x49,0x07,0x42,0x02,0x49,0x07,0x42,0x02,0x49,0x07,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x02,0x49,0x07,0x42,0x02,0x49,0x07,0x42,0x02,0x49,0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06, // 0xCC ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x7F,0x47,0x3F,0x07,0x7F,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x27, // 0xCD ' '
+  0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06,0x4A,0x02,0x54,0x02,0x54,0x02,0x49,0x3F,0x07,0x4A,0x02,0x54,0x02,0x54,0x02,0x49,0x07,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x0E,0x42,0x02,0x42,0x06, // 0xCE ' '
+  0x3F,0x3F,0x3F,0x03,0x40,0x0E,0x40,0x05,0x42,0x0C,0x42,0x05,0x42,0x02,0x44,0x02,0x42,0x07,0x4E,0x09,0x4C,0x0A,0x43,0x04,0x43,0x0A,0x42,0x06,0x42,0x09,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x08,0x42,0x09,0x42,0x06,0x42,0x0A,0x43,0x04,0x43,0x0A,0x4C,0x09,0x4E,0x07,0x42,0x02,0x44,0x02,0x42,0x05,0x42,0x0C,0x42,0x05,0x40,0x0E,0x40,0x3F,0x3F,0x3F,0x3F,0x3A, // 0xCF ' '
+  0x19,0x44,0x06,0x40,0x0A,0x47,0x01,0x43,0x09,0x4C,0x0D,0x48,0x11,0x45,0x10,0x47,0x0D,0x44,0x00,0x45,0x0B,0x42,0x03,0x44,0x0B,0x41,0x05,0x44,0x13,0x44,0x0C,0x4B,0x09,0x4D,0x08,0x4F,0x06,0x45,0x04,0x45,0x06,0x43,0x07,0x44,0x05,0x43,0x09,0x44,0x04,0x43,0x09,0x44,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x06,0x43,0x07,0x43,0x07,0x45,0x03,0x45,0x08,0x4D,0x0A,0x4A,0x0F,0x45,0x3F,0x3F,0x3F,0x08, // 0xD0 ' '
+  0x3F,0x3F,0x2A,0x4B,0x0B,0x4E,0x08,0x4F,0x07,0x43,0x06,0x45,0x06,0x43,0x08,0x44,0x05,0x43,0x09,0x44,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x00,0x4B,0x06,0x43,0x00,0x4B,0x06,0x43,0x00,0x4B,0x06,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x42,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x09,0x43,0x05,0x43,0x08,0x44,0x05,0x43,0x05,0x46,0x06,0x4F,0x07,0x4D,0x09,0x4B,0x3F,0x3F,0x3F,0x08, // 0xD1 ' '
+  0x09,0x45,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x42,0x05,0x42,0x3F,0x10,0x50,0x06,0x50,0x06,0x50,0x06,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x4E,0x08,0x4E,0x08,0x4E,0x08,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x51,0x05,0x51,0x05,0x51,0x3F,0x3F,0x3F,0x01, // 0xD2 ' '
+  0x06,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x3F,0x27,0x50,0x06,0x50,0x06,0x50,0x06,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x4E,0x08,0x4E,0x08,0x4E,0x08,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x51,0x05,0x51,0x05,0x51,0x3F,0x3F,0x3F,0x01, // 0xD3 ' '
+  0x06,0x43,0x14,0x43,0x15,0x42,0x15,0x42,0x3F,0x15,0x50,0x06,0x50,0x06,0x50,0x06,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x4E,0x08,0x4E,0x08,0x4E,0x08,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x51,0x05,0x51,0x05,0x51,0x3F,0x3F,0x3F,0x01, // 0xD4 ' '
+  0x3F,0x3F,0x3F,0x3F,0x0A,0x4B,0x0B,0x4B,0x0B,0x4B,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x08, // 0xD5 ' '
+  0x0C,0x43,0x12,0x43,0x12,0x42,0x13,0x42,0x3F,0x15,0x51,0x05,0x51,0x05,0x51,0x0C,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x51,0x05,0x51,0x05,0x51,0x3F,0x3F,0x3F,0x02, // 0xD6 ' '
+  0x08,0x45,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x42,0x05,0x42,0x3F,0x10,0x51,0x05,0x51,0x05,0x51,0x0C,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x51,0x05,0x51,0x05,0x51,0x3F,0x3F,0x3F,0x02, // 0xD7 ' '
+  0x05,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x3F,0x27,0x51,0x05,0x51,0x05,0x51,0x0C,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x51,0x05,0x51,0x05,0x51,0x3F,0x3F,0x3F,0x02, // 0xD8 ' '
+  0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09,0x4D,0x09,0x4D,0x09,0x4D,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x39, // 0xD9 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x12,0x4C,0x0A,0x4C,0x0A,0x4C,0x0A,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x09, // 0xDA ' '
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F, // 0xDB ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x5F, // 0xDC ' '
+  0x22,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x3F,0x3F,0x3F,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x39, // 0xDD ' '
+  0x05,0x43,0x14,0x43,0x15,0x42,0x15,0x42,0x3F,0x15,0x51,0x05,0x51,0x05,0x51,0x0C,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0C,0x51,0x05,0x51,0x05,0x51,0x3F,0x3F,0x3F,0x02, // 0xDE ' '
+  0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x7F,0x5F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1F, // 0xDF ' '
+  0x0C,0x43,0x12,0x43,0x12,0x42,0x13,0x42,0x3F,0x1A,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x02,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0xE0 ' '
+  0x1E,0x46,0x0E,0x4A,0x0B,0x4C,0x0A,0x44,0x03,0x44,0x08,0x44,0x05,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x42,0x09,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x03,0x43,0x0B,0x43,0x02,0x43,0x0C,0x43,0x02,0x43,0x0C,0x43,0x02,0x43,0x0C,0x43,0x02,0x44,0x0B,0x43,0x03,0x44,0x0A,0x43,0x03,0x45,0x09,0x43,0x04,0x46,0x07,0x43,0x05,0x46,0x06,0x43,0x07,0x44,0x06,0x43,0x08,0x44,0x05,0x43,0x09,0x44,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x01,0x42,0x04,0x43,0x05,0x43,0x01,0x4B,0x05,0x43,0x01,0x4A,0x06,0x43,0x03,0x46,0x3F,0x3F,0x3F,0x05, // 0xE1 ' '
+  0x08,0x45,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x42,0x05,0x42,0x3F,0x15,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x02,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0xE2 ' '
+  0x05,0x43,0x14,0x43,0x15,0x42,0x15,0x42,0x3F,0x1A,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x02,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0xE3 ' '
+  0x37,0x43,0x04,0x41,0x0B,0x46,0x02,0x41,0x0A,0x4C,0x0A,0x41,0x02,0x46,0x0B,0x41,0x04,0x43,0x3F,0x2E,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0xE4 ' '
+  0x07,0x43,0x04,0x41,0x0B,0x46,0x01,0x42,0x0A,0x42,0x01,0x46,0x0B,0x41,0x04,0x43,0x3F,0x16,0x47,0x0D,0x4B,0x0A,0x4D,0x08,0x44,0x05,0x44,0x06,0x44,0x07,0x44,0x05,0x43,0x09,0x43,0x04,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x02,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0D,0x43,0x02,0x43,0x0B,0x43,0x03,0x43,0x0B,0x43,0x04,0x43,0x09,0x43,0x05,0x44,0x07,0x44,0x06,0x44,0x05,0x44,0x08,0x4D,0x0A,0x4B,0x0D,0x47,0x3F,0x3F,0x3F,0x07, // 0xE5 ' '
+  0x3F,0x3F,0x3F,0x3F,0x0B,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x06,0x44,0x06,0x44,0x06,0x44,0x05,0x45,0x06,0x46,0x02,0x46,0x06,0x4B,0x00,0x43,0x06,0x43,0x00,0x45,0x01,0x44,0x05,0x43,0x01,0x43,0x03,0x43,0x05,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0F, // 0xE6 ' '
+  0x1B,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x03,0x44,0x0A,0x43,0x01,0x48,0x08,0x43,0x00,0x4A,0x07,0x43,0x00,0x42,0x03,0x44,0x06,0x45,0x06,0x43,0x06,0x44,0x07,0x43,0x06,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x08,0x43,0x06,0x43,0x08,0x43,0x06,0x44,0x06,0x44,0x06,0x46,0x03,0x44,0x07,0x4E,0x08,0x43,0x00,0x48,0x09,0x43,0x02,0x44,0x0B,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x0F, // 0xE7 ' '
+  0x3F,0x3F,0x2B,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x4D,0x09,0x4F,0x07,0x50,0x06,0x43,0x07,0x44,0x06,0x43,0x08,0x44,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x09,0x43,0x05,0x43,0x08,0x44,0x05,0x43,0x07,0x44,0x06,0x43,0x05,0x45,0x07,0x4E,0x08,0x4D,0x09,0x4A,0x0C,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x0F, // 0xE8 ' '
+  0x0C,0x43,0x12,0x43,0x12,0x42,0x13,0x42,0x3F,0x15,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x05,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x07,0x44,0x04,0x44,0x08,0x4E,0x0A,0x4A,0x0E,0x46,0x3F,0x3F,0x3F,0x07, // 0xE9 ' '
+  0x08,0x45,0x10,0x47,0x0E,0x43,0x01,0x43,0x0C,0x42,0x05,0x42,0x3F,0x10,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x05,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x07,0x44,0x04,0x44,0x08,0x4E,0x0A,0x4A,0x0E,0x46,0x3F,0x3F,0x3F,0x07, // 0xEA ' '
+  0x06,0x43,0x14,0x43,0x15,0x42,0x15,0x42,0x3F,0x14,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x04,0x43,0x0A,0x43,0x05,0x43,0x08,0x43,0x06,0x43,0x07,0x44,0x07,0x44,0x04,0x44,0x08,0x4E,0x0A,0x4A,0x0E,0x46,0x3F,0x3F,0x3F,0x07, // 0xEB ' '
+  0x24,0x43,0x12,0x43,0x13,0x42,0x13,0x42,0x13,0x42,0x13,0x42,0x3F,0x2C,0x44,0x0C,0x43,0x02,0x43,0x0C,0x42,0x03,0x44,0x0A,0x43,0x04,0x43,0x0A,0x42,0x05,0x43,0x09,0x43,0x05,0x44,0x08,0x42,0x07,0x43,0x07,0x43,0x07,0x44,0x06,0x43,0x08,0x43,0x05,0x43,0x09,0x44,0x04,0x43,0x0A,0x43,0x03,0x43,0x0B,0x44,0x02,0x43,0x0C,0x43,0x01,0x43,0x0D,0x43,0x01,0x43,0x0E,0x43,0x00,0x42,0x0F,0x47,0x0F,0x46,0x11,0x45,0x11,0x45,0x12,0x43,0x13,0x43,0x13,0x42,0x13,0x43,0x13,0x42,0x13,0x43,0x12,0x43,0x0E,0x47,0x0F,0x46,0x10,0x45,0x0F, // 0xEC ' '
+  0x0C,0x43,0x12,0x43,0x12,0x42,0x13,0x42,0x3F,0x13,0x44,0x0D,0x43,0x01,0x43,0x0C,0x43,0x03,0x43,0x0B,0x42,0x04,0x44,0x09,0x43,0x05,0x43,0x09,0x42,0x07,0x43,0x07,0x43,0x07,0x44,0x05,0x43,0x09,0x44,0x04,0x42,0x0B,0x43,0x03,0x43,0x0B,0x44,0x02,0x42,0x0D,0x44,0x00,0x43,0x0E,0x47,0x0F,0x46,0x11,0x45,0x12,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x08, // 0xED ' '
+  0x7F,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x37, // 0xEE ' '
+  0x0A,0x43,0x12,0x43,0x12,0x42,0x13,0x42,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x2C, // 0xEF ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x33,0x4F,0x07,0x4F,0x07,0x4F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x0B, // 0xF0 ' '
+  0x3F,0x3F,0x3F,0x3F,0x12,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x0B,0x54,0x02,0x54,0x02,0x54,0x0B,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x3F,0x13,0x54,0x02,0x54,0x02,0x54,0x3F,0x3F,0x3F,0x00, // 0xF1 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x7F,0x47,0x3F,0x07,0x6F, // 0xF2 ' '
+  0x3F,0x08,0x47,0x0B,0x42,0x00,0x48,0x09,0x42,0x01,0x40,0x04,0x43,0x07,0x42,0x09,0x42,0x07,0x42,0x09,0x42,0x06,0x42,0x09,0x42,0x06,0x42,0x06,0x45,0x07,0x42,0x06,0x44,0x07,0x42,0x09,0x44,0x04,0x42,0x0C,0x43,0x03,0x42,0x0D,0x42,0x02,0x42,0x0E,0x42,0x01,0x42,0x08,0x40,0x04,0x43,0x01,0x42,0x08,0x48,0x01,0x42,0x09,0x46,0x02,0x42,0x03,0x43,0x0C,0x42,0x02,0x44,0x0B,0x42,0x03,0x44,0x0A,0x42,0x03,0x41,0x00,0x42,0x0A,0x42,0x02,0x41,0x01,0x42,0x09,0x42,0x02,0x42,0x01,0x42,0x08,0x42,0x02,0x42,0x02,0x42,0x08,0x42,0x02,0x41,0x03,0x42,0x07,0x42,0x02,0x41,0x04,0x42,0x06,0x42,0x03,0x4B,0x04,0x42,0x03,0x4B,0x03,0x42,0x0B,0x42,0x04,0x42,0x0C,0x42,0x04,0x42,0x0C,0x42,0x03,0x42,0x0D,0x42,0x02,0x42,0x3F,0x3F,0x3B, // 0xF3 ' '
+  0x3F,0x0E,0x4B,0x09,0x4D,0x08,0x47,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x07,0x48,0x04,0x41,0x08,0x47,0x04,0x41,0x08,0x47,0x04,0x41,0x09,0x46,0x04,0x41,0x0A,0x45,0x04,0x41,0x0C,0x43,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x34, // 0xF4 ' '
+  0x3F,0x11,0x47,0x0D,0x4A,0x0B,0x4B,0x0A,0x43,0x06,0x41,0x09,0x43,0x13,0x42,0x14,0x42,0x14,0x42,0x14,0x44,0x13,0x44,0x13,0x46,0x10,0x48,0x0E,0x49,0x0C,0x42,0x02,0x45,0x0B,0x41,0x05,0x44,0x09,0x42,0x06,0x44,0x08,0x42,0x07,0x43,0x08,0x42,0x08,0x42,0x08,0x43,0x07,0x42,0x09,0x44,0x05,0x42,0x09,0x45,0x03,0x42,0x0B,0x47,0x00,0x42,0x0D,0x48,0x10,0x46,0x12,0x45,0x13,0x43,0x14,0x43,0x14,0x42,0x14,0x42,0x14,0x42,0x08,0x40,0x09,0x43,0x08,0x43,0x05,0x43,0x09,0x4C,0x0A,0x4B,0x0E,0x46,0x38, // 0xF5 ' '
+  0x3F,0x3F,0x3F,0x3F,0x11,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x03,0x54,0x02,0x54,0x02,0x54,0x3F,0x3F,0x02,0x43,0x13,0x43,0x13,0x43,0x13,0x43,0x3F,0x3F,0x3F,0x09, // 0xF6 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x0A,0x41,0x14,0x41,0x15,0x43,0x15,0x42,0x15,0x42,0x14,0x42,0x10,0x45,0x11,0x44,0x09, // 0xF7 ' '
+  0x3F,0x10,0x44,0x11,0x46,0x0F,0x42,0x02,0x42,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x41,0x04,0x41,0x0E,0x42,0x02,0x42,0x0F,0x46,0x11,0x44,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x29, // 0xF8 ' '
+  0x05,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x0A,0x42,0x06,0x42,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3C, // 0xF9 ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x11,0x44,0x12,0x44,0x12,0x44,0x12,0x44,0x12,0x44,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x08, // 0xFA ' '
+  0x3F,0x0F,0x44,0x10,0x46,0x10,0x46,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x14,0x42,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x1A, // 0xFB ' '
+  0x3F,0x0F,0x47,0x0D,0x4A,0x0C,0x42,0x04,0x43,0x14,0x42,0x14,0x42,0x12,0x43,0x0E,0x47,0x0F,0x46,0x15,0x43,0x15,0x42,0x14,0x42,0x14,0x42,0x0B,0x42,0x04,0x43,0x0B,0x4A,0x0D,0x47,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x18, // 0xFC ' '
+  0x3F,0x0F,0x46,0x0E,0x4A,0x0C,0x41,0x05,0x43,0x14,0x42,0x14,0x42,0x14,0x42,0x13,0x42,0x12,0x43,0x11,0x44,0x11,0x43,0x11,0x43,0x12,0x43,0x13,0x4B,0x0B,0x4B,0x0B,0x4B,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x15, // 0xFD ' '
+  0x3F,0x3F,0x3F,0x3F,0x08,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x01,0x55,0x3F,0x3F,0x3F,0x00, // 0xFE ' '
+  0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F,0x3F, // 0xFF ' '
 };
+static const UG_U16 font_24x40_offsets[] = {
+  0,15,131,213,274,337,405,473,488,503,518,533,636,725,740,859,
+  943,996,1049,1137,1243,1381,1477,1503,1595,1675,1755,1788,1821,1871,1920,1973,
+  2026,2041,2097,2152,2261,2370,2522,2642,2675,2750,2826,2893,2943,2977,2997,3022,
+  3098,3210,3277,3344,3412,3499,3565,3663,3726,3832,3930,3965,4009,4059,4084,4134,
+  4198,4344,4435,4523,4585,4679,4735,4791,4871,4971,5027,5085,5189,5245,5401,5527,
+  5621,5697,5800,5894,5956,6009,6109,6205,6355,6448,6526,6582,6657,6732,6807,6892,
+  6908,6930,7004,7112,7166,7272,7336,7404,7511,7621,7679,7752,7856,7922,8056,8150,
+  8230,8333,8438,8504,8560,8616,8710,8792,8926,9008,9101,9151,9226,9301,9376,9420,
+  9522,9597,9701,9774,9863,9947,10030,10125,10192,10271,10345,10418,10478,10543,10602,10704,
+  10817,10880,10968,11056,11151,11241,11330,11439,11542,11645,11750,11861,11959,12024,12144,12226,
+  12309,12392,12451,12540,12643,12752,12893,12949,13011,13075,13180,13212,13336,13472,13528,13605,
+  13681,13806,14037,14162,14243,14324,14422,14524,14622,14774,14929,15090,15180,15274,15373,15458,
+  15508,15559,15607,15654,15735,15752,15830,15919,16025,16119,16210,16292,16370,16525,16543,16685,
+  16765,16871,16965,17032,17099,17162,17212,17275,17342,17409,17460,17510,17525,17541,17603,17666,
+  17682,17783,17907,18012,18113,18208,18317,18426,18547,18621,18728,18839,18946,19048,19133,19149,
+  19171,19191,19236,19253,19393,19531,19627,19661,19690,19730,19756,19780,19820,19864,19906,19956,
+  19971 };
+static const UG_U8 font_24x40_widths[] = {
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,
+  24,24,24,24,24,24,24,24,24,24,24,24,24,24,24,24 };
 #endif
 
 #ifdef USE_FONT_32X53
@@ -4557,7 +4595,7 @@ __UG_FONT_DATA unsigned char font_32x53[256][212]={
    const UG_FONT FONT_22X36 = {(unsigned char*)font_22x36,FONT_TYPE_1BPP,22,36,0,255,NULL};
 #endif
 #ifdef USE_FONT_24X40
-   const UG_FONT FONT_24X40 = {(unsigned char*)font_24x40,FONT_TYPE_1BPP,24,40,0,255,NULL};
+   const UG_FONT FONT_24X40 = {(unsigned char*)font_24x40,FONT_TYPE_RLE,24,40,0,255,(UG_U8*)font_24x40_widths,font_24x40_offsets};
 #endif
 #ifdef USE_FONT_32X53
    const UG_FONT FONT_32X53 = {(unsigned char*)font_32x53,FONT_TYPE_1BPP,32,53,0,255,NULL};
@@ -5313,13 +5351,133 @@ const UG_COLOR pal_checkbox_released[] =
 /* -------------------------------------------------------------------------------- */
 /* -- INTERNAL FUNCTIONS                                                         -- */
 /* -------------------------------------------------------------------------------- */
+#ifdef USE_COLOR_RGB565
+   #define UG_BLEND_MASK_R 0xF800
+   #define UG_BLEND_MASK_G 0x07E0
+   #define UG_BLEND_MASK_B 0x001F
+#endif
+#ifdef USE_COLOR_RGB888
+   #define UG_BLEND_MASK_R 0xFF0000
+   #define UG_BLEND_MASK_G 0x00FF00
+   #define UG_BLEND_MASK_B 0x0000FF
+#endif
+
+/* One channel of fc and bc mixed level/UG_BLEND_LEVELS to (UG_BLEND_LEVELS-level)/UG_BLEND_LEVELS, rounded */
+static UG_COLOR _UG_BlendChannel( UG_COLOR fc, UG_COLOR bc, UG_U32 mask, UG_U8 level )
+{
+   UG_U32 lsb = mask & -mask;
+
+   return (((fc & mask) * level + (bc & mask) * (UG_U32)(UG_BLEND_LEVELS - level) + lsb * (UG_BLEND_LEVELS / 2)) / UG_BLEND_LEVELS) & mask;
+}
+
+/* The blended colors of the last fc and bc, built again only when a glyph uses other colors */
+static UG_COLOR blend_table[UG_BLEND_LEVELS + 1];
+static UG_COLOR blend_fc;
+static UG_COLOR blend_bc;
+static UG_U8 blend_valid;
+
+const UG_COLOR* UG_BlendTable( UG_COLOR fc, UG_COLOR bc )
+{
+   UG_U8 l;
+
+   if ( !blend_valid || fc != blend_fc || bc != blend_bc )
+   {
+      for ( l = 0; l <= UG_BLEND_LEVELS; l++ )
+      {
+         blend_table[l] = _UG_BlendChannel(fc, bc, UG_BLEND_MASK_R, l) |
+                          _UG_BlendChannel(fc, bc, UG_BLEND_MASK_G, l) |
+                          _UG_BlendChannel(fc, bc, UG_BLEND_MASK_B, l);
+      }
+      blend_fc = fc;
+      blend_bc = bc;
+      blend_valid = 1;
+   }
+
+   return blend_table;
+}
+
+/* Where the runs of a FONT_TYPE_RLE glyph go */
+typedef struct
+{
+   void(*push_pixel)(UG_COLOR);
+   void(*fill_run)(UG_COLOR, UG_U16);
+   UG_S16 xs;
+   UG_S16 xe;
+   UG_S16 x;
+   UG_S16 y;
+} UG_RLE_OUT;
+
+static void _UG_PutRun( UG_RLE_OUT* out, UG_COLOR color, UG_U16 n )
+{
+   if ( out->fill_run )
+   {
+      out->fill_run(color, n);
+   }
+   else if ( out->push_pixel )
+   {
+      while ( n-- ) out->push_pixel(color);
+   }
+   else
+   {
+      while ( n-- )
+      {
+         gui->pset(out->x, out->y, color);
+         if ( ++out->x > out->xe )
+         {
+            out->x = out->xs;
+            out->y++;
+         }
+      }
+   }
+}
+
+static void _UG_PutCharRLE( UG_U8 bt, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const UG_FONT* font, UG_U16 actual_char_width )
+{
+   const UG_U8* p = font->p + font->offsets[bt - font->start_char];
+   const UG_U8* end = font->p + font->offsets[bt - font->start_char + 1];
+   UG_RLE_OUT out = { NULL, NULL, x, x + actual_char_width - 1, x, y };
+   const UG_COLOR* blend = NULL; /* only built for blended pixels */
+   UG_U8 b;
+   UG_U16 n;
+
+   /* Is hardware acceleration available? */
+   if ( gui->driver[DRIVER_FILL_AREA].state & DRIVER_ENABLED )
+   {
+      out.push_pixel = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(x,y,x+actual_char_width-1,y+font->char_height-1);
+
+      /* Then every run is a single burst */
+      if ( gui->driver[DRIVER_FILL_RUN].state & DRIVER_ENABLED )
+         out.fill_run = (void(*)(UG_COLOR, UG_U16))gui->driver[DRIVER_FILL_RUN].driver;
+   }
+
+   while ( p < end )
+   {
+      b = *p++;
+      n = (b & ~FONT_RLE_TYPE_MASK) + 1;
+
+      switch ( b & FONT_RLE_TYPE_MASK )
+      {
+         case FONT_RLE_BC: _UG_PutRun(&out, bc, n); break;
+         case FONT_RLE_FC: _UG_PutRun(&out, fc, n); break;
+         case FONT_RLE_ALPHA:
+            if ( !blend ) blend = UG_BlendTable(fc, bc);
+            _UG_PutRun(&out, blend[UG_BLEND_LEVEL(*p++)], n);
+            break;
+         case FONT_RLE_ALPHAS:
+            if ( !blend ) blend = UG_BlendTable(fc, bc);
+            while ( n-- ) _UG_PutRun(&out, blend[UG_BLEND_LEVEL(*p++)], 1);
+            break;
+      }
+   }
+}
+
 void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const UG_FONT* font)
 {
    UG_U16 i,j,k,xo,yo,c,bn,actual_char_width;
    UG_U8 b,bt;
    UG_U32 index;
-   UG_COLOR color;
    void(*push_pixel)(UG_COLOR);
+   const UG_COLOR* blend;
 
    bt = (UG_U8)chr;
 
@@ -5344,12 +5502,25 @@ void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const
    if ( font->char_width % 8 ) bn++;
    actual_char_width = (font->widths ? font->widths[bt - font->start_char] : font->char_width);
 
+   /* Already runs, so not through the glyph cache */
+   if ( font->font_type == FONT_TYPE_RLE )
+   {
+      _UG_PutCharRLE(bt, x, y, fc, bc, font, actual_char_width);
+      return;
+   }
+
    /* Is hardware acceleration available? */
    if ( gui->driver[DRIVER_FILL_AREA].state & DRIVER_ENABLED )
    {
 	   //(void(*)(UG_COLOR))
       push_pixel = ((void*(*)(UG_S16, UG_S16, UG_S16, UG_S16))gui->driver[DRIVER_FILL_AREA].driver)(x,y,x+actual_char_width-1,y+font->char_height-1);
-	   
+
+#ifdef USE_GLYPH_CACHE
+      /* Already drawn once with these colors? */
+      if ( (gui->driver[DRIVER_FILL_RUN].state & DRIVER_ENABLED) &&
+           glyph_cache_begin(font, bt, fc, bc, &push_pixel, (void(*)(UG_COLOR, UG_U16))gui->driver[DRIVER_FILL_RUN].driver) ) return;
+#endif
+
       if (font->font_type == FONT_TYPE_1BPP)
 	  {
 	      index = (bt - font->start_char)* font->char_height * bn;
@@ -5377,20 +5548,21 @@ void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const
 	  }
 	  else if (font->font_type == FONT_TYPE_8BPP)
 	  {
+		   blend = UG_BlendTable(fc, bc);
 		   index = (bt - font->start_char)* font->char_height * font->char_width;
 		   for( j=0;j<font->char_height;j++ )
 		   {
 			  for( i=0;i<actual_char_width;i++ )
 			  {
 				 b = font->p[index++];
-				 color = ((((fc & 0xFF) * b + (bc & 0xFF) * (256 - b)) >> 8) & 0xFF) |//Blue component
-				         ((((fc & 0xFF00) * b + (bc & 0xFF00) * (256 - b)) >> 8)  & 0xFF00) |//Green component
-				         ((((fc & 0xFF0000) * b + (bc & 0xFF0000) * (256 - b)) >> 8) & 0xFF0000); //Red component
-				 push_pixel(color);
+				 push_pixel(blend[UG_BLEND_LEVEL(b)]);
 			  }
 			  index += font->char_width - actual_char_width;
 		  }
 	  }
+#ifdef USE_GLYPH_CACHE
+      glyph_cache_end();
+#endif
    }
    else
    {
@@ -5425,6 +5597,7 @@ void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const
       }
       else if (font->font_type == FONT_TYPE_8BPP)
       {
+         blend = UG_BlendTable(fc, bc);
          index = (bt - font->start_char)* font->char_height * font->char_width;
          for( j=0;j<font->char_height;j++ )
          {
@@ -5432,10 +5605,7 @@ void _UG_PutChar( char chr, UG_S16 x, UG_S16 y, UG_COLOR fc, UG_COLOR bc, const
             for( i=0;i<actual_char_width;i++ )
             {
                b = font->p[index++];
-               color = ((((fc & 0xFF) * b + (bc & 0xFF) * (256 - b)) >> 8) & 0xFF) | //Blue component
-                       ((((fc & 0xFF00) * b + (bc & 0xFF00) * (256 - b)) >> 8)  & 0xFF00) | //Green component
-                       ((((fc & 0xFF0000) * b + (bc & 0xFF0000) * (256 - b)) >> 8) & 0xFF0000); //Red component
-               gui->pset(xo,yo,color);
+               gui->pset(xo,yo,blend[UG_BLEND_LEVEL(b)]);
                xo++;
             }
             index += font->char_width - actual_char_width;
@@ -0,0 +1,23 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Stand-in for the nRF SDK app_error.h, only what common/src uses
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#define NRF_FAULT_ID_SDK_ERROR 0x4001
+
+typedef struct {
+  uint16_t line_num; /**< The line number where the error occurred. */
+  uint8_t const *p_file_name; /**< The file in which the error occurred. */
+  uint32_t err_code; /**< The error code representing the error that occurred. */
+} error_info_t;
+
+void app_error_fault_handler(uint32_t id, uint32_t pc, uint32_t info);
+
+#define APP_ERROR_HANDLER(ERR_CODE) app_error_fault_handler((ERR_CODE), 0, 0)
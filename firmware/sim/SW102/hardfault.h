@@ -0,0 +1,22 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Stand-in for the nRF SDK hardfault.h, only what common/src uses
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+typedef struct HardFault_stack {
+  uint32_t r0;
+  uint32_t r1;
+  uint32_t r2;
+  uint32_t r3;
+  uint32_t r12;
+  uint32_t lr;
+  uint32_t pc;
+  uint32_t psr;
+} HardFault_stack_t;
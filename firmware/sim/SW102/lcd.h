@@ -0,0 +1,15 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Stand-in for SW102/include/lcd.h
+ */
+
+#pragma once
+
+#include "stdint.h"
+
+void lcd_init(void);
+void lcd_refresh(void); // Call to flush the changed parts of the framebuffer to SPI device
+void lcd_set_backlight_intensity(uint8_t level);
@@ -0,0 +1,26 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Stand-in for SW102/include/main.h, which pulls in the nRF SDK board headers.
+ */
+
+#ifndef INCLUDE_MAIN_H_
+#define INCLUDE_MAIN_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+
+//#define  MAIN_SCREEN_FIELD_LABELS_COLOR C_GRAY
+#define  MAIN_SCREEN_FIELD_LABELS_COLOR C_WHITE_SMOKE
+
+void system_power(bool state);
+
+uint32_t get_seconds(); // how many seconds since boot
+uint32_t get_time_base_counter_1ms();
+
+void SW102_rt_processing_stop(void);
+void SW102_rt_processing_start(void);
+
+#endif /* INCLUDE_MAIN_H_ */
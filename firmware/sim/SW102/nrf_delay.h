@@ -0,0 +1,16 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Stand-in for the nRF SDK nrf_delay.h, only what common/src uses
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+static inline void nrf_delay_ms(uint32_t ms)
+{
+  // virtual time only advances in the simulator main loop
+}
@@ -0,0 +1,18 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Stand-in for the nRF SDK nrf_nvic.h, only what common/src uses
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include "sim.h"
+
+static inline uint32_t sd_nvic_SystemReset(void)
+{
+  sim_exit(1);
+  return 0;
+}
@@ -0,0 +1,163 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Checks the anti-aliased glyph colors of UG_BlendTable() against a floating point RGB565 blend, for every alpha
+ * of many color pairs: each channel must be within the error of rounding the alpha to UG_BLEND_LEVELS levels plus
+ * the rounding of the channel itself. Also shows how far the old blend, with RGB888 channel masks, was. Then times
+ * both per pixel, counting the table builds for a new color pair every glyph of 4000 pixels.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <time.h>
+#include "ugui.h"
+
+#define CHECK_PAIRS       20000
+#define BENCH_PIXELS      (1 << 24)
+#define BENCH_GLYPH_PIXELS 4000
+
+static const struct {
+  const char *name;
+  uint32_t ui32_mask;
+  int shift;
+  int max;
+} m_channels[3] = { { "red", 0xF800, 11, 31 }, { "green", 0x07E0, 5, 63 }, { "blue", 0x001F, 0, 31 } };
+
+static volatile UG_COLOR m_sink;
+
+uint32_t profile_hw_ticks(void)
+{
+  return 0;
+}
+
+// The blend _UG_PutChar() used before, RGB888 masks
+static UG_COLOR old_blend(UG_COLOR fc, UG_COLOR bc, UG_U8 b)
+{
+  return ((((fc & 0xFF) * b + (bc & 0xFF) * (256 - b)) >> 8) & 0xFF) |
+         ((((fc & 0xFF00) * b + (bc & 0xFF00) * (256 - b)) >> 8) & 0xFF00) |
+         ((((fc & 0xFF0000) * b + (bc & 0xFF0000) * (256 - b)) >> 8) & 0xFF0000);
+}
+
+static double reference(UG_COLOR fc, UG_COLOR bc, int channel, int alpha)
+{
+  int f = (fc & m_channels[channel].ui32_mask) >> m_channels[channel].shift;
+  int b = (bc & m_channels[channel].ui32_mask) >> m_channels[channel].shift;
+
+  return f * (alpha / 255.0) + b * (1.0 - alpha / 255.0);
+}
+
+static double channel_error(UG_COLOR color, UG_COLOR fc, UG_COLOR bc, int channel, int alpha)
+{
+  int c = (color & m_channels[channel].ui32_mask) >> m_channels[channel].shift;
+
+  return fabs(c - reference(fc, bc, channel, alpha));
+}
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static bool check(void)
+{
+  double max_alpha_error = 0, max_error[3] = { 0 }, max_old_error[3] = { 0 };
+
+  // how far the rounded level is from the alpha, the same for every pair
+  for (int alpha = 0; alpha < 256; alpha++) {
+    double e = fabs(UG_BLEND_LEVEL(alpha) / (double) UG_BLEND_LEVELS - alpha / 255.0);
+
+    if (e > max_alpha_error)
+      max_alpha_error = e;
+  }
+
+  for (int pair = 0; pair < CHECK_PAIRS; pair++) {
+    // the first ones are the extremes, black and white both ways and a color on itself
+    UG_COLOR fc = pair == 0 ? C_WHITE : pair == 1 ? C_BLACK : pair == 2 ? C_RED : rand();
+    UG_COLOR bc = pair == 0 ? C_BLACK : pair == 1 ? C_WHITE : pair == 2 ? C_RED : rand();
+    const UG_COLOR *p_table = UG_BlendTable(fc, bc);
+
+    if (p_table[0] != bc || p_table[UG_BLEND_LEVELS] != fc) {
+      printf("%04x on %04x: levels 0 and %d are %04x and %04x\n", fc, bc, UG_BLEND_LEVELS, p_table[0],
+          p_table[UG_BLEND_LEVELS]);
+      return false;
+    }
+
+    for (int alpha = 0; alpha < 256; alpha++) {
+      UG_COLOR color = p_table[UG_BLEND_LEVEL(alpha)];
+
+      for (int c = 0; c < 3; c++) {
+        double e = channel_error(color, fc, bc, c, alpha);
+        double bound = 0.5 + m_channels[c].max * max_alpha_error + 1e-9;
+
+        if (e > bound) {
+          printf("%04x on %04x alpha %d: %s is off by %.2f, more than %.2f\n", fc, bc, alpha, m_channels[c].name, e,
+              bound);
+          return false;
+        }
+
+        if (e > max_error[c])
+          max_error[c] = e;
+
+        e = channel_error(old_blend(fc, bc, alpha), fc, bc, c, alpha);
+        if (e > max_old_error[c])
+          max_old_error[c] = e;
+      }
+    }
+  }
+
+  printf("%d color pairs, every alpha, max channel error vs floating point (red/green/blue):\n", CHECK_PAIRS);
+  printf("  %d levels table: %.2f/%.2f/%.2f\n", UG_BLEND_LEVELS, max_error[0], max_error[1], max_error[2]);
+  printf("  old RGB888 masks: %.2f/%.2f/%.2f\n", max_old_error[0], max_old_error[1], max_old_error[2]);
+
+  return true;
+}
+
+static void bench(void)
+{
+  uint8_t *p_alphas = malloc(BENCH_PIXELS);
+  const UG_COLOR *p_table = NULL;
+  uint64_t ui64_start;
+  UG_COLOR fc = C_WHITE, bc = C_BLACK;
+
+  for (int i = 0; i < BENCH_PIXELS; i++)
+    p_alphas[i] = rand();
+
+  ui64_start = now_ns();
+  for (int i = 0; i < BENCH_PIXELS; i++) {
+    if (i % BENCH_GLYPH_PIXELS == 0)
+      fc ^= 1; // a new pair each glyph
+    m_sink = old_blend(fc, bc, p_alphas[i]);
+  }
+  printf("old blend:   %.2f ns per pixel\n", (now_ns() - ui64_start) / (double) BENCH_PIXELS);
+
+  ui64_start = now_ns();
+  for (int i = 0; i < BENCH_PIXELS; i++) {
+    if (i % BENCH_GLYPH_PIXELS == 0) {
+      fc ^= 1;
+      p_table = UG_BlendTable(fc, bc);
+    }
+    m_sink = p_table[UG_BLEND_LEVEL(p_alphas[i])];
+  }
+  printf("blend table: %.2f ns per pixel\n", (now_ns() - ui64_start) / (double) BENCH_PIXELS);
+
+  free(p_alphas);
+}
+
+int main(void)
+{
+  srand(1);
+
+  if (!check())
+    return 1;
+
+  bench();
+  return 0;
+}
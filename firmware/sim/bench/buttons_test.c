@@ -0,0 +1,202 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Feeds press timelines to the buttons state machine and checks the events it sends, for every phase of the
+ * BUTTONS_CLOCK_MS tick. Each timeline runs twice: polled, the way the main loop worked before the edge interrupts
+ * (handle the events, then buttons_clock() on the next tick), and with the edge interrupts waking it up. Prints how
+ * late the events were handled against when they could first be known, e.g. the release for a slow click.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include "buttons.h"
+#include "events.h"
+
+#define MAX_PRESSES 6
+#define MAX_EVENTS  3
+#define RUN_MS      5000 // every timeline is over by then
+
+enum { ONOFF, UP, DOWN, M, BUTTONS };
+
+typedef struct {
+  uint8_t button;
+  uint32_t ui32_start_ms;
+  uint32_t ui32_hold_ms;
+} press_t;
+
+typedef struct {
+  buttons_events_t event;
+  uint32_t ui32_ideal_ms; // when it could first be known
+} expected_t;
+
+typedef struct {
+  const char *name;
+  press_t presses[MAX_PRESSES];
+  expected_t expected[MAX_EVENTS];
+} timeline_t;
+
+static const timeline_t m_timelines[] = {
+  { "click", { { UP, 1000, 100 } }, { { UP_CLICK, 1400 } } },
+  { "slow click", { { DOWN, 1000, 250 } }, { { DOWN_CLICK, 1250 } } },
+  { "long click", { { ONOFF, 1000, 2000 } }, { { ONOFF_LONG_CLICK, 2500 } } },
+  { "click + long click", { { M, 1000, 100 }, { M, 1150, 2000 } }, { { M_CLICK_LONG_CLICK, 2650 } } },
+  { "double click", { { UP, 1000, 100 }, { UP, 1150, 100 } }, { { UP_CLICK, 1250 } } },
+  { "up + down", { { UP, 1000, 2000 }, { DOWN, 1050, 2000 } }, { { UPDOWN_CLICK, 2500 } } },
+  { "bouncy click", { { UP, 1000, 2 }, { UP, 1003, 2 }, { UP, 1006, 94 }, { UP, 1102, 2 }, { UP, 1106, 1 } },
+      { { UP_CLICK, 1400 } } },
+  { "two clicks", { { UP, 1000, 100 }, { DOWN, 1500, 100 } }, { { UP_CLICK, 1400 }, { DOWN_CLICK, 1900 } } },
+};
+
+#define TIMELINES (sizeof(m_timelines) / sizeof(m_timelines[0]))
+
+static uint32_t ui32_m_time_ms;
+static bool m_state[BUTTONS];
+static bool m_posted;
+
+uint32_t get_time_base_counter_1ms(void)
+{
+  return ui32_m_time_ms;
+}
+
+void event_post(event_t event)
+{
+  m_posted = true;
+}
+
+uint32_t buttons_get_onoff_state(void)
+{
+  return m_state[ONOFF];
+}
+
+uint32_t buttons_get_up_state(void)
+{
+  return m_state[UP];
+}
+
+uint32_t buttons_get_down_state(void)
+{
+  return m_state[DOWN];
+}
+
+uint32_t buttons_get_m_state(void)
+{
+  return m_state[M];
+}
+
+// The latency of each event of one timeline run, false if the events were not the expected ones
+static bool run(const timeline_t *p_timeline, bool edges, uint32_t ui32_phase, uint32_t ui32_latency[MAX_EVENTS])
+{
+  uint32_t ui32_base = ui32_m_time_ms;
+  int events = 0;
+
+  for (uint32_t t = 0; t < RUN_MS; t++) {
+    bool state[BUTTONS] = { false };
+    bool changed = false;
+
+    ui32_m_time_ms = ui32_base + t;
+
+    for (int i = 0; i < MAX_PRESSES && p_timeline->presses[i].ui32_hold_ms; i++) {
+      const press_t *p_press = &p_timeline->presses[i];
+
+      if (t >= p_press->ui32_start_ms && t < p_press->ui32_start_ms + p_press->ui32_hold_ms)
+        state[p_press->button] = true;
+    }
+
+    for (int i = 0; i < BUTTONS; i++) {
+      changed |= state[i] != m_state[i];
+      m_state[i] = state[i];
+    }
+
+    if (changed && edges)
+      buttons_edge_irq();
+
+    // the SysTick / gui_timer
+    if (t % BUTTONS_CLOCK_MS == ui32_phase && buttons_busy())
+      m_posted = true;
+
+    if (!m_posted)
+      continue;
+    m_posted = false;
+
+    if (edges)
+      buttons_clock();
+
+    buttons_events_t ev = buttons_get_events();
+    for (buttons_events_t bit = 1; ev; bit <<= 1) {
+      if (!(ev & bit))
+        continue;
+      ev &= ~bit;
+
+      if (events == MAX_EVENTS || p_timeline->expected[events].event != bit) {
+        printf("%s, %s, phase %u: unexpected event 0x%x at %u ms\n", p_timeline->name, edges ? "edges" : "polled",
+            ui32_phase, bit, t);
+        return false;
+      }
+
+      ui32_latency[events] = t - p_timeline->expected[events].ui32_ideal_ms;
+      if (t < p_timeline->expected[events].ui32_ideal_ms) {
+        printf("%s, %s, phase %u: event 0x%x at %u ms, before it could be known\n", p_timeline->name,
+            edges ? "edges" : "polled", ui32_phase, bit, t);
+        return false;
+      }
+      events++;
+    }
+    if (buttons_get_events())
+      buttons_clear_all_events(); // handled, like handle_buttons() does
+
+    if (!edges)
+      buttons_clock();
+  }
+
+  if (events < MAX_EVENTS && p_timeline->expected[events].event) {
+    printf("%s, %s, phase %u: event 0x%x missing\n", p_timeline->name, edges ? "edges" : "polled", ui32_phase,
+        p_timeline->expected[events].event);
+    return false;
+  }
+
+  return true;
+}
+
+int main(void)
+{
+  uint32_t ui32_edges_max = 0;
+
+  printf("%-20s %16s %16s\n", "latency, ms", "polled avg/max", "edges avg/max");
+
+  for (uint32_t i = 0; i < TIMELINES; i++) {
+    uint32_t ui32_total[2] = { 0 }, ui32_max[2] = { 0 }, ui32_count[2] = { 0 };
+
+    for (int edges = 0; edges < 2; edges++) {
+      for (uint32_t phase = 0; phase < BUTTONS_CLOCK_MS; phase++) {
+        uint32_t ui32_latency[MAX_EVENTS];
+
+        if (!run(&m_timelines[i], edges, phase, ui32_latency))
+          return 1;
+
+        for (int e = 0; e < MAX_EVENTS && m_timelines[i].expected[e].event; e++) {
+          ui32_total[edges] += ui32_latency[e];
+          ui32_count[edges]++;
+          if (ui32_latency[e] > ui32_max[edges])
+            ui32_max[edges] = ui32_latency[e];
+        }
+      }
+    }
+
+    printf("%-20s %10.1f/%-5u %10.1f/%-5u\n", m_timelines[i].name, ui32_total[0] / (double) ui32_count[0],
+        ui32_max[0], ui32_total[1] / (double) ui32_count[1], ui32_max[1]);
+
+    if (ui32_max[1] > ui32_edges_max)
+      ui32_edges_max = ui32_max[1];
+  }
+
+  // with the edges only the timeouts wait for the tick
+  if (ui32_edges_max > BUTTONS_CLOCK_MS) {
+    printf("edges: an event was %u ms late, more than a tick\n", ui32_edges_max);
+    return 1;
+  }
+
+  return 0;
+}
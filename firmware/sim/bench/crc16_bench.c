@@ -0,0 +1,115 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Checks crc16()/crc16_update() from common/src/utils.c against the original bitwise Modbus CRC and measures
+ * their speed. Built once for each CRC16_TABLE_SIZE, see "make crc16-bench".
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "utils.h"
+
+#define BENCH_BUFFER_SIZE 85 // our biggest package, UART_NUMBER_DATA_BYTES_TO_SEND
+#define BENCH_ROUNDS      200000
+
+// the implementation we had before the tables
+static uint16_t crc16_reference(const uint8_t *p_data, uint16_t ui16_len)
+{
+  uint16_t ui16_crc = 0xffff;
+
+  while (ui16_len--) {
+    ui16_crc ^= *p_data++;
+    for (int i = 8; i > 0; i--) {
+      if (ui16_crc & 0x0001)
+        ui16_crc = (ui16_crc >> 1) ^ 0xA001;
+      else
+        ui16_crc >>= 1;
+    }
+  }
+
+  return ui16_crc;
+}
+
+static uint16_t crc16_per_byte(const uint8_t *p_data, uint16_t ui16_len)
+{
+  uint16_t ui16_crc = 0xffff;
+
+  while (ui16_len--)
+    crc16(*p_data++, &ui16_crc);
+
+  return ui16_crc;
+}
+
+static double now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static int check(void)
+{
+  static const uint8_t check_string[] = "123456789";
+  uint8_t buf[256];
+  int errors = 0;
+
+  // the Modbus CRC16 check value
+  if (crc16_update(0xffff, check_string, 9) != 0x4B37 || crc16_per_byte(check_string, 9) != 0x4B37)
+    errors++;
+
+  // every length, including splitting the block in two updates
+  for (int round = 0; round < 1000; round++) {
+    uint16_t ui16_len = rand() % sizeof(buf);
+    uint16_t ui16_split = ui16_len ? rand() % ui16_len : 0;
+
+    for (uint16_t i = 0; i < ui16_len; i++)
+      buf[i] = rand();
+
+    uint16_t ui16_crc = crc16_reference(buf, ui16_len);
+    if (crc16_per_byte(buf, ui16_len) != ui16_crc ||
+        crc16_update(0xffff, buf, ui16_len) != ui16_crc ||
+        crc16_update(crc16_update(0xffff, buf, ui16_split), buf + ui16_split, ui16_len - ui16_split) != ui16_crc)
+      errors++;
+  }
+
+  return errors;
+}
+
+static void bench(const char *name, uint16_t (*fn)(const uint8_t *, uint16_t), const uint8_t *p_buf)
+{
+  volatile uint16_t ui16_sink = 0;
+  double start = now_ns();
+
+  for (int round = 0; round < BENCH_ROUNDS; round++)
+    ui16_sink ^= fn(p_buf, BENCH_BUFFER_SIZE);
+
+  double ns = (now_ns() - start) / ((double) BENCH_ROUNDS * BENCH_BUFFER_SIZE);
+  printf("  %-14s %6.2f ns/byte\n", name, ns);
+}
+
+static uint16_t crc16_update_block(const uint8_t *p_data, uint16_t ui16_len)
+{
+  return crc16_update(0xffff, p_data, ui16_len);
+}
+
+int main(void)
+{
+  uint8_t buf[BENCH_BUFFER_SIZE];
+  int errors = check();
+
+  printf("CRC16_TABLE_SIZE %d: %s\n", CRC16_TABLE_SIZE, errors ? "FAILED" : "ok");
+
+  for (int i = 0; i < BENCH_BUFFER_SIZE; i++)
+    buf[i] = rand();
+
+  bench("reference", crc16_reference, buf);
+  bench("crc16()", crc16_per_byte, buf);
+  bench("crc16_update()", crc16_update_block, buf);
+
+  return errors ? 1 : 0;
+}
@@ -0,0 +1,295 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Checks the BLE cycling measurements of cycling_meas.c: the bytes of a known Cycling Speed and Cadence and Cycling
+ * Power measurement, the revolutions and their interpolated event times against the exact ones for random speed
+ * and cadence, and the speed a central computes from the notifications against the speed ridden, with the event
+ * times interpolated and stamped with the 100ms tick instead.
+ *
+ * Then sends the notifications of a synthetic hour, with stops and a parked end, as ble_services.c does and prints
+ * how many there are and the radio on-time they take, against the old fixed 1s speed and cadence timer. The radio
+ * time is modelled at 1Mbps: the first notification of a connection event takes the place of the empty packet the
+ * display would send anyway, each next one adds an exchange with the central.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "cycling_meas.h"
+
+#define TICK_MS             100
+#define PERIMETER_MM        2050
+#define CONN_INTERVAL_MS    500 // MIN_CONN_INTERVAL of ble_services.c
+
+// nRF51 at 1Mbps, in us
+#define EMPTY_PDU_US        80 // preamble, access address, header and CRC
+#define IFS_US              150
+#define EVENT_US            (140 + EMPTY_PDU_US + IFS_US + EMPTY_PDU_US) // radio ramp up, the central's packet, ours
+#define NOTIFY_OVERHEAD     7 // L2CAP and ATT headers
+
+static uint32_t ui32_m_errors;
+
+static void check(bool ok, const char *p_what)
+{
+  if (!ok && ui32_m_errors++ < 10)
+    printf("  FAIL %s\n", p_what);
+}
+
+static uint32_t get_u32(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t) p[3] << 24);
+}
+
+static uint16_t get_u16(const uint8_t *p)
+{
+  return p[0] | (p[1] << 8);
+}
+
+static void encode_test(void)
+{
+  cycling_meas_t meas;
+  uint8_t ui8_data[CYCLING_MEAS_MAX_BYTES];
+
+  cycling_meas_init(&meas);
+  meas.ui32_wheel_revs = 0x12345678;
+  meas.ui32_wheel_event_time = 0x0003abcd; // 1/2048 s
+  meas.ui16_crank_revs = 0x9abc;
+  meas.ui32_crank_event_time = 0x00054321;
+  meas.i16_power = 321;
+
+  static const uint8_t ui8_csc[] = { 0x03, 0x78, 0x56, 0x34, 0x12, 0xe6, 0xd5, 0xbc, 0x9a, 0x90, 0xa1 };
+  check(cycling_meas_csc_encode(&meas, ui8_data) == sizeof(ui8_csc) && !memcmp(ui8_data, ui8_csc, sizeof(ui8_csc)),
+      "CSC measurement bytes");
+
+  static const uint8_t ui8_cp[] = { 0x30, 0x00, 0x41, 0x01, 0x78, 0x56, 0x34, 0x12, 0xcd, 0xab, 0xbc, 0x9a, 0x90, 0xa1 };
+  check(cycling_meas_cp_encode(&meas, ui8_data) == sizeof(ui8_cp) && !memcmp(ui8_data, ui8_cp, sizeof(ui8_cp)),
+      "CP measurement bytes");
+}
+
+// Random speed and cadence each tick, the revolutions and event times against the exact ones
+static void interpolation_test(void)
+{
+  cycling_meas_t meas;
+  // in the units the speed and cadence come in over a millisecond, which doubles hold exactly
+  double d_wheel = 0, d_crank = 0; // since the last revolution, in 1/36 mm and rpm * ms
+  uint32_t ui32_wheel_revs = 0, ui32_crank_revs = 0;
+  double d_wheel_time = 0, d_crank_time = 0, d_time = 0; // s
+  int32_t i32_max_wheel_error = 0, i32_max_crank_error = 0;
+
+  srand(22);
+  cycling_meas_init(&meas);
+
+  for (uint32_t tick = 0; tick < 200000; tick++) {
+    uint16_t ui16_speed_x10 = (tick / 50) % 7 == 0 ? 0 : rand() % 800;
+    uint8_t ui8_cadence = rand() % 4 == 0 ? 0 : rand() % 140;
+
+    // exact crossings, the speed and cadence being constant over the tick
+    d_time = tick * (TICK_MS / 1000.0);
+    double d_total = (double) ui16_speed_x10 * TICK_MS, d_done = 0;
+    while (d_total - d_done >= PERIMETER_MM * 36.0 - d_wheel) {
+      d_done += PERIMETER_MM * 36.0 - d_wheel;
+      d_wheel = 0;
+      d_wheel_time = d_time + d_done / d_total * (TICK_MS / 1000.0);
+      ui32_wheel_revs++;
+    }
+    d_wheel += d_total - d_done;
+
+    d_total = (double) ui8_cadence * TICK_MS;
+    d_done = 0;
+    while (d_total - d_done >= 60000 - d_crank) {
+      d_done += 60000 - d_crank;
+      d_crank = 0;
+      d_crank_time = d_time + d_done / d_total * (TICK_MS / 1000.0);
+      ui32_crank_revs++;
+    }
+    d_crank += d_total - d_done;
+    d_time += TICK_MS / 1000.0;
+
+    cycling_meas_update(&meas, TICK_MS, ui16_speed_x10, PERIMETER_MM, ui8_cadence, 100);
+
+    check(meas.ui32_wheel_revs == ui32_wheel_revs, "wheel revolutions");
+    check(meas.ui16_crank_revs == (uint16_t) ui32_crank_revs, "crank revolutions");
+
+    int32_t i32_error = (int32_t) meas.ui32_wheel_event_time - (int32_t) floor(d_wheel_time * 2048);
+    if (abs(i32_error) > i32_max_wheel_error)
+      i32_max_wheel_error = abs(i32_error);
+    i32_error = (int32_t) meas.ui32_crank_event_time - (int32_t) floor(d_crank_time * 2048);
+    if (abs(i32_error) > i32_max_crank_error)
+      i32_max_crank_error = abs(i32_error);
+  }
+
+  check(i32_max_wheel_error <= 1 && i32_max_crank_error <= 1, "event times");
+  printf("  %u wheel and %u crank revolutions in %.1f hours, event times at most %d and %d/2048 s off\n",
+      ui32_wheel_revs, ui32_crank_revs, d_time / 3600, i32_max_wheel_error, i32_max_crank_error);
+}
+
+// The speed a central gets from two CSC measurements, in km/h
+static double central_speed(const uint8_t *p_a, const uint8_t *p_b)
+{
+  uint32_t ui32_revs = get_u32(&p_b[1]) - get_u32(&p_a[1]);
+  uint16_t ui16_time = get_u16(&p_b[5]) - get_u16(&p_a[5]); // 1/1024 s, wraps every 64 s
+
+  return ui16_time ? ui32_revs * PERIMETER_MM / 1000.0 / (ui16_time / 1024.0) * 3.6 : 0;
+}
+
+// Steady speeds, the central's speed from one notification a second with interpolated event times and with the
+// revolutions stamped at the end of the tick they were counted in
+static void central_speed_test(void)
+{
+  double d_max_error = 0, d_max_tick_error = 0;
+
+  for (uint16_t ui16_speed_x10 = 50; ui16_speed_x10 <= 450; ui16_speed_x10 += 7) {
+    cycling_meas_t meas;
+    uint8_t ui8_prev[CYCLING_MEAS_CSC_BYTES], ui8_data[CYCLING_MEAS_CSC_BYTES];
+    uint8_t ui8_prev_tick[CYCLING_MEAS_CSC_BYTES], ui8_tick[CYCLING_MEAS_CSC_BYTES];
+    uint32_t ui32_tick_time = 0, ui32_revs = 0;
+
+    cycling_meas_init(&meas);
+    for (uint32_t tick = 0; tick < 2000; tick++) { // 200 s, the 1/1024 s event time wraps 3 times
+      cycling_meas_update(&meas, TICK_MS, ui16_speed_x10, PERIMETER_MM, 60, 100);
+      if (meas.ui32_wheel_revs != ui32_revs) {
+        ui32_revs = meas.ui32_wheel_revs;
+        ui32_tick_time = meas.ui32_time;
+      }
+
+      if (tick % 10)
+        continue;
+
+      cycling_meas_csc_encode(&meas, ui8_data);
+      memcpy(ui8_tick, ui8_data, sizeof(ui8_tick));
+      ui8_tick[5] = (uint8_t) (ui32_tick_time >> 1);
+      ui8_tick[6] = (uint8_t) (ui32_tick_time >> 9);
+
+      // like a central, keep the last speed while no revolution came
+      if (tick && get_u32(&ui8_data[1]) == get_u32(&ui8_prev[1]))
+        continue;
+
+      if (tick >= 100) { // once the wheel turned a few times
+        double d_error = fabs(central_speed(ui8_prev, ui8_data) - ui16_speed_x10 / 10.0) / (ui16_speed_x10 / 10.0);
+        double d_tick_error = fabs(central_speed(ui8_prev_tick, ui8_tick) - ui16_speed_x10 / 10.0)
+            / (ui16_speed_x10 / 10.0);
+
+        if (d_error > d_max_error)
+          d_max_error = d_error;
+        if (d_tick_error > d_max_tick_error)
+          d_max_tick_error = d_tick_error;
+      }
+      memcpy(ui8_prev, ui8_data, sizeof(ui8_prev));
+      memcpy(ui8_prev_tick, ui8_tick, sizeof(ui8_prev_tick));
+    }
+  }
+
+  check(d_max_error < 0.005, "speed at the central");
+  printf("  speed at the central from one notification a second, 5 to 45 km/h: at most %.2f%% off interpolated, "
+      "%.1f%% with tick times\n", 100 * d_max_error, 100 * d_max_tick_error);
+}
+
+typedef struct {
+  uint32_t ui32_notifications;
+  uint32_t ui32_bytes;
+  uint64_t ui64_radio_us; // of the notifications, over the connection events the display has anyway
+  uint8_t ui8_queued; // for the next connection event
+} radio_t;
+
+static void radio_notify(radio_t *p_radio, uint8_t ui8_length)
+{
+  uint32_t ui32_pdu_us = (NOTIFY_OVERHEAD + ui8_length) * 8;
+
+  // the first one goes instead of our empty packet, the next ones need the central to ask for them
+  p_radio->ui64_radio_us += p_radio->ui8_queued++ ? EMPTY_PDU_US + 2 * IFS_US + EMPTY_PDU_US + ui32_pdu_us
+                                                  : ui32_pdu_us;
+  p_radio->ui32_notifications++;
+  p_radio->ui32_bytes += ui8_length;
+}
+
+// An hour: rides of a few minutes at changing speeds, coasting now and then, stops at traffic lights, parked at
+// the end with the display still on
+static void ride(uint32_t ui32_tick, uint16_t *p_speed_x10, uint8_t *p_cadence, uint16_t *p_power)
+{
+  uint32_t ui32_s = ui32_tick * TICK_MS / 1000;
+
+  if (ui32_s >= 50 * 60 || ui32_s % 300 >= 255) {
+    *p_speed_x10 = *p_cadence = *p_power = 0;
+    return;
+  }
+
+  *p_speed_x10 = 200 + 60 * sin(ui32_s / 40.0) + rand() % 20;
+  if (ui32_s % 90 >= 75) { // coasting
+    *p_cadence = 0;
+    *p_power = 0;
+  } else {
+    *p_cadence = 70 + rand() % 10;
+    *p_power = 120 + rand() % 40;
+  }
+}
+
+static void radio_test(void)
+{
+  cycling_meas_t meas;
+  cycling_notify_t csc_notify, cp_notify;
+  radio_t old = { 0 }, csc = { 0 }, both = { 0 };
+  uint8_t ui8_data[CYCLING_MEAS_MAX_BYTES], ui8_length;
+  uint32_t ui32_parked_notifications = 0;
+  uint16_t ui16_speed_x10, ui16_power;
+  uint8_t ui8_cadence;
+
+  srand(22);
+  cycling_meas_init(&meas);
+  memset(&csc_notify, 0, sizeof(csc_notify));
+  memset(&cp_notify, 0, sizeof(cp_notify));
+
+  for (uint32_t tick = 0; tick < 3600 * 1000 / TICK_MS; tick++) {
+    ride(tick, &ui16_speed_x10, &ui8_cadence, &ui16_power);
+    cycling_meas_update(&meas, TICK_MS, ui16_speed_x10, PERIMETER_MM, ui8_cadence, ui16_power);
+
+    // the old SPEED_AND_CADENCE_MEAS_INTERVAL timer
+    if (tick % (1000 / TICK_MS) == 0)
+      radio_notify(&old, CYCLING_MEAS_CSC_BYTES);
+
+    ui8_length = cycling_meas_csc_encode(&meas, ui8_data);
+    if (cycling_notify_due(&csc_notify, ui8_data, ui8_length, TICK_MS)) {
+      cycling_notify_sent(&csc_notify, ui8_data, ui8_length);
+      radio_notify(&csc, ui8_length);
+      radio_notify(&both, ui8_length);
+      ui32_parked_notifications += tick * TICK_MS >= 51 * 60 * 1000;
+    }
+
+    ui8_length = cycling_meas_cp_encode(&meas, ui8_data);
+    if (cycling_notify_due(&cp_notify, ui8_data, ui8_length, TICK_MS)) {
+      cycling_notify_sent(&cp_notify, ui8_data, ui8_length);
+      radio_notify(&both, ui8_length);
+      ui32_parked_notifications += tick * TICK_MS >= 51 * 60 * 1000;
+    }
+
+    if ((tick + 1) % (CONN_INTERVAL_MS / TICK_MS) == 0)
+      old.ui8_queued = csc.ui8_queued = both.ui8_queued = 0;
+  }
+
+  check(ui32_parked_notifications == 0, "no notifications while parked");
+  check(csc.ui32_notifications < old.ui32_notifications, "fewer speed and cadence notifications");
+
+  uint64_t ui64_events_us = (uint64_t) 3600 * 1000 / CONN_INTERVAL_MS * EVENT_US;
+  printf("  an hour, 50 minutes riding with stops then parked, %ums connection interval:\n", CONN_INTERVAL_MS);
+  printf("    %-36s %5u notifications, %6u bytes, radio %6.2fs (connection events %.2fs)\n",
+      "old CSC 1s timer", old.ui32_notifications, old.ui32_bytes, old.ui64_radio_us / 1e6, ui64_events_us / 1e6);
+  printf("    %-36s %5u notifications, %6u bytes, radio %6.2fs\n", "CSC on change",
+      csc.ui32_notifications, csc.ui32_bytes, csc.ui64_radio_us / 1e6);
+  printf("    %-36s %5u notifications, %6u bytes, radio %6.2fs\n", "CSC and CP on change",
+      both.ui32_notifications, both.ui32_bytes, both.ui64_radio_us / 1e6);
+}
+
+int main(int argc, char **argv)
+{
+  printf("cycling measurements:\n");
+
+  encode_test();
+  interpolation_test();
+  central_speed_test();
+  radio_test();
+
+  printf(ui32_m_errors ? "FAILED\n" : "OK\n");
+  return ui32_m_errors ? 1 : 0;
+}
@@ -0,0 +1,480 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Runs the data export of data_export.h against a stand-in for the BLE central, a forked process on the other end
+ * of two pipes. The display side models the link: each connection event carries the packets the TX buffers hold,
+ * then TX complete frees them and pumps the export again, like ble_services.c does. The central reads the packets
+ * of each event, checks the sequence numbers, the CRC and the data against its copy of the sources, and writes its
+ * next request, one connection event at a time so the run is the same every time.
+ *
+ * Every request is checked with full size packets and with 2 byte ones, which split the header and the CRC. Then
+ * prints how long the whole ride log takes with one notification per connection event at the old 500ms interval,
+ * and queuing them until the SoftDevice is full at 500ms and at the 7.5ms asked for during an export.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "utils.h"
+#include "screen.h"
+#include "eeprom.h"
+#include "events.h"
+#include "ride_log.h"
+#include "data_export.h"
+
+#define TX_BUFFERS        6 // packets per connection event of the S130 with BLE_CONN_BW_HIGH
+#define RIDE_LOG_BLOCKS   40 // enough to time the link, the SW102 FDS pages only hold 2 or 3
+#define MAX_RESPONSE      (RIDE_LOG_BLOCKS * RIDE_LOG_BLOCK_BYTES + 256)
+#define EVENT_END         0 // length byte of the marker after the packets of a connection event
+#define CENTRAL_DONE      0xff // length byte of the central's reply when it has no more requests
+
+typedef struct {
+  const char *p_name;
+  uint16_t ui16_packet_size;
+  uint16_t ui16_tx_buffers;
+  float f_interval_ms;
+  bool check;
+} link_t;
+
+static const link_t m_links[] = {
+  { "checks, 20 byte packets", DATA_EXPORT_MAX_PACKET, TX_BUFFERS, 7.5, true },
+  { "checks, 2 byte packets", 2, TX_BUFFERS, 7.5, true },
+  { "1 packet per event at 500ms", DATA_EXPORT_MAX_PACKET, 1, 500, false },
+  { "queued per event at 500ms", DATA_EXPORT_MAX_PACKET, TX_BUFFERS, 500, false },
+  { "queued per event at 7.5ms", DATA_EXPORT_MAX_PACKET, TX_BUFFERS, 7.5, false },
+};
+
+// the sources, filled before the fork so the central has the same copy
+GraphData g_graphData[VARS_SIZE];
+static int32_t i32_m_graph_points[VARS_SIZE][GRAPH_STORED_POINTS];
+static eeprom_data_t m_eeprom_data;
+static uint32_t ui32_m_blocks[RIDE_LOG_BLOCKS][RIDE_LOG_BLOCK_WORDS];
+#define GRAPH_PUSHES_MAX  ((GRAPH_MAX_POINTS + 50) * GRAPH_LEVEL_FACTOR_1 * GRAPH_LEVEL_FACTOR_2 + VARS_SIZE)
+static int32_t i32_m_pushed[VARS_SIZE][GRAPH_PUSHES_MAX];
+static uint16_t ui16_m_pushed[VARS_SIZE];
+
+// the display side
+static int m_to_central, m_from_central;
+static const link_t *p_m_link;
+static uint16_t ui16_m_tx_free;
+static bool m_export_posted;
+static uint32_t ui32_m_refused;
+
+const eeprom_data_t* eeprom_get_data(void)
+{
+  return &m_eeprom_data;
+}
+
+const uint32_t* ride_log_store_next(ride_log_iter_t *p_iter)
+{
+  if (p_iter->ui32_a == RIDE_LOG_BLOCKS)
+    return NULL;
+
+  return ui32_m_blocks[p_iter->ui32_a++];
+}
+
+void event_post(event_t event)
+{
+  if (event == EVENT_EXPORT)
+    m_export_posted = true;
+}
+
+static void write_all(int fd, const void *p_data, size_t size)
+{
+  if (write(fd, p_data, size) != (ssize_t) size) {
+    perror("write");
+    exit(1);
+  }
+}
+
+static void read_all(int fd, void *p_data, size_t size)
+{
+  uint8_t *p = p_data;
+
+  while (size) {
+    ssize_t n = read(fd, p, size);
+    if (n <= 0) {
+      fprintf(stderr, "the other end of the pipe went away\n");
+      exit(1);
+    }
+    p += n;
+    size -= n;
+  }
+}
+
+// What ble_services.c does with ble_nus_string_send(), the packet goes out with this connection event
+static bool link_send(const uint8_t *p_packet, uint16_t ui16_length)
+{
+  uint8_t ui8_length = ui16_length;
+
+  if (!ui16_m_tx_free) {
+    ui32_m_refused++;
+    return false;
+  }
+
+  ui16_m_tx_free--;
+  write_all(m_to_central, &ui8_length, 1);
+  write_all(m_to_central, p_packet, ui16_length);
+  return true;
+}
+
+static void display(void)
+{
+  uint8_t ui8_length, ui8_request[8];
+
+  data_export_init(link_send, NULL, p_m_link->ui16_packet_size);
+
+  for (;;) {
+    // BLE_EVT_TX_COMPLETE of the last connection event, then the main loop
+    ui16_m_tx_free = p_m_link->ui16_tx_buffers;
+    if (data_export_busy())
+      event_post(EVENT_EXPORT);
+
+    if (m_export_posted) {
+      m_export_posted = false;
+      data_export_pump();
+    }
+
+    ui8_length = EVENT_END;
+    write_all(m_to_central, &ui8_length, 1);
+
+    read_all(m_from_central, &ui8_length, 1);
+    if (ui8_length == CENTRAL_DONE)
+      return;
+
+    if (ui8_length) {
+      read_all(m_from_central, ui8_request, ui8_length);
+      data_export_request(ui8_request, ui8_length); // from nus_data_handler()
+    }
+  }
+}
+
+// The central: one request, its response as it should be, and what came
+typedef struct {
+  uint8_t ui8_request[4];
+  uint8_t ui8_request_length;
+  uint8_t ui8_status;
+  uint8_t ui8_expected[MAX_RESPONSE];
+  uint32_t ui32_expected_length;
+  uint16_t ui16_abort_after; // connection events, then the next request is sent while this response goes on
+} exchange_t;
+
+static uint8_t ui8_m_response[MAX_RESPONSE + 4];
+static uint32_t ui32_m_response_length;
+static uint32_t ui32_m_events;
+static uint16_t ui16_m_seq;
+static bool m_last;
+static uint32_t ui32_m_errors;
+
+static void check(bool ok, const char *p_what, const exchange_t *p_exchange)
+{
+  if (ok)
+    return;
+
+  if (ui32_m_errors++ < 10)
+    printf("  FAIL %s: %s, request %u\n", p_m_link->p_name, p_what, p_exchange->ui8_request[0]);
+}
+
+static void put_u32(uint8_t *p_dest, uint32_t ui32_value)
+{
+  for (int i = 0; i < 4; i++)
+    p_dest[i] = (uint8_t) (ui32_value >> (8 * i));
+}
+
+// The last GRAPH_MAX_POINTS of the level, each point of it the mean of its level factor of points of the level below
+static uint16_t expected_graph(exchange_t *p_exchange, uint8_t ui8_var, uint8_t ui8_level)
+{
+  static int32_t i32_points[GRAPH_PUSHES_MAX];
+  uint16_t ui16_points = ui16_m_pushed[ui8_var];
+  uint16_t ui16_first;
+
+  memcpy(i32_points, i32_m_pushed[ui8_var], sizeof(i32_points));
+  for (uint8_t l = 1; l <= ui8_level; l++) {
+    uint8_t ui8_factor = ui8_g_graph_level_factor[l];
+
+    ui16_points /= ui8_factor;
+    for (uint16_t i = 0; i < ui16_points; i++) {
+      int32_t i32_sum = 0;
+
+      for (uint16_t j = 0; j < ui8_factor; j++)
+        i32_sum += i32_points[i * ui8_factor + j];
+      i32_points[i] = i32_sum / ui8_factor;
+    }
+  }
+
+  ui16_first = ui16_points > GRAPH_MAX_POINTS ? ui16_points - GRAPH_MAX_POINTS : 0;
+  for (uint16_t i = ui16_first; i < ui16_points; i++)
+    put_u32(&p_exchange->ui8_expected[4 * (i - ui16_first)], i32_points[i]);
+
+  return 4 * (ui16_points - ui16_first);
+}
+
+static uint32_t exchanges_build(exchange_t *p_exchanges)
+{
+  exchange_t *p = p_exchanges;
+  uint32_t n = 0;
+
+  p[n].ui8_request[0] = DATA_EXPORT_CMD_INFO;
+  p[n].ui8_request_length = 1;
+  p[n].ui8_status = DATA_EXPORT_OK;
+  p[n].ui8_expected[0] = DATA_EXPORT_VERSION;
+  p[n].ui8_expected[1] = (uint8_t) sizeof(eeprom_data_t);
+  p[n].ui8_expected[2] = (uint8_t) (sizeof(eeprom_data_t) >> 8);
+  p[n].ui8_expected[3] = VARS_SIZE;
+  p[n].ui8_expected[4] = (uint8_t) GRAPH_MAX_POINTS;
+  p[n].ui8_expected[5] = GRAPH_MAX_POINTS >> 8;
+  p[n].ui8_expected[6] = (uint8_t) RIDE_LOG_BLOCK_BYTES;
+  p[n].ui8_expected[7] = RIDE_LOG_BLOCK_BYTES >> 8;
+  memcpy(&p[n].ui8_expected[8], VERSION_STRING, strlen(VERSION_STRING));
+  p[n].ui32_expected_length = 8 + strlen(VERSION_STRING);
+  n++;
+
+  p[n].ui8_request[0] = DATA_EXPORT_CMD_SETTINGS;
+  p[n].ui8_request_length = 1;
+  p[n].ui8_status = DATA_EXPORT_OK;
+  memcpy(p[n].ui8_expected, &m_eeprom_data, sizeof(m_eeprom_data));
+  p[n].ui32_expected_length = sizeof(m_eeprom_data);
+  n++;
+
+  // an empty graph, one not full yet, and full ones that wrapped around
+  static const uint8_t ui8_graphs[][2] = { { 0, 0 }, { 1, 1 }, { 2, 2 }, { VARS_SIZE - 1, 0 } };
+  for (uint32_t i = 0; i < sizeof(ui8_graphs) / sizeof(ui8_graphs[0]); i++) {
+    p[n].ui8_request[0] = DATA_EXPORT_CMD_GRAPH;
+    p[n].ui8_request[1] = ui8_graphs[i][0];
+    p[n].ui8_request[2] = ui8_graphs[i][1];
+    p[n].ui8_request_length = 3;
+    p[n].ui8_status = DATA_EXPORT_OK;
+    p[n].ui32_expected_length = expected_graph(&p[n], ui8_graphs[i][0], ui8_graphs[i][1]);
+    n++;
+  }
+
+  p[n].ui8_request[0] = DATA_EXPORT_CMD_GRAPH;
+  p[n].ui8_request[1] = VARS_SIZE;
+  p[n].ui8_request[2] = 0;
+  p[n].ui8_request_length = 3;
+  p[n].ui8_status = DATA_EXPORT_BAD_ARGUMENT;
+  n++;
+
+  p[n].ui8_request[0] = DATA_EXPORT_CMD_GRAPH;
+  p[n].ui8_request[1] = 0;
+  p[n].ui8_request[2] = GRAPH_LEVELS;
+  p[n].ui8_request_length = 3;
+  p[n].ui8_status = DATA_EXPORT_BAD_ARGUMENT;
+  n++;
+
+  p[n].ui8_request[0] = DATA_EXPORT_CMD_GRAPH;
+  p[n].ui8_request_length = 1;
+  p[n].ui8_status = DATA_EXPORT_BAD_ARGUMENT;
+  n++;
+
+  p[n].ui8_request[0] = 0x7f;
+  p[n].ui8_request_length = 1;
+  p[n].ui8_status = DATA_EXPORT_BAD_COMMAND;
+  n++;
+
+  // started again by the next request
+  p[n].ui8_request[0] = DATA_EXPORT_CMD_RIDE_LOG;
+  p[n].ui8_request_length = 1;
+  p[n].ui16_abort_after = 3;
+  n++;
+
+  p[n].ui8_request[0] = DATA_EXPORT_CMD_RIDE_LOG;
+  p[n].ui8_request_length = 1;
+  p[n].ui8_status = DATA_EXPORT_OK;
+  memcpy(p[n].ui8_expected, ui32_m_blocks, sizeof(ui32_m_blocks));
+  p[n].ui32_expected_length = sizeof(ui32_m_blocks);
+  n++;
+
+  return n;
+}
+
+// Reads the packets of one connection event
+static void central_event(const exchange_t *p_exchange)
+{
+  uint8_t ui8_length, ui8_packet[256];
+
+  ui32_m_events++;
+  for (;;) {
+    read_all(m_to_central, &ui8_length, 1);
+    if (ui8_length == EVENT_END)
+      return;
+
+    read_all(m_to_central, ui8_packet, ui8_length);
+    check(ui8_length >= 2 && ui8_length <= p_m_link->ui16_packet_size, "packet size", p_exchange);
+    check(!m_last, "packet after the last one", p_exchange);
+    check((ui8_packet[0] & ~DATA_EXPORT_LAST) == (ui16_m_seq++ & (uint8_t) ~DATA_EXPORT_LAST), "sequence", p_exchange);
+
+    m_last = ui8_packet[0] & DATA_EXPORT_LAST;
+    check(m_last || ui8_length == p_m_link->ui16_packet_size, "short packet before the last one", p_exchange);
+
+    if (ui32_m_response_length + ui8_length - 1 > sizeof(ui8_m_response)) {
+      check(false, "response too long", p_exchange);
+      continue;
+    }
+    memcpy(&ui8_m_response[ui32_m_response_length], &ui8_packet[1], ui8_length - 1);
+    ui32_m_response_length += ui8_length - 1;
+  }
+}
+
+static void central_request(const exchange_t *p_exchange)
+{
+  write_all(m_from_central, &p_exchange->ui8_request_length, 1);
+  write_all(m_from_central, p_exchange->ui8_request, p_exchange->ui8_request_length);
+
+  ui32_m_response_length = 0;
+  ui32_m_events = 0;
+  ui16_m_seq = 0;
+  m_last = false;
+}
+
+static void central_response_check(const exchange_t *p_exchange)
+{
+  uint32_t ui32_length = ui32_m_response_length;
+
+  check(ui32_length == 2 + p_exchange->ui32_expected_length + 2, "response length", p_exchange);
+  if (ui32_length < 4)
+    return;
+
+  uint16_t ui16_crc = crc16_update(0xffff, ui8_m_response, ui32_length - 2);
+  check(ui8_m_response[ui32_length - 2] == (uint8_t) ui16_crc && ui8_m_response[ui32_length - 1] == ui16_crc >> 8,
+      "CRC", p_exchange);
+  check(ui8_m_response[0] == p_exchange->ui8_request[0], "command", p_exchange);
+  check(ui8_m_response[1] == p_exchange->ui8_status, "status", p_exchange);
+  check(ui32_length != 2 + p_exchange->ui32_expected_length + 2
+      || !memcmp(&ui8_m_response[2], p_exchange->ui8_expected, p_exchange->ui32_expected_length), "data", p_exchange);
+}
+
+static void central(void)
+{
+  static exchange_t exchanges[16];
+  uint32_t ui32_exchanges = exchanges_build(exchanges);
+  const exchange_t *p_exchange = NULL;
+  uint32_t i = 0;
+  uint8_t ui8_none = 0, ui8_done = CENTRAL_DONE;
+
+  if (!p_m_link->check) {
+    exchanges[0] = exchanges[ui32_exchanges - 1]; // the whole ride log
+    ui32_exchanges = 1;
+  }
+
+  for (;;) {
+    central_event(p_exchange ? p_exchange : &exchanges[0]);
+
+    if (p_exchange && p_exchange->ui16_abort_after) {
+      if (ui32_m_events <= p_exchange->ui16_abort_after) {
+        write_all(m_from_central, &ui8_none, 1);
+        continue;
+      }
+      check(!m_last, "response over before the next request", p_exchange);
+    } else if (p_exchange) {
+      if (!m_last && ui32_m_events < 1000000) {
+        write_all(m_from_central, &ui8_none, 1);
+        continue;
+      }
+      central_response_check(p_exchange);
+
+      if (!p_m_link->check) {
+        float f_s = ui32_m_events * p_m_link->f_interval_ms / 1000;
+        printf("  %-28s ride log %u bytes in %6u events, %7.2fs, %6.0f bytes/s\n", p_m_link->p_name,
+            ui32_m_response_length, ui32_m_events, f_s, ui32_m_response_length / f_s);
+      }
+    }
+
+    // the next request goes out with this connection event
+    if (i == ui32_exchanges)
+      break;
+    p_exchange = &exchanges[i++];
+    central_request(p_exchange);
+  }
+
+  write_all(m_from_central, &ui8_done, 1);
+  exit(ui32_m_errors ? 1 : 0);
+}
+
+static void sources_fill(void)
+{
+  srand(21);
+
+  for (uint32_t i = 0; i < sizeof(m_eeprom_data); i++)
+    ((uint8_t *) &m_eeprom_data)[i] = rand();
+
+  for (uint32_t i = 0; i < RIDE_LOG_BLOCKS; i++)
+    for (uint32_t j = 0; j < RIDE_LOG_BLOCK_WORDS; j++)
+      ui32_m_blocks[i][j] = rand() ^ ((uint32_t) rand() << 16);
+
+  for (int v = 0; v < VARS_SIZE; v++) {
+    uint16_t ui16_points = v == 0 ? 0 : v == 1 ? 100 * GRAPH_LEVEL_FACTOR_1 : GRAPH_PUSHES_MAX - VARS_SIZE + v;
+    GraphStore store = { .points = i32_m_graph_points[v], .size = sizeof(int32_t), .offset = 0 };
+
+    graph_data_init(&g_graphData[v], &store, 0);
+    for (uint16_t i = 0; i < ui16_points; i++) {
+      // small enough for the sums of the levels above 0
+      int32_t i32_value = rand() % 2000000 - 1000000;
+      graph_data_push(&g_graphData[v], i32_value);
+      i32_m_pushed[v][i] = i32_value;
+    }
+    ui16_m_pushed[v] = ui16_points;
+  }
+}
+
+static bool run(const link_t *p_link)
+{
+  int to_central[2], from_central[2];
+  int status;
+
+  p_m_link = p_link;
+  if (pipe(to_central) || pipe(from_central)) {
+    perror("pipe");
+    exit(1);
+  }
+
+  fflush(stdout);
+  pid_t pid = fork();
+  if (pid < 0) {
+    perror("fork");
+    exit(1);
+  }
+
+  if (pid == 0) {
+    close(to_central[1]);
+    close(from_central[0]);
+    m_to_central = to_central[0];
+    m_from_central = from_central[1];
+    central();
+  }
+
+  close(to_central[0]);
+  close(from_central[1]);
+  m_to_central = to_central[1];
+  m_from_central = from_central[0];
+  ui32_m_refused = 0;
+  display();
+
+  close(m_to_central);
+  close(m_from_central);
+  waitpid(pid, &status, 0);
+
+  bool ok = WIFEXITED(status) && WEXITSTATUS(status) == 0;
+  if (p_link->check)
+    printf("  %-28s %s, %u sends refused by the full link\n", p_link->p_name, ok ? "OK" : "FAILED", ui32_m_refused);
+
+  return ok;
+}
+
+int main(int argc, char **argv)
+{
+  bool ok = true;
+
+  sources_fill();
+
+  printf("data export, %u ride log blocks, %u TX buffers per connection event:\n", RIDE_LOG_BLOCKS, TX_BUFFERS);
+  for (uint32_t i = 0; i < sizeof(m_links) / sizeof(m_links[0]); i++)
+    ok &= run(&m_links[i]);
+
+  printf(ok ? "OK\n" : "FAILED\n");
+  return ok ? 0 : 1;
+}
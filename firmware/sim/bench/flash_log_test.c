@@ -0,0 +1,418 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Runs thousands of settings saves through the flash log on a simulated NOR flash that cuts the power at random
+ * points, in the middle of a word being programmed or a page being erased, and also during the boot time
+ * recovery. After every cut the log is initialized again, like at boot, and what it reads must be either the
+ * settings of the last completed save or of the save that was cut, never a mix and never nothing. The flash
+ * rejects programming a word that is not erased, except to 0, like the STM32 does.
+ *
+ * Then replays the same saves, from an empty log through two page compactions, with the power cut at each of their
+ * flash operations in turn, the compaction of a save too. The same again from the settings of the older firmware,
+ * in its format in the last two pages of the log, through the copy to the log and the saves that erase them.
+ *
+ * Then counts page erases and programmed words per save without cuts and estimates the save time with the
+ * STM32F103 datasheet typical timings, against the old one page, one byte per half word, format.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <setjmp.h>
+#include "eeprom_hw.h"
+#include "flash_log.h"
+
+#define SETTINGS_WORDS 136 // sizeof(eeprom_data_t) / 4
+#define TEST_SAVES     20000
+#define BENCH_SAVES    10000
+
+#define T_PROGRAM_HALF_WORD_US 52.5
+#define T_ERASE_PAGE_US        20000.0
+
+// The older firmware format, one byte per half word, see 850C eeprom-hw.c
+#define LEGACY_PAGE_KEY_ADDRESS      (1024 - 1)
+#define LEGACY_PAGE_WRITE_ID_ADDRESS (LEGACY_PAGE_KEY_ADDRESS - 1)
+#define LEGACY_MAGIC_KEY             0x5a
+#define LEGACY_FIRST_PAGE            (FLASH_LOG_PAGES - 2)
+
+static uint32_t ui32_m_flash[FLASH_LOG_PAGES][FLASH_LOG_PAGE_WORDS];
+static bool m_legacy; // the older firmware ran on this flash
+static uint32_t ui32_m_erases;
+static uint32_t ui32_m_words;
+static uint32_t ui32_m_bad_programs;
+static int32_t i32_m_cut_countdown = -1; // flash operations left before the power is cut, -1 for never
+static jmp_buf m_power_cut;
+
+static void power_cut_check(uint32_t *p_word, uint32_t ui32_value, bool erase)
+{
+  if (i32_m_cut_countdown < 0 || i32_m_cut_countdown--)
+    return;
+
+  i32_m_cut_countdown = -1;
+
+  // the operation that was running is left half done
+  if (erase) {
+    for (int i = 0; i < FLASH_LOG_PAGE_WORDS; i++) {
+      if (rand() % 2)
+        p_word[i] = 0xffffffff;
+    }
+  } else {
+    *p_word &= ui32_value | (uint32_t) rand();
+  }
+
+  longjmp(m_power_cut, 1);
+}
+
+const uint32_t* flash_log_hw_page(uint8_t ui8_page)
+{
+  return ui32_m_flash[ui8_page];
+}
+
+bool flash_log_hw_program(uint8_t ui8_page, uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num)
+{
+  while (ui16_num--) {
+    uint32_t *p_flash = &ui32_m_flash[ui8_page][ui16_offset++];
+
+    if (*p_flash != 0xffffffff && *p_words != 0) {
+      ui32_m_bad_programs++;
+      return false;
+    }
+
+    power_cut_check(p_flash, *p_words, false);
+    *p_flash &= *p_words++;
+    ui32_m_words++;
+  }
+
+  return true;
+}
+
+bool flash_log_hw_erase(uint8_t ui8_page)
+{
+  power_cut_check(ui32_m_flash[ui8_page], 0, true);
+  memset(ui32_m_flash[ui8_page], 0xff, sizeof(ui32_m_flash[ui8_page]));
+  ui32_m_erases++;
+
+  return true;
+}
+
+static uint8_t legacy_byte(uint8_t ui8_page, uint16_t ui16_address)
+{
+  return (uint8_t) ((const uint16_t *) ui32_m_flash[LEGACY_FIRST_PAGE + ui8_page])[ui16_address];
+}
+
+static void legacy_write(uint8_t ui8_page, uint8_t ui8_write_id, const uint32_t *p_settings)
+{
+  uint16_t *p_half_words = (uint16_t *) ui32_m_flash[LEGACY_FIRST_PAGE + ui8_page];
+
+  p_half_words[ADDRESS_KEY] = KEY;
+  for (int i = 0; i < SETTINGS_WORDS * 4; i++)
+    p_half_words[1 + i] = ((const uint8_t *) p_settings)[i];
+  p_half_words[LEGACY_PAGE_WRITE_ID_ADDRESS] = ui8_write_id;
+  p_half_words[LEGACY_PAGE_KEY_ADDRESS] = LEGACY_MAGIC_KEY;
+}
+
+bool flash_log_hw_legacy_read(void *p_dest, uint16_t ui16_length_words)
+{
+  uint8_t ui8_page;
+
+  if (!m_legacy)
+    return false;
+
+  if (legacy_byte(1, LEGACY_PAGE_KEY_ADDRESS) == LEGACY_MAGIC_KEY &&
+      (legacy_byte(0, LEGACY_PAGE_KEY_ADDRESS) != LEGACY_MAGIC_KEY ||
+       legacy_byte(1, LEGACY_PAGE_WRITE_ID_ADDRESS) > legacy_byte(0, LEGACY_PAGE_WRITE_ID_ADDRESS)))
+    ui8_page = 1;
+  else if (legacy_byte(0, LEGACY_PAGE_KEY_ADDRESS) == LEGACY_MAGIC_KEY)
+    ui8_page = 0;
+  else
+    return false;
+
+  if (legacy_byte(ui8_page, ADDRESS_KEY) != KEY)
+    return false;
+
+  for (int i = 0; i < ui16_length_words * 4; i++)
+    ((uint8_t *) p_dest)[i] = legacy_byte(ui8_page, 1 + i);
+
+  return true;
+}
+
+/// What changes between two rides: the odometer, Wh and trip chunks, sometimes a setting elsewhere
+static void ride(uint32_t *p_settings)
+{
+  p_settings[2] += 1 + rand() % 500;
+  p_settings[12] += rand() % 100;
+  p_settings[13] = rand();
+
+  if (rand() % 10 == 0)
+    p_settings[rand() % SETTINGS_WORDS] = rand();
+}
+
+/// Boots until the log initializes without a cut, returns false if it can't read any settings
+static bool boot(uint32_t *p_settings)
+{
+  while (setjmp(m_power_cut))
+    ;
+
+  if (rand() % 4 == 0)
+    i32_m_cut_countdown = rand() % 40;
+
+  flash_log_init();
+  i32_m_cut_countdown = -1;
+
+  return flash_log_read_words(p_settings, SETTINGS_WORDS);
+}
+
+/// The settings after a cut must be those of the last completed save or of the save that was cut
+static bool check_after_cut(const uint32_t *p_saved, const uint32_t *p_settings, bool saved_once, const char *p_what,
+    int i_save)
+{
+  static uint32_t ui32_read[SETTINGS_WORDS];
+
+  memset(ui32_read, 0, sizeof(ui32_read));
+  if (!boot(ui32_read)) {
+    if (saved_once) {
+      printf("%s %d: settings lost after a power cut\n", p_what, i_save);
+      return false;
+    }
+    return true;
+  }
+
+  if (memcmp(ui32_read, p_saved, sizeof(ui32_read)) && memcmp(ui32_read, p_settings, sizeof(ui32_read))) {
+    printf("%s %d: read settings are neither the old nor the new ones\n", p_what, i_save);
+    return false;
+  }
+
+  return true;
+}
+
+static bool power_cut_test(void)
+{
+  static uint32_t ui32_saved[SETTINGS_WORDS]; // the last completely saved settings
+  static uint32_t ui32_settings[SETTINGS_WORDS];
+  static uint32_t ui32_read[SETTINGS_WORDS];
+  volatile uint32_t ui32_cuts = 0;
+  volatile bool saved_once = false;
+
+  memset(ui32_m_flash, 0xff, sizeof(ui32_m_flash));
+  flash_log_init();
+
+  for (volatile int i = 0; i < TEST_SAVES; i++) {
+    ride(ui32_settings);
+
+    if (setjmp(m_power_cut) == 0) {
+      if (rand() % 3 == 0)
+        i32_m_cut_countdown = rand() % 400; // also in the compaction of the saves that open a page
+
+      if (!flash_log_write_words(ui32_settings, SETTINGS_WORDS)) {
+        printf("save %d failed\n", i);
+        return false;
+      }
+
+      i32_m_cut_countdown = -1;
+      memcpy(ui32_saved, ui32_settings, sizeof(ui32_saved));
+      saved_once = true;
+
+      // sometimes just turn it off and on again
+      if (rand() % 8)
+        continue;
+    } else {
+      ui32_cuts++;
+    }
+
+    if (!check_after_cut(ui32_saved, ui32_settings, saved_once, "save", i))
+      return false;
+
+    memset(ui32_read, 0, sizeof(ui32_read));
+    if (!flash_log_read_words(ui32_read, SETTINGS_WORDS))
+      continue;
+
+    // the firmware goes on with what it read
+    memcpy(ui32_settings, ui32_read, sizeof(ui32_settings));
+    memcpy(ui32_saved, ui32_read, sizeof(ui32_saved));
+    saved_once = true;
+  }
+
+  // the settings reset of the config menu
+  flash_log_write_key(0);
+  flash_log_init();
+  if (flash_log_read_words(ui32_read, SETTINGS_WORDS)) {
+    printf("settings still valid after writing a wrong key\n");
+    return false;
+  }
+
+  flash_log_write_words(ui32_settings, SETTINGS_WORDS);
+  flash_log_init();
+  if (!flash_log_read_words(ui32_read, SETTINGS_WORDS) || memcmp(ui32_read, ui32_settings, sizeof(ui32_read))) {
+    printf("settings not valid after saving them again\n");
+    return false;
+  }
+
+  if (ui32_m_bad_programs) {
+    printf("%u words programmed without being erased\n", ui32_m_bad_programs);
+    return false;
+  }
+
+  printf("%d saves with %u power cuts, the settings always read as the last or the cut save\n", TEST_SAVES,
+      (uint32_t) ui32_cuts);
+  return true;
+}
+
+/// Saves from an empty log until two pages were compacted, cutting the power after ui32_cut flash operations.
+/// Returns the number of flash operations of all saves if there was no cut, 0 if the check after the cut failed.
+static uint32_t compaction_run(uint32_t ui32_cut)
+{
+  static uint32_t ui32_saved[SETTINGS_WORDS];
+  static uint32_t ui32_settings[SETTINGS_WORDS];
+  volatile int i = 0;
+
+  srand(2); // the same saves every run
+  memset(ui32_m_flash, 0xff, sizeof(ui32_m_flash));
+  memset(ui32_settings, 0, sizeof(ui32_settings));
+  ui32_m_erases = 0;
+  ui32_m_words = 0;
+  flash_log_init();
+
+  if (setjmp(m_power_cut)) {
+    if (!check_after_cut(ui32_saved, ui32_settings, i > 0, "compaction run, save", i))
+      return 0;
+    return ui32_cut + 1;
+  }
+
+  i32_m_cut_countdown = ui32_cut;
+  for (; ui32_m_erases < 2; i++) {
+    ride(ui32_settings);
+    ui32_settings[rand() % SETTINGS_WORDS] = rand(); // a chunk that may still be in the page being compacted
+    flash_log_write_words(ui32_settings, SETTINGS_WORDS);
+    memcpy(ui32_saved, ui32_settings, sizeof(ui32_saved));
+  }
+  i32_m_cut_countdown = -1;
+
+  return ui32_m_erases + ui32_m_words;
+}
+
+static bool compaction_cut_test(void)
+{
+  uint32_t ui32_ops = compaction_run(-1);
+
+  for (uint32_t ui32_cut = 0; ui32_cut < ui32_ops; ui32_cut++) {
+    if (!compaction_run(ui32_cut))
+      return false;
+  }
+
+  printf("power cut at each of the %u flash operations from an empty log through 2 compactions\n", ui32_ops);
+  return true;
+}
+
+/// Boots on the flash of the older firmware, after boots cut while copying its settings, and saves until both its pages were erased and a page was compacted,
+/// cutting the power after ui32_cut flash operations. Returns like compaction_run().
+static uint32_t legacy_run(uint32_t ui32_cut)
+{
+  static uint32_t ui32_saved[SETTINGS_WORDS];
+  static uint32_t ui32_settings[SETTINGS_WORDS];
+  volatile int i = 0;
+
+  srand(3);
+  memset(ui32_m_flash, 0xff, sizeof(ui32_m_flash));
+  for (int j = 0; j < SETTINGS_WORDS; j++)
+    ui32_settings[j] = rand();
+  legacy_write(0, 1, ui32_settings); // an older save in the other page
+  for (int j = 0; j < SETTINGS_WORDS; j++)
+    ui32_settings[j] = rand();
+  legacy_write(1, 2, ui32_settings);
+  memcpy(ui32_saved, ui32_settings, sizeof(ui32_saved));
+
+  // a few boots cut while copying them fill the first log pages with records of no save
+  for (volatile int j = 0; j < 5; j++) {
+    if (setjmp(m_power_cut) == 0) {
+      i32_m_cut_countdown = 100 + rand() % 80;
+      flash_log_init();
+      flash_log_read_words(ui32_settings, SETTINGS_WORDS);
+    }
+  }
+  ui32_m_erases = 0;
+  ui32_m_words = 0;
+
+  if (setjmp(m_power_cut)) {
+    if (!check_after_cut(ui32_saved, ui32_settings, true, "legacy run, save", i))
+      return 0;
+    return ui32_cut + 1;
+  }
+
+  i32_m_cut_countdown = ui32_cut;
+  flash_log_init();
+  if (!flash_log_read_words(ui32_settings, SETTINGS_WORDS) || memcmp(ui32_settings, ui32_saved, sizeof(ui32_saved))) {
+    printf("legacy run: the older settings not read\n");
+    return 0;
+  }
+
+  for (; ui32_m_erases < 3; i++) {
+    ride(ui32_settings);
+    flash_log_write_words(ui32_settings, SETTINGS_WORDS);
+    memcpy(ui32_saved, ui32_settings, sizeof(ui32_saved));
+  }
+  i32_m_cut_countdown = -1;
+
+  return ui32_m_erases + ui32_m_words;
+}
+
+static bool legacy_cut_test(void)
+{
+  uint32_t ui32_ops;
+
+  m_legacy = true;
+  ui32_ops = legacy_run(-1);
+
+  for (uint32_t ui32_cut = 0; ui32_ops && ui32_cut < ui32_ops; ui32_cut++) {
+    if (!legacy_run(ui32_cut))
+      ui32_ops = 0;
+  }
+  m_legacy = false;
+
+  if (!ui32_ops)
+    return false;
+
+  printf("power cut at each of the %u flash operations from the older settings format through its erase\n",
+      ui32_ops);
+  return true;
+}
+
+static void bench(void)
+{
+  static uint32_t ui32_settings[SETTINGS_WORDS];
+  uint32_t ui32_old_half_words = 1 + SETTINGS_WORDS * 4 + 3; // KEY, data, page key and write ID
+  double old_us = T_ERASE_PAGE_US + ui32_old_half_words * T_PROGRAM_HALF_WORD_US;
+  double new_us;
+
+  memset(ui32_m_flash, 0xff, sizeof(ui32_m_flash));
+  flash_log_init();
+  flash_log_write_words(ui32_settings, SETTINGS_WORDS);
+  ui32_m_erases = 0;
+  ui32_m_words = 0;
+
+  for (int i = 0; i < BENCH_SAVES; i++) {
+    ride(ui32_settings);
+    flash_log_write_words(ui32_settings, SETTINGS_WORDS);
+  }
+
+  new_us = (ui32_m_erases * T_ERASE_PAGE_US + ui32_m_words * 2 * T_PROGRAM_HALF_WORD_US) / BENCH_SAVES;
+
+  printf("old: %6.3f erases, %5u half words, %5.1f ms per save\n", 1.0, ui32_old_half_words, old_us / 1000);
+  printf("log: %6.3f erases, %5.1f words,      %5.1f ms per save\n", (double) ui32_m_erases / BENCH_SAVES,
+      (double) ui32_m_words / BENCH_SAVES, new_us / 1000);
+}
+
+int main(void)
+{
+  srand(1);
+
+  if (!power_cut_test() || !compaction_cut_test() || !legacy_cut_test())
+    return 1;
+
+  bench();
+
+  return 0;
+}
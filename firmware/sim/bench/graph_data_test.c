@@ -0,0 +1,235 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Checks the points and max/min of every level of graph_data.h against levels built the plain way, each a list of
+ * all its points with each point the mean of its level factor of points of the level below, for random, rising,
+ * falling, sawtooth and mostly stopped data, with and without a min threshold, with the points stored as int32_t
+ * and as int16_t with an offset, and that an int8_t store saturates. make graph-data-test also runs it with other
+ * level factors than the firmware's. Then times a rt_graph_process() tick, where
+ * all the graphs get a point, and reading a whole level like the graph does when it is drawn, for each point size.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "graph_data.h"
+
+#define BENCH_GRAPHS     14 // VARS_SIZE
+#define BENCH_TICKS      20000
+#define CHECK_POINTS     (2 * GRAPH_MAX_POINTS * GRAPH_LEVEL_FACTOR_1 * GRAPH_LEVEL_FACTOR_2 + 123)
+
+static GraphData m_graphs[BENCH_GRAPHS];
+static int32_t i32_m_points[BENCH_GRAPHS][GRAPH_STORED_POINTS]; // big enough for any point size
+static int32_t i32_m_levels[GRAPH_LEVELS][CHECK_POINTS];
+static uint32_t ui32_m_level_points[GRAPH_LEVELS];
+static volatile int32_t i32_m_sink;
+
+// The plain levels, a point of each level above when the level below has its level factor more
+static void levels_push(int32_t i32_value)
+{
+  i32_m_levels[0][ui32_m_level_points[0]++] = i32_value;
+
+  for (int l = 1; l < GRAPH_LEVELS && ui32_m_level_points[l - 1] % ui8_g_graph_level_factor[l] == 0; l++) {
+    int32_t i32_sum = 0;
+
+    for (int i = 1; i <= ui8_g_graph_level_factor[l]; i++)
+      i32_sum += i32_m_levels[l - 1][ui32_m_level_points[l - 1] - i];
+
+    i32_m_levels[l][ui32_m_level_points[l]++] = i32_sum / ui8_g_graph_level_factor[l];
+  }
+}
+
+static int32_t sample(int pattern, int i)
+{
+  switch (pattern) {
+    case 0: return rand() % 1000 - 200;
+    case 1: return i;
+    case 2: return -i;
+    case 3: return i % 37;
+    default: return (rand() % 4) ? 0 : rand() % 300; // mostly stopped
+  }
+}
+
+static bool check_level(const GraphData *p_graph, int pattern, int32_t i32_min_threshold, int i, int l)
+{
+  uint32_t ui32_points = ui32_m_level_points[l] < GRAPH_MAX_POINTS ? ui32_m_level_points[l] : GRAPH_MAX_POINTS;
+  const int32_t *p_level = &i32_m_levels[l][ui32_m_level_points[l] - ui32_points];
+  int32_t i32_max = INT32_MIN, i32_min = INT32_MAX, i32_got_max, i32_got_min;
+
+  if (graph_data_points(p_graph, l) != ui32_points) {
+    printf("pattern %d threshold %d: point %d level %d has %u points, expected %u\n", pattern, i32_min_threshold, i,
+        l, graph_data_points(p_graph, l), ui32_points);
+    return false;
+  }
+
+  for (uint32_t p = 0; p < ui32_points; p++) {
+    if (graph_data_point(p_graph, l, p) != p_level[p]) {
+      printf("pattern %d threshold %d: point %d level %d point %u is %d, expected %d\n", pattern, i32_min_threshold,
+          i, l, p, graph_data_point(p_graph, l, p), p_level[p]);
+      return false;
+    }
+
+    if (p_level[p] > i32_max)
+      i32_max = p_level[p];
+
+    if (p_level[p] < i32_min && p_level[p] >= i32_min_threshold)
+      i32_min = p_level[p];
+  }
+
+  graph_data_max_min(p_graph, l, &i32_got_max, &i32_got_min);
+  if (i32_got_max != i32_max || i32_got_min != i32_min) {
+    printf("pattern %d threshold %d: point %d level %d max/min %d/%d, expected %d/%d\n", pattern, i32_min_threshold,
+        i, l, i32_got_max, i32_got_min, i32_max, i32_min);
+    return false;
+  }
+
+  return true;
+}
+
+static GraphStore store(int g, uint8_t ui8_size, int32_t i32_offset)
+{
+  GraphStore store = { .points = i32_m_points[g], .size = ui8_size, .offset = i32_offset };
+
+  return store;
+}
+
+static bool check(int pattern, int32_t i32_min_threshold, const GraphStore *p_store)
+{
+  static GraphData graph;
+
+  graph_data_init(&graph, p_store, i32_min_threshold);
+  for (int l = 0; l < GRAPH_LEVELS; l++)
+    ui32_m_level_points[l] = 0;
+
+  for (int i = 0; i < CHECK_POINTS; i++) {
+    int32_t i32_value = sample(pattern, i);
+
+    graph_data_push(&graph, i32_value);
+    levels_push(i32_value);
+
+    for (int l = 0; l < GRAPH_LEVELS; l++) {
+      if (!check_level(&graph, pattern, i32_min_threshold, i, l))
+        return false;
+    }
+  }
+
+  return true;
+}
+
+// The values out of the range of the store come back saturated
+static bool check_saturated(void)
+{
+  static GraphData graph;
+  GraphStore int8_store = store(0, sizeof(int8_t), 128);
+
+  graph_data_init(&graph, &int8_store, 0);
+  for (int32_t i = 0; i < GRAPH_MAX_POINTS; i++)
+    graph_data_push(&graph, i * 2 - 100);
+
+  for (int32_t i = 0; i < GRAPH_MAX_POINTS; i++) {
+    int32_t i32_expected = i * 2 - 100 < 0 ? 0 : i * 2 - 100 > 255 ? 255 : i * 2 - 100;
+
+    if (graph_data_point(&graph, 0, i) != i32_expected) {
+      printf("int8_t point %d is %d, expected %d\n", i, graph_data_point(&graph, 0, i), i32_expected);
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t) ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+static void bench(uint8_t ui8_size)
+{
+  uint64_t ui64_total = 0, ui64_max = 0;
+
+  for (int g = 0; g < BENCH_GRAPHS; g++) {
+    GraphStore graph_store = store(g, ui8_size, 0);
+
+    graph_data_init(&m_graphs[g], &graph_store, 1);
+  }
+
+  // fill all the levels first, we only want the full, discarding, case
+  for (int i = 0; i < GRAPH_MAX_POINTS * GRAPH_LEVEL_FACTOR_1 * GRAPH_LEVEL_FACTOR_2 * 2; i++) {
+    for (int g = 0; g < BENCH_GRAPHS; g++)
+      graph_data_push(&m_graphs[g], sample(0, i));
+  }
+
+  for (int i = 0; i < BENCH_TICKS; i++) {
+    uint64_t ui64_start = now_ns(), ui64_ns;
+
+    for (int g = 0; g < BENCH_GRAPHS; g++)
+      graph_data_push(&m_graphs[g], sample(1, i));
+
+    ui64_ns = now_ns() - ui64_start;
+    ui64_total += ui64_ns;
+    if (ui64_ns > ui64_max)
+      ui64_max = ui64_ns;
+  }
+
+  printf("int%d_t points\n", ui8_size * 8);
+  printf("  tick: %llu ns avg, %llu ns max for %d graphs\n", (unsigned long long) (ui64_total / BENCH_TICKS),
+      (unsigned long long) ui64_max, BENCH_GRAPHS);
+
+  for (int l = 0; l < GRAPH_LEVELS; l++) {
+    uint64_t ui64_start = now_ns(), ui64_max_min;
+
+    for (int i = 0; i < BENCH_TICKS / 100; i++) {
+      int32_t i32_max, i32_min;
+
+      graph_data_max_min(&m_graphs[0], l, &i32_max, &i32_min);
+      i32_m_sink = i32_max + i32_min;
+    }
+    ui64_max_min = (now_ns() - ui64_start) / (BENCH_TICKS / 100);
+
+    ui64_start = now_ns();
+    for (int i = 0; i < BENCH_TICKS / 100; i++) {
+      int32_t i32_max, i32_min;
+
+      graph_data_max_min(&m_graphs[0], l, &i32_max, &i32_min);
+      for (uint16_t p = 0; p < graph_data_points(&m_graphs[0], l); p++)
+        i32_m_sink = graph_data_point(&m_graphs[0], l, p);
+    }
+
+    printf("  drawing level %d: %llu ns for the max/min (%llu ns of it) and its %u points\n", l,
+        (unsigned long long) ((now_ns() - ui64_start) / (BENCH_TICKS / 100)), (unsigned long long) ui64_max_min,
+        graph_data_points(&m_graphs[0], l));
+  }
+
+  printf("  %u bytes for the %d graphs\n", (unsigned) (sizeof(m_graphs) + BENCH_GRAPHS * GRAPH_STORED_POINTS * ui8_size),
+      BENCH_GRAPHS);
+}
+
+int main(void)
+{
+  srand(1);
+
+  GraphStore int32_store = store(0, sizeof(int32_t), 0), int16_store = store(0, sizeof(int16_t), 300);
+
+  for (int pattern = 0; pattern < 5; pattern++) {
+    if (!check(pattern, INT32_MIN, &int32_store) || !check(pattern, 1, &int32_store) ||
+        !check(pattern, INT32_MIN, &int16_store) || !check(pattern, 1, &int16_store))
+      return 1;
+  }
+  printf("graph points and max/min of all levels match the plain levels for all patterns, int32_t and int16_t, "
+      "level factors %d and %d\n", GRAPH_LEVEL_FACTOR_1, GRAPH_LEVEL_FACTOR_2);
+
+  if (!check_saturated())
+    return 1;
+  printf("int8_t points saturate\n");
+
+  bench(sizeof(int32_t));
+  bench(sizeof(int16_t));
+  bench(sizeof(int8_t));
+
+  return 0;
+}
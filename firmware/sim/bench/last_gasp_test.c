@@ -0,0 +1,293 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Pulls the battery thousands of times while riding and checks the last gasp record gets to flash before VDD is
+ * too low for the MCU, on fake flash with the datasheet worst case timings. After the supply supervisor fires,
+ * VDD falls at the load current over the VDD capacitance, the record is programmed a word at a time once the
+ * flash is done with what the main loop had started, and if VDD reaches the minimum first the word being
+ * programmed is left half done and nothing else is written. Each pull is followed by a boot, with power cuts of
+ * its own, that merges the record into the settings: they must hold the counters at the pull when the record
+ * fit and the ones of the last save or record otherwise, never anything else. Sometimes the supply comes back
+ * and the ride goes on, the settings saves after that must win over the record.
+ *
+ * The VDD capacitance and currents are not measured on the boards, they are the assumptions the budget printed
+ * here holds for. The minimum capacitance printed for each case is what to compare with the board.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <setjmp.h>
+#include "last_gasp.h"
+
+#define PULLS 20000
+
+typedef struct {
+  const char *name;
+  double t_us; // what is left of it when the supply supervisor fires is random
+} activity_t;
+
+#ifdef SW102
+// nRF51822: POFWARN at 2.7V, runs down to 1.8V, 46us to write a word. The SoftDevice starts sd_flash_write()
+// after the radio event in progress and sends the POFWARN event through SWI2
+#define PLATFORM          "SW102 POFWARN"
+#define V_WARN            2.7
+#define V_MIN             1.8
+#define C_UF              47.0
+#define I_MA_BEFORE       10.0
+#define I_MA_AFTER        10.0 // nRF51 and the OLED, nothing to turn off
+#define LATENCY_US        50.0
+#define WORD_US           46.0
+
+static const activity_t m_activities[] = {
+  { "idle", 0 },
+  { "writing a word", 46 },
+  { "radio event", 2500 },
+  { "erasing an FDS page", 22300 },
+};
+#else
+// STM32F103: PVD falling edge at 2.76V at worst for the 2.9V level, runs and programs down to 2.0V, 70us to
+// program a half word, 40ms to erase a page. The handler turns the backlight off first
+#define PLATFORM          "850C PVD"
+#define V_WARN            2.76
+#define V_MIN             2.0
+#define C_UF              47.0
+#define I_MA_BEFORE       80.0
+#define I_MA_AFTER        20.0
+#define LATENCY_US        2.0
+#define WORD_US           (2 * 70.0)
+
+static const activity_t m_activities[] = {
+  { "idle", 0 },
+  { "programming a word", 2 * 70 },
+  { "erasing a page", 40000 },
+};
+#endif
+
+#define ACTIVITIES (sizeof(m_activities) / sizeof(m_activities[0]))
+
+typedef struct {
+  uint32_t ui32_odometer_x10;
+  uint32_t ui32_wh_x10;
+} counters_t;
+
+static uint32_t ui32_m_area[LAST_GASP_AREA_WORDS];
+static uint32_t ui32_m_bad_programs;
+static jmp_buf m_power_cut;
+
+// the supply drop, in us since the supervisor fired
+static bool m_dropping;
+static double d_m_now_us;
+static double d_m_busy_until_us; // the flash finishes what the main loop started
+static double d_m_brown_out_us; // VDD reaches V_MIN
+
+static int32_t i32_m_cut_countdown = -1; // at boot, flash operations left before the power is cut, -1 for never
+
+static counters_t m_settings; // what the flash log holds, flash_log_test cuts its saves
+
+static void power_cut(uint32_t *p_word, uint32_t ui32_value, bool erase)
+{
+  // the operation that was running is left half done
+  if (erase) {
+    for (int i = 0; i < LAST_GASP_AREA_WORDS; i++) {
+      if (rand() % 2)
+        p_word[i] = 0xffffffff;
+    }
+  } else {
+    *p_word &= ui32_value | (uint32_t) rand();
+  }
+
+  longjmp(m_power_cut, 1);
+}
+
+static void power_cut_check(uint32_t *p_word, uint32_t ui32_value, bool erase)
+{
+  if (i32_m_cut_countdown < 0 || i32_m_cut_countdown--)
+    return;
+
+  i32_m_cut_countdown = -1;
+  power_cut(p_word, ui32_value, erase);
+}
+
+const uint32_t* last_gasp_hw_area(void)
+{
+  return ui32_m_area;
+}
+
+bool last_gasp_hw_program(uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num)
+{
+  while (ui16_num--) {
+    uint32_t *p_flash = &ui32_m_area[ui16_offset++];
+
+    if (*p_flash != 0xffffffff && *p_words != 0) {
+      ui32_m_bad_programs++;
+      return false;
+    }
+
+    if (m_dropping) {
+      if (d_m_now_us < d_m_busy_until_us)
+        d_m_now_us = d_m_busy_until_us;
+      d_m_now_us += WORD_US;
+      if (d_m_now_us > d_m_brown_out_us)
+        power_cut(p_flash, *p_words, false);
+    } else {
+      power_cut_check(p_flash, *p_words, false);
+    }
+
+    *p_flash &= *p_words++;
+  }
+
+  return true;
+}
+
+bool last_gasp_hw_erase(void)
+{
+  power_cut_check(ui32_m_area, 0, true);
+  memset(ui32_m_area, 0xff, sizeof(ui32_m_area));
+
+  return true;
+}
+
+void last_gasp_hw_enable(bool enable)
+{
+}
+
+// From the supervisor to VDD at V_MIN, the handler cuts the load after LATENCY_US
+static double brown_out_us(double c_uf)
+{
+  double v = V_WARN - LATENCY_US * I_MA_BEFORE / c_uf / 1000;
+
+  return LATENCY_US + (v - V_MIN) * c_uf / I_MA_AFTER * 1000;
+}
+
+// The record is in flash this long after the supervisor fired, at worst
+static double record_us(const activity_t *p_activity)
+{
+  return fmax(LATENCY_US, p_activity->t_us) + LAST_GASP_WRITE_WORDS * WORD_US;
+}
+
+// The VDD capacitance that holds it up for t_us
+static double capacitance_uf(double t_us)
+{
+  return ((t_us - LATENCY_US) * I_MA_AFTER + LATENCY_US * I_MA_BEFORE) / ((V_WARN - V_MIN) * 1000);
+}
+
+// What eeprom_init() does, cut short at random points until it completes
+static void boot(counters_t *p_counters)
+{
+  last_gasp_record_t record;
+
+  while (setjmp(m_power_cut))
+    ;
+
+  if (rand() % 4 == 0)
+    i32_m_cut_countdown = rand() % LAST_GASP_RECORDS;
+
+  last_gasp_init();
+  *p_counters = m_settings;
+  if (last_gasp_read(&record)) {
+    p_counters->ui32_odometer_x10 = record.ui32_odometer_x10;
+    p_counters->ui32_wh_x10 = record.ui32_wh_x10;
+    m_settings = *p_counters;
+    last_gasp_merged();
+  }
+
+  i32_m_cut_countdown = -1;
+}
+
+static bool pull_test(void)
+{
+  static uint32_t ui32_pulls[ACTIVITIES], ui32_saved[ACTIVITIES];
+  static counters_t counters, durable; // now, and what must be read at next boot
+  static counters_t read;
+  uint32_t ui32_recoveries = 0;
+  double d_brown_out_us = brown_out_us(C_UF);
+
+  memset(ui32_m_area, 0xff, sizeof(ui32_m_area));
+  boot(&counters);
+
+  for (int i = 0; i < PULLS; i++) {
+    static const activity_t *p_activity;
+    static bool recovers, saved;
+
+    counters.ui32_odometer_x10 += 1 + rand() % 300;
+    counters.ui32_wh_x10 += rand() % 100;
+
+    // turned off and on, or the configuration menu left
+    if (rand() % 4 == 0) {
+      m_settings = counters;
+      last_gasp_merged();
+      durable = counters;
+    }
+
+    p_activity = &m_activities[rand() % ACTIVITIES];
+    recovers = rand() % 8 == 0;
+
+    m_dropping = true;
+    d_m_now_us = LATENCY_US;
+    d_m_busy_until_us = p_activity->t_us * rand() / RAND_MAX;
+    d_m_brown_out_us = recovers ? INFINITY : d_brown_out_us;
+    saved = false;
+    if (setjmp(m_power_cut) == 0) {
+      last_gasp_save(counters.ui32_odometer_x10, counters.ui32_wh_x10);
+      saved = true;
+    }
+    m_dropping = false;
+
+    if (saved)
+      durable = counters;
+
+    if (recovers) {
+      ui32_recoveries++;
+      continue;
+    }
+
+    ui32_pulls[p_activity - m_activities]++;
+    ui32_saved[p_activity - m_activities] += saved;
+
+    if (!saved && record_us(p_activity) <= d_brown_out_us) {
+      printf("pull %d: no record while %s, that fits the budget\n", i, p_activity->name);
+      return false;
+    }
+
+    boot(&read);
+    if (memcmp(&read, &durable, sizeof(read))) {
+      printf("pull %d: read odometer %u Wh %u, expected %u %u\n", i, read.ui32_odometer_x10, read.ui32_wh_x10,
+          durable.ui32_odometer_x10, durable.ui32_wh_x10);
+      return false;
+    }
+    counters = read;
+  }
+
+  if (ui32_m_bad_programs) {
+    printf("%u words programmed without being erased\n", ui32_m_bad_programs);
+    return false;
+  }
+
+  printf("%s at %.2fV, %.0fuF, %.0f then %.0fmA: %.0f us to %.1fV\n", PLATFORM, V_WARN, C_UF, I_MA_BEFORE,
+      I_MA_AFTER, d_brown_out_us, V_MIN);
+  for (int i = 0; i < ACTIVITIES; i++) {
+    const activity_t *p_activity = &m_activities[i];
+
+    printf("  %-20s record in flash after %6.0f us, needs %6.1f uF: %s, %u of %u pulls saved\n", p_activity->name,
+        record_us(p_activity), capacitance_uf(record_us(p_activity)),
+        record_us(p_activity) <= d_brown_out_us ? "fits" : "lost, the last save is kept", ui32_saved[i],
+        ui32_pulls[i]);
+  }
+  printf("%d battery pulls and %u supply recoveries, the boot always read the last save or record\n",
+      PULLS - ui32_recoveries, ui32_recoveries);
+
+  return true;
+}
+
+int main(void)
+{
+  srand(1);
+
+  return pull_test() ? 0 : 1;
+}
@@ -0,0 +1,305 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Logs a synthetic hour long ride through the ride logger into fake flash pages, then decodes every stored block
+ * and checks it gives back the sampled values. Prints the bytes of flash per hour and the worst case time a
+ * ride_log_flush() call takes on the 850C, from the STM32F103 datasheet flash timings, which must never be a page
+ * erase: that is done ahead by ride_log_idle() when the main loop has nothing to do. Then logs more rides with
+ * power cuts at random points of the block writes: the blocks written before a cut must all be there, the cut one
+ * not at all and the log must go on after the reboot.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "state.h"
+#include "events.h"
+#include "ride_log.h"
+
+#define TICK_MS          100
+#define RIDE_S           3600
+#define SAMPLES_MAX      (8 * RIDE_S)
+#define CUT_RIDES        200
+
+// STM32F103 worst case: 70us to program a half word, 40ms to erase a page
+#define PROGRAM_US       (2 * 70)
+#define ERASE_US         40000
+
+uint32_t ui32_seconds_since_startup;
+
+static uint32_t ui32_m_flash[RIDE_LOG_PAGES][RIDE_LOG_PAGE_WORDS];
+static uint32_t ui32_m_call_us; // flash time of the current ride_log_flush() call
+static bool m_call_erased;
+static uint32_t ui32_m_max_program_us, ui32_m_max_erase_us, ui32_m_max_idle_us;
+static int32_t i32_m_words_to_cut = -1; // the power goes after programming this many more words
+static bool m_power_off;
+static uint32_t ui32_m_blocks_done; // whose header was programmed all
+static bool m_posted;
+
+static rt_vars_t m_rt_vars;
+static uint32_t ui32_m_expected[SAMPLES_MAX][RIDE_LOG_CHANNELS_NUM]; // by time of the sample, in seconds
+static uint32_t ui32_m_samples;
+
+void event_post(event_t event)
+{
+  if (event == EVENT_RIDE_LOG)
+    m_posted = true;
+}
+
+const uint32_t* ride_log_hw_page(uint16_t ui16_page)
+{
+  return ui32_m_flash[ui16_page];
+}
+
+bool ride_log_hw_program(uint16_t ui16_page, uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num)
+{
+  bool header = ui16_offset % RIDE_LOG_BLOCK_WORDS == 0 && !m_power_off;
+
+  while (ui16_num && !m_power_off) {
+    ui16_num--;
+
+    uint32_t *p_flash = &ui32_m_flash[ui16_page][ui16_offset++];
+
+    if (*p_flash != 0xffffffff && *p_words != 0)
+      return false;
+
+    *p_flash &= *p_words++;
+    ui32_m_call_us += PROGRAM_US;
+
+    if (i32_m_words_to_cut >= 0 && i32_m_words_to_cut-- == 0)
+      m_power_off = true;
+  }
+
+  if (header && !ui16_num)
+    ui32_m_blocks_done++;
+
+  return true;
+}
+
+bool ride_log_hw_erase(uint16_t ui16_page)
+{
+  if (!m_power_off) {
+    memset(ui32_m_flash[ui16_page], 0xff, sizeof(ui32_m_flash[ui16_page]));
+    ui32_m_call_us += ERASE_US;
+    m_call_erased = true;
+  }
+
+  return true;
+}
+
+// Something like a commute: accelerate, cruise with some noise, stop at lights every few minutes
+static void ride_step(uint32_t ui32_ms)
+{
+  static uint32_t ui32_odometer_mm, ui32_wh_mws;
+  double t = ui32_ms / 1000.0;
+  bool stopped = fmod(t, 300) > 255 || t < 20;
+
+  if (ui32_ms == 0) {
+    ui32_odometer_mm = 1234567800;
+    ui32_wh_mws = 0;
+  }
+
+  if (!stopped) {
+    m_rt_vars.ui16_wheel_speed_x10 = 250 + 40 * sin(t / 45) + rand() % 7 - 3;
+    m_rt_vars.ui8_pedal_cadence_filtered = 70 + rand() % 11 - 5;
+    m_rt_vars.ui16_pedal_power_filtered = 140 + rand() % 41 - 20;
+    m_rt_vars.ui16_battery_current_filtered_x5 = 40 + 20 * sin(t / 45) + rand() % 5;
+  } else {
+    m_rt_vars.ui16_wheel_speed_x10 = 0;
+    m_rt_vars.ui8_pedal_cadence_filtered = 0;
+    m_rt_vars.ui16_pedal_power_filtered = 0;
+    m_rt_vars.ui16_battery_current_filtered_x5 = 0;
+  }
+
+  m_rt_vars.ui16_battery_voltage_filtered_x10 = 530 - t / 120 + rand() % 3;
+  m_rt_vars.ui16_battery_power_filtered = m_rt_vars.ui16_battery_voltage_filtered_x10
+      * m_rt_vars.ui16_battery_current_filtered_x5 / 50;
+  m_rt_vars.ui8_motor_temperature = 25 + (t < 1800 ? t / 60 : 30);
+  m_rt_vars.ui8_assist_level = 2 + (fmod(t, 900) > 600);
+
+  ui32_odometer_mm += m_rt_vars.ui16_wheel_speed_x10 * TICK_MS / 36;
+  m_rt_vars.ui32_odometer_x10 = ui32_odometer_mm / 100000;
+  ui32_wh_mws += m_rt_vars.ui16_battery_power_filtered * TICK_MS;
+  m_rt_vars.ui32_wh_x10 = ui32_wh_mws / 360000;
+}
+
+static void expect_sample(void)
+{
+  uint32_t *p_values = ui32_m_expected[ui32_seconds_since_startup];
+
+#define RIDE_LOG_CHANNEL_EXPECT(name, field, divisor) p_values[RIDE_LOG_CHANNEL_##name] = m_rt_vars.field;
+  RIDE_LOG_CHANNEL_LIST(RIDE_LOG_CHANNEL_EXPECT)
+
+  ui32_m_samples++;
+}
+
+// The main loop: handle EVENT_RIDE_LOG until there is nothing left, or the power is cut
+static void flush(uint32_t *p_calls)
+{
+  while (m_posted && !m_power_off) {
+    m_posted = false;
+    ui32_m_call_us = 0;
+    m_call_erased = false;
+    ride_log_flush();
+    (*p_calls)++;
+
+    uint32_t *p_max_us = m_call_erased ? &ui32_m_max_erase_us : &ui32_m_max_program_us;
+    if (ui32_m_call_us > *p_max_us)
+      *p_max_us = ui32_m_call_us;
+  }
+
+  // main_idle() found no events
+  if (!m_power_off) {
+    ui32_m_call_us = 0;
+    ride_log_idle();
+    if (ui32_m_call_us > ui32_m_max_idle_us)
+      ui32_m_max_idle_us = ui32_m_call_us;
+  }
+}
+
+// Runs a ride of ui32_seconds from ui32_seconds_since_startup
+static void ride(uint32_t ui32_seconds, uint32_t *p_calls)
+{
+  for (uint32_t ui32_ms = 0; ui32_ms < ui32_seconds * 1000 && !m_power_off; ui32_ms += TICK_MS) {
+    ride_step(ui32_ms);
+
+    // ride_log_sample() takes the sample on every RIDE_LOG_INTERVAL_MS / TICK_MS tick
+    if (ui32_ms % RIDE_LOG_INTERVAL_MS == RIDE_LOG_INTERVAL_MS - TICK_MS)
+      expect_sample();
+    ride_log_sample(&m_rt_vars);
+
+    flush(p_calls);
+
+    if (ui32_ms % 1000 == 1000 - TICK_MS)
+      ui32_seconds_since_startup++;
+  }
+}
+
+typedef struct {
+  uint32_t ui32_samples;
+  bool ok;
+} check_t;
+
+static void check_sample(void *p_context, const ride_log_header_t *p_header, uint16_t ui16_sample,
+    const uint32_t ui32_values[RIDE_LOG_CHANNELS_NUM])
+{
+  check_t *p_check = p_context;
+  uint32_t ui32_time = p_header->ui32_time_s + ui16_sample * p_header->ui16_interval_ms / 1000;
+
+  if (ui32_time >= SAMPLES_MAX || memcmp(ui32_values, ui32_m_expected[ui32_time], sizeof(ui32_m_expected[0]))) {
+    printf("block %u sample %u (%u s) decodes to the wrong values\n", p_header->ui32_seq, ui16_sample, ui32_time);
+    p_check->ok = false;
+  }
+
+  p_check->ui32_samples++;
+}
+
+// Decode all the stored blocks, they must have consecutive sequence numbers from ui32_first_seq
+static bool check_log(uint32_t ui32_first_seq, uint32_t ui32_seq_end, check_t *p_check)
+{
+  ride_log_iter_t iter = { 0 };
+  const uint32_t *p_block;
+  uint32_t ui32_seq = ui32_first_seq;
+
+  p_check->ui32_samples = 0;
+  p_check->ok = true;
+
+  while ((p_block = ride_log_store_next(&iter))) {
+    const ride_log_header_t *p_header = (const ride_log_header_t *) p_block;
+
+    if (p_header->ui32_seq < ui32_first_seq)
+      continue; // an older ride the ring has not overwritten yet
+
+    if (p_header->ui32_seq != ui32_seq) {
+      printf("block %u missing, found %u\n", ui32_seq, p_header->ui32_seq);
+      return false;
+    }
+    ui32_seq++;
+
+    if (p_header->ui32_seq == ui32_first_seq && !(p_header->ui8_flags & RIDE_LOG_FLAG_BOOT)) {
+      printf("block %u is the first of a ride without RIDE_LOG_FLAG_BOOT\n", p_header->ui32_seq);
+      return false;
+    }
+
+    if (!ride_log_decode(p_block, check_sample, p_check))
+      return false;
+  }
+
+  if (ui32_seq != ui32_seq_end) {
+    printf("blocks %u to %u, expected up to %u\n", ui32_first_seq, ui32_seq, ui32_seq_end);
+    return false;
+  }
+
+  return p_check->ok;
+}
+
+int main(void)
+{
+  check_t check;
+  uint32_t ui32_calls = 0, ui32_seq;
+
+  memset(ui32_m_flash, 0xff, sizeof(ui32_m_flash));
+  srand(1);
+
+  // an hour long ride and the power off at the end
+  ride_log_init();
+  ride(RIDE_S, &ui32_calls);
+  ride_log_power_off();
+  ui32_seq = ride_log_store_init();
+
+  if (!check_log(0, ui32_seq, &check) || check.ui32_samples != ui32_m_samples) {
+    printf("ride: %u samples decoded of %u\n", check.ui32_samples, ui32_m_samples);
+    return 1;
+  }
+
+  printf("1 hour at %u ms, %u channels: %u samples, %u blocks, %u bytes/hour, %.1f bytes/sample\n",
+      RIDE_LOG_INTERVAL_MS, RIDE_LOG_CHANNELS_NUM, check.ui32_samples, ui32_seq,
+      ui32_seq * (uint32_t) RIDE_LOG_BLOCK_BYTES, ui32_seq * (double) RIDE_LOG_BLOCK_BYTES / check.ui32_samples);
+  printf("ring of %u kbytes holds %.1f hours\n", RIDE_LOG_PAGES * RIDE_LOG_PAGE_WORDS * 4 / 1024,
+      RIDE_LOG_PAGES * RIDE_LOG_PAGE_WORDS / (double) RIDE_LOG_BLOCK_WORDS / ui32_seq);
+  printf("ride_log_flush(): %u calls, worst %u us programming, %u us erasing a page\n", ui32_calls,
+      ui32_m_max_program_us, ui32_m_max_erase_us);
+  printf("ride_log_idle(): worst %u us, erasing the next page ahead\n", ui32_m_max_idle_us);
+  if (ui32_m_max_erase_us) {
+    printf("ride_log_flush() erased a page\n");
+    return 1;
+  }
+  printf("samples dropped: %u\n", ui32_g_ride_log_samples_dropped);
+
+  if (ui32_g_ride_log_samples_dropped)
+    return 1;
+
+  // rides with a power cut while a block is written, the ring wraps many times over
+  for (int i = 0; i < CUT_RIDES; i++) {
+    uint32_t ui32_first_seq = ui32_seq;
+
+    ui32_seconds_since_startup = 0;
+    ui32_m_samples = 0;
+    memset(ui32_m_expected, 0, sizeof(ui32_m_expected));
+
+    ride_log_init();
+    ui32_m_blocks_done = 0;
+    i32_m_words_to_cut = rand() % (RIDE_LOG_BLOCK_WORDS * (1 + rand() % 20));
+    ride(RIDE_S, &ui32_calls);
+
+    // reboot
+    m_power_off = false;
+    i32_m_words_to_cut = -1;
+    ui32_seq = ride_log_store_init();
+
+    // the cut block is there only if all its header made it
+    if (ui32_seq != ui32_first_seq + ui32_m_blocks_done || !check_log(ui32_first_seq, ui32_seq, &check)) {
+      printf("power cut %d: %u blocks written, the log has %u\n", i, ui32_m_blocks_done, ui32_seq - ui32_first_seq);
+      return 1;
+    }
+  }
+
+  printf("%u power cuts while writing: no block lost or mixed\n", CUT_RIDES);
+
+  return 0;
+}
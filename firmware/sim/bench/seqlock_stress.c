@@ -0,0 +1,107 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Runs a seqlock writer and reader on two threads, like rt_processing() publishing rt_vars and
+ * copy_rt_to_ui_vars() reading them, and checks the reader never gets a torn copy. The writer fills every
+ * field with the same value, so a copy with two different values is torn. Running once without the seqlock
+ * shows the check does catch tearing.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <pthread.h>
+#include "seqlock.h"
+
+#define STRESS_FIELDS 64 // about the size of rt_vars_t in words
+#define STRESS_READS  2000000
+
+typedef struct {
+  uint32_t ui32_field[STRESS_FIELDS];
+} stress_vars_t;
+
+static stress_vars_t m_shared;
+static seqlock_t m_seq;
+static volatile bool m_use_seqlock;
+static volatile bool m_stop;
+
+static void *writer(void *arg)
+{
+  uint32_t ui32_value = 0;
+
+  while (!m_stop) {
+    ui32_value++;
+
+    if (m_use_seqlock)
+      seqlock_write_begin(&m_seq);
+
+    for (int i = 0; i < STRESS_FIELDS; i++)
+      ((volatile uint32_t *) m_shared.ui32_field)[i] = ui32_value;
+
+    if (m_use_seqlock)
+      seqlock_write_end(&m_seq);
+  }
+
+  return NULL;
+}
+
+static uint32_t run(bool use_seqlock, uint32_t *p_retries)
+{
+  pthread_t thread;
+  stress_vars_t copy;
+  uint32_t ui32_seq;
+  uint32_t ui32_torn = 0;
+
+  m_use_seqlock = use_seqlock;
+  m_stop = false;
+  *p_retries = 0;
+  pthread_create(&thread, NULL, writer, NULL);
+
+  for (int read = 0; read < STRESS_READS; read++) {
+    if (use_seqlock) {
+      ui32_seq = seqlock_read_begin(&m_seq);
+      while (true) {
+        for (int i = 0; i < STRESS_FIELDS; i++)
+          copy.ui32_field[i] = ((volatile uint32_t *) m_shared.ui32_field)[i];
+
+        if (!seqlock_read_retry(&m_seq, ui32_seq))
+          break;
+
+        (*p_retries)++;
+        ui32_seq = seqlock_read_begin(&m_seq);
+      }
+    }
+    else {
+      for (int i = 0; i < STRESS_FIELDS; i++)
+        copy.ui32_field[i] = ((volatile uint32_t *) m_shared.ui32_field)[i];
+    }
+
+    for (int i = 1; i < STRESS_FIELDS; i++) {
+      if (copy.ui32_field[i] != copy.ui32_field[0]) {
+        ui32_torn++;
+        break;
+      }
+    }
+  }
+
+  m_stop = true;
+  pthread_join(thread, NULL);
+  return ui32_torn;
+}
+
+int main(void)
+{
+  uint32_t ui32_retries;
+  uint32_t ui32_torn;
+
+  ui32_torn = run(false, &ui32_retries);
+  printf("without seqlock: %u of %u copies torn\n", ui32_torn, STRESS_READS);
+
+  ui32_torn = run(true, &ui32_retries);
+  printf("with seqlock:    %u of %u copies torn, %u retries\n", ui32_torn, STRESS_READS, ui32_retries);
+
+  return ui32_torn ? 1 : 0;
+}
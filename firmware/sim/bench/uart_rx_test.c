@@ -0,0 +1,175 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Feeds one stream of motor frames to the parser of uart_rx_queue.c cut at every offset and in chunks of every
+ * size, then through a DMA ring the way usart1.c receives it, with the end of the ring at every offset of the
+ * stream. Every time the good frames must come out of the queue as sent and the bad one must be counted. Last the
+ * DMA overruns the ring and the frames after it must still come through.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include "uart.h"
+#include "utils.h"
+#include "uart_rx_queue.h"
+
+#define STREAM_MAX    128
+#define GOOD_FRAMES   3
+#define RING_SIZE     64 // small, so the stream wraps around it
+
+static uint8_t ui8_m_stream[STREAM_MAX];
+static uint16_t ui16_m_stream_len;
+static const uint8_t *p_m_good[GOOD_FRAMES]; // in the stream
+static uint8_t ui8_m_good;
+
+static uint8_t ui8_m_ring_buffer[RING_SIZE];
+static uart_rx_dma_ring_t m_ring = { ui8_m_ring_buffer, RING_SIZE };
+static uint16_t ui16_m_dma_pos;
+
+static void stream_put(const uint8_t *p_data, uint16_t ui16_len)
+{
+  memcpy(&ui8_m_stream[ui16_m_stream_len], p_data, ui16_len);
+  ui16_m_stream_len += ui16_len;
+}
+
+// 0x43, length, type, data, CRC16 low and high byte, like the motor sends them
+static void stream_frame(uint8_t ui8_type, uint8_t ui8_data_len, bool bad_crc)
+{
+  uint8_t *p_frame = &ui8_m_stream[ui16_m_stream_len];
+  uint8_t ui8_len = 3 + ui8_data_len;
+  uint16_t ui16_crc;
+
+  p_frame[0] = 0x43;
+  p_frame[1] = ui8_len;
+  p_frame[2] = ui8_type;
+  for (uint8_t i = 0; i < ui8_data_len; i++)
+    p_frame[3 + i] = (uint8_t) (ui8_type * 37 + i * 11); // 0x43 among them too
+
+  ui16_crc = crc16_update(0xffff, p_frame, ui8_len);
+  if (bad_crc)
+    ui16_crc ^= 0x0100;
+  p_frame[ui8_len] = (uint8_t) (ui16_crc & 0xff);
+  p_frame[ui8_len + 1] = (uint8_t) (ui16_crc >> 8);
+
+  if (!bad_crc)
+    p_m_good[ui8_m_good++] = p_frame;
+  ui16_m_stream_len += ui8_len + 2;
+}
+
+static void stream_init(void)
+{
+  static const uint8_t ui8_noise[] = { 0x00, 0x55, 0xaa, 0x12, 0x7f };
+
+  stream_put(ui8_noise, sizeof(ui8_noise));
+  stream_frame(0, UART_NUMBER_DATA_BYTES_TO_RECEIVE - 5, false); // the periodic package, the longest one
+  stream_frame(1, 0, false);
+  stream_put(ui8_noise, 1);
+  stream_frame(2, 3, true);
+  stream_frame(2, 3, false);
+}
+
+// The frames of one stream are all out of the queue, in order and untouched
+static bool check(const char *p_what, uint16_t ui16_a, uint16_t ui16_b)
+{
+  static uart_rx_queue_stats_t m_last;
+  const uint8_t *p_frame;
+  uint8_t ui8_frames = 0;
+  bool ok = true;
+
+  while ((p_frame = uart_rx_queue_pop())) {
+    if (ui8_frames >= GOOD_FRAMES || memcmp(p_frame, p_m_good[ui8_frames], p_m_good[ui8_frames][1] + 2))
+      ok = false;
+    ui8_frames++;
+  }
+
+  if (ui8_frames != GOOD_FRAMES || g_uart_rx_queue_stats.ui32_crc_errors - m_last.ui32_crc_errors != 1
+      || g_uart_rx_queue_stats.ui32_lost != m_last.ui32_lost)
+    ok = false;
+  m_last = g_uart_rx_queue_stats;
+
+  if (!ok)
+    printf("%s %u/%u: %u frames, %u CRC errors\n", p_what, ui16_a, ui16_b, ui8_frames,
+        g_uart_rx_queue_stats.ui32_crc_errors);
+  return ok;
+}
+
+// The DMA writes a byte and raises its half and full transfer interrupts
+static void dma_write(const uint8_t *p_data, uint16_t ui16_len)
+{
+  while (ui16_len--) {
+    ui8_m_ring_buffer[ui16_m_dma_pos] = *p_data++;
+    ui16_m_dma_pos = (ui16_m_dma_pos + 1) & (RING_SIZE - 1);
+
+    if (ui16_m_dma_pos == RING_SIZE / 2 || ui16_m_dma_pos == 0)
+      uart_rx_dma_ring_update(&m_ring, ui16_m_dma_pos);
+  }
+}
+
+// The line goes idle, then usart1_rx_dma_poll()
+static void dma_idle_poll(void)
+{
+  uart_rx_dma_ring_update(&m_ring, ui16_m_dma_pos);
+  uart_rx_dma_ring_parse(&m_ring);
+}
+
+int main(void)
+{
+  static const uint8_t ui8_zero[RING_SIZE];
+  uint32_t ui32_runs = 0;
+
+  stream_init();
+
+  // in two chunks, cut at every offset
+  for (uint16_t k = 0; k <= ui16_m_stream_len; k++, ui32_runs++) {
+    uart_rx_queue_parse(ui8_m_stream, k);
+    uart_rx_queue_parse(&ui8_m_stream[k], ui16_m_stream_len - k);
+    if (!check("cut at", k, ui16_m_stream_len))
+      return 1;
+  }
+
+  // in chunks of every size
+  for (uint16_t size = 1; size <= ui16_m_stream_len; size++, ui32_runs++) {
+    for (uint16_t i = 0; i < ui16_m_stream_len; i += size)
+      uart_rx_queue_parse(&ui8_m_stream[i], i + size > ui16_m_stream_len ? ui16_m_stream_len - i : size);
+    if (!check("chunks of", size, ui16_m_stream_len))
+      return 1;
+  }
+
+  // through the DMA ring, starting at every position of it and polled at every offset of the stream
+  for (uint16_t start = 0; start < RING_SIZE; start++) {
+    for (uint16_t k = 0; k <= ui16_m_stream_len; k++, ui32_runs++) {
+      dma_write(ui8_zero, (start - ui16_m_dma_pos) & (RING_SIZE - 1));
+      dma_idle_poll();
+
+      dma_write(ui8_m_stream, k);
+      dma_idle_poll();
+      dma_write(&ui8_m_stream[k], ui16_m_stream_len - k);
+      dma_idle_poll();
+      if (!check("DMA ring at", start, k))
+        return 1;
+    }
+  }
+
+  // more than a lap of the ring before the poll, what was lost is counted and the next frames come through
+  uint32_t ui32_overruns = g_uart_rx_queue_stats.ui32_overruns;
+
+  dma_write(ui8_m_stream, 20);
+  dma_write(ui8_zero, RING_SIZE);
+  dma_idle_poll();
+  dma_write(ui8_m_stream, ui16_m_stream_len);
+  dma_idle_poll();
+  if (g_uart_rx_queue_stats.ui32_overruns != ui32_overruns + 1) {
+    printf("DMA overrun not counted\n");
+    return 1;
+  }
+  if (!check("DMA ring after overrun", 0, 0))
+    return 1;
+
+  printf("%u runs of a %u bytes stream, cut anywhere and across the DMA ring end: all frames received\n",
+      ui32_runs, ui16_m_stream_len);
+  return 0;
+}
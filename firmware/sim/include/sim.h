@@ -0,0 +1,63 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#pragma once
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef SW102
+#define SIM_DISPLAY_WIDTH   64
+#define SIM_DISPLAY_HEIGHT  128
+#else
+#define SIM_DISPLAY_WIDTH   320
+#define SIM_DISPLAY_HEIGHT  480
+#endif
+
+typedef enum {
+  SIM_BUTTON_ONOFF = 0,
+  SIM_BUTTON_UP,
+  SIM_BUTTON_DOWN,
+  SIM_BUTTON_M,
+  SIM_BUTTONS_NUM
+} sim_button_t;
+
+// timer.c - virtual 1ms time base, nothing here ever sleeps
+void sim_time_advance_1ms(void);
+uint32_t sim_ticks_missed(void);
+
+// rtc.c - wall clock over the virtual time base
+void sim_rtc_second(void);
+
+// uart.c - a fake TSDZ2 that answers our packets like the real motor controller
+void sim_motor_clock_1ms(void);
+uint32_t sim_motor_frames_sent(void);
+uint32_t sim_motor_frames_dropped(void);
+void sim_motor_set_noise(uint32_t ui32_permille);
+
+// buttons_hw.c - scripted button presses
+bool sim_buttons_add_press(const char *spec);
+void sim_buttons_clock_1ms(void);
+
+// eeprom_hw.c - RAM backed flash for the settings log, optionally persisted to a file between runs
+void sim_flash_set_file(const char *path);
+uint32_t sim_flash_erases(void);
+uint32_t sim_flash_writes(void);
+// and for the ride log pages
+void sim_ride_log_set_file(const char *path);
+uint32_t sim_ride_log_blocks(void);
+
+// adc.c
+extern uint16_t ui16_g_sim_battery_voltage_x10;
+
+// lcd.c - in memory framebuffer with PPM dumps
+bool sim_lcd_frame_changed(void);
+bool sim_lcd_write_ppm(const char *path);
+uint32_t sim_lcd_frame_hash(void);
+extern uint32_t ui32_g_sim_lcd_stale_flushes; // SW102: partial refreshes that left the display different from frameBuffer
+
+// main.c
+void sim_exit(int code);
@@ -0,0 +1,21 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#include "adc.h"
+#include "sim.h"
+
+// 52.0V, a healthy 48V battery. Anything under MIN_VOLTAGE_10X (14.0V) makes the firmware
+// think it is running on a developer's desk
+uint16_t ui16_g_sim_battery_voltage_x10 = 520;
+
+void battery_voltage_init(void)
+{
+}
+
+uint16_t battery_voltage_10x_get()
+{
+  return ui16_g_sim_battery_voltage_x10;
+}
@@ -0,0 +1,96 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Scripted buttons. Each press is given as "<start ms>:<button>[:<hold ms>]", e.g. "15000:up:2500" is a long
+ * press of the up button 15 seconds after boot.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "buttons.h"
+#include "state.h"
+#include "timer.h"
+#include "sim.h"
+
+#define SIM_MAX_PRESSES     64
+#define SIM_DEFAULT_HOLD_MS 100 // a short click
+
+typedef struct {
+  sim_button_t button;
+  uint32_t ui32_start_ms;
+  uint32_t ui32_end_ms;
+} sim_press_t;
+
+static sim_press_t m_presses[SIM_MAX_PRESSES];
+static uint32_t ui32_m_num_presses;
+static uint32_t ui32_m_state[SIM_BUTTONS_NUM];
+static bool m_edge_irq_enabled;
+
+static const char *button_names[SIM_BUTTONS_NUM] = { "onoff", "up", "down", "m" };
+
+bool sim_buttons_add_press(const char *spec)
+{
+  char name[16];
+  unsigned long start, hold = SIM_DEFAULT_HOLD_MS;
+
+  if (ui32_m_num_presses >= SIM_MAX_PRESSES)
+    return false;
+
+  if (sscanf(spec, "%lu:%15[a-z]:%lu", &start, name, &hold) < 2)
+    return false;
+
+  for (int i = 0; i < SIM_BUTTONS_NUM; i++) {
+    if (strcmp(name, button_names[i]) == 0) {
+      m_presses[ui32_m_num_presses].button = i;
+      m_presses[ui32_m_num_presses].ui32_start_ms = start;
+      m_presses[ui32_m_num_presses].ui32_end_ms = start + hold;
+      ui32_m_num_presses++;
+      return true;
+    }
+  }
+
+  return false;
+}
+
+/// Called every 1ms by the simulator main loop, this is our GPIO input register and its edge interrupt
+void sim_buttons_clock_1ms(void)
+{
+  uint32_t ui32_time = get_time_base_counter_1ms();
+  uint32_t ui32_state[SIM_BUTTONS_NUM] = { 0 };
+
+  for (uint32_t i = 0; i < ui32_m_num_presses; i++) {
+    if (ui32_time >= m_presses[i].ui32_start_ms && ui32_time < m_presses[i].ui32_end_ms)
+      ui32_state[m_presses[i].button] = 1;
+  }
+
+  if (memcmp(ui32_state, ui32_m_state, sizeof(ui32_m_state))) {
+    memcpy(ui32_m_state, ui32_state, sizeof(ui32_m_state));
+
+    if (m_edge_irq_enabled)
+      buttons_edge_irq();
+  }
+}
+
+void buttons_init(void) {
+  m_edge_irq_enabled = true;
+}
+
+uint32_t buttons_get_up_state(void) {
+  return ui32_m_state[ui_vars.ui8_buttons_up_down_invert ? SIM_BUTTON_DOWN : SIM_BUTTON_UP];
+}
+
+uint32_t buttons_get_down_state(void) {
+  return ui32_m_state[ui_vars.ui8_buttons_up_down_invert ? SIM_BUTTON_UP : SIM_BUTTON_DOWN];
+}
+
+uint32_t buttons_get_onoff_state(void) {
+  return ui32_m_state[SIM_BUTTON_ONOFF];
+}
+
+uint32_t buttons_get_m_state(void) {
+  return ui32_m_state[SIM_BUTTON_M];
+}
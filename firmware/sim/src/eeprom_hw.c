@@ -0,0 +1,212 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * RAM backed flash for the settings log, with the same pages and NOR rules as the 850C: erase sets a page to
+ * 0xff, programming can only clear bits. If a file is given the contents are loaded at boot and saved after each
+ * write, so settings survive between runs. The ride log gets pages of its own the same way. The last gasp page is
+ * only in RAM, the sim has no supply to fall.
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include "eeprom_hw.h"
+#include "flash_log.h"
+#include "ride_log.h"
+#include "last_gasp.h"
+#include "sim.h"
+
+static uint32_t ui32_m_flash[FLASH_LOG_PAGES][FLASH_LOG_PAGE_WORDS];
+static const char *m_flash_file;
+static uint32_t ui32_m_erases;
+static uint32_t ui32_m_writes;
+
+static uint32_t ui32_m_ride_log[RIDE_LOG_PAGES][RIDE_LOG_PAGE_WORDS];
+static const char *m_ride_log_file;
+static uint32_t ui32_m_ride_log_blocks;
+
+void sim_flash_set_file(const char *path)
+{
+  m_flash_file = path;
+}
+
+uint32_t sim_flash_erases(void)
+{
+  return ui32_m_erases;
+}
+
+uint32_t sim_flash_writes(void)
+{
+  return ui32_m_writes;
+}
+
+void sim_ride_log_set_file(const char *path)
+{
+  m_ride_log_file = path;
+}
+
+uint32_t sim_ride_log_blocks(void)
+{
+  return ui32_m_ride_log_blocks;
+}
+
+static uint32_t ui32_m_last_gasp[LAST_GASP_AREA_WORDS];
+
+static void pages_save(const char *path, const void *p_pages, size_t size)
+{
+  if (!path)
+    return;
+
+  FILE *f = fopen(path, "wb");
+  if (f) {
+    fwrite(p_pages, 1, size, f);
+    fclose(f);
+  }
+}
+
+static void pages_load(const char *path, void *p_pages, size_t size)
+{
+  memset(p_pages, 0xff, size); // erased flash
+
+  if (path) {
+    FILE *f = fopen(path, "rb");
+    if (f) {
+      if (fread(p_pages, 1, size, f) != size)
+        memset(p_pages, 0xff, size);
+      fclose(f);
+    }
+  }
+}
+
+static void flash_save(void)
+{
+  pages_save(m_flash_file, ui32_m_flash, sizeof(ui32_m_flash));
+}
+
+void eeprom_hw_init(void)
+{
+  pages_load(m_flash_file, ui32_m_flash, sizeof(ui32_m_flash));
+  pages_load(m_ride_log_file, ui32_m_ride_log, sizeof(ui32_m_ride_log));
+  pages_load(NULL, ui32_m_last_gasp, sizeof(ui32_m_last_gasp));
+
+  flash_log_init();
+}
+
+// Only the key can be written, anything but KEY makes the next flash_read_words() fail
+uint32_t eeprom_write(uint32_t ui32_address, uint8_t ui8_data)
+{
+  if (ui32_address != ADDRESS_KEY)
+    return 1;
+
+  return flash_log_write_key(ui8_data) ? 0 : 1;
+}
+
+// Read raw EEPROM data, return false if it is blank or malformatted
+bool flash_read_words(void *dest, uint16_t length_words)
+{
+  return flash_log_read_words(dest, length_words);
+}
+
+bool flash_write_words(const void *value, uint16_t length_words)
+{
+  return flash_log_write_words(value, length_words);
+}
+
+const uint32_t* flash_log_hw_page(uint8_t ui8_page)
+{
+  return ui32_m_flash[ui8_page];
+}
+
+// The simulator never had the older settings format
+bool flash_log_hw_legacy_read(void *dest, uint16_t length_words)
+{
+  return false;
+}
+
+bool flash_log_hw_program(uint8_t ui8_page, uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num)
+{
+  while (ui16_num--) {
+    uint32_t *p_flash = &ui32_m_flash[ui8_page][ui16_offset++];
+
+    // like the STM32, a programmed word can only be overwritten with 0
+    if (*p_flash != 0xffffffff && *p_words != 0)
+      return false;
+
+    *p_flash &= *p_words++;
+    ui32_m_writes++;
+  }
+
+  flash_save();
+  return true;
+}
+
+bool flash_log_hw_erase(uint8_t ui8_page)
+{
+  memset(ui32_m_flash[ui8_page], 0xff, sizeof(ui32_m_flash[ui8_page]));
+  ui32_m_erases++;
+  flash_save();
+
+  return true;
+}
+
+const uint32_t* ride_log_hw_page(uint16_t ui16_page)
+{
+  return ui32_m_ride_log[ui16_page];
+}
+
+bool ride_log_hw_program(uint16_t ui16_page, uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num)
+{
+  if (ui16_offset % RIDE_LOG_BLOCK_WORDS == 0)
+    ui32_m_ride_log_blocks++; // the header goes last
+
+  while (ui16_num--) {
+    uint32_t *p_flash = &ui32_m_ride_log[ui16_page][ui16_offset++];
+
+    if (*p_flash != 0xffffffff && *p_words != 0)
+      return false;
+
+    *p_flash &= *p_words++;
+  }
+
+  pages_save(m_ride_log_file, ui32_m_ride_log, sizeof(ui32_m_ride_log));
+  return true;
+}
+
+bool ride_log_hw_erase(uint16_t ui16_page)
+{
+  memset(ui32_m_ride_log[ui16_page], 0xff, sizeof(ui32_m_ride_log[ui16_page]));
+  pages_save(m_ride_log_file, ui32_m_ride_log, sizeof(ui32_m_ride_log));
+
+  return true;
+}
+
+const uint32_t* last_gasp_hw_area(void)
+{
+  return ui32_m_last_gasp;
+}
+
+bool last_gasp_hw_program(uint16_t ui16_offset, const uint32_t *p_words, uint16_t ui16_num)
+{
+  while (ui16_num--) {
+    uint32_t *p_flash = &ui32_m_last_gasp[ui16_offset++];
+
+    if (*p_flash != 0xffffffff && *p_words != 0)
+      return false;
+
+    *p_flash &= *p_words++;
+  }
+
+  return true;
+}
+
+bool last_gasp_hw_erase(void)
+{
+  memset(ui32_m_last_gasp, 0xff, sizeof(ui32_m_last_gasp));
+
+  return true;
+}
+
+void last_gasp_hw_enable(bool enable)
+{
+}
@@ -0,0 +1,335 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * uGUI driver that draws into a framebuffer in RAM. The 850C flavour mimics the ILI9481 window/push pixel
+ * accelerators, the SW102 flavour uses the same paged mono framebuffer as the SH1107 driver.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "main.h"
+#include "lcd.h"
+#include "ugui.h"
+#include "eeprom.h"
+#include "state.h"
+#include "screen.h"
+#include "glyph_cache.h"
+#include "profile.h"
+#include "ride_log.h"
+#include "sim.h"
+
+UG_GUI gui;
+
+static bool m_frame_changed;
+static uint8_t ui8_m_backlight;
+
+uint32_t ui32_g_sim_lcd_stale_flushes;
+
+// There is no cycle counter to read on the host, so the glyph cache statistics and the profile are in nanoseconds
+uint32_t profile_hw_ticks(void)
+{
+  struct timespec now;
+
+  clock_gettime(CLOCK_MONOTONIC, &now);
+  return (uint32_t) (now.tv_sec * 1000000000ULL + now.tv_nsec);
+}
+
+#ifdef SW102
+
+/* Frame buffer in RAM with same structure as LCD memory --> 16 pages a 64 columns (1 kB) */
+uint8_t frameBuffer[16][64];
+
+// What the SH1107 RAM holds, i.e. only what lcd_refresh() transferred. This is what we dump, so a change the dirty
+// tracking missed shows up as stale pixels.
+static uint8_t ui8_m_display_ram[16][64];
+
+// Columns of each page changed since the last lcd_refresh(), none if x1 > x2, like the SW102 driver
+static uint8_t ui8_m_dirty_x1[16];
+static uint8_t ui8_m_dirty_x2[16];
+
+static void pset(UG_S16 x, UG_S16 y, UG_COLOR col)
+{
+  if (col == C_TRANSPARENT)
+    return;
+
+  if (x >= SIM_DISPLAY_WIDTH || x < 0 || y >= SIM_DISPLAY_HEIGHT || y < 0)
+    return;
+
+  uint8_t old = frameBuffer[y / 8][x];
+
+  if (col > 0)
+    frameBuffer[y / 8][x] |= 1 << (y % 8);
+  else
+    frameBuffer[y / 8][x] &= ~(1 << (y % 8));
+
+  if (frameBuffer[y / 8][x] != old) {
+    if (x < ui8_m_dirty_x1[y / 8])
+      ui8_m_dirty_x1[y / 8] = x;
+    if (x > ui8_m_dirty_x2[y / 8])
+      ui8_m_dirty_x2[y / 8] = x;
+  }
+}
+
+static UG_RESULT accel_fill_frame(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c)
+{
+  UG_S16 temp;
+
+  if (c == C_TRANSPARENT)
+    return UG_RESULT_OK;
+
+  if (x2 < x1) { temp = x1; x1 = x2; x2 = temp; }
+  if (y2 < y1) { temp = y1; y1 = y2; y2 = temp; }
+
+  for (UG_S16 y = y1; y <= y2; y++)
+    for (UG_S16 x = x1; x <= x2; x++)
+      pset(x, y, c);
+
+  return UG_RESULT_OK;
+}
+
+static UG_RESULT accel_draw_line(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c)
+{
+  if (y1 != y2)
+    return UG_RESULT_FAIL;
+
+  return accel_fill_frame(x1, y1, x2, y2, c);
+}
+
+void lcd_init(void)
+{
+  UG_Init(&gui, pset, SIM_DISPLAY_WIDTH, SIM_DISPLAY_HEIGHT);
+  UG_DriverRegister(DRIVER_DRAW_LINE, (void *) accel_draw_line);
+  UG_DriverRegister(DRIVER_FILL_FRAME, (void *) accel_fill_frame);
+
+  // clear the display RAM
+  memset(ui8_m_dirty_x2, 63, sizeof(ui8_m_dirty_x2));
+  lcd_refresh();
+}
+
+/// Same page/column addressing as the SH1107 driver, instead of SPI we copy into the display RAM
+static void lcd_refresh_page(uint8_t page, uint8_t x1, uint8_t x2)
+{
+  uint8_t len = x2 - x1 + 1;
+
+  if (memcmp(&ui8_m_display_ram[page][x1], &frameBuffer[page][x1], len)) {
+    memcpy(&ui8_m_display_ram[page][x1], &frameBuffer[page][x1], len);
+    m_frame_changed = true;
+  }
+
+  ui32_g_lcd_pixels_written += len * 8;
+}
+
+void lcd_refresh(void)
+{
+  for (uint8_t i = 0; i < 16; i++) {
+    if (ui8_m_dirty_x1[i] <= ui8_m_dirty_x2[i])
+      lcd_refresh_page(i, ui8_m_dirty_x1[i], ui8_m_dirty_x2[i]);
+
+    ui8_m_dirty_x1[i] = SIM_DISPLAY_WIDTH;
+    ui8_m_dirty_x2[i] = 0;
+  }
+
+  // anything still different was changed without being marked dirty
+  if (memcmp(ui8_m_display_ram, frameBuffer, sizeof(frameBuffer)))
+    ui32_g_sim_lcd_stale_flushes++;
+}
+
+static void pixel_rgb(UG_S16 x, UG_S16 y, uint8_t *rgb)
+{
+  uint8_t v = (ui8_m_display_ram[y / 8][x] & (1 << (y % 8))) ? 0xff : 0;
+
+  rgb[0] = rgb[1] = rgb[2] = v;
+}
+
+#else
+
+static uint16_t ui16_m_framebuffer[SIM_DISPLAY_HEIGHT][SIM_DISPLAY_WIDTH];
+
+// current window for HW_FillArea
+static UG_S16 i16_m_win_x1, i16_m_win_x2, i16_m_win_y2;
+static UG_S16 i16_m_win_x, i16_m_win_y;
+
+lcd_IC_t g_lcd_ic_type = LCD_ILI9481;
+
+void lcd_pixel_set(UG_S16 x, UG_S16 y, UG_COLOR c)
+{
+  if (c == C_TRANSPARENT)
+    return;
+
+  ui32_g_lcd_pixels_written++; // the real driver sends it even when it is off screen
+
+  if (x >= SIM_DISPLAY_WIDTH || x < 0 || y >= SIM_DISPLAY_HEIGHT || y < 0)
+    return;
+
+  ui16_m_framebuffer[y][x] = c;
+  m_frame_changed = true;
+}
+
+static void push_pixel_sim(UG_COLOR c)
+{
+  if (c == C_TRANSPARENT)
+    c = C_BLACK; // same as the real driver, it can't skip pixels
+
+  if (i16_m_win_y > i16_m_win_y2)
+    return;
+
+  lcd_pixel_set(i16_m_win_x, i16_m_win_y, c);
+
+  if (++i16_m_win_x > i16_m_win_x2) {
+    i16_m_win_x = i16_m_win_x1;
+    i16_m_win_y++;
+  }
+}
+
+void (*HW_FillArea(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2))(UG_COLOR)
+{
+  i16_m_win_x1 = i16_m_win_x = x1;
+  i16_m_win_x2 = x2;
+  i16_m_win_y = y1;
+  i16_m_win_y2 = y2;
+
+  return push_pixel_sim;
+}
+
+static void HW_FillRun(UG_COLOR c, UG_U16 len)
+{
+  while (len--)
+    push_pixel_sim(c);
+}
+
+UG_RESULT HW_FillFrame(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c)
+{
+  UG_S16 temp;
+
+  if (c == C_TRANSPARENT)
+    return UG_RESULT_OK;
+
+  if (x2 < x1) { temp = x1; x1 = x2; x2 = temp; }
+  if (y2 < y1) { temp = y1; y1 = y2; y2 = temp; }
+
+  for (UG_S16 y = y1; y <= y2; y++)
+    for (UG_S16 x = x1; x <= x2; x++)
+      lcd_pixel_set(x, y, c);
+
+  return UG_RESULT_OK;
+}
+
+UG_RESULT HW_DrawLine(UG_S16 x1, UG_S16 y1, UG_S16 x2, UG_S16 y2, UG_COLOR c)
+{
+  if (c == C_TRANSPARENT)
+    return UG_RESULT_OK;
+
+  if ((x1 < 0) || (x1 >= SIM_DISPLAY_WIDTH) || (y1 < 0) || (y1 >= SIM_DISPLAY_HEIGHT))
+    return UG_RESULT_FAIL;
+  if ((x2 < 0) || (x2 >= SIM_DISPLAY_WIDTH) || (y2 < 0) || (y2 >= SIM_DISPLAY_HEIGHT))
+    return UG_RESULT_FAIL;
+
+  // same as the real driver, only vertical and horizontal lines are accelerated
+  if ((x1 == x2) || (y1 == y2))
+    return HW_FillFrame(x1, y1, x2, y2, c);
+
+  return UG_RESULT_FAIL;
+}
+
+void lcd_init(void)
+{
+  UG_Init(&gui, lcd_pixel_set, SIM_DISPLAY_WIDTH, SIM_DISPLAY_HEIGHT);
+  UG_DriverRegister(DRIVER_FILL_FRAME, (void *) HW_FillFrame);
+  UG_DriverRegister(DRIVER_DRAW_LINE, (void *) HW_DrawLine);
+  UG_DriverRegister(DRIVER_FILL_AREA, (void *) HW_FillArea);
+  UG_DriverRegister(DRIVER_FILL_RUN, (void *) HW_FillRun);
+
+  UG_FillScreen(C_BLACK);
+
+  set_lcd_backlight(); // default to at least some backlight
+}
+
+static void pixel_rgb(UG_S16 x, UG_S16 y, uint8_t *rgb)
+{
+  uint16_t c = ui16_m_framebuffer[y][x];
+
+  rgb[0] = ((c >> 11) & 0x1f) * 255 / 31;
+  rgb[1] = ((c >> 5) & 0x3f) * 255 / 63;
+  rgb[2] = (c & 0x1f) * 255 / 31;
+}
+
+#endif
+
+void lcd_set_backlight_intensity(uint8_t ui8_intensity)
+{
+  ui8_m_backlight = ui8_intensity;
+}
+
+void system_power(bool state)
+{
+  if (!state)
+    sim_exit(0);
+}
+
+void lcd_power_off(uint8_t updateDistanceOdo)
+{
+  // save current battery Wh
+  ui_vars.ui32_wh_x10_offset = ui_vars.ui32_wh_x10;
+
+  // save the variables on EEPROM
+  eeprom_write_variables();
+  ride_log_power_off();
+
+  // put screen all black and disable backlight
+  UG_FillScreen(0);
+  lcd_set_backlight_intensity(0);
+
+  // now disable the power to all the system
+  system_power(0);
+}
+
+/// Returns true if anything was drawn since the last call
+bool sim_lcd_frame_changed(void)
+{
+  bool changed = m_frame_changed;
+
+  m_frame_changed = false;
+  return changed;
+}
+
+// FNV-1a of the RGB of all the pixels, for comparing runs without writing the frames
+uint32_t sim_lcd_frame_hash(void)
+{
+  uint8_t rgb[3];
+  uint32_t ui32_hash = 2166136261;
+
+  for (UG_S16 y = 0; y < SIM_DISPLAY_HEIGHT; y++) {
+    for (UG_S16 x = 0; x < SIM_DISPLAY_WIDTH; x++) {
+      pixel_rgb(x, y, rgb);
+      for (uint8_t i = 0; i < sizeof(rgb); i++)
+        ui32_hash = (ui32_hash ^ rgb[i]) * 16777619;
+    }
+  }
+
+  return ui32_hash;
+}
+
+bool sim_lcd_write_ppm(const char *path)
+{
+  uint8_t rgb[3];
+  FILE *f = fopen(path, "wb");
+
+  if (!f)
+    return false;
+
+  fprintf(f, "P6\n%d %d\n255\n", SIM_DISPLAY_WIDTH, SIM_DISPLAY_HEIGHT);
+  for (UG_S16 y = 0; y < SIM_DISPLAY_HEIGHT; y++) {
+    for (UG_S16 x = 0; x < SIM_DISPLAY_WIDTH; x++) {
+      pixel_rgb(x, y, rgb);
+      fwrite(rgb, 1, sizeof(rgb), f);
+    }
+  }
+
+  fclose(f);
+  return true;
+}
@@ -0,0 +1,230 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Runs the common firmware on a Linux host against fake HAL stand-ins. Time is virtual: every simulated
+ * millisecond advances the motor link, the buttons and the 100ms realtime tick, then main_idle() runs the handlers
+ * of the events they posted, just like the displays do when they wake up. Nothing ever sleeps, so the run is as fast as the host and fully
+ * deterministic, which makes it usable under perf/callgrind.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include "main.h"
+#include "lcd.h"
+#include "adc.h"
+#include "uart.h"
+#include "rtc.h"
+#include "timer.h"
+#include "eeprom.h"
+#include "screen.h"
+#include "mainscreen.h"
+#include "state.h"
+#include "uart_rx_queue.h"
+#include "profile.h"
+#include "events.h"
+#include "ride_log.h"
+#ifndef SW102
+#include "glyph_cache.h"
+#endif
+#include "sim.h"
+
+static uint32_t ui32_m_main_idle_calls;
+static uint32_t ui32_m_frames_dumped;
+static uint32_t ui32_m_frames_drawn;
+static uint64_t ui64_m_frame_pixels;
+static uint32_t ui32_m_frame_pixels_max;
+static const char *m_dump_prefix;
+static const char *m_final_ppm;
+static uint32_t ui32_m_hash_ms; // print the hash of the frame this often, 0 for never
+static bool m_quiet;
+
+static void usage(const char *argv0)
+{
+  fprintf(stderr,
+      "usage: %s [options]\n"
+      "  -t <ms>         simulated run time (default 60000)\n"
+      "  -p <ms:button[:hold ms]>\n"
+      "                  press a button (onoff, up, down, m), can be repeated\n"
+      "  -o <prefix>     write <prefix>_<ms>.ppm each time the screen changes\n"
+      "  -f <file.ppm>   write the last frame when the simulation ends\n"
+      "  -c <ms>         print <ms> and a hash of the frame that often, to compare runs\n"
+      "  -g <graph>      show this graph on the 850C main screen (0 speed, 1 trip distance, ...)\n"
+      "  -e <file>       load/save the settings flash from/to this file\n"
+      "  -r <file>       load/save the ride log flash from/to this file\n"
+      "  -v <volts x10>  battery voltage measured by the display ADC (default 520)\n"
+      "  -n <permille>   probability of a bit error in each byte sent by the motor\n"
+      "  -q              do not print statistics\n",
+      argv0);
+  exit(1);
+}
+
+void sim_exit(int code)
+{
+  if (m_final_ppm)
+    sim_lcd_write_ppm(m_final_ppm);
+
+  if (!m_quiet) {
+    printf("simulated time:      %u ms\n", get_time_base_counter_1ms());
+    printf("main_idle wakeups:   %u\n", ui32_m_main_idle_calls);
+    printf("motor frames sent:   %u\n", sim_motor_frames_sent());
+    printf("motor frames lost:   %u\n", sim_motor_frames_dropped());
+    printf("rx crc errors:       %u\n", g_uart_rx_queue_stats.ui32_crc_errors);
+    printf("rx overruns:         %u\n", g_uart_rx_queue_stats.ui32_overruns);
+    printf("rt ticks late/lost:  %u\n", sim_ticks_missed());
+    printf("flash erases/words:  %u/%u\n", sim_flash_erases(), sim_flash_writes());
+    printf("ride log blocks:     %u (%u samples dropped)\n", sim_ride_log_blocks(), ui32_g_ride_log_samples_dropped);
+    printf("frames drawn:        %u\n", ui32_m_frames_drawn);
+    printf("lcd pixels/frame:    %llu avg, %u max\n",
+        ui32_m_frames_drawn ? (unsigned long long) (ui64_m_frame_pixels / ui32_m_frames_drawn) : 0ULL,
+        ui32_m_frame_pixels_max);
+    printf("editables fmt/skip:  %u/%u (%u/%u per second)\n", ui32_g_editables_formatted, ui32_g_editables_skipped,
+        ui32_g_editables_formatted * 1000 / get_time_base_counter_1ms(),
+        ui32_g_editables_skipped * 1000 / get_time_base_counter_1ms());
+#ifdef SW102
+    printf("lcd stale flushes:   %u\n", ui32_g_sim_lcd_stale_flushes);
+#else
+    uint32_t ui32_glyphs = g_glyph_cache_stats.ui32_hits + g_glyph_cache_stats.ui32_misses;
+    printf("glyph cache hits:    %u/%u (%u%%)\n", g_glyph_cache_stats.ui32_hits, ui32_glyphs,
+        ui32_glyphs ? g_glyph_cache_stats.ui32_hits * 100 / ui32_glyphs : 0);
+    printf("glyph ns hit/miss:   %u/%u\n",
+        g_glyph_cache_stats.ui32_hits ? g_glyph_cache_stats.ui32_hit_cycles / g_glyph_cache_stats.ui32_hits : 0,
+        g_glyph_cache_stats.ui32_misses ? g_glyph_cache_stats.ui32_miss_cycles / g_glyph_cache_stats.ui32_misses : 0);
+#endif
+    printf("frames dumped:       %u\n", ui32_m_frames_dumped);
+
+    // the same numbers diagnosticsScreen shows, with the histogram as counts
+    printf("profile (us)          count     min     avg     max  <64u <512u   <4m  <32m  >32m\n");
+    for (int i = 0; i < PROFILE_POINTS; i++) {
+      const profile_stats_t *p_stats = &g_profile_stats[i];
+
+      if (!p_stats->ui32_count)
+        continue;
+
+      printf("  %-18s %7u %7u %7u %7u", g_profile_names[i], p_stats->ui32_count, p_stats->ui32_min_us,
+          (uint32_t) (p_stats->ui64_total_us / p_stats->ui32_count), p_stats->ui32_max_us);
+      for (int j = 0; j < PROFILE_BUCKETS; j++)
+        printf(" %5u", p_stats->ui32_buckets[j]);
+      printf("\n");
+    }
+  }
+
+  exit(code);
+}
+
+int main(int argc, char **argv)
+{
+  uint32_t ui32_run_ms = 60000;
+#ifndef SW102
+  int i_graph = -1;
+#endif
+  int opt;
+
+  while ((opt = getopt(argc, argv, "t:p:o:f:c:g:e:r:v:n:q")) != -1) {
+    switch (opt) {
+      case 't':
+        ui32_run_ms = strtoul(optarg, NULL, 0);
+        break;
+      case 'p':
+        if (!sim_buttons_add_press(optarg))
+          usage(argv[0]);
+        break;
+      case 'o':
+        m_dump_prefix = optarg;
+        break;
+      case 'f':
+        m_final_ppm = optarg;
+        break;
+      case 'c':
+        ui32_m_hash_ms = strtoul(optarg, NULL, 0);
+        break;
+#ifndef SW102
+      case 'g':
+        i_graph = strtol(optarg, NULL, 0);
+        break;
+#endif
+      case 'e':
+        sim_flash_set_file(optarg);
+        break;
+      case 'r':
+        sim_ride_log_set_file(optarg);
+        break;
+      case 'v':
+        ui16_g_sim_battery_voltage_x10 = strtoul(optarg, NULL, 0);
+        break;
+      case 'n':
+        sim_motor_set_noise(strtoul(optarg, NULL, 0));
+        break;
+      case 'q':
+        m_quiet = true;
+        break;
+      default:
+        usage(argv[0]);
+    }
+  }
+
+  // same init order as the real firmware
+#ifdef SW102
+  buttons_init();
+  lcd_init();
+  uart_init();
+  battery_voltage_init();
+  eeprom_init();
+  ride_log_init();
+#else
+  buttons_init();
+  uart_init();
+  eeprom_init();
+  ride_log_init();
+  rtc_init();
+  lcd_init();
+  screen_init();
+
+  // the graphs selector, over the one of the settings
+  if (i_graph >= 0)
+    ui_vars.field_selectors[0] = i_graph;
+#endif
+
+  screenShow(&bootScreen);
+
+  while (get_time_base_counter_1ms() < ui32_run_ms) {
+    sim_buttons_clock_1ms();
+    sim_motor_clock_1ms();
+    sim_time_advance_1ms();
+
+    if (events_pending()) {
+      uint32_t ui32_pixels = ui32_g_lcd_pixels_written;
+
+      main_idle();
+      ui32_m_main_idle_calls++;
+
+      ui32_pixels = ui32_g_lcd_pixels_written - ui32_pixels;
+      if (ui32_pixels) {
+        ui32_m_frames_drawn++;
+        ui64_m_frame_pixels += ui32_pixels;
+        if (ui32_pixels > ui32_m_frame_pixels_max)
+          ui32_m_frame_pixels_max = ui32_pixels;
+      }
+
+      if (m_dump_prefix && sim_lcd_frame_changed()) {
+        char path[256];
+
+        snprintf(path, sizeof(path), "%s_%07u.ppm", m_dump_prefix, get_time_base_counter_1ms());
+        if (sim_lcd_write_ppm(path))
+          ui32_m_frames_dumped++;
+      }
+    } else {
+      ride_log_idle(); // what main_idle() does when the displays wake up with no events
+    }
+
+    if (ui32_m_hash_ms && get_time_base_counter_1ms() % ui32_m_hash_ms == 0)
+      printf("%u %08x\n", get_time_base_counter_1ms(), sim_lcd_frame_hash());
+  }
+
+  sim_exit(0);
+  return 0;
+}
@@ -0,0 +1,64 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+#include "rtc.h"
+#include "events.h"
+#include "sim.h"
+
+#define SECONDS_IN_DAY 86399
+
+uint32_t ui32_seconds_since_startup = 0;
+
+// wall clock, seconds of the day when the simulation started
+static uint32_t ui32_m_rtc_offset;
+
+void rtc_init(void)
+{
+  event_post(EVENT_RTC_MINUTE); // show the clock right away
+}
+
+/// Called by sim_time_advance_1ms() each second, like the RTC second interrupt
+void sim_rtc_second(void)
+{
+#ifndef SW102 // it has no wall clock
+  if ((ui32_m_rtc_offset + ui32_seconds_since_startup) % 60 == 0)
+    event_post(EVENT_RTC_MINUTE);
+#endif
+}
+
+void rtc_set_time(rtc_time_t *rtc_time)
+{
+  ui32_m_rtc_offset = ((((uint32_t) rtc_time->ui8_hours) * 3600) + (((uint32_t) rtc_time->ui8_minutes) * 60)) -
+      ui32_seconds_since_startup;
+  event_post(EVENT_RTC_MINUTE);
+}
+
+rtc_time_t* rtc_get_time(void)
+{
+  uint32_t ui32_temp;
+  static rtc_time_t rtc_time;
+
+  ui32_temp = (ui32_m_rtc_offset + ui32_seconds_since_startup) % SECONDS_IN_DAY;
+  rtc_time.ui8_hours = ui32_temp / 3600;
+  rtc_time.ui8_minutes = (ui32_temp % 3600) / 60;
+
+  return &rtc_time;
+}
+
+rtc_time_t* rtc_get_time_since_startup(void)
+{
+  uint32_t ui32_temp;
+  static rtc_time_t rtc_time;
+
+  ui32_temp = ui32_seconds_since_startup % SECONDS_IN_DAY;
+  rtc_time.ui8_hours = ui32_temp / 3600;
+  rtc_time.ui8_minutes = (ui32_temp % 3600) / 60;
+
+  return &rtc_time;
+}
@@ -0,0 +1,98 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "main.h"
+#include "timer.h"
+#include "rtc.h"
+#include "state.h"
+#include "buttons.h"
+#include "events.h"
+#include "sim.h"
+
+static uint32_t ui32_m_time_ms;
+static bool m_rt_processing_stop;
+static bool m_rt_processing_pending;
+static uint32_t ui32_m_ticks_missed;
+
+/// msecs since boot, this is virtual time advanced by the simulator main loop
+uint32_t get_time_base_counter_1ms(void) {
+  return ui32_m_time_ms;
+}
+
+/// Called by the simulator main loop, this is our SysTick (850C) / app_timer (SW102)
+void sim_time_advance_1ms(void) {
+  ui32_m_time_ms++;
+
+  if (ui32_m_time_ms % 1000 == 0) {
+    ui32_seconds_since_startup++;
+    sim_rtc_second();
+  }
+
+  // the SysTick (850C) / gui_timer (SW102) only wake the main loop for the buttons while they are in use
+  if (ui32_m_time_ms % BUTTONS_CLOCK_MS == 0 && buttons_busy())
+    event_post(EVENT_BUTTONS);
+
+  // every 100ms, like the TIM4 ISR (850C) or the gui_timer (SW102)
+  if (ui32_m_time_ms % 100 == 0) {
+    if (m_rt_processing_stop) {
+#ifdef SW102
+      ui32_m_ticks_missed++; // the app_timer handler simply skips this tick
+#else
+      m_rt_processing_pending = true; // TIM4 is stopped, the tick will be late
+#endif
+    }
+    else
+      rt_processing();
+  }
+}
+
+uint32_t sim_ticks_missed(void) {
+  return ui32_m_ticks_missed;
+}
+
+static void rt_processing_stop_sim(void) {
+  m_rt_processing_stop = true;
+}
+
+static void rt_processing_start_sim(void) {
+  m_rt_processing_stop = false;
+
+  if (m_rt_processing_pending) {
+    m_rt_processing_pending = false;
+    ui32_m_ticks_missed++;
+    rt_processing();
+  }
+}
+
+#ifdef SW102
+void SW102_rt_processing_stop(void) {
+  rt_processing_stop_sim();
+}
+
+void SW102_rt_processing_start(void) {
+  rt_processing_start_sim();
+}
+
+uint32_t get_seconds() {
+  return ui32_seconds_since_startup;
+}
+#else
+void Display850C_rt_processing_stop(void) {
+  rt_processing_stop_sim();
+}
+
+void Display850C_rt_processing_start(void) {
+  rt_processing_start_sim();
+}
+
+void delay_ms(uint32_t ms) {
+  // busy waits would never end in virtual time, so just let time pass
+  while (ms--)
+    sim_time_advance_1ms();
+}
+#endif
@@ -0,0 +1,275 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Fake UART plus a fake TSDZ2 motor controller on the other end of the wire. The motor sends its periodic
+ * package every 100ms and answers the configuration and firmware version requests. The bytes travel at the
+ * real baud rate and reach the parser like on the real display: one byte per interrupt on the SW102, in chunks
+ * out of a circular DMA buffer on the 850C.
+ */
+
+#include <string.h>
+#include <stdlib.h>
+#include <math.h>
+#include "uart.h"
+#include "uart_rx_queue.h"
+#include "utils.h"
+#include "state.h"
+#include "sim.h"
+
+#define SIM_UART_BAUD           9600
+#define SIM_MOTOR_BOOT_MS       500 // motor controller needs some time before it starts talking
+#define SIM_MOTOR_PERIOD_MS     100
+#define SIM_WIRE_SIZE           512
+
+uint8_t ui8_usart1_tx_buffer[UART_NUMBER_DATA_BYTES_TO_SEND];
+
+// bytes sent by the motor but not yet received by us
+static uint8_t ui8_m_wire[SIM_WIRE_SIZE];
+static uint32_t ui32_m_wire_head, ui32_m_wire_tail;
+static uint32_t ui32_m_wire_bits; // baud rate accumulator, x1000
+static bool m_wire_busy;
+
+static uint32_t ui32_m_time_ms;
+static uint32_t ui32_m_frames_sent;
+static uint32_t ui32_m_wheel_ticks;
+static uint32_t ui32_m_wheel_mm;
+static uint32_t ui32_m_noise_permille; // probability of a corrupted byte on the wire
+
+void sim_motor_set_noise(uint32_t ui32_permille)
+{
+  ui32_m_noise_permille = ui32_permille;
+}
+
+static void wire_put(const uint8_t *p_data, uint8_t ui8_len)
+{
+  for (uint8_t ui8_i = 0; ui8_i < ui8_len; ui8_i++) {
+    ui8_m_wire[ui32_m_wire_head % SIM_WIRE_SIZE] = p_data[ui8_i];
+
+    // rand() is never seeded so the runs are still repeatable
+    if (ui32_m_noise_permille && (uint32_t) (rand() % 1000) < ui32_m_noise_permille)
+      ui8_m_wire[ui32_m_wire_head % SIM_WIRE_SIZE] ^= 1 << (rand() % 8);
+
+    ui32_m_wire_head++;
+  }
+}
+
+#ifdef SW102
+
+/// Same as uart_evt_callback() on the SW102, the parser is fed one byte at a time from the interrupt
+static void uart_rx_byte(uint8_t ui8_byte_received)
+{
+  uart_rx_queue_parse(&ui8_byte_received, 1);
+}
+
+static void uart_rx_idle(void)
+{
+}
+
+static void uart_rx_poll(void)
+{
+}
+
+#else
+
+/// Same as the 850C usart1.c, the DMA writes to a circular buffer and the ISRs only track its position
+#define SIM_RX_DMA_BUFFER_SIZE 256
+
+static uint8_t ui8_m_rx_dma_buffer[SIM_RX_DMA_BUFFER_SIZE];
+static uint16_t ui16_m_rx_dma_pos; // the DMA channel counter
+static uart_rx_dma_ring_t m_rx_dma_ring = { ui8_m_rx_dma_buffer, SIM_RX_DMA_BUFFER_SIZE };
+
+static void uart_rx_byte(uint8_t ui8_byte_received)
+{
+  ui8_m_rx_dma_buffer[ui16_m_rx_dma_pos] = ui8_byte_received;
+  ui16_m_rx_dma_pos = (ui16_m_rx_dma_pos + 1) & (SIM_RX_DMA_BUFFER_SIZE - 1);
+
+  // half and full transfer interrupts
+  if (ui16_m_rx_dma_pos == SIM_RX_DMA_BUFFER_SIZE / 2 || ui16_m_rx_dma_pos == 0)
+    uart_rx_dma_ring_update(&m_rx_dma_ring, ui16_m_rx_dma_pos);
+}
+
+/// USART idle line interrupt
+static void uart_rx_idle(void)
+{
+  uart_rx_dma_ring_update(&m_rx_dma_ring, ui16_m_rx_dma_pos);
+}
+
+/// usart1_rx_dma_poll()
+static void uart_rx_poll(void)
+{
+  uart_rx_dma_ring_parse(&m_rx_dma_ring);
+}
+
+#endif
+
+static void motor_send(uint8_t *p_frame, uint8_t ui8_len)
+{
+  uint16_t ui16_crc = 0xffff;
+
+  p_frame[0] = 0x43;
+  p_frame[1] = ui8_len;
+  for (uint8_t ui8_i = 0; ui8_i < ui8_len; ui8_i++)
+    crc16(p_frame[ui8_i], &ui16_crc);
+  p_frame[ui8_len] = (uint8_t) (ui16_crc & 0xff);
+  p_frame[ui8_len + 1] = (uint8_t) (ui16_crc >> 8);
+
+  wire_put(p_frame, ui8_len + 2);
+  ui32_m_frames_sent++;
+}
+
+/// The periodic package, a slow ride that keeps every field of the main screen and the graphs busy
+static void motor_send_periodic(void)
+{
+  uint8_t ui8_frame[UART_NUMBER_DATA_BYTES_TO_RECEIVE];
+  double t = ui32_m_time_ms / 1000.0;
+
+  uint16_t ui16_battery_voltage_x10 = 520 - (uint16_t) (t / 60.0) % 100; // lose 1V per minute
+  uint16_t ui16_adc_battery_voltage = ((uint32_t) ui16_battery_voltage_x10) * 1000 / ADC_BATTERY_VOLTAGE_PER_ADC_STEP_X10000;
+  uint16_t ui16_wheel_speed_x10 = 200 + (int16_t) (80.0 * sin(t / 20.0));
+  uint8_t ui8_cadence = 70 + (int8_t) (15.0 * sin(t / 7.0));
+  uint8_t ui8_battery_current_x5 = 30 + (int8_t) (25.0 * sin(t / 5.0));
+  uint16_t ui16_pedal_power_x10 = 1500 + (int16_t) (700.0 * sin(t / 3.0));
+
+  // 2.6mm per 100ms for each 0.1km/h
+  ui32_m_wheel_mm += ui16_wheel_speed_x10 * 2.6;
+  while (ui32_m_wheel_mm > 2100) {
+    ui32_m_wheel_ticks++;
+    ui32_m_wheel_mm -= 2100;
+  }
+
+  memset(ui8_frame, 0, sizeof(ui8_frame));
+  ui8_frame[2] = 0;
+  ui8_frame[3] = (uint8_t) (ui16_adc_battery_voltage & 0xff);
+  ui8_frame[4] = (uint8_t) ((ui16_adc_battery_voltage >> 4) & 0x30);
+  ui8_frame[5] = ui8_battery_current_x5;
+  ui8_frame[6] = (uint8_t) (ui16_wheel_speed_x10 & 0xff);
+  ui8_frame[7] = (uint8_t) (ui16_wheel_speed_x10 >> 8);
+  ui8_frame[8] = 0; // brakes, hall sensors, PAS
+  ui8_frame[9] = 0; // throttle ADC
+  ui8_frame[10] = 40 + (uint8_t) (t / 30.0) % 40; // motor temperature or throttle
+  ui8_frame[11] = 100; // torque sensor ADC
+  ui8_frame[12] = 10;
+  ui8_frame[13] = 10;
+  ui8_frame[14] = ui8_cadence;
+  ui8_frame[15] = 120; // duty cycle
+  ui8_frame[16] = (uint8_t) ((ui16_wheel_speed_x10 * 2) & 0xff); // motor ERPS
+  ui8_frame[17] = (uint8_t) ((ui16_wheel_speed_x10 * 2) >> 8);
+  ui8_frame[18] = 5; // FOC angle
+  ui8_frame[19] = NO_ERROR;
+  ui8_frame[20] = ui8_battery_current_x5; // motor current
+  ui8_frame[21] = (uint8_t) ui32_m_wheel_ticks;
+  ui8_frame[22] = (uint8_t) (ui32_m_wheel_ticks >> 8);
+  ui8_frame[23] = (uint8_t) (ui32_m_wheel_ticks >> 16);
+  ui8_frame[24] = (uint8_t) (ui16_pedal_power_x10 & 0xff);
+  ui8_frame[25] = (uint8_t) (ui16_pedal_power_x10 >> 8);
+
+  motor_send(ui8_frame, 26);
+}
+
+/// The motor side of the link, called from uart_send_tx_buffer()
+static void motor_receive(const uint8_t *p_data, uint8_t ui8_len)
+{
+  uint8_t ui8_frame[UART_NUMBER_DATA_BYTES_TO_RECEIVE];
+  uint16_t ui16_crc = 0xffff;
+
+  if (ui8_len < 5 || p_data[0] != 0x59 || p_data[1] + 2 != ui8_len)
+    return;
+
+  for (uint8_t ui8_i = 0; ui8_i < p_data[1]; ui8_i++)
+    crc16(p_data[ui8_i], &ui16_crc);
+  if (p_data[p_data[1]] != (uint8_t) (ui16_crc & 0xff) ||
+      p_data[p_data[1] + 1] != (uint8_t) (ui16_crc >> 8))
+    return;
+
+  switch (p_data[2]) {
+    // configurations received
+    case 1:
+      ui8_frame[2] = 1;
+      motor_send(ui8_frame, 3);
+      break;
+
+    // firmware version
+    case 2:
+      ui8_frame[2] = 2;
+      ui8_frame[3] = atoi(TSDZ2_FIRMWARE_MAJOR);
+      ui8_frame[4] = atoi(TSDZ2_FIRMWARE_MINOR);
+      ui8_frame[5] = 0;
+      motor_send(ui8_frame, 6);
+      break;
+
+    default:
+      break;
+  }
+}
+
+/// Called every 1ms by the simulator main loop
+void sim_motor_clock_1ms(void)
+{
+  ui32_m_time_ms++;
+
+  // the motor runs its own clock, keep it out of phase with our 100ms tick
+  if (ui32_m_time_ms >= SIM_MOTOR_BOOT_MS &&
+      (ui32_m_time_ms % SIM_MOTOR_PERIOD_MS) == (SIM_MOTOR_PERIOD_MS / 2))
+    motor_send_periodic();
+
+  // 10 bits per byte on the wire
+  ui32_m_wire_bits += SIM_UART_BAUD;
+  while (ui32_m_wire_bits >= 10 * 1000) {
+    ui32_m_wire_bits -= 10 * 1000;
+
+    if (ui32_m_wire_tail == ui32_m_wire_head) {
+      // the line was busy and now it is idle
+      if (m_wire_busy) {
+        m_wire_busy = false;
+        uart_rx_idle();
+      }
+      continue;
+    }
+
+    m_wire_busy = true;
+    uart_rx_byte(ui8_m_wire[ui32_m_wire_tail % SIM_WIRE_SIZE]);
+    ui32_m_wire_tail++;
+  }
+}
+
+uint32_t sim_motor_frames_sent(void)
+{
+  return ui32_m_frames_sent;
+}
+
+uint32_t sim_motor_frames_dropped(void)
+{
+  return g_uart_rx_queue_stats.ui32_lost;
+}
+
+void uart_init(void)
+{
+}
+
+/**
+ * @brief Returns pointer to the next RX buffer ready for parsing or NULL, valid until the next call
+ */
+const uint8_t* uart_get_rx_buffer_rdy(void)
+{
+  uart_rx_poll();
+
+  return uart_rx_queue_pop();
+}
+
+/**
+ * @brief Returns pointer to TX buffer
+ */
+uint8_t* uart_get_tx_buffer(void)
+{
+  return ui8_usart1_tx_buffer;
+}
+
+/**
+ * @brief Send TX buffer over UART.
+ */
+void uart_send_tx_buffer(uint8_t *tx_buffer, uint8_t ui8_len)
+{
+  motor_receive(tx_buffer, ui8_len);
+}
@@ -0,0 +1,132 @@
+/*
+ * Host simulator for the 850C and SW102 common firmware
+ *
+ * Released under the GPL License, Version 3
+ *
+ * Prints the ride log as CSV, one line per sample. The input is any file of RIDE_LOG_BLOCK_BYTES blocks: the ride
+ * log pages of a flash image (sim -r, or read from the 850C) or the blocks as exported. Blocks that are not valid
+ * are skipped, the rest are sorted by sequence number and a new ride starts at each RIDE_LOG_FLAG_BOOT.
+ */
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "events.h"
+#include "ride_log.h"
+
+typedef struct {
+  uint32_t ui32_ride;
+} decode_t;
+
+// ride_log.c is shared with the firmware, the tool only uses the decoder
+uint32_t ui32_seconds_since_startup;
+
+void event_post(event_t event)
+{
+}
+
+uint32_t ride_log_store_init(void)
+{
+  return 0;
+}
+
+bool ride_log_store_write(const uint32_t *p_block)
+{
+  return true;
+}
+
+static const char *m_names[RIDE_LOG_CHANNELS_NUM] = {
+#define RIDE_LOG_CHANNEL_NAME(name, field, divisor) #name,
+  RIDE_LOG_CHANNEL_LIST(RIDE_LOG_CHANNEL_NAME)
+};
+
+static const uint16_t m_divisors[RIDE_LOG_CHANNELS_NUM] = {
+#define RIDE_LOG_CHANNEL_DIVISOR(name, field, divisor) divisor,
+  RIDE_LOG_CHANNEL_LIST(RIDE_LOG_CHANNEL_DIVISOR)
+};
+
+static int block_compare(const void *p_a, const void *p_b)
+{
+  uint32_t ui32_a = ((const ride_log_header_t *) p_a)->ui32_seq;
+  uint32_t ui32_b = ((const ride_log_header_t *) p_b)->ui32_seq;
+
+  return ui32_a < ui32_b ? -1 : ui32_a > ui32_b;
+}
+
+static void print_sample(void *p_context, const ride_log_header_t *p_header, uint16_t ui16_sample,
+    const uint32_t ui32_values[RIDE_LOG_CHANNELS_NUM])
+{
+  decode_t *p_decode = p_context;
+
+  printf("%u,%u,%.1f", p_decode->ui32_ride, p_header->ui32_seq,
+      p_header->ui32_time_s + ui16_sample * p_header->ui16_interval_ms / 1000.0);
+
+  for (int i = 0; i < RIDE_LOG_CHANNELS_NUM; i++) {
+    if (!((p_header->ui16_channels >> i) & 1))
+      printf(",");
+    else if (m_divisors[i] == 1)
+      printf(",%u", ui32_values[i]);
+    else
+      printf(",%g", ui32_values[i] / (double) m_divisors[i]);
+  }
+  printf("\n");
+}
+
+int main(int argc, char **argv)
+{
+  if (argc != 2) {
+    fprintf(stderr, "usage: %s <ride log image or blocks>\n", argv[0]);
+    return 1;
+  }
+
+  FILE *f = fopen(argv[1], "rb");
+  if (!f) {
+    perror(argv[1]);
+    return 1;
+  }
+
+  uint32_t (*p_blocks)[RIDE_LOG_BLOCK_WORDS] = NULL;
+  uint32_t ui32_blocks = 0, ui32_read = 0, ui32_size = 0;
+  uint32_t ui32_block[RIDE_LOG_BLOCK_WORDS];
+
+  while (fread(ui32_block, RIDE_LOG_BLOCK_BYTES, 1, f) == 1) {
+    ui32_read++;
+    if (!ride_log_block_valid(ui32_block))
+      continue; // erased or cut short
+
+    if (ui32_blocks == ui32_size) {
+      ui32_size = ui32_size ? ui32_size * 2 : 64;
+      p_blocks = realloc(p_blocks, ui32_size * RIDE_LOG_BLOCK_BYTES);
+      if (!p_blocks) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+      }
+    }
+    memcpy(p_blocks[ui32_blocks++], ui32_block, RIDE_LOG_BLOCK_BYTES);
+  }
+  fclose(f);
+
+  qsort(p_blocks, ui32_blocks, RIDE_LOG_BLOCK_BYTES, block_compare);
+
+  printf("ride,block,time_s");
+  for (int i = 0; i < RIDE_LOG_CHANNELS_NUM; i++)
+    printf(",%s", m_names[i]);
+  printf("\n");
+
+  decode_t decode = { 0 };
+  for (uint32_t i = 0; i < ui32_blocks; i++) {
+    const ride_log_header_t *p_header = (const ride_log_header_t *) p_blocks[i];
+
+    if (i > 0 && (p_header->ui8_flags & RIDE_LOG_FLAG_BOOT))
+      decode.ui32_ride++;
+
+    ride_log_decode(p_blocks[i], print_sample, &decode);
+  }
+
+  fprintf(stderr, "%u valid blocks of %u, %u rides\n", ui32_blocks, ui32_read, ui32_blocks ? decode.ui32_ride + 1 : 0);
+  free(p_blocks);
+
+  return 0;
+}